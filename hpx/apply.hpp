@@ -10,6 +10,7 @@
 #include <hpx/async.hpp>
 #include <hpx/runtime/applier/apply.hpp>
 #include <hpx/runtime/applier/apply_continue.hpp>
+#include <hpx/runtime/launch_policy.hpp>
 #include <hpx/runtime/threads/thread_executor.hpp>
 #include <hpx/runtime/threads/thread_helpers.hpp>
 #include <hpx/traits/is_executor.hpp>
@@ -25,6 +26,7 @@
 #endif
 #include <hpx/parallel/executors/execution.hpp>
 
+#include <cstddef>
 #include <type_traits>
 #include <utility>
 
@@ -55,6 +57,34 @@ namespace hpx { namespace detail
         }
     };
 
+    // launch a plain function/function object on a new thread, the launch
+    // policy selects the priority and whether the thread gets a stack
+    template <typename Policy>
+    struct apply_dispatch<Policy,
+        typename std::enable_if<
+            traits::is_launch_policy<Policy>::value
+        >::type>
+    {
+        template <typename F, typename ...Ts>
+        HPX_FORCEINLINE static
+        typename std::enable_if<
+            traits::detail::is_deferred_invocable<F, Ts...>::value,
+            bool
+        >::type
+        call(launch policy, F&& f, Ts&&... ts)
+        {
+            util::thread_description desc(f, "apply_dispatch::call");
+            threads::register_thread_nullary(
+                util::deferred_call(std::forward<F>(f), std::forward<Ts>(ts)...),
+                desc, threads::pending, true, policy.priority(),
+                std::size_t(-1),
+                policy == launch::nostack ?
+                    threads::thread_stacksize_nostack :
+                    threads::thread_stacksize_default);
+            return false;
+        }
+    };
+
     // threads::executor
     template <typename Executor>
     struct apply_dispatch<Executor,
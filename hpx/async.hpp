@@ -26,6 +26,7 @@
 
 #include <exception>
 #include <functional>
+#include <memory>
 #include <type_traits>
 #include <utility>
 
@@ -112,11 +113,27 @@ namespace hpx { namespace detail
                     typename std::is_void<result_type>::type());
             }
 
+            if (policy == launch::sync_if_cheap)
+            {
+                if (lcos::detail::can_inline_continuation())
+                {
+                    lcos::detail::handle_continuation_recursion_count cnt;
+                    return detail::call_sync(
+                        util::deferred_call(
+                            std::forward<F>(f), std::forward<Ts>(ts)...),
+                        typename std::is_void<result_type>::type());
+                }
+                policy = launch::async;
+            }
+
             lcos::local::futures_factory<result_type()> p(
                 util::deferred_call(std::forward<F>(f), std::forward<Ts>(ts)...));
             if (hpx::detail::has_async_policy(policy))
             {
-                threads::thread_id_type tid = p.apply(policy, policy.priority());
+                threads::thread_id_type tid = p.apply(policy, policy.priority(),
+                    policy == launch::nostack ?
+                        threads::thread_stacksize_nostack :
+                        threads::thread_stacksize_default);
                 if (policy == launch::fork)
                 {
                     // make sure this thread is executed last
@@ -164,6 +181,26 @@ namespace hpx { namespace detail
             return p.get_future();
         }
 
+        template <typename F, typename ...Ts>
+        HPX_FORCEINLINE static
+        typename std::enable_if<
+            traits::detail::is_deferred_invocable<F, Ts...>::value,
+            hpx::future<
+                typename util::detail::invoke_deferred_result<F, Ts...>::type
+            >
+        >::type
+        call(hpx::detail::nostack_policy policy, F && f, Ts&&... ts)
+        {
+            typedef typename util::detail::invoke_deferred_result<F, Ts...>::type
+                result_type;
+
+            lcos::local::futures_factory<result_type()> p(
+                util::deferred_call(std::forward<F>(f), std::forward<Ts>(ts)...));
+
+            p.apply(policy, policy.priority(), threads::thread_stacksize_nostack);
+            return p.get_future();
+        }
+
         template <typename F, typename ...Ts>
         HPX_FORCEINLINE static
         typename std::enable_if<
@@ -226,6 +263,32 @@ namespace hpx { namespace detail
         }
     };
 
+    // Launch the given function asynchronously, the memory for the shared
+    // state of the returned future is allocated using the given allocator.
+    template <>
+    struct async_dispatch<std::allocator_arg_t>
+    {
+        template <typename Allocator, typename F, typename ...Ts>
+        HPX_FORCEINLINE static
+        typename std::enable_if<
+            traits::detail::is_deferred_invocable<F, Ts...>::value,
+            hpx::future<
+                typename util::detail::invoke_deferred_result<F, Ts...>::type
+            >
+        >::type
+        call(std::allocator_arg_t, Allocator const& a, F&& f, Ts&&... ts)
+        {
+            typedef typename util::detail::invoke_deferred_result<F, Ts...>::type
+                result_type;
+
+            lcos::local::futures_factory<result_type()> p(std::allocator_arg, a,
+                util::deferred_call(std::forward<F>(f), std::forward<Ts>(ts)...));
+
+            p.apply(launch::async, threads::thread_priority_default);
+            return p.get_future();
+        }
+    };
+
     // threads::executor
     template <typename Executor>
     struct async_dispatch<Executor,
@@ -12,6 +12,7 @@
 #include <hpx/config.hpp>
 
 #include <hpx/compute/host/block_executor.hpp>
+#include <hpx/compute/host/placement_policies.hpp>
 #include <hpx/compute/host/target.hpp>
 #include <hpx/parallel/algorithms/for_each.hpp>
 #include <hpx/parallel/execution_policy.hpp>
@@ -36,8 +37,10 @@
 namespace hpx { namespace compute { namespace host
 {
     /// The block_allocator allocates blocks of memory evenly divided onto the
-    /// passed vector of targets. This is done by using first touch memory
-    /// placement. (maybe better methods will be used in the future...);
+    /// passed vector of targets. The memory is distributed onto the NUMA
+    /// domains of the targets using the given placement policy (see
+    /// placement_policies.hpp), by default by first touch from the executor
+    /// of the target which later processes the corresponding elements.
     ///
     /// This allocator can be used to write NUMA aware algorithms:
     ///
@@ -49,7 +52,8 @@ namespace hpx { namespace compute { namespace host
     /// vector_type v(N, allocator_type(numa_nodes));
     ///
     template <typename T, typename Executor =
-        hpx::parallel::execution::local_priority_queue_attached_executor>
+        hpx::parallel::execution::local_priority_queue_attached_executor,
+        typename Placement = first_touch_placement>
     struct block_allocator
     {
         typedef T value_type;
@@ -61,11 +65,12 @@ namespace hpx { namespace compute { namespace host
         typedef std::ptrdiff_t difference_type;
 
         typedef Executor executor_type;
+        typedef Placement placement_type;
 
         template <typename U>
         struct rebind
         {
-            typedef block_allocator<U> other;
+            typedef block_allocator<U, Executor, Placement> other;
         };
 
         typedef std::false_type is_always_equal;
@@ -94,12 +99,12 @@ namespace hpx { namespace compute { namespace host
         {}
 
         template <typename U>
-        block_allocator(block_allocator<U> const& alloc)
+        block_allocator(block_allocator<U, Executor, Placement> const& alloc)
           : executor_(alloc.executor_)
         {}
 
         template <typename U>
-        block_allocator(block_allocator<U> && alloc)
+        block_allocator(block_allocator<U, Executor, Placement> && alloc)
           : executor_(std::move(alloc.executor_))
         {}
 
@@ -127,14 +132,25 @@ namespace hpx { namespace compute { namespace host
         }
 
         // Allocates n * sizeof(T) bytes of uninitialized storage by calling
-        // topo.allocate(). The pointer hint may be used to provide locality of
-        // reference: the allocator, if supported by the implementation, will
-        // attempt to allocate the new memory block as close as possible to hint.
+        // topo.allocate() and distributes it onto the NUMA domains of the
+        // targets using the placement policy. The pointer hint may be used to
+        // provide locality of reference: the allocator, if supported by the
+        // implementation, will attempt to allocate the new memory block as
+        // close as possible to hint.
         pointer allocate(size_type n,
             std::allocator<void>::const_pointer hint = nullptr)
         {
-            return reinterpret_cast<pointer>(
+            pointer p = reinterpret_cast<pointer>(
                 hpx::threads::get_topology().allocate(n * sizeof(T)));
+
+            try {
+                placement_type()(executor_, p, n);
+            }
+            catch (...) {
+                hpx::threads::get_topology().deallocate(p, n * sizeof(T));
+                throw;
+            }
+            return p;
         }
 
         // Deallocates the storage referenced by the pointer p, which must be a
@@ -143,7 +159,7 @@ namespace hpx { namespace compute { namespace host
         // originally produced p; otherwise, the behavior is undefined.
         void deallocate(pointer p, size_type n)
         {
-            hpx::threads::get_topology().deallocate(p, n);
+            hpx::threads::get_topology().deallocate(p, n * sizeof(T));
         }
 
         // Returns the maximum theoretically possible value of n, for which the
@@ -257,13 +273,39 @@ namespace hpx { namespace compute { namespace host
             p->~U();
         }
 
+        // Moves the pages holding the n elements pointed to by p to the NUMA
+        // domains of the targets processing them. This is useful for memory
+        // which has been touched by a different placement before.
+        void migrate(pointer p, size_type n)
+        {
+            migrate_placement()(executor_, p, n);
+        }
+
+        // Returns the number of pages holding the n elements pointed to by p
+        // which are not located on the NUMA domain of the target processing
+        // them
+        size_type remote_pages(const_pointer p, size_type n) const
+        {
+            return count_remote_pages(executor_, p, n);
+        }
+
         // Access the underlying target (device)
         target_type const& target() const noexcept
         {
             return executor_.targets();
         }
 
+        // Access the executor whose chunk-to-domain mapping is used to place
+        // the memory
+        block_executor<executor_type> const& executor() const noexcept
+        {
+            return executor_;
+        }
+
     private:
+        template <typename U, typename Executor_, typename Placement_>
+        friend struct block_allocator;
+
         block_executor<executor_type> executor_;
     };
 }}}
@@ -15,6 +15,7 @@
 #include <hpx/parallel/executors/thread_pool_attached_executors.hpp>
 #include <hpx/traits/executor_traits.hpp>
 #include <hpx/traits/is_executor.hpp>
+#include <hpx/util/assert.hpp>
 #include <hpx/util/deferred_call.hpp>
 #include <hpx/util/iterator_range.hpp>
 #include <hpx/util/range.hpp>
@@ -126,6 +127,17 @@ namespace hpx { namespace compute { namespace host
                 std::forward<F>(f), std::forward<Ts>(ts)...);
         }
 
+        /// Run the given function on the executor of the given target
+        template <typename F, typename ... Ts>
+        hpx::future<
+            typename hpx::util::detail::invoke_deferred_result<F, Ts...>::type>
+        async_execute_at(std::size_t target, F && f, Ts &&... ts)
+        {
+            HPX_ASSERT(target < executors_.size());
+            return parallel::execution::async_execute(executors_[target],
+                std::forward<F>(f), std::forward<Ts>(ts)...);
+        }
+
         template <typename F, typename ... Ts>
         typename hpx::util::detail::invoke_deferred_result<F, Ts...>::type
         sync_execute(F && f, Ts &&... ts)
@@ -149,7 +161,6 @@ namespace hpx { namespace compute { namespace host
                     >::type
             > > results;
             std::size_t cnt = util::size(shape);
-            std::size_t part_size = cnt / executors_.size();
 
             results.reserve(cnt);
 
@@ -157,8 +168,11 @@ namespace hpx { namespace compute { namespace host
                 auto begin = util::begin(shape);
                 for (std::size_t i = 0; i != executors_.size(); ++i)
                 {
+                    std::pair<std::size_t, std::size_t> part =
+                        get_partition(cnt, i);
+
                     auto part_end = begin;
-                    std::advance(part_end, part_size);
+                    std::advance(part_end, part.second - part.first);
                     auto futures =
                         parallel::execution::bulk_async_execute(
                             executors_[i],
@@ -191,7 +205,6 @@ namespace hpx { namespace compute { namespace host
                     F, Shape, Ts...
                 >::type results;
             std::size_t cnt = util::size(shape);
-            std::size_t part_size = cnt / executors_.size();
 
             results.reserve(cnt);
 
@@ -199,8 +212,11 @@ namespace hpx { namespace compute { namespace host
                 auto begin = util::begin(shape);
                 for (std::size_t i = 0; i != executors_.size(); ++i)
                 {
+                    std::pair<std::size_t, std::size_t> part =
+                        get_partition(cnt, i);
+
                     auto part_end = begin;
-                    std::advance(part_end, part_size);
+                    std::advance(part_end, part.second - part.first);
                     auto part_results =
                         parallel::execution::bulk_sync_execute(
                             executors_[i],
@@ -228,6 +244,26 @@ namespace hpx { namespace compute { namespace host
             return targets_;
         }
 
+        /// Return the range [first, last) of the elements out of a sequence
+        /// of \a count elements which is processed by the given target. This
+        /// is the chunk-to-domain mapping the placement policies of the
+        /// block_allocator agree with.
+        std::pair<std::size_t, std::size_t>
+        get_partition(std::size_t count, std::size_t target) const noexcept
+        {
+            HPX_ASSERT(target < executors_.size());
+
+            std::size_t const num_targets = executors_.size();
+            std::size_t const part_size = count / num_targets;
+            std::size_t const remainder = count % num_targets;
+
+            // the first 'remainder' targets receive one additional element
+            std::size_t const first =
+                target * part_size + (std::min)(target, remainder);
+            return std::make_pair(first,
+                first + part_size + (target < remainder ? 1 : 0));
+        }
+
     private:
         void init_executors()
         {
@@ -0,0 +1,263 @@
+///////////////////////////////////////////////////////////////////////////////
+//  Copyright (c) 2026 agent
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+///////////////////////////////////////////////////////////////////////////////
+
+#ifndef HPX_COMPUTE_HOST_PLACEMENT_POLICIES_HPP
+#define HPX_COMPUTE_HOST_PLACEMENT_POLICIES_HPP
+
+#include <hpx/config.hpp>
+
+#include <hpx/compute/host/block_executor.hpp>
+#include <hpx/compute/host/target.hpp>
+#include <hpx/error_code.hpp>
+#include <hpx/lcos/future.hpp>
+#include <hpx/lcos/wait_all.hpp>
+#include <hpx/runtime/threads/cpu_mask.hpp>
+#include <hpx/runtime/threads/topology.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+#if defined(HPX_WINDOWS)
+#include <windows.h>
+#else
+#include <unistd.h>
+#endif
+
+// The placement policies decide how the memory allocated by a block_allocator
+// is distributed onto the NUMA domains of its targets. All of them (except
+// interleaved_placement) agree with the chunk-to-domain mapping used by the
+// block_executor (see block_executor::get_partition) such that the algorithms
+// run on a compute::vector access local memory only.
+namespace hpx { namespace compute { namespace host
+{
+    namespace detail
+    {
+        // memory is placed in units of pages, the page size is queried
+        // from the operating system once
+        inline std::size_t get_placement_page_size()
+        {
+#if defined(HPX_WINDOWS)
+            static std::size_t const page_size = []() -> std::size_t
+            {
+                SYSTEM_INFO info;
+                GetSystemInfo(&info);
+                return std::size_t(info.dwPageSize);
+            }();
+#else
+            static std::size_t const page_size =
+                std::size_t(sysconf(_SC_PAGESIZE));
+#endif
+            return page_size;
+        }
+
+        inline char* page_align_down(char* p)
+        {
+            return reinterpret_cast<char*>(
+                reinterpret_cast<std::uintptr_t>(p) &
+                    ~std::uintptr_t(get_placement_page_size() - 1));
+        }
+
+        inline char* page_align_up(char* p)
+        {
+            return page_align_down(p + get_placement_page_size() - 1);
+        }
+
+        // Return the page aligned memory area [first, last) holding the
+        // elements assigned to the given target. A page which is shared by
+        // two targets belongs to the target which owns its first byte.
+        template <typename T, typename Executor>
+        std::pair<char*, char*> get_target_area(
+            block_executor<Executor> const& exec, T* p, std::size_t count,
+            std::size_t target)
+        {
+            std::pair<std::size_t, std::size_t> part =
+                exec.get_partition(count, target);
+
+            char* base = reinterpret_cast<char*>(p);
+            char* first = (target == 0) ? page_align_down(base) :
+                page_align_up(base + part.first * sizeof(T));
+            char* last = page_align_up(base + part.second * sizeof(T));
+
+            return std::make_pair(first, (std::max)(first, last));
+        }
+
+        // bind the area of each target to the NUMA domain of the target
+        template <typename T, typename Executor>
+        void bind_target_areas(block_executor<Executor> const& exec, T* p,
+            std::size_t count, bool migrate)
+        {
+            auto const& topo = hpx::threads::get_topology();
+            auto const& targets = exec.targets();
+
+            for (std::size_t i = 0; i != targets.size(); ++i)
+            {
+                std::pair<char*, char*> area =
+                    get_target_area(exec, p, count, i);
+                if (area.first == area.second)
+                    continue;
+
+                // memory placement is a hint only, ignore failures on
+                // systems which do not support binding memory
+                error_code ec(lightweight);
+                topo.set_area_membind(area.first, area.second - area.first,
+                    targets[i].native_handle().get_device(),
+                    hpx::threads::membind_bind, migrate, ec);
+            }
+        }
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// Places the pages of each target's block of elements by touching them
+    /// from the executor of that target before the memory is used otherwise.
+    /// This relies on the first touch policy of the operating system.
+    struct first_touch_placement
+    {
+        template <typename T, typename Executor>
+        void operator()(block_executor<Executor>& exec, T* p,
+            std::size_t count) const
+        {
+            char* begin = reinterpret_cast<char*>(p);
+            char* end = begin + count * sizeof(T);
+
+            std::vector<hpx::future<void> > touched;
+            touched.reserve(exec.targets().size());
+
+            for (std::size_t i = 0; i != exec.targets().size(); ++i)
+            {
+                std::pair<char*, char*> area =
+                    detail::get_target_area(exec, p, count, i);
+
+                char* first = (std::max)(area.first, begin);
+                char* last = (std::min)(area.second, end);
+                if (first >= last)
+                    continue;
+
+                touched.push_back(exec.async_execute_at(i,
+                    [first, last]()
+                    {
+                        std::size_t const page_size =
+                            detail::get_placement_page_size();
+                        for (char* page = first; page < last;
+                             page += page_size)
+                        {
+                            *page = 0;
+                        }
+                    }));
+            }
+
+            hpx::wait_all(touched);
+            for (hpx::future<void>& f : touched)
+                f.get();        // rethrow exceptions
+        }
+    };
+
+    /// Binds the pages of each target's block of elements to the NUMA domain
+    /// of that target (using mbind on Linux). Pages which have been touched
+    /// already are not moved.
+    struct bind_placement
+    {
+        template <typename T, typename Executor>
+        void operator()(block_executor<Executor>& exec, T* p,
+            std::size_t count) const
+        {
+            detail::bind_target_areas(exec, p, count, false);
+        }
+    };
+
+    /// Binds the pages of each target's block of elements to the NUMA domain
+    /// of that target and moves the pages which reside elsewhere already
+    /// (using move_pages on Linux). This is meant to be used for memory which
+    /// has been touched before, e.g. if the targets of a container change.
+    struct migrate_placement
+    {
+        template <typename T, typename Executor>
+        void operator()(block_executor<Executor>& exec, T* p,
+            std::size_t count) const
+        {
+            detail::bind_target_areas(exec, p, count, true);
+        }
+    };
+
+    /// Interleaves the pages of the memory area across the NUMA domains of
+    /// all targets page by page. This does not follow the chunk-to-domain
+    /// mapping of the block_executor but spreads the memory bandwidth evenly
+    /// if the access pattern is not known in advance.
+    struct interleaved_placement
+    {
+        template <typename T, typename Executor>
+        void operator()(block_executor<Executor>& exec, T* p,
+            std::size_t count) const
+        {
+            auto const& targets = exec.targets();
+            if (targets.empty() || count == 0)
+                return;
+
+            hpx::threads::mask_type mask = targets[0].native_handle().get_device();
+            for (std::size_t i = 1; i != targets.size(); ++i)
+                mask |= targets[i].native_handle().get_device();
+
+            char* first = detail::page_align_down(reinterpret_cast<char*>(p));
+            char* last = detail::page_align_up(
+                reinterpret_cast<char*>(p + count));
+
+            error_code ec(lightweight);
+            hpx::threads::get_topology().set_area_membind(first, last - first,
+                mask, hpx::threads::membind_interleave, false, ec);
+        }
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// Return the number of pages holding elements of the given sequence
+    /// which are located on a NUMA domain different from the one of the
+    /// target which processes those elements. All accesses to these pages
+    /// are remote accesses. Pages which have not been touched yet or whose
+    /// location can't be determined are not counted.
+    template <typename T, typename Executor>
+    std::size_t count_remote_pages(block_executor<Executor> const& exec,
+        T const* p, std::size_t count)
+    {
+        auto const& topo = hpx::threads::get_topology();
+        auto const& targets = exec.targets();
+
+        char* begin = reinterpret_cast<char*>(const_cast<T*>(p));
+        char* end = begin + count * sizeof(T);
+
+        std::size_t const page_size = detail::get_placement_page_size();
+
+        std::size_t remote_pages = 0;
+        for (std::size_t i = 0; i != targets.size(); ++i)
+        {
+            std::pair<char*, char*> area =
+                detail::get_target_area(exec, const_cast<T*>(p), count, i);
+
+            hpx::threads::mask_cref_type target_mask =
+                targets[i].native_handle().get_device();
+
+            char* first = (std::max)(area.first, begin);
+            char* last = (std::min)(area.second, end);
+            for (char* page = first; page < last; page += page_size)
+            {
+                error_code ec(lightweight);
+                hpx::threads::mask_type location =
+                    topo.get_area_memlocation(page, ec);
+
+                if (!ec && hpx::threads::any(location) &&
+                    !hpx::threads::bit_and(location, target_mask,
+                        topo.get_number_of_pus()))
+                {
+                    ++remote_pages;
+                }
+            }
+        }
+        return remote_pages;
+    }
+}}}
+
+#endif
@@ -100,6 +100,18 @@
 #  define HPX_PARCEL_MAX_CONNECTIONS 512
 #endif
 
+/// This defines the number of parcels which may be sent over a single tcp
+/// connection before their acknowledgments have been received. This value
+/// can be changed at runtime by setting the configuration parameter:
+///
+///   hpx.parcel.tcp.pipeline_window = ...
+///
+/// (or by setting the corresponding environment variable
+/// HPX_PARCEL_TCP_PIPELINE_WINDOW).
+#if !defined(HPX_PARCEL_TCP_PIPELINE_WINDOW)
+#  define HPX_PARCEL_TCP_PIPELINE_WINDOW 16
+#endif
+
 /// This defines the number of outgoing ipc (parcel-) connections kept alive
 /// (to each of the other localities on the same node). This value can be changed
 /// at runtime by setting the configuration parameter:
@@ -161,6 +173,56 @@
 #  define HPX_PARCEL_MAX_OUTBOUND_MESSAGE_SIZE 1000000
 #endif
 
+/// This defines the maximal number of bytes retained by the pool of recycled
+/// message buffers of each parcelport. This value can be changed at runtime
+/// by setting the configuration parameter:
+///
+///   hpx.parcel.buffer_pool_size = ...
+///
+/// (or by setting the corresponding environment variable
+/// HPX_PARCEL_BUFFER_POOL_SIZE).
+#if !defined(HPX_PARCEL_BUFFER_POOL_SIZE)
+#  define HPX_PARCEL_BUFFER_POOL_SIZE 67108864
+#endif
+
+/// This defines the minimal number of bytes each of the segments should hold
+/// a large batch of parcels is split into when encoding it concurrently on
+/// several worker threads. Batches smaller than twice this size are always
+/// encoded on the sending thread. This value can be changed at runtime by
+/// setting the configuration parameter:
+///
+///   hpx.parcel.parallel_encoding_segment_size = ...
+///
+/// (or by setting the corresponding environment variable
+/// HPX_PARCEL_PARALLEL_ENCODING_SEGMENT_SIZE). A value of zero disables
+/// concurrent encoding.
+#if !defined(HPX_PARCEL_PARALLEL_ENCODING_SEGMENT_SIZE)
+#  define HPX_PARCEL_PARALLEL_ENCODING_SEGMENT_SIZE 262144
+#endif
+
+/// These define the sizes of the ring buffer and of the heap of each of the
+/// channels used by the shared memory parcelport, and the minimal size of
+/// zero-copy chunks which are placed into the heap instead of being copied
+/// through the ring buffer. These values can be changed at runtime by setting
+/// the configuration parameters:
+///
+///   hpx.parcel.shmem.ring_size = ...
+///   hpx.parcel.shmem.heap_size = ...
+///   hpx.parcel.shmem.zero_copy_threshold = ...
+///
+/// (or by setting the corresponding environment variables
+/// HPX_PARCEL_SHMEM_RING_SIZE, HPX_PARCEL_SHMEM_HEAP_SIZE, and
+/// HPX_PARCEL_SHMEM_ZERO_COPY_THRESHOLD).
+#if !defined(HPX_PARCEL_SHMEM_RING_SIZE)
+#  define HPX_PARCEL_SHMEM_RING_SIZE 1048576
+#endif
+#if !defined(HPX_PARCEL_SHMEM_HEAP_SIZE)
+#  define HPX_PARCEL_SHMEM_HEAP_SIZE 67108864
+#endif
+#if !defined(HPX_PARCEL_SHMEM_ZERO_COPY_THRESHOLD)
+#  define HPX_PARCEL_SHMEM_ZERO_COPY_THRESHOLD 8192
+#endif
+
 ///////////////////////////////////////////////////////////////////////////////
 // This defines the number of bytes of overhead it takes to serialize a
 // parcel.
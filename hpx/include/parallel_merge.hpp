@@ -0,0 +1,12 @@
+//  Copyright (c) 2026 agent
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#if !defined(HPX_INCLUDE_PARALLEL_MERGE_HPP)
+#define HPX_INCLUDE_PARALLEL_MERGE_HPP
+
+#include <hpx/parallel/algorithms/merge.hpp>
+#include <hpx/parallel/container_algorithms/merge.hpp>
+
+#endif
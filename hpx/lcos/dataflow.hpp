@@ -255,6 +255,24 @@ namespace hpx { namespace lcos { namespace detail
               , threads::thread_stacksize_current);
         }
 
+        void finalize(hpx::detail::nostack_policy policy)
+        {
+            // all arguments are ready, the function is likely to run to
+            // completion without suspending, run it on the stack of the
+            // scheduler
+            util::thread_description desc(func_, "dataflow_frame::finalize");
+            boost::intrusive_ptr<dataflow_frame> this_(this);
+
+            threads::register_thread_nullary(
+                util::deferred_call(&dataflow_frame::done, std::move(this_))
+              , desc
+              , threads::pending
+              , true
+              , policy.priority()
+              , std::size_t(-1)
+              , threads::thread_stacksize_nostack);
+        }
+
         HPX_FORCEINLINE
         void finalize(hpx::detail::sync_policy)
         {
@@ -283,16 +301,36 @@ namespace hpx { namespace lcos { namespace detail
             }
         }
 
+        void finalize(hpx::detail::sync_if_cheap_policy policy)
+        {
+            if (can_inline_continuation())
+            {
+                done();
+            }
+            else
+            {
+                finalize(hpx::detail::async_policy(policy.priority()));
+            }
+        }
+
         void finalize(launch policy)
         {
             if (policy == launch::sync)
             {
                 finalize(launch::sync);
             }
+            else if (policy == launch::sync_if_cheap)
+            {
+                finalize(hpx::detail::sync_if_cheap_policy(policy.priority()));
+            }
             else if (policy == launch::fork)
             {
                 finalize(launch::fork);
             }
+            else if (policy == launch::nostack)
+            {
+                finalize(hpx::detail::nostack_policy(policy.priority()));
+            }
             else
             {
                 finalize(launch::async);
@@ -182,6 +182,10 @@ namespace hpx { namespace detail
         typedef typename action_type::local_result_type result_type;
         typedef typename action_type::component_type component_type;
 
+        // actions are never run inline on the calling thread
+        if (policy == launch::sync_if_cheap)
+            policy = launch::async;
+
         std::pair<bool, components::pinned_ptr> r;
 
         naming::address addr;
@@ -340,6 +344,10 @@ namespace hpx { namespace detail
         typedef typename action_type::local_result_type result_type;
         typedef typename action_type::component_type component_type;
 
+        // actions are never run inline on the calling thread
+        if (policy == launch::sync_if_cheap)
+            policy = launch::async;
+
         std::pair<bool, components::pinned_ptr> r;
 
         naming::address addr;
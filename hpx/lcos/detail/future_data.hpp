@@ -8,6 +8,7 @@
 
 #include <hpx/config.hpp>
 #include <hpx/error_code.hpp>
+#include <hpx/lcos/detail/shared_state_pool.hpp>
 #include <hpx/lcos/local/detail/condition_variable.hpp>
 #include <hpx/lcos/local/spinlock.hpp>
 #include <hpx/runtime/get_worker_thread_num.hpp>
@@ -28,14 +29,17 @@
 #include <hpx/util/unique_function.hpp>
 #include <hpx/util/unused.hpp>
 
+#include <boost/atomic.hpp>
 #include <boost/intrusive_ptr.hpp>
 
 #include <chrono>
 #include <cstddef>
+#include <cstdint>
 #include <exception>
 #include <functional>
 #include <memory>
 #include <mutex>
+#include <new>
 #include <type_traits>
 #include <utility>
 
@@ -89,6 +93,45 @@ namespace detail
         // _not_ going to addref the future_data instance
         struct init_no_addref {};
 
+#if defined(HPX_HAVE_SHARED_STATE_POOL)
+        // Shared states created using new are allocated from the shared
+        // state pool. Shared states created using an allocator bypass these
+        // operators.
+        static void* operator new(std::size_t size)
+        {
+            return allocate_shared_state(size);
+        }
+
+        static void operator delete(void* p, std::size_t size)
+        {
+            deallocate_shared_state(p, size);
+        }
+
+#if defined(__cpp_aligned_new)
+        // over-aligned shared states are not pooled
+        static void* operator new(std::size_t size, std::align_val_t align)
+        {
+            return ::operator new(size, align);
+        }
+
+        static void operator delete(void* p, std::size_t size,
+            std::align_val_t align)
+        {
+            ::operator delete(p, size, align);
+        }
+#endif
+
+        // The placement operator new has to be overloaded as well
+        static void* operator new(std::size_t, void* p)
+        {
+            return p;
+        }
+
+        // This operator delete is called only if the placement new fails
+        static void operator delete(void*, void*)
+        {}
+#endif
+
     protected:
         future_data_refcnt_base() : count_(0) {}
         future_data_refcnt_base(init_no_addref) : count_(1) {}
@@ -194,75 +237,78 @@ namespace detail
     };
 
     ///////////////////////////////////////////////////////////////////////////
-    template <typename F1, typename F2>
-    struct compose_cb_impl
+    // All continuations but the first one attached to a future are kept in an
+    // intrusive (lock-free) list of these nodes.
+    struct future_data_continuation
     {
-        template <typename A1, typename A2>
-        compose_cb_impl(A1 && f1, A2 && f2)
-          : f1_(std::forward<A1>(f1))
-          , f2_(std::forward<A2>(f2))
-        {}
+        typedef util::unique_function_nonser<void()> completed_callback_type;
 
-        compose_cb_impl(compose_cb_impl&& other)
-          : f1_(std::move(other.f1_))
-          , f2_(std::move(other.f2_))
+        explicit future_data_continuation(completed_callback_type && f)
+          : f_(std::move(f)), next_(nullptr)
         {}
 
-        void operator()()
+        // marks the list of a future which became ready, continuations can't
+        // be added to the list anymore (this is never dereferenced)
+        static future_data_continuation* closed()
         {
-            bool recurse_asynchronously = hpx::threads::get_self_ptr() == nullptr;
-#if defined(HPX_HAVE_THREADS_GET_STACK_POINTER)
-            recurse_asynchronously =
-                !this_thread::has_sufficient_stack_space();
-#else
-            handle_continuation_recursion_count cnt;
-            recurse_asynchronously = recurse_asynchronously ||
-                cnt.count_ > HPX_CONTINUATION_MAX_RECURSION_DEPTH;
-#endif
-            if (recurse_asynchronously)
+            return reinterpret_cast<future_data_continuation*>(
+                std::uintptr_t(1));
+        }
+
+        // delete all nodes of the given list
+        static void destroy(future_data_continuation* head)
+        {
+            while (head != nullptr && head != closed())
             {
-                error_code ec;
-                threads::thread_id_type id = threads::register_thread_nullary(
-                    compose_cb_impl(std::move(f1_), std::move(f2_)),
-                    "compose_cb",
-                    threads::pending, true, threads::thread_priority_boost,
-                    std::size_t(-1), threads::thread_stacksize_current, ec);
-                return;
+                future_data_continuation* next = head->next_;
+                delete head;
+                head = next;
             }
-
-            f1_();
-            f2_();
         }
 
-    private:
-        F1 f1_;
-        F2 f2_;
+        completed_callback_type f_;
+        future_data_continuation* next_;
     };
 
-    template <typename F1, typename F2>
-    static HPX_FORCEINLINE util::unique_function_nonser<void()>
-    compose_cb(F1 && f1, F2 && f2)
-    {
-        if (!f1)
-            return std::forward<F2>(f2);
-        else if (!f2)
-            return std::forward<F1>(f1);
-
-        // otherwise create a combined callback
-        typedef compose_cb_impl<
-            typename util::decay<F1>::type, typename util::decay<F2>::type
-        > result_type;
-        return result_type(std::forward<F1>(f1), std::forward<F2>(f2));
-    }
-
     ///////////////////////////////////////////////////////////////////////////
     HPX_EXPORT bool run_on_completed_on_new_thread(
         util::unique_function_nonser<bool()> && f, error_code& ec);
 
+    // maximal number of nested continuations run directly on the same thread
+    // (hpx.continuations.max_inline_depth)
+    HPX_EXPORT std::size_t get_max_continuation_inline_depth();
+
+    // Returns whether a continuation may be run directly on the calling
+    // thread, i.e. whether the calling thread is an HPX thread which has
+    // neither exceeded the maximal continuation recursion depth nor its
+    // stack space.
+    HPX_EXPORT bool can_inline_continuation();
+
+    // The launch policy used for continuations which were not given an
+    // explicit launch policy (hpx.continuations.policy), returns launch::all
+    // if the built-in defaults should be used.
+    HPX_EXPORT launch get_default_continuation_policy();
+
     ///////////////////////////////////////////////////////////////////////////
     template <typename Result>
     struct future_data;
 
+    // The shared state is synchronized through the atomic state_ word, which
+    // holds the current state (empty, value, or exception) along with a few
+    // flags:
+    //
+    //  - setting: set_value/set_exception is storing the result, it is
+    //    cleared when the result is published (i.e. the state becomes ready)
+    //  - waiting: at least one thread has been suspended in wait/wait_until,
+    //    only in this case the setter acquires mtx_ to notify cond_
+    //  - callback_busy/callback: the (first) continuation is being stored in
+    //    or is available from the on_completed_ slot
+    //
+    // Further continuations are pushed onto an intrusive lock-free list
+    // which is closed when the state becomes ready. All of them are invoked
+    // in the order they were attached, the one in the slot first. Neither attaching a
+    // single continuation nor setting the value (with no thread waiting)
+    // requires acquiring a lock or allocating memory.
     template <>
     struct future_data<traits::detail::future_data_void> : future_data_refcnt_base
     {
@@ -300,32 +346,46 @@ namespace detail
         /// \a future.
         bool is_ready() const
         {
-            std::unique_lock<mutex_type> l(mtx_);
-            return is_ready_locked(l);
+            return (state_.load(boost::memory_order_acquire) & ready) != 0;
         }
 
         template <typename Lock>
         bool is_ready_locked(Lock& l) const
         {
             HPX_ASSERT_OWNS_LOCK(l);
-            return (state_ & ready) != 0;
+            return is_ready();
         }
 
         bool has_value() const
         {
-            std::unique_lock<mutex_type> l(mtx_);
-            return state_ == value;
+            return get_state() == value;
         }
 
         bool has_exception() const
         {
-            std::unique_lock<mutex_type> l(mtx_);
-            return state_ == exception;
+            return get_state() == exception;
         }
 
     protected:
-         mutable mutex_type mtx_;
-         state state_;                               // current state
+        // flags stored in state_ in addition to the state itself
+        enum state_flags
+        {
+            state_mask = 7,
+            setting = 8,
+            waiting = 16,
+            callback_busy = 32,
+            callback = 64
+        };
+
+        state get_state() const
+        {
+            return static_cast<state>(
+                state_.load(boost::memory_order_acquire) & state_mask);
+        }
+
+        // protects cond_ and the data members of derived shared states
+        mutable mutex_type mtx_;
+        boost::atomic<int> state_;                  // current state and flags
     };
 
     template <typename Result>
@@ -341,38 +401,43 @@ namespace detail
             >::init_no_addref init_no_addref;
 
         future_data()
+          : continuations_(nullptr)
         {}
 
         future_data(init_no_addref no_addref)
           : future_data<traits::detail::future_data_void>(no_addref)
+          , continuations_(nullptr)
         {}
 
         template <typename Target>
         future_data(Target && data, init_no_addref no_addref)
           : future_data<traits::detail::future_data_void>(no_addref)
+          , continuations_(nullptr)
         {
             result_type* value_ptr =
                 reinterpret_cast<result_type*>(&storage_);
             ::new ((void*)value_ptr) result_type(
                 future_data_result<Result>::set(std::forward<Target>(data)));
-            state_ = value;
+            state_.store(value, boost::memory_order_relaxed);
         }
 
         future_data(std::exception_ptr const& e, init_no_addref no_addref)
           : future_data<traits::detail::future_data_void>(no_addref)
+          , continuations_(nullptr)
         {
             std::exception_ptr* exception_ptr =
                 reinterpret_cast<std::exception_ptr*>(&storage_);
             ::new ((void*)exception_ptr) std::exception_ptr(e);
-            state_ = exception;
+            state_.store(exception, boost::memory_order_relaxed);
         }
         future_data(std::exception_ptr && e, init_no_addref no_addref)
           : future_data<traits::detail::future_data_void>(no_addref)
+          , continuations_(nullptr)
         {
             std::exception_ptr* exception_ptr =
                 reinterpret_cast<std::exception_ptr*>(&storage_);
             ::new ((void*)exception_ptr) std::exception_ptr(std::move(e));
-            state_ = exception;
+            state_.store(exception, boost::memory_order_relaxed);
         }
 
         virtual ~future_data() noexcept
@@ -423,7 +488,8 @@ namespace detail
             // - there are multiple readers only (shared_future, lock hurts
             //   concurrency)
 
-            if (state_ == empty) {
+            state s = this->get_state();
+            if (s == empty) {
                 // the value has already been moved out of this future
                 HPX_THROWS_IF(ec, no_state,
                     "future_data::get_result",
@@ -434,7 +500,7 @@ namespace detail
             // the thread has been re-activated by one of the actions
             // supported by this promise (see promise::set_event
             // and promise::set_exception).
-            if (state_ == exception)
+            if (s == exception)
             {
                 std::exception_ptr* exception_ptr =
                     reinterpret_cast<std::exception_ptr*>(&storage_);
@@ -465,7 +531,8 @@ namespace detail
             // - there are multiple readers only (shared_future, lock hurts
             //   concurrency)
 
-            if (state_ == empty) {
+            state s = this->get_state();
+            if (s == empty) {
                 // the value has already been moved out of this future
                 HPX_THROWS_IF(ec, no_state,
                     "future_data::get_result",
@@ -476,7 +543,7 @@ namespace detail
             // the thread has been re-activated by one of the actions
             // supported by this promise (see promise::set_event
             // and promise::set_exception).
-            if (state_ == exception)
+            if (s == exception)
             {
                 std::exception_ptr* exception_ptr =
                     reinterpret_cast<std::exception_ptr*>(&storage_);
@@ -518,13 +585,16 @@ namespace detail
             // We need to run the completion on a new thread if we are on a
             // non HPX thread.
             bool recurse_asynchronously = hpx::threads::get_self_ptr() == nullptr;
+
+            // the recursion count is maintained in any case as it is used
+            // by continuations launched with launch::sync_if_cheap
+            handle_continuation_recursion_count cnt;
 #if defined(HPX_HAVE_THREADS_GET_STACK_POINTER)
             recurse_asynchronously =
                 !this_thread::has_sufficient_stack_space();
 #else
-            handle_continuation_recursion_count cnt;
             recurse_asynchronously = recurse_asynchronously ||
-                cnt.count_ > HPX_CONTINUATION_MAX_RECURSION_DEPTH;
+                cnt.count_ > get_max_continuation_inline_depth();
 #endif
             if (!recurse_asynchronously)
             {
@@ -566,91 +636,47 @@ namespace detail
         template <typename Target>
         void set_value(Target && data, error_code& ec = throws)
         {
-            std::unique_lock<mutex_type> l(this->mtx_);
-
             // check whether the data has already been set
-            if (is_ready_locked(l)) {
-                l.unlock();
+            if (!start_setting()) {
                 HPX_THROWS_IF(ec, promise_already_satisfied,
                     "future_data::set_value",
                     "data has already been set for this future");
                 return;
             }
 
-            completed_callback_type on_completed = std::move(this->on_completed_);
-
             // set the data
-            result_type* value_ptr =
-                reinterpret_cast<result_type*>(&storage_);
-            ::new ((void*)value_ptr) result_type(
-                future_data_result<Result>::set(std::forward<Target>(data)));
-            state_ = value;
-
-            // handle all threads waiting for the future to become ready
-
-            // Note: we use notify_one repeatedly instead of notify_all as we
-            //       know: a) that most of the time we have at most one thread
-            //       waiting on the future (most futures are not shared), and
-            //       b) our implementation of condition_variable::notify_one
-            //       relinquishes the lock before resuming the waiting thread
-            //       which avoids suspension of this thread when it tries to
-            //       re-lock the mutex while exiting from condition_variable::wait
-            while (cond_.notify_one(std::move(l), threads::thread_priority_boost, ec))
-            {
-                l = std::unique_lock<mutex_type>(this->mtx_);
+            try {
+                result_type* value_ptr =
+                    reinterpret_cast<result_type*>(&storage_);
+                ::new ((void*)value_ptr) result_type(
+                    future_data_result<Result>::set(std::forward<Target>(data)));
+            }
+            catch (...) {
+                state_.fetch_and(~setting, boost::memory_order_relaxed);
+                throw;
             }
 
-            // Note: cv.notify_one() above 'consumes' the lock 'l' and leaves
-            //       it unlocked when returning.
-
-            // invoke the callback (continuation) function
-            if (on_completed)
-                handle_on_completed(std::move(on_completed));
+            finish_setting(value, ec);
         }
 
         template <typename Target>
         void set_exception(Target && data, error_code& ec = throws)
         {
-            std::unique_lock<mutex_type> l(this->mtx_);
-
             // check whether the data has already been set
-            if (is_ready_locked(l)) {
-                l.unlock();
+            if (!start_setting()) {
                 HPX_THROWS_IF(ec, promise_already_satisfied,
                     "future_data::set_exception",
                     "data has already been set for this future");
                 return;
             }
 
-            completed_callback_type on_completed = std::move(this->on_completed_);
-
             // set the data
             std::exception_ptr* exception_ptr =
                 reinterpret_cast<std::exception_ptr*>(&storage_);
             ::new ((void*)exception_ptr) std::exception_ptr(
                 std::forward<Target>(data));
-            state_ = exception;
-
-            // handle all threads waiting for the future to become ready
-
-            // Note: we use notify_one repeatedly instead of notify_all as we
-            //       know: a) that most of the time we have at most one thread
-            //       waiting on the future (most futures are not shared), and
-            //       b) our implementation of condition_variable::notify_one
-            //       relinquishes the lock before resuming the waiting thread
-            //       which avoids suspension of this thread when it tries to
-            //       re-lock the mutex while exiting from condition_variable::wait
-            while (cond_.notify_one(std::move(l), threads::thread_priority_boost, ec))
-            {
-                l = std::unique_lock<mutex_type>(this->mtx_);
-            }
-
-            // Note: cv.notify_one() above 'consumes' the lock 'l' and leaves
-            //       it unlocked when returning.
 
-            // invoke the callback (continuation) function
-            if (on_completed)
-                handle_on_completed(std::move(on_completed));
+            finish_setting(exception, ec);
         }
 
         // helper functions for setting data (if successful) or the error (if
@@ -696,7 +722,7 @@ namespace detail
             // and no reader
 
             // release any stored data and callback functions
-            switch (state_) {
+            switch (this->get_state()) {
             case value:
             {
                 result_type* value_ptr =
@@ -714,8 +740,10 @@ namespace detail
             default: break;
             }
 
-            state_ = empty;
+            state_.store(empty, boost::memory_order_relaxed);
             on_completed_ = completed_callback_type();
+            future_data_continuation::destroy(
+                continuations_.exchange(nullptr, boost::memory_order_relaxed));
         }
 
         // continuation support
@@ -727,34 +755,74 @@ namespace detail
         {
             if (!data_sink) return;
 
-            std::unique_lock<mutex_type> l(this->mtx_);
-
-            if (is_ready_locked(l)) {
-
-                HPX_ASSERT(!on_completed_);
+            // try to store the continuation in the slot first
+            int s = state_.load(boost::memory_order_acquire);
+            while (!(s & (ready | callback_busy | callback)))
+            {
+                if (state_.compare_exchange_weak(s, s | callback_busy,
+                        boost::memory_order_acquire))
+                {
+                    on_completed_ = std::move(data_sink);
+
+                    // publish the continuation unless the future became
+                    // ready in the meantime, in which case we're responsible
+                    // for invoking it
+                    s = state_.load(boost::memory_order_relaxed);
+                    int desired;
+                    do {
+                        desired = s & ~callback_busy;
+                        if (!(s & ready))
+                            desired |= callback;
+                    } while (!state_.compare_exchange_weak(s, desired,
+                        boost::memory_order_acq_rel,
+                        boost::memory_order_relaxed));
+
+                    // finish_setting has left the continuations to us, the
+                    // one in the slot was attached first
+                    if (s & ready)
+                        handle_all_continuations(true);
+                    return;
+                }
+            }
 
+            if (s & ready)
+            {
                 // invoke the callback (continuation) function right away
-                l.unlock();
-
                 handle_on_completed(std::move(data_sink));
+                return;
             }
-            else {
-                // store a combined callback wrapping the old and the new one
-                // make sure continuations are evaluated in the order they are
-                // attached
-                this->on_completed_ = compose_cb(
-                    std::move(on_completed_), std::move(data_sink));
-            }
+
+            // the slot is taken, append the continuation to the list
+            std::unique_ptr<future_data_continuation> node(
+                new future_data_continuation(std::move(data_sink)));
+
+            future_data_continuation* head =
+                continuations_.load(boost::memory_order_acquire);
+            do {
+                if (head == future_data_continuation::closed())
+                {
+                    // the future became ready in the meantime
+                    handle_on_completed(std::move(node->f_));
+                    return;
+                }
+                node->next_ = head;
+            } while (!continuations_.compare_exchange_weak(head, node.get(),
+                boost::memory_order_acq_rel, boost::memory_order_acquire));
+
+            node.release();
         }
 
         virtual void wait(error_code& ec = throws)
         {
-            std::unique_lock<mutex_type> l(mtx_);
-
             // block if this entry is empty
-            if (state_ == empty) {
-                cond_.wait(l, "future_data::wait", ec);
-                if (ec) return;
+            if (!this->is_ready()) {
+                std::unique_lock<mutex_type> l(mtx_);
+                if (!(state_.fetch_or(waiting, boost::memory_order_acq_rel) &
+                        ready))
+                {
+                    cond_.wait(l, "future_data::wait", ec);
+                    if (ec) return;
+                }
             }
 
             if (&ec != &throws)
@@ -765,19 +833,22 @@ namespace detail
         wait_until(util::steady_clock::time_point const& abs_time,
             error_code& ec = throws)
         {
-            std::unique_lock<mutex_type> l(mtx_);
-
             // block if this entry is empty
-            if (state_ == empty) {
-                threads::thread_state_ex_enum const reason =
-                    cond_.wait_until(l, abs_time,
-                        "future_data::wait_until", ec);
-                if (ec) return future_status::uninitialized;
+            if (!this->is_ready()) {
+                std::unique_lock<mutex_type> l(mtx_);
+                if (!(state_.fetch_or(waiting, boost::memory_order_acq_rel) &
+                        ready))
+                {
+                    threads::thread_state_ex_enum const reason =
+                        cond_.wait_until(l, abs_time,
+                            "future_data::wait_until", ec);
+                    if (ec) return future_status::uninitialized;
 
-                if (reason == threads::wait_timeout)
-                    return future_status::timeout;
+                    if (reason == threads::wait_timeout)
+                        return future_status::timeout;
 
-                return future_status::ready;
+                    return future_status::ready;
+                }
             }
 
             if (&ec != &throws)
@@ -788,14 +859,115 @@ namespace detail
 
         std::exception_ptr get_exception_ptr() const
         {
-            HPX_ASSERT(state_ == exception);
+            HPX_ASSERT(this->get_state() == exception);
             return *reinterpret_cast<std::exception_ptr const*>(&storage_);
         }
 
+    private:
+        // claim the right to store the result
+        bool start_setting()
+        {
+            int s = state_.load(boost::memory_order_relaxed);
+            do {
+                if (s & (ready | setting))
+                    return false;
+            } while (!state_.compare_exchange_weak(s, s | setting,
+                boost::memory_order_acquire, boost::memory_order_relaxed));
+            return true;
+        }
+
+        // publish the stored result, wake up waiting threads, and invoke
+        // the continuations
+        void finish_setting(state new_state, error_code& ec)
+        {
+            int s = state_.load(boost::memory_order_relaxed);
+            while (!state_.compare_exchange_weak(s,
+                (s & callback_busy) | new_state,
+                boost::memory_order_acq_rel, boost::memory_order_relaxed))
+            {
+            }
+
+            // handle all threads waiting for the future to become ready
+            if (s & waiting)
+            {
+                // Note: we use notify_one repeatedly instead of notify_all as
+                //       we know: a) that most of the time we have at most one
+                //       thread waiting on the future (most futures are not
+                //       shared), and b) our implementation of
+                //       condition_variable::notify_one relinquishes the lock
+                //       before resuming the waiting thread which avoids
+                //       suspension of this thread when it tries to re-lock
+                //       the mutex while exiting from condition_variable::wait
+                std::unique_lock<mutex_type> l(this->mtx_);
+                while (cond_.notify_one(
+                    std::move(l), threads::thread_priority_boost, ec))
+                {
+                    l = std::unique_lock<mutex_type>(this->mtx_);
+                }
+
+                // Note: cv.notify_one() above 'consumes' the lock 'l' and
+                //       leaves it unlocked when returning.
+            }
+
+            // a continuation which is still being stored in the slot was
+            // attached before all continuations in the list, set_on_completed
+            // will invoke all of them in order once it has stored it
+            if (s & callback_busy)
+                return;
+
+            handle_all_continuations((s & callback) != 0);
+        }
+
+        // invoke the callback (continuation) functions in the order they
+        // were attached: the one stored in the slot (if any) first, followed
+        // by the ones appended to the list
+        void handle_all_continuations(bool has_callback)
+        {
+            if (has_callback)
+            {
+                completed_callback_type on_completed = std::move(on_completed_);
+                handle_on_completed(std::move(on_completed));
+            }
+
+            future_data_continuation* head = continuations_.exchange(
+                future_data_continuation::closed(),
+                boost::memory_order_acq_rel);
+            if (head != nullptr)
+                handle_continuations(head);
+        }
+
+        void handle_continuations(future_data_continuation* head)
+        {
+            // the list holds the continuations in reverse order
+            future_data_continuation* prev = nullptr;
+            while (head != nullptr)
+            {
+                future_data_continuation* next = head->next_;
+                head->next_ = prev;
+                prev = head;
+                head = next;
+            }
+
+            while (prev != nullptr)
+            {
+                std::unique_ptr<future_data_continuation> node(prev);
+                prev = prev->next_;
+
+                try {
+                    handle_on_completed(std::move(node->f_));
+                }
+                catch (...) {
+                    future_data_continuation::destroy(prev);
+                    throw;
+                }
+            }
+        }
+
     protected:
         completed_callback_type on_completed_;
 
     private:
+        boost::atomic<future_data_continuation*> continuations_;
         local::detail::condition_variable cond_;    // threads waiting in read
         typename future_data_storage<Result>::type storage_;
     };
@@ -0,0 +1,39 @@
+//  Copyright (c) 2026 agent
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#if !defined(HPX_LCOS_DETAIL_SHARED_STATE_POOL_HPP)
+#define HPX_LCOS_DETAIL_SHARED_STATE_POOL_HPP
+
+#include <hpx/config.hpp>
+
+#include <cstddef>
+
+///////////////////////////////////////////////////////////////////////////////
+// Memory pool used for the shared states of futures.
+//
+// The sizes of the shared states are rounded up to a multiple of the cache
+// line size, every size class up to max_pooled_shared_state_size bytes is
+// served from slabs carved into equally sized chunks. Each OS thread caches
+// free chunks of all size classes, allocating and freeing a shared state from
+// this cache needs no lock. Chunks may be freed on any thread. Larger shared
+// states are allocated using the global operator new.
+//
+// The cached chunks of the OS threads managed by the runtime are handed back
+// to the global free lists when those threads are stopped. Other threads
+// keep their cached chunks (at most 256 per size class) until process exit.
+namespace hpx { namespace lcos { namespace detail
+{
+    enum { max_pooled_shared_state_size = 512 };
+
+    HPX_EXPORT void* allocate_shared_state(std::size_t size);
+    HPX_EXPORT void deallocate_shared_state(void* p, std::size_t size);
+
+    // Move the chunks cached by the calling OS thread to the global free
+    // lists, this is called whenever an OS thread is unregistered from the
+    // runtime.
+    HPX_EXPORT void release_shared_state_cache();
+}}}
+
+#endif
@@ -107,8 +107,13 @@ namespace hpx { namespace lcos { namespace detail
         >::type
         call(F && f, Ts &&... ts)
         {
-            return dataflow_dispatch<hpx::detail::async_policy>::call(
-                launch::async, std::forward<F>(f), std::forward<Ts>(ts)...);
+            // use the globally configured continuation policy, if any
+            launch policy = get_default_continuation_policy();
+            if (policy == launch::all)
+                policy = launch::async;
+
+            return dataflow_dispatch<launch>::call(
+                policy, std::forward<F>(f), std::forward<Ts>(ts)...);
         }
     };
 
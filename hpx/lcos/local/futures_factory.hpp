@@ -15,6 +15,7 @@
 #include <hpx/runtime/threads/thread_helpers.hpp>
 #include <hpx/throw_exception.hpp>
 #include <hpx/traits/future_access.hpp>
+#include <hpx/util/decay.hpp>
 #include <hpx/util/deferred_call.hpp>
 #include <hpx/util/thread_description.hpp>
 
@@ -22,6 +23,7 @@
 
 #include <cstddef>
 #include <exception>
+#include <memory>
 #include <type_traits>
 #include <utility>
 
@@ -184,6 +186,72 @@ namespace hpx { namespace lcos { namespace local
         };
     }
 
+    namespace detail
+    {
+        ///////////////////////////////////////////////////////////////////////
+        // task object whose memory is managed by the given allocator
+        template <typename Allocator, typename Result, typename F,
+            typename Base = lcos::detail::task_base<Result> >
+        struct task_object_allocator : task_object<Result, F, Base>
+        {
+            typedef task_object<Result, F, Base> base_type;
+            typedef typename base_type::init_no_addref init_no_addref;
+            typedef typename
+                    std::allocator_traits<Allocator>::template
+                        rebind_alloc<task_object_allocator>
+                other_allocator;
+
+            task_object_allocator(F const& f, init_no_addref no_addref,
+                    other_allocator const& alloc)
+              : base_type(f, no_addref), alloc_(alloc)
+            {}
+
+            task_object_allocator(F && f, init_no_addref no_addref,
+                    other_allocator const& alloc)
+              : base_type(std::move(f), no_addref), alloc_(alloc)
+            {}
+
+        private:
+            void destroy()
+            {
+                typedef std::allocator_traits<other_allocator> traits;
+
+                other_allocator alloc(alloc_);
+                traits::destroy(alloc, this);
+                traits::deallocate(alloc, this, 1);
+            }
+
+        private:
+            other_allocator alloc_;
+        };
+
+        template <typename Result, typename Base, typename Allocator,
+            typename F>
+        boost::intrusive_ptr<lcos::detail::task_base<Result> >
+        allocate_task_object(Allocator const& a, F && f)
+        {
+            typedef task_object_allocator<
+                    Allocator, Result, typename util::decay<F>::type, Base
+                > shared_state_type;
+            typedef typename shared_state_type::other_allocator other_allocator;
+            typedef std::allocator_traits<other_allocator> traits;
+            typedef typename shared_state_type::init_no_addref init_no_addref;
+
+            other_allocator alloc(a);
+            shared_state_type* p = traits::allocate(alloc, 1);
+            try {
+                traits::construct(alloc, p, std::forward<F>(f),
+                    init_no_addref(), alloc);
+            }
+            catch (...) {
+                traits::deallocate(alloc, p, 1);
+                throw;
+            }
+            return boost::intrusive_ptr<lcos::detail::task_base<Result> >(
+                p, false);
+        }
+    }
+
     ///////////////////////////////////////////////////////////////////////////
     // The futures_factory is very similar to a packaged_task except that it
     // allows for the owner to go out of scope before the future becomes ready.
@@ -239,6 +307,15 @@ namespace hpx { namespace lcos { namespace local
                     new task_object<Result, Result (*)()>(f, init_no_addref()),
                     false);
             }
+
+            template <typename Allocator, typename F>
+            static return_type call(std::allocator_arg_t, Allocator const& a,
+                F && f)
+            {
+                return allocate_task_object<
+                        Result, lcos::detail::task_base<Result>
+                    >(a, std::forward<F>(f));
+            }
         };
 
         template <typename Result>
@@ -286,6 +363,15 @@ namespace hpx { namespace lcos { namespace local
                         f, init_no_addref()),
                     false);
             }
+
+            template <typename Allocator, typename F>
+            static return_type call(std::allocator_arg_t, Allocator const& a,
+                F && f)
+            {
+                return allocate_task_object<
+                        Result, lcos::detail::cancelable_task_base<Result>
+                    >(a, std::forward<F>(f));
+            }
         };
     }
 
@@ -325,6 +411,14 @@ namespace hpx { namespace lcos { namespace local
             future_obtained_(false)
         {}
 
+        // the allocator a is used to allocate the memory for the shared state
+        template <typename Allocator, typename F>
+        futures_factory(std::allocator_arg_t, Allocator const& a, F && f)
+          : task_(detail::create_task_object<Result, Cancelable>::call(
+                std::allocator_arg, a, std::forward<F>(f))),
+            future_obtained_(false)
+        {}
+
         ~futures_factory()
         {}
 
@@ -28,6 +28,7 @@
 
 #include <boost/intrusive_ptr.hpp>
 
+#include <cstddef>
 #include <exception>
 #include <functional>
 #include <mutex>
@@ -262,6 +263,19 @@ namespace hpx { namespace lcos { namespace detail
             run(std::move(f), priority, throws);
         }
 
+        // run the continuation directly if this is cheap, otherwise schedule
+        // it on a new thread
+        void run_if_cheap(
+            typename traits::detail::shared_state_ptr_for<
+                Future
+            >::type && f, threads::thread_priority priority)
+        {
+            if (can_inline_continuation())
+                run(std::move(f), priority, throws);
+            else
+                async(std::move(f), priority, throws);
+        }
+
         threads::thread_result_type
         async_impl_v1(
             typename traits::detail::shared_state_ptr_for<
@@ -299,6 +313,18 @@ namespace hpx { namespace lcos { namespace detail
             >::type && f,
             threads::thread_priority priority,
             error_code& ec)
+        {
+            async(std::move(f), priority, threads::thread_stacksize_default,
+                ec);
+        }
+
+        void async(
+            typename traits::detail::shared_state_ptr_for<
+                Future
+            >::type && f,
+            threads::thread_priority priority,
+            threads::thread_stacksize stacksize,
+            error_code& ec)
         {
             {
                 std::lock_guard<mutex_type> l(this->mtx_);
@@ -320,7 +346,8 @@ namespace hpx { namespace lcos { namespace detail
             applier::register_thread_plain(
                 util::bind(util::one_shot(async_impl_ptr),
                     std::move(this_), std::move(f)),
-                desc, threads::pending, true, priority);
+                desc, threads::pending, true, priority, std::size_t(-1),
+                stacksize);
 
             if (&ec != &throws)
                 ec = make_success_code();
@@ -429,6 +456,19 @@ namespace hpx { namespace lcos { namespace detail
             async(std::move(f), priority, throws);
         }
 
+        // The future is ready once the continuation is invoked, so it
+        // usually runs to completion without suspending. Run it on the stack
+        // of the scheduler instead of giving it a stack of its own.
+        void async_nostack(
+            typename traits::detail::shared_state_ptr_for<
+                Future
+            >::type && f,
+            threads::thread_priority priority)
+        {
+            async(std::move(f), priority, threads::thread_stacksize_nostack,
+                throws);
+        }
+
         void async(
             typename traits::detail::shared_state_ptr_for<
                 Future
@@ -513,8 +553,15 @@ namespace hpx { namespace lcos { namespace detail
             boost::intrusive_ptr<continuation> this_(this);
             void (continuation::*cb)(shared_state_ptr &&, threads::thread_priority);
 
-            if (policy & launch::sync)
+            if (policy == launch::all)
+                policy = get_default_continuation_policy();
+
+            if (policy == launch::sync_if_cheap)
+                cb = &continuation::run_if_cheap;
+            else if (policy & launch::sync)
                 cb = &continuation::run;
+            else if (policy == launch::nostack)
+                cb = &continuation::async_nostack;
             else
                 cb = &continuation::async;
 
@@ -418,10 +418,12 @@ namespace hpx { namespace parallel { inline namespace v1
 
                 using hpx::util::get;
                 using hpx::util::make_zip_iterator;
-                typedef util::scan_partitioner<
+                typedef util::single_pass_scan_partitioner<
                         ExPolicy, std::pair<FwdIter1, FwdIter2>, std::size_t
                     > scan_partitioner_type;
 
+                // count the elements to copy, the evaluated predicate is
+                // stored in 'flags' to be reused when copying the elements
                 auto f1 =
                     [pred, proj, flags, policy]
                     (
@@ -447,47 +449,48 @@ namespace hpx { namespace parallel { inline namespace v1
 
                         return curr;
                     };
-                auto f3 =
-                    [dest, flags, policy](
+                // copy the elements given the number of elements copied by
+                // all partitions to the left
+                auto f2 =
+                    [pred, proj, dest, flags](
                         zip_iterator part_begin, std::size_t part_size,
-                        hpx::shared_future<std::size_t> curr,
-                        hpx::shared_future<std::size_t> next
-                    ) mutable
+                        std::size_t prefix, bool reduced
+                    ) mutable -> std::size_t
                     {
                         HPX_UNUSED(flags);
-                        HPX_UNUSED(policy);
 
-                        next.get();     // rethrow exceptions
+                        FwdIter2 out = dest;
+                        std::advance(out, prefix);
 
-                        std::advance(dest, curr.get());
-                        util::loop_n<ExPolicy>(
-                            part_begin, part_size,
-                            [&dest](zip_iterator it) mutable
+                        for (/**/; part_size != 0; (void) --part_size, ++part_begin)
+                        {
+                            using hpx::util::invoke;
+                            if (reduced ? get<1>(*part_begin) :
+                                    invoke(pred, invoke(proj, get<0>(*part_begin))))
                             {
-                                if(get<1>(*it))
-                                    *dest++ = get<0>(*it);
-                            });
+                                *out++ = get<0>(*part_begin);
+                                ++prefix;
+                            }
+                        }
+                        return prefix;
                     };
 
                 return scan_partitioner_type::call(
                     std::forward<ExPolicy>(policy),
                     make_zip_iterator(first, flags.get()), count, init,
-                    // step 1 performs first part of scan algorithm
+                    // reduce a partition
                     std::move(f1),
-                    // step 2 propagates the partition results from left
-                    // to right
-                    hpx::util::unwrapping(std::plus<std::size_t>()),
-                    // step 3 runs final accumulation on each partition
-                    std::move(f3),
-                    // step 4 use this return value
-                    [last, dest, flags](
-                        std::vector<hpx::shared_future<std::size_t> > && items,
-                        std::vector<hpx::future<void> > &&) mutable
+                    // combine the results of two partitions
+                    std::plus<std::size_t>(),
+                    // copy the elements of a partition
+                    std::move(f2),
+                    // use this return value
+                    [last, dest, flags](std::size_t total) mutable
                     ->  std::pair<FwdIter1, FwdIter2>
                     {
                         HPX_UNUSED(flags);
 
-                        std::advance(dest, items.back().get());
+                        std::advance(dest, total);
                         return std::make_pair(last, dest);
                     });
             }
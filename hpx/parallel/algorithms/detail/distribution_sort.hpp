@@ -0,0 +1,596 @@
+//  Copyright (c) 2026 agent
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#if !defined(HPX_PARALLEL_ALGORITHMS_DETAIL_DISTRIBUTION_SORT_HPP)
+#define HPX_PARALLEL_ALGORITHMS_DETAIL_DISTRIBUTION_SORT_HPP
+
+#include <hpx/config.hpp>
+#include <hpx/lcos/future.hpp>
+#include <hpx/lcos/wait_all.hpp>
+#include <hpx/traits/is_iterator.hpp>
+#include <hpx/util/assert.hpp>
+#include <hpx/util/decay.hpp>
+
+#include <hpx/parallel/algorithms/detail/predicates.hpp>
+#include <hpx/parallel/exception_list.hpp>
+#include <hpx/parallel/execution_policy.hpp>
+#include <hpx/parallel/executors/execution.hpp>
+#include <hpx/parallel/executors/execution_information.hpp>
+#include <hpx/parallel/util/detail/handle_local_exceptions.hpp>
+#include <hpx/parallel/util/projection_identity.hpp>
+
+#include <boost/shared_array.hpp>
+
+#include <algorithm>
+#include <climits>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <exception>
+#include <functional>
+#include <iterator>
+#include <limits>
+#include <list>
+#include <random>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace hpx { namespace parallel { inline namespace v1 { namespace detail
+{
+    /// \cond NOINTERNAL
+
+    // Ranges with less elements are sorted using std::sort instead of the
+    // radix sort.
+    static const std::size_t radix_sort_limit = 4096ul;
+
+    // Ranges with at least this many elements are sorted using the sample
+    // sort (if no radix sort can be used).
+    static const std::size_t sample_sort_limit = 524288ul;
+
+    // Minimal number of elements handled by a single task while
+    // classifying or scattering elements.
+    static const std::size_t distribution_sort_chunk_size = 65536ul;
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Execute f(chunk) for all chunks concurrently, all exceptions are
+    // collected into an exception_list.
+    template <typename ExPolicy, typename F>
+    void distribution_sort_for_each_chunk(ExPolicy& policy,
+        std::size_t num_chunks, F const& f)
+    {
+        if (num_chunks == 1)
+        {
+            f(std::size_t(0));
+            return;
+        }
+
+        std::vector<hpx::future<void> > workitems;
+        workitems.reserve(num_chunks);
+
+        for (std::size_t chunk = 0; chunk != num_chunks; ++chunk)
+        {
+            workitems.push_back(
+                execution::async_execute(policy.executor(), f, chunk));
+        }
+
+        std::list<std::exception_ptr> errors;
+        hpx::wait_all(workitems);
+        util::detail::handle_local_exceptions<ExPolicy>::call(
+            workitems, errors);
+    }
+
+    // Turn the per-chunk element counts of all buckets (stored chunk-major)
+    // into the positions the elements of each chunk have to be moved to.
+    // The elements of one bucket are placed in order of their chunks, which
+    // keeps the distribution step stable.
+    inline void distribution_sort_offsets(std::size_t const* counts,
+        std::size_t* offsets, std::size_t num_chunks, std::size_t num_buckets,
+        std::size_t stride)
+    {
+        std::size_t running = 0;
+        for (std::size_t bucket = 0; bucket != num_buckets; ++bucket)
+        {
+            for (std::size_t chunk = 0; chunk != num_chunks; ++chunk)
+            {
+                offsets[chunk * num_buckets + bucket] = running;
+                running += counts[chunk * stride + bucket];
+            }
+        }
+    }
+
+    template <typename ExPolicy>
+    std::size_t distribution_sort_cores(ExPolicy& policy)
+    {
+        if (execution::is_sequenced_execution_policy<ExPolicy>::value)
+            return 1;
+
+        return execution::processing_units_count(
+            policy.executor(), policy.parameters());
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    // radix sort
+    static const std::size_t radix_sort_bits = 8;
+    static const std::size_t radix_sort_buckets = 1ul << radix_sort_bits;
+
+    // Map arithmetic keys onto unsigned integers of the same width which
+    // compare the same way as the original values.
+    template <typename T, typename Enable = void>
+    struct radix_sort_key;
+
+    template <typename T>
+    struct radix_sort_key<T,
+        typename std::enable_if<
+            std::is_integral<T>::value && std::is_unsigned<T>::value
+        >::type>
+    {
+        typedef T type;
+
+        static type get(T key)
+        {
+            return key;
+        }
+    };
+
+    template <typename T>
+    struct radix_sort_key<T,
+        typename std::enable_if<
+            std::is_integral<T>::value && std::is_signed<T>::value
+        >::type>
+    {
+        typedef typename std::make_unsigned<T>::type type;
+
+        static type get(T key)
+        {
+            // flip the sign bit, negative values precede positive ones
+            return type(type(key) ^ (type(1) << (sizeof(type) * CHAR_BIT - 1)));
+        }
+    };
+
+    template <typename T, typename Bits>
+    struct radix_sort_floating_point_key
+    {
+        typedef Bits type;
+
+        static type get(T key)
+        {
+            static_assert(sizeof(T) == sizeof(Bits),
+                "sizeof(T) == sizeof(Bits)");
+
+            type bits;
+            std::memcpy(&bits, &key, sizeof(type));
+
+            // invert all bits of negative values, otherwise flip the sign bit
+            type const sign = type(1) << (sizeof(type) * CHAR_BIT - 1);
+            return (bits & sign) ? type(~bits) : type(bits | sign);
+        }
+    };
+
+    template <>
+    struct radix_sort_key<float>
+      : radix_sort_floating_point_key<float, std::uint32_t>
+    {};
+
+    template <>
+    struct radix_sort_key<double>
+      : radix_sort_floating_point_key<double, std::uint64_t>
+    {};
+
+    template <typename T>
+    struct is_radix_sort_key
+      : std::integral_constant<bool,
+            (std::is_integral<T>::value && !std::is_same<T, bool>::value) ||
+            (std::is_same<T, float>::value &&
+                std::numeric_limits<float>::is_iec559 &&
+                sizeof(float) == sizeof(std::uint32_t)) ||
+            (std::is_same<T, double>::value &&
+                std::numeric_limits<double>::is_iec559 &&
+                sizeof(double) == sizeof(std::uint64_t))>
+    {};
+
+    template <typename Compare, typename T>
+    struct is_radix_sort_compare
+      : std::false_type
+    {};
+
+    template <typename T>
+    struct is_radix_sort_compare<detail::less, T>
+      : std::true_type
+    {};
+
+    template <typename T>
+    struct is_radix_sort_compare<std::less<T>, T>
+      : std::true_type
+    {};
+
+    template <typename T>
+    struct is_radix_sort_compare<std::less<void>, T>
+      : std::true_type
+    {};
+
+    // The radix sort is used for arithmetic keys which are compared using
+    // operator<() without any projection.
+    template <typename Iter, typename Compare,
+        typename Proj = util::projection_identity>
+    struct use_radix_sort
+      : std::integral_constant<bool,
+            hpx::traits::is_random_access_iterator<Iter>::value &&
+            std::is_same<
+                typename hpx::util::decay<Proj>::type,
+                util::projection_identity
+            >::value &&
+            is_radix_sort_key<
+                typename std::iterator_traits<Iter>::value_type
+            >::value &&
+            is_radix_sort_compare<
+                typename hpx::util::decay<Compare>::type,
+                typename std::iterator_traits<Iter>::value_type
+            >::value>
+    {};
+
+    ///////////////////////////////////////////////////////////////////////////
+    // The values which are moved together with the keys being sorted
+    struct radix_sort_no_values
+    {
+        void to_buffer(std::size_t, std::size_t) {}
+        void from_buffer(std::size_t, std::size_t) {}
+        void move_back(std::size_t, std::size_t) {}
+    };
+
+    template <typename ValueIter>
+    struct radix_sort_values
+    {
+        typedef typename std::iterator_traits<ValueIter>::value_type
+            value_type;
+
+        radix_sort_values(ValueIter first, std::size_t size)
+          : first_(first), buffer_(new value_type[size])
+        {}
+
+        void to_buffer(std::size_t from, std::size_t to)
+        {
+            buffer_[to] = std::move(first_[from]);
+        }
+        void from_buffer(std::size_t from, std::size_t to)
+        {
+            first_[to] = std::move(buffer_[from]);
+        }
+        void move_back(std::size_t begin, std::size_t end)
+        {
+            std::move(buffer_.get() + begin, buffer_.get() + end,
+                first_ + begin);
+        }
+
+        ValueIter first_;
+        boost::shared_array<value_type> buffer_;
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename Key, typename Iter>
+    void radix_sort_count(Iter src, std::size_t begin, std::size_t end,
+        std::size_t shift, std::size_t* count)
+    {
+        typedef radix_sort_key<Key> key_traits;
+
+        for (std::size_t i = begin; i != end; ++i)
+        {
+            ++count[(key_traits::get(src[i]) >> shift) &
+                (radix_sort_buckets - 1)];
+        }
+    }
+
+    template <typename Key, typename SrcIter, typename DestIter,
+        typename Values>
+    void radix_sort_scatter(SrcIter src, DestIter dest, std::size_t begin,
+        std::size_t end, std::size_t shift, std::size_t* offsets,
+        Values& values, bool to_buffer)
+    {
+        typedef radix_sort_key<Key> key_traits;
+
+        for (std::size_t i = begin; i != end; ++i)
+        {
+            Key key = src[i];
+            std::size_t pos = offsets[(key_traits::get(key) >> shift) &
+                (radix_sort_buckets - 1)]++;
+
+            dest[pos] = key;
+            if (to_buffer)
+                values.to_buffer(i, pos);
+            else
+                values.from_buffer(i, pos);
+        }
+    }
+
+    //------------------------------------------------------------------------
+    //  function : radix_sort
+    /// \brief Least significant digit radix sort of the keys in the range
+    ///        [first, last), moving the associated values along. Every pass
+    ///        counts the digits of all chunks concurrently and scatters the
+    ///        elements of all chunks concurrently into an auxiliary buffer.
+    ///        Passes for which all keys share the same digit are skipped.
+    //------------------------------------------------------------------------
+    template <typename ExPolicy, typename KeyIter, typename Values>
+    void radix_sort(ExPolicy& policy, KeyIter first, KeyIter last,
+        Values& values)
+    {
+        typedef typename std::iterator_traits<KeyIter>::value_type key_type;
+        typedef radix_sort_key<key_type> key_traits;
+        typedef typename key_traits::type unsigned_key;
+
+        std::size_t const passes =
+            sizeof(unsigned_key) * CHAR_BIT / radix_sort_bits;
+        std::size_t const stride = passes * radix_sort_buckets;
+
+        std::size_t const size = std::size_t(last - first);
+        if (size < 2)
+            return;
+
+        std::size_t const cores = distribution_sort_cores(policy);
+        std::size_t const chunk_size =
+            (std::max)(distribution_sort_chunk_size,
+                (size + cores - 1) / cores);
+        std::size_t const num_chunks = (size + chunk_size - 1) / chunk_size;
+
+        // the histograms of all digits are computed in one sweep
+        std::vector<std::size_t> counts(num_chunks * stride, 0);
+        distribution_sort_for_each_chunk(policy, num_chunks,
+            [&](std::size_t chunk)
+            {
+                std::size_t* count = &counts[chunk * stride];
+                std::size_t const end =
+                    (std::min)(size, (chunk + 1) * chunk_size);
+
+                for (std::size_t i = chunk * chunk_size; i != end; ++i)
+                {
+                    unsigned_key key = key_traits::get(first[i]);
+                    for (std::size_t p = 0; p != passes; ++p)
+                    {
+                        ++count[p * radix_sort_buckets +
+                            (key & (radix_sort_buckets - 1))];
+                        key = unsigned_key(key >> radix_sort_bits);
+                    }
+                }
+            });
+
+        boost::shared_array<key_type> buffer;
+        std::vector<std::size_t> offsets(num_chunks * radix_sort_buckets);
+
+        bool in_buffer = false;
+        bool moved = false;
+        for (std::size_t p = 0; p != passes; ++p)
+        {
+            std::size_t const shift = p * radix_sort_bits;
+
+            // skip this pass if all keys share the same digit, the overall
+            // number of elements per digit does not depend on their order
+            bool trivial = false;
+            for (std::size_t digit = 0; digit != radix_sort_buckets; ++digit)
+            {
+                std::size_t total = 0;
+                for (std::size_t chunk = 0; chunk != num_chunks; ++chunk)
+                {
+                    total += counts[
+                        chunk * stride + p * radix_sort_buckets + digit];
+                }
+                if (total == size)
+                {
+                    trivial = true;
+                    break;
+                }
+            }
+            if (trivial)
+                continue;
+
+            if (!buffer)
+                buffer.reset(new key_type[size]);
+
+            // the elements have changed chunks, count them again
+            if (moved)
+            {
+                distribution_sort_for_each_chunk(policy, num_chunks,
+                    [&](std::size_t chunk)
+                    {
+                        std::size_t* count =
+                            &counts[chunk * stride + p * radix_sort_buckets];
+                        std::fill(count, count + radix_sort_buckets, 0);
+
+                        std::size_t const begin = chunk * chunk_size;
+                        std::size_t const end =
+                            (std::min)(size, begin + chunk_size);
+                        if (in_buffer)
+                        {
+                            radix_sort_count<key_type>(buffer.get(),
+                                begin, end, shift, count);
+                        }
+                        else
+                        {
+                            radix_sort_count<key_type>(first,
+                                begin, end, shift, count);
+                        }
+                    });
+            }
+
+            distribution_sort_offsets(&counts[p * radix_sort_buckets],
+                offsets.data(), num_chunks, radix_sort_buckets, stride);
+
+            distribution_sort_for_each_chunk(policy, num_chunks,
+                [&](std::size_t chunk)
+                {
+                    std::size_t* offset =
+                        &offsets[chunk * radix_sort_buckets];
+
+                    std::size_t const begin = chunk * chunk_size;
+                    std::size_t const end =
+                        (std::min)(size, begin + chunk_size);
+                    if (in_buffer)
+                    {
+                        radix_sort_scatter<key_type>(buffer.get(), first,
+                            begin, end, shift, offset, values, false);
+                    }
+                    else
+                    {
+                        radix_sort_scatter<key_type>(first, buffer.get(),
+                            begin, end, shift, offset, values, true);
+                    }
+                });
+
+            in_buffer = !in_buffer;
+            moved = true;
+        }
+
+        // an odd number of passes leaves the elements in the buffer
+        if (in_buffer)
+        {
+            distribution_sort_for_each_chunk(policy, num_chunks,
+                [&](std::size_t chunk)
+                {
+                    std::size_t const begin = chunk * chunk_size;
+                    std::size_t const end =
+                        (std::min)(size, begin + chunk_size);
+
+                    std::copy(buffer.get() + begin, buffer.get() + end,
+                        first + begin);
+                    values.move_back(begin, end);
+                });
+        }
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    // sample sort
+    static const std::size_t sample_sort_oversampling = 32;
+    static const std::size_t sample_sort_min_bucket = 16384ul;
+    static const std::size_t sample_sort_max_buckets = 1024ul;
+
+    // The sample sort distributes the elements into an auxiliary buffer
+    template <typename Iter>
+    struct use_sample_sort
+      : std::integral_constant<bool,
+            std::is_default_constructible<
+                typename std::iterator_traits<Iter>::value_type
+            >::value &&
+            std::is_move_assignable<
+                typename std::iterator_traits<Iter>::value_type
+            >::value>
+    {};
+
+    //------------------------------------------------------------------------
+    //  function : sample_sort
+    /// \brief Select splitters from a random sample of the range and
+    ///        concurrently distribute all elements into the buckets
+    ///        delimited by those. Elements equal to a splitter are put into
+    ///        a separate bucket which does not need any sorting, all other
+    ///        buckets are sorted concurrently.
+    //------------------------------------------------------------------------
+    template <typename ExPolicy, typename RandomIt, typename Compare>
+    void sample_sort(ExPolicy& policy, RandomIt first, RandomIt last,
+        Compare comp)
+    {
+        typedef typename std::iterator_traits<RandomIt>::value_type
+            value_type;
+
+        std::size_t const size = std::size_t(last - first);
+
+        std::size_t const cores = distribution_sort_cores(policy);
+        std::size_t const num_buckets = (std::max)(std::size_t(2),
+            (std::min)((std::min)(4 * cores, size / sample_sort_min_bucket),
+                sample_sort_max_buckets));
+
+        // select the splitters from a sorted random sample
+        std::size_t const num_samples = num_buckets * sample_sort_oversampling;
+
+        std::vector<value_type> samples;
+        samples.reserve(num_samples);
+
+        std::minstd_rand gen(
+            static_cast<std::minstd_rand::result_type>(size));
+        std::uniform_int_distribution<std::size_t> dist(0, size - 1);
+        for (std::size_t i = 0; i != num_samples; ++i)
+            samples.push_back(first[dist(gen)]);
+
+        std::sort(samples.begin(), samples.end(), comp);
+
+        std::vector<value_type> splitters;
+        splitters.reserve(num_buckets - 1);
+        for (std::size_t i = 1; i != num_buckets; ++i)
+            splitters.push_back(samples[i * sample_sort_oversampling]);
+
+        // bucket 2 * i holds all elements between splitter i - 1 and i,
+        // bucket 2 * i + 1 holds all elements equal to splitter i
+        std::size_t const num_classes = 2 * splitters.size() + 1;
+
+        std::size_t const chunk_size =
+            (std::max)(distribution_sort_chunk_size,
+                (size + 4 * cores - 1) / (4 * cores));
+        std::size_t const num_chunks = (size + chunk_size - 1) / chunk_size;
+
+        std::vector<std::uint16_t> classes(size);
+        std::vector<std::size_t> counts(num_chunks * num_classes, 0);
+
+        distribution_sort_for_each_chunk(policy, num_chunks,
+            [&](std::size_t chunk)
+            {
+                std::size_t* count = &counts[chunk * num_classes];
+                std::size_t const end =
+                    (std::min)(size, (chunk + 1) * chunk_size);
+
+                for (std::size_t i = chunk * chunk_size; i != end; ++i)
+                {
+                    value_type const& value = first[i];
+                    std::size_t bucket = std::size_t(
+                        std::lower_bound(splitters.begin(), splitters.end(),
+                            value, comp) - splitters.begin());
+
+                    std::size_t cls = 2 * bucket;
+                    if (bucket != splitters.size() &&
+                        !comp(value, splitters[bucket]))
+                    {
+                        ++cls;
+                    }
+
+                    classes[i] = std::uint16_t(cls);
+                    ++count[cls];
+                }
+            });
+
+        std::vector<std::size_t> offsets(num_chunks * num_classes);
+        distribution_sort_offsets(counts.data(), offsets.data(),
+            num_chunks, num_classes, num_classes);
+
+        std::vector<std::size_t> class_first(num_classes + 1, size);
+        for (std::size_t cls = 0; cls != num_classes; ++cls)
+            class_first[cls] = offsets[cls];
+
+        boost::shared_array<value_type> buffer(new value_type[size]);
+
+        distribution_sort_for_each_chunk(policy, num_chunks,
+            [&](std::size_t chunk)
+            {
+                std::size_t* offset = &offsets[chunk * num_classes];
+                std::size_t const end =
+                    (std::min)(size, (chunk + 1) * chunk_size);
+
+                for (std::size_t i = chunk * chunk_size; i != end; ++i)
+                    buffer[offset[classes[i]]++] = std::move(first[i]);
+            });
+
+        // sort the buckets and move them back into place
+        distribution_sort_for_each_chunk(policy, num_classes,
+            [&](std::size_t cls)
+            {
+                value_type* begin = buffer.get() + class_first[cls];
+                value_type* end = buffer.get() + class_first[cls + 1];
+
+                if ((cls & 1) == 0)
+                    std::sort(begin, end, comp);
+
+                std::move(begin, end, first + class_first[cls]);
+            });
+    }
+
+    /// \endcond
+}}}}
+
+#endif
@@ -0,0 +1,828 @@
+//  Copyright (c) 2026 agent
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file parallel/algorithms/merge.hpp
+
+#if !defined(HPX_PARALLEL_ALGORITHMS_MERGE_HPP)
+#define HPX_PARALLEL_ALGORITHMS_MERGE_HPP
+
+#include <hpx/config.hpp>
+#include <hpx/dataflow.hpp>
+#include <hpx/lcos/future.hpp>
+#include <hpx/traits/concepts.hpp>
+#include <hpx/traits/is_iterator.hpp>
+#include <hpx/util/decay.hpp>
+
+#include <hpx/parallel/algorithms/detail/dispatch.hpp>
+#include <hpx/parallel/algorithms/detail/predicates.hpp>
+#include <hpx/parallel/algorithms/uninitialized_move.hpp>
+#include <hpx/parallel/exception_list.hpp>
+#include <hpx/parallel/execution_policy.hpp>
+#include <hpx/parallel/executors/execution.hpp>
+#include <hpx/parallel/traits/projected.hpp>
+#include <hpx/parallel/util/compare_projected.hpp>
+#include <hpx/parallel/util/detail/algorithm_result.hpp>
+#include <hpx/parallel/util/detail/handle_local_exceptions.hpp>
+#include <hpx/parallel/util/projection_identity.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <exception>
+#include <iterator>
+#include <list>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace hpx { namespace parallel { inline namespace v1
+{
+    ///////////////////////////////////////////////////////////////////////////
+    // merge
+    namespace detail
+    {
+        /// \cond NOINTERNAL
+        static const std::size_t merge_limit_per_task = 65536ul;
+
+        // auxiliary buffers never occupy more memory than this, sequences
+        // which don't fit are merged in place instead
+        static const std::size_t max_auxiliary_buffer_bytes =
+            std::size_t(1) << 30;
+
+        ///////////////////////////////////////////////////////////////////////
+        // Uninitialized storage for the auxiliary buffer used by inplace_merge
+        // and stable_sort. Its elements are move constructed from the input
+        // sequence, they don't need to be default constructible.
+        template <typename T>
+        class auxiliary_buffer
+        {
+        public:
+            HPX_NON_COPYABLE(auxiliary_buffer);
+
+            typedef T value_type;
+
+        private:
+            auxiliary_buffer(T* data, std::size_t size)
+              : data_(data)
+              , size_(size)
+              , constructed_(0)
+            {}
+
+        public:
+            ~auxiliary_buffer()
+            {
+                for (std::size_t i = 0; i != constructed_; ++i)
+                    data_[i].~T();
+                ::operator delete(data_);
+            }
+
+            // the largest number of elements a buffer is created for
+            static std::size_t max_size()
+            {
+                return max_auxiliary_buffer_bytes / sizeof(T);
+            }
+
+            // allocates storage for at most max_size() elements, returns an
+            // empty pointer if the memory could not be allocated
+            static std::shared_ptr<auxiliary_buffer> create(std::size_t size)
+            {
+                std::shared_ptr<auxiliary_buffer> buffer;
+
+                size = (std::min)(size, max_size());
+                T* data = static_cast<T*>(
+                    ::operator new(sizeof(T) * size, std::nothrow));
+                if (data == nullptr)
+                    return buffer;
+
+                try {
+                    buffer.reset(new auxiliary_buffer(data, size));
+                }
+                catch (...) {
+                    ::operator delete(data);
+                    throw;
+                }
+                return buffer;
+            }
+
+            T* data() const
+            {
+                return data_;
+            }
+
+            std::size_t size() const
+            {
+                return size_;
+            }
+
+            // the first size elements have been constructed and need to be
+            // destroyed together with the buffer
+            void set_constructed(std::size_t size)
+            {
+                constructed_ = size;
+            }
+
+            // move the elements of [first, last) to the beginning of the
+            // buffer, reusing the elements left over by earlier calls
+            template <typename Iter>
+            T* assign(Iter first, Iter last)
+            {
+                std::size_t size = std::size_t(last - first);
+                HPX_ASSERT(size <= size_);
+
+                if (size <= constructed_)
+                {
+                    std::move(first, last, data_);
+                }
+                else
+                {
+                    Iter mid = first + constructed_;
+                    std::move(first, mid, data_);
+                    std_uninitialized_move(mid, last, data_ + constructed_);
+                    constructed_ = size;
+                }
+                return data_;
+            }
+
+        private:
+            T* data_;
+            std::size_t size_;
+            std::size_t constructed_;
+        };
+
+        ///////////////////////////////////////////////////////////////////////
+        // Rethrow the exceptions of the two halves of a recursively
+        // decomposed operation (if any).
+        template <typename ExPolicy, typename T1, typename T2>
+        void handle_merge_exceptions(hpx::future<T1> const& left,
+            hpx::future<T2> const& right)
+        {
+            if (left.has_exception() || right.has_exception())
+            {
+                std::list<std::exception_ptr> errors;
+                if (left.has_exception())
+                    util::detail::handle_local_exceptions<ExPolicy>::call(
+                        left.get_exception_ptr(), errors);
+                if (right.has_exception())
+                    util::detail::handle_local_exceptions<ExPolicy>::call(
+                        right.get_exception_ptr(), errors);
+
+                throw exception_list(std::move(errors));
+            }
+        }
+
+        // Sequentially merge two sorted ranges by copying the elements
+        struct copy_merge
+        {
+            template <typename Iter1, typename Iter2, typename OutIter,
+                typename Compare>
+            OutIter operator()(Iter1 first1, Iter1 last1,
+                Iter2 first2, Iter2 last2, OutIter dest,
+                Compare const& comp) const
+            {
+                return std::merge(first1, last1, first2, last2, dest, comp);
+            }
+        };
+
+        // Sequentially merge two sorted ranges by moving the elements. The
+        // comparison is always applied to the elements in place, which
+        // avoids moving from an element while invoking the predicate.
+        struct move_merge
+        {
+            template <typename Iter1, typename Iter2, typename OutIter,
+                typename Compare>
+            OutIter operator()(Iter1 first1, Iter1 last1,
+                Iter2 first2, Iter2 last2, OutIter dest,
+                Compare const& comp) const
+            {
+                for (/**/; first1 != last1 && first2 != last2; ++dest)
+                {
+                    if (comp(*first2, *first1))
+                    {
+                        *dest = std::move(*first2);
+                        ++first2;
+                    }
+                    else
+                    {
+                        *dest = std::move(*first1);
+                        ++first1;
+                    }
+                }
+                dest = std::move(first1, last1, dest);
+                return std::move(first2, last2, dest);
+            }
+        };
+
+        //------------------------------------------------------------------------
+        //  function : parallel_merge_helper
+        /// \brief Merge the sorted ranges [first1, last1) and [first2, last2)
+        ///        into the range starting at dest. The larger of both input
+        ///        ranges is split at its middle element, the matching split
+        ///        point in the other range is found by binary search. Both
+        ///        resulting pairs of sub-ranges are merged concurrently,
+        ///        equal elements from the first range stay in front of the
+        ///        ones from the second range.
+        /// \return a future referring to the end of the destination range
+        //------------------------------------------------------------------------
+        template <typename ExPolicy, typename Iter1, typename Iter2,
+            typename OutIter, typename Compare, typename Merge>
+        hpx::future<OutIter> parallel_merge_helper(ExPolicy policy,
+            Iter1 first1, Iter1 last1, Iter2 first2, Iter2 last2,
+            OutIter dest, Compare comp, Merge merge_op)
+        {
+            std::size_t size1 = std::size_t(last1 - first1);
+            std::size_t size2 = std::size_t(last2 - first2);
+
+            if (size1 + size2 <= merge_limit_per_task)
+            {
+                return execution::async_execute(
+                    policy.executor(),
+                    [=]() -> OutIter
+                    {
+                        return merge_op(first1, last1, first2, last2, dest,
+                            comp);
+                    });
+            }
+
+            Iter1 mid1 = first1;
+            Iter2 mid2 = first2;
+            if (size1 >= size2)
+            {
+                mid1 = first1 + size1 / 2;
+                mid2 = std::lower_bound(first2, last2, *mid1, comp);
+            }
+            else
+            {
+                mid2 = first2 + size2 / 2;
+                mid1 = std::upper_bound(first1, last1, *mid2, comp);
+            }
+
+            OutIter mid_dest = dest + ((mid1 - first1) + (mid2 - first2));
+
+            // spawn tasks for each sub section
+            hpx::future<OutIter> left =
+                execution::async_execute(
+                    policy.executor(),
+                    &parallel_merge_helper<
+                        ExPolicy, Iter1, Iter2, OutIter, Compare, Merge>,
+                    policy, first1, mid1, first2, mid2, dest, comp,
+                    merge_op);
+
+            hpx::future<OutIter> right =
+                execution::async_execute(
+                    policy.executor(),
+                    &parallel_merge_helper<
+                        ExPolicy, Iter1, Iter2, OutIter, Compare, Merge>,
+                    policy, mid1, last1, mid2, last2, mid_dest, comp,
+                    merge_op);
+
+            return hpx::dataflow(
+                policy.executor(),
+                [](hpx::future<OutIter> && left,
+                    hpx::future<OutIter> && right) -> OutIter
+                {
+                    handle_merge_exceptions<ExPolicy>(left, right);
+                    return right.get();
+                },
+                std::move(left), std::move(right));
+        }
+
+        //------------------------------------------------------------------------
+        //  function : parallel_rotate_merge
+        /// \brief Merge the consecutive sorted ranges [first, middle) and
+        ///        [middle, last) without an auxiliary buffer. The ranges are
+        ///        split the same way as by \a parallel_merge_helper, the
+        ///        sub-ranges in between both split points are exchanged by
+        ///        rotating them, which leaves two independent merge problems
+        ///        that are handled concurrently. Sub-ranges smaller than
+        ///        merge_limit_per_task are merged by std::inplace_merge.
+        //------------------------------------------------------------------------
+        template <typename ExPolicy, typename RandomIt, typename Compare>
+        hpx::future<void> parallel_rotate_merge(ExPolicy policy,
+            RandomIt first, RandomIt middle, RandomIt last, Compare comp)
+        {
+            std::size_t size1 = std::size_t(middle - first);
+            std::size_t size2 = std::size_t(last - middle);
+
+            if (size1 == 0 || size2 == 0)
+                return hpx::make_ready_future();
+
+            if (size1 + size2 <= merge_limit_per_task)
+            {
+                return execution::async_execute(
+                    policy.executor(),
+                    [first, middle, last, comp]()
+                    {
+                        std::inplace_merge(first, middle, last, comp);
+                    });
+            }
+
+            RandomIt mid1 = first;
+            RandomIt mid2 = middle;
+            if (size1 >= size2)
+            {
+                mid1 = first + size1 / 2;
+                mid2 = std::lower_bound(middle, last, *mid1, comp);
+            }
+            else
+            {
+                mid2 = middle + size2 / 2;
+                mid1 = std::upper_bound(first, middle, *mid2, comp);
+            }
+
+            RandomIt new_middle = std::rotate(mid1, middle, mid2);
+
+            // spawn tasks for each sub section
+            hpx::future<void> left =
+                execution::async_execute(
+                    policy.executor(),
+                    &parallel_rotate_merge<ExPolicy, RandomIt, Compare>,
+                    policy, first, mid1, new_middle, comp);
+
+            hpx::future<void> right =
+                execution::async_execute(
+                    policy.executor(),
+                    &parallel_rotate_merge<ExPolicy, RandomIt, Compare>,
+                    policy, new_middle, mid2, last, comp);
+
+            return hpx::dataflow(
+                policy.executor(),
+                [](hpx::future<void> && left, hpx::future<void> && right)
+                {
+                    handle_merge_exceptions<ExPolicy>(left, right);
+                },
+                std::move(left), std::move(right));
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        template <typename OutIter>
+        struct merge : public detail::algorithm<merge<OutIter>, OutIter>
+        {
+            merge()
+              : merge::algorithm("merge")
+            {}
+
+            template <typename ExPolicy, typename InIter1, typename InIter2,
+                typename F>
+            static OutIter
+            sequential(ExPolicy, InIter1 first1, InIter1 last1,
+                InIter2 first2, InIter2 last2, OutIter dest, F && f)
+            {
+                return std::merge(first1, last1, first2, last2, dest,
+                    std::forward<F>(f));
+            }
+
+            template <typename ExPolicy, typename RanIter1, typename RanIter2,
+                typename F>
+            static typename util::detail::algorithm_result<
+                ExPolicy, OutIter
+            >::type
+            parallel(ExPolicy && policy, RanIter1 first1, RanIter1 last1,
+                RanIter2 first2, RanIter2 last2, OutIter dest, F && f)
+            {
+                typedef util::detail::algorithm_result<ExPolicy, OutIter>
+                    algorithm_result;
+                typedef typename hpx::util::decay<ExPolicy>::type policy_type;
+                typedef typename hpx::util::decay<F>::type compare_type;
+
+                hpx::future<OutIter> result;
+                try {
+                    result = parallel_merge_helper(
+                        policy_type(policy), first1, last1, first2, last2,
+                        dest, compare_type(std::forward<F>(f)), copy_merge());
+                }
+                catch (...) {
+                    return algorithm_result::get(
+                        detail::handle_exception<ExPolicy, OutIter>::call(
+                            std::current_exception()));
+                }
+
+                if (result.has_exception())
+                {
+                    return algorithm_result::get(
+                        detail::handle_exception<ExPolicy, OutIter>::call(
+                            std::move(result)));
+                }
+
+                return algorithm_result::get(std::move(result));
+            }
+        };
+        /// \endcond
+    }
+
+    /// Merges two sorted ranges [first1, last1) and [first2, last2) into one
+    /// sorted range beginning at \a dest. The order of equivalent elements is
+    /// preserved, for equivalent elements in both input ranges the elements
+    /// from the first range precede the elements from the second range. This
+    /// algorithm expects both input ranges to be sorted with the given binary
+    /// predicate \a f.
+    ///
+    /// \note   Complexity: At most (N1 + N2 - 1) comparisons, where \a N1 is
+    ///         the length of the first sequence and \a N2 is the length of the
+    ///         second sequence. The parallel version performs an additional
+    ///         O(log(N1 + N2)) comparisons for each of the partitions it
+    ///         creates.
+    ///
+    /// The resulting range cannot overlap with either of the input ranges.
+    ///
+    /// \tparam ExPolicy    The type of the execution policy to use (deduced).
+    ///                     It describes the manner in which the execution
+    ///                     of the algorithm may be parallelized and the manner
+    ///                     in which it applies user-provided function objects.
+    /// \tparam FwdIter1    The type of the source iterators used (deduced)
+    ///                     representing the first sequence.
+    ///                     This iterator type must meet the requirements of an
+    ///                     forward iterator.
+    /// \tparam FwdIter2    The type of the source iterators used (deduced)
+    ///                     representing the second sequence.
+    ///                     This iterator type must meet the requirements of an
+    ///                     forward iterator.
+    /// \tparam FwdIter3    The type of the iterator representing the
+    ///                     destination range (deduced).
+    ///                     This iterator type must meet the requirements of an
+    ///                     output iterator.
+    /// \tparam Pred        The type of an optional function/function object to use.
+    ///                     Unlike its sequential form, the parallel
+    ///                     overload of \a merge requires \a Pred to meet the
+    ///                     requirements of \a CopyConstructible. This defaults
+    ///                     to std::less<>
+    ///
+    /// \param policy       The execution policy to use for the scheduling of
+    ///                     the iterations.
+    /// \param first1       Refers to the beginning of the sequence of elements
+    ///                     of the first range the algorithm will be applied to.
+    /// \param last1        Refers to the end of the sequence of elements of
+    ///                     the first range the algorithm will be applied to.
+    /// \param first2       Refers to the beginning of the sequence of elements
+    ///                     of the second range the algorithm will be applied to.
+    /// \param last2        Refers to the end of the sequence of elements of
+    ///                     the second range the algorithm will be applied to.
+    /// \param dest         Refers to the beginning of the destination range.
+    /// \param op           The binary predicate which returns true if the
+    ///                     first argument is less than the second. The
+    ///                     signature of the predicate function should be
+    ///                     equivalent to the following:
+    ///                     \code
+    ///                     bool pred(const Type1 &a, const Type1 &b);
+    ///                     \endcode \n
+    ///                     The signature does not need to have const &, but
+    ///                     the function must not modify the objects passed to
+    ///                     it. The type \a Type1 must be such
+    ///                     that objects of types \a FwdIter1 and \a FwdIter2
+    ///                     can be dereferenced and then implicitly converted
+    ///                     to \a Type1
+    ///
+    /// The application of function objects in parallel algorithm
+    /// invoked with a sequential execution policy object execute in sequential
+    /// order in the calling thread (\a sequenced_policy) or in a
+    /// single new thread spawned from the current thread
+    /// (for \a sequenced_task_policy).
+    ///
+    /// The application of function objects in parallel algorithm
+    /// invoked with an execution policy object of type
+    /// \a parallel_policy or \a parallel_task_policy are
+    /// permitted to execute in an unordered fashion in unspecified
+    /// threads, and indeterminately sequenced within each thread.
+    ///
+    /// \returns  The \a merge algorithm returns a \a hpx::future<FwdIter3>
+    ///           if the execution policy is of type
+    ///           \a sequenced_task_policy or
+    ///           \a parallel_task_policy and
+    ///           returns \a FwdIter3 otherwise.
+    ///           The \a merge algorithm returns the output iterator to the
+    ///           element in the destination range, one past the last element
+    ///           copied.
+    ///
+    template <typename ExPolicy, typename FwdIter1, typename FwdIter2,
+        typename FwdIter3, typename Pred = detail::less>
+    inline typename std::enable_if<
+        execution::is_execution_policy<ExPolicy>::value,
+        typename util::detail::algorithm_result<ExPolicy, FwdIter3>::type
+    >::type
+    merge(ExPolicy && policy, FwdIter1 first1, FwdIter1 last1,
+        FwdIter2 first2, FwdIter2 last2, FwdIter3 dest, Pred && op = Pred())
+    {
+#if defined(HPX_HAVE_ALGORITHM_INPUT_ITERATOR_SUPPORT)
+        static_assert(
+            (hpx::traits::is_input_iterator<FwdIter1>::value),
+            "Requires at least input iterator.");
+        static_assert(
+            (hpx::traits::is_input_iterator<FwdIter2>::value),
+            "Requires at least input iterator.");
+        static_assert(
+            (hpx::traits::is_output_iterator<FwdIter3>::value ||
+                hpx::traits::is_forward_iterator<FwdIter3>::value),
+            "Requires at least output iterator.");
+#else
+        static_assert(
+            (hpx::traits::is_forward_iterator<FwdIter1>::value),
+            "Requires at least forward iterator.");
+        static_assert(
+            (hpx::traits::is_forward_iterator<FwdIter2>::value),
+            "Requires at least forward iterator.");
+        static_assert(
+            (hpx::traits::is_forward_iterator<FwdIter3>::value),
+            "Requires at least forward iterator.");
+#endif
+
+        // the parallel version needs random access to all three ranges
+        typedef std::integral_constant<bool,
+                execution::is_sequenced_execution_policy<ExPolicy>::value ||
+               !hpx::traits::is_random_access_iterator<FwdIter1>::value ||
+               !hpx::traits::is_random_access_iterator<FwdIter2>::value ||
+               !hpx::traits::is_random_access_iterator<FwdIter3>::value
+            > is_seq;
+
+        return detail::merge<FwdIter3>().call(
+            std::forward<ExPolicy>(policy), is_seq(),
+            first1, last1, first2, last2, dest, std::forward<Pred>(op));
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    // inplace_merge
+    namespace detail
+    {
+        /// \cond NOINTERNAL
+
+        //------------------------------------------------------------------------
+        //  function : parallel_inplace_merge_async
+        /// \brief Move the whole range into an auxiliary buffer (concurrently
+        ///        for each partition) and merge both halves back into the
+        ///        original range using \a parallel_merge_helper. Ranges
+        ///        which don't fit into an auxiliary buffer are merged in place
+        ///        using \a parallel_rotate_merge.
+        //------------------------------------------------------------------------
+        template <typename ExPolicy, typename RandomIt, typename Compare>
+        hpx::future<RandomIt>
+        parallel_inplace_merge_async(ExPolicy && policy, RandomIt first,
+            RandomIt middle, RandomIt last, Compare comp)
+        {
+            typedef typename hpx::util::decay<ExPolicy>::type policy_type;
+            typedef typename std::iterator_traits<RandomIt>::value_type
+                value_type;
+
+            hpx::future<RandomIt> result;
+            try {
+                std::size_t size = std::size_t(last - first);
+                std::size_t mid_point = std::size_t(middle - first);
+
+                if (size <= merge_limit_per_task ||
+                    mid_point == 0 || mid_point == size)
+                {
+                    std::inplace_merge(first, middle, last, comp);
+                    return hpx::make_ready_future(last);
+                }
+
+                // sequences not fitting into an auxiliary buffer are merged
+                // in place
+                typedef auxiliary_buffer<value_type> buffer_type;
+                std::shared_ptr<buffer_type> buffer;
+                if (size <= buffer_type::max_size())
+                    buffer = buffer_type::create(size);
+
+                if (!buffer)
+                {
+                    result = parallel_rotate_merge(policy_type(policy),
+                            first, middle, last, comp
+                        ).then(
+                            [last](hpx::future<void> && f) -> RandomIt
+                            {
+                                f.get();
+                                return last;
+                            });
+                }
+                else
+                {
+                    std::vector<hpx::future<void> > workitems;
+                    workitems.reserve(size / merge_limit_per_task + 1);
+
+                    for (std::size_t base = 0; base < size;
+                         base += merge_limit_per_task)
+                    {
+                        std::size_t count =
+                            (std::min)(merge_limit_per_task, size - base);
+                        value_type* dest = buffer->data() + base;
+                        RandomIt part_first = first + base;
+
+                        workitems.push_back(execution::async_execute(
+                            policy.executor(),
+                            [part_first, count, dest]()
+                            {
+                                std_uninitialized_move(
+                                    part_first, part_first + count, dest);
+                            }));
+                    }
+
+                    policy_type p(policy);
+                    hpx::future<RandomIt> merged = hpx::dataflow(
+                        policy.executor(),
+                        [p, buffer, first, size, mid_point, comp](
+                            std::vector<hpx::future<void> > && workitems)
+                        ->  hpx::future<RandomIt>
+                        {
+                            value_type* data = buffer->data();
+
+                            bool failed = false;
+                            for (hpx::future<void> const& f : workitems)
+                                failed = failed || f.has_exception();
+
+                            if (!failed)
+                            {
+                                buffer->set_constructed(size);
+                            }
+                            else
+                            {
+                                // destroy the elements of all partitions which
+                                // have been moved successfully
+                                for (std::size_t i = 0;
+                                     i != workitems.size(); ++i)
+                                {
+                                    if (workitems[i].has_exception())
+                                        continue;
+
+                                    std::size_t base = i * merge_limit_per_task;
+                                    std::size_t count = (std::min)(
+                                        merge_limit_per_task, size - base);
+                                    for (std::size_t j = 0; j != count; ++j)
+                                        data[base + j].~value_type();
+                                }
+                            }
+
+                            std::list<std::exception_ptr> errors;
+                            util::detail::handle_local_exceptions<
+                                    policy_type
+                                >::call(workitems, errors);
+
+                            return parallel_merge_helper(p,
+                                data, data + mid_point, data + mid_point,
+                                data + size, first, comp, move_merge());
+                        },
+                        std::move(workitems));
+
+                    result = merged.then(
+                        [buffer](hpx::future<RandomIt> && f) -> RandomIt
+                        {
+                            // keep the auxiliary buffer alive until all of the
+                            // elements have been moved back
+                            return f.get();
+                        });
+                }
+            }
+            catch (...) {
+                return detail::handle_exception<ExPolicy, RandomIt>::call(
+                    std::current_exception());
+            }
+
+            if (result.has_exception())
+            {
+                return detail::handle_exception<ExPolicy, RandomIt>::call(
+                    std::move(result));
+            }
+
+            return result;
+        }
+
+        template <typename RandomIt>
+        struct inplace_merge
+          : public detail::algorithm<inplace_merge<RandomIt>, RandomIt>
+        {
+            inplace_merge()
+              : inplace_merge::algorithm("inplace_merge")
+            {}
+
+            template <typename ExPolicy, typename Compare, typename Proj>
+            static RandomIt
+            sequential(ExPolicy, RandomIt first, RandomIt middle,
+                RandomIt last, Compare && comp, Proj && proj)
+            {
+                std::inplace_merge(first, middle, last,
+                    util::compare_projected<Compare, Proj>(
+                            std::forward<Compare>(comp),
+                            std::forward<Proj>(proj)
+                        ));
+                return last;
+            }
+
+            template <typename ExPolicy, typename Compare, typename Proj>
+            static typename util::detail::algorithm_result<
+                ExPolicy, RandomIt
+            >::type
+            parallel(ExPolicy && policy, RandomIt first, RandomIt middle,
+                RandomIt last, Compare && comp, Proj && proj)
+            {
+                return util::detail::algorithm_result<ExPolicy, RandomIt>::get(
+                    parallel_inplace_merge_async(std::forward<ExPolicy>(policy),
+                        first, middle, last,
+                        util::compare_projected<Compare, Proj>(
+                            std::forward<Compare>(comp),
+                            std::forward<Proj>(proj)
+                        )));
+            }
+        };
+        /// \endcond
+    }
+
+    /// Merges two consecutive sorted ranges [first, middle) and
+    /// [middle, last) into one sorted range [first, last). The order of
+    /// equivalent elements is preserved, for equivalent elements in both
+    /// input ranges the elements from the first range precede the elements
+    /// from the second range.
+    ///
+    /// \note   Complexity: Exactly N-1 comparisons if enough additional memory
+    ///         is available, O(Nlog(N)) otherwise, where
+    ///         N = std::distance(first, last). The parallel version performs
+    ///         an additional O(log(N)) comparisons for each of the partitions
+    ///         it creates.
+    ///
+    /// \tparam ExPolicy    The type of the execution policy to use (deduced).
+    ///                     It describes the manner in which the execution
+    ///                     of the algorithm may be parallelized and the manner
+    ///                     in which it applies user-provided function objects.
+    /// \tparam RandomIt    The type of the source iterators used (deduced).
+    ///                     This iterator type must meet the requirements of a
+    ///                     random access iterator.
+    /// \tparam Comp        The type of the function/function object to use
+    ///                     (deduced).
+    /// \tparam Proj        The type of an optional projection function. This
+    ///                     defaults to \a util::projection_identity
+    ///
+    /// \param policy       The execution policy to use for the scheduling of
+    ///                     the iterations.
+    /// \param first        Refers to the beginning of the first sorted range
+    ///                     the algorithm will be applied to.
+    /// \param middle       Refers to the end of the first sorted range and the
+    ///                     beginning of the second sorted range the algorithm
+    ///                     will be applied to.
+    /// \param last         Refers to the end of the second sorted range the
+    ///                     algorithm will be applied to.
+    /// \param comp         comp is a callable object. The return value of the
+    ///                     INVOKE operation applied to an object of type Comp,
+    ///                     when contextually converted to bool, yields true if
+    ///                     the first argument of the call is less than the
+    ///                     second, and false otherwise. It is assumed that comp
+    ///                     will not apply any non-constant function through the
+    ///                     dereferenced iterator.
+    /// \param proj         Specifies the function (or function object) which
+    ///                     will be invoked for each pair of elements as a
+    ///                     projection operation before the actual predicate
+    ///                     \a comp is invoked.
+    ///
+    /// \a comp has to induce a strict weak ordering on the values.
+    ///
+    /// The parallel version of this algorithm moves all elements into an
+    /// auxiliary buffer of std::distance(first, last) elements (which are
+    /// move constructed). If the buffer can't be allocated (or would exceed
+    /// 1 GiB) the elements are merged in place by repeatedly rotating the
+    /// sub-ranges in between the split points (in parallel as well).
+    ///
+    /// The application of function objects in parallel algorithm
+    /// invoked with an execution policy object of type
+    /// \a sequenced_policy execute in sequential order in the
+    /// calling thread.
+    ///
+    /// The application of function objects in parallel algorithm
+    /// invoked with an execution policy object of type
+    /// \a parallel_policy or \a parallel_task_policy are
+    /// permitted to execute in an unordered fashion in unspecified
+    /// threads, and indeterminately sequenced within each thread.
+    ///
+    /// \returns  The \a inplace_merge algorithm returns a
+    ///           \a hpx::future<RandomIt> if the execution policy is of
+    ///           type
+    ///           \a sequenced_task_policy or
+    ///           \a parallel_task_policy and returns \a RandomIt
+    ///           otherwise.
+    ///           The algorithm returns an iterator pointing to the first
+    ///           element after the last element in the input sequence.
+    ///
+    template <typename ExPolicy, typename RandomIt,
+        typename Proj = util::projection_identity,
+        typename Compare = detail::less,
+    HPX_CONCEPT_REQUIRES_(
+        execution::is_execution_policy<ExPolicy>::value &&
+        hpx::traits::is_iterator<RandomIt>::value &&
+        traits::is_projected<Proj, RandomIt>::value &&
+        traits::is_indirect_callable<
+            ExPolicy, Compare,
+                traits::projected<Proj, RandomIt>,
+                traits::projected<Proj, RandomIt>
+        >::value)>
+    typename util::detail::algorithm_result<ExPolicy, RandomIt>::type
+    inplace_merge(ExPolicy && policy, RandomIt first, RandomIt middle,
+        RandomIt last, Compare && comp = Compare(), Proj && proj = Proj())
+    {
+        static_assert(
+            (hpx::traits::is_random_access_iterator<RandomIt>::value),
+            "Requires a random access iterator.");
+
+        typedef execution::is_sequenced_execution_policy<ExPolicy> is_seq;
+
+        return detail::inplace_merge<RandomIt>().call(
+            std::forward<ExPolicy>(policy), is_seq(), first, middle, last,
+            std::forward<Compare>(comp), std::forward<Proj>(proj));
+    }
+}}}
+
+#endif
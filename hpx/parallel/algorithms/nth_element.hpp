@@ -0,0 +1,433 @@
+//  Copyright (c) 2026 agent
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file parallel/algorithms/nth_element.hpp
+
+#if !defined(HPX_PARALLEL_ALGORITHMS_NTH_ELEMENT_HPP)
+#define HPX_PARALLEL_ALGORITHMS_NTH_ELEMENT_HPP
+
+#include <hpx/config.hpp>
+#include <hpx/lcos/future.hpp>
+#include <hpx/lcos/wait_all.hpp>
+#include <hpx/traits/concepts.hpp>
+#include <hpx/traits/is_iterator.hpp>
+#include <hpx/util/assert.hpp>
+#include <hpx/util/decay.hpp>
+
+#include <hpx/parallel/algorithms/detail/dispatch.hpp>
+#include <hpx/parallel/algorithms/detail/predicates.hpp>
+#include <hpx/parallel/algorithms/sort.hpp>
+#include <hpx/parallel/exception_list.hpp>
+#include <hpx/parallel/execution_policy.hpp>
+#include <hpx/parallel/executors/execution.hpp>
+#include <hpx/parallel/executors/execution_information.hpp>
+#include <hpx/parallel/traits/projected.hpp>
+#include <hpx/parallel/util/compare_projected.hpp>
+#include <hpx/parallel/util/detail/algorithm_result.hpp>
+#include <hpx/parallel/util/detail/handle_local_exceptions.hpp>
+#include <hpx/parallel/util/projection_identity.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <exception>
+#include <iterator>
+#include <list>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace hpx { namespace parallel { inline namespace v1
+{
+    ///////////////////////////////////////////////////////////////////////////
+    // nth_element
+    namespace detail
+    {
+        /// \cond NOINTERNAL
+        template <typename RandomIt, typename Compare>
+        struct less_than_pivot
+        {
+            template <typename T>
+            bool operator()(T const& t) const
+            {
+                return comp_(t, *pivot_);
+            }
+
+            RandomIt pivot_;
+            Compare comp_;
+        };
+
+        template <typename RandomIt, typename Compare>
+        struct not_greater_than_pivot
+        {
+            template <typename T>
+            bool operator()(T const& t) const
+            {
+                return !comp_(*pivot_, t);
+            }
+
+            RandomIt pivot_;
+            Compare comp_;
+        };
+
+        //------------------------------------------------------------------------
+        //  function : parallel_partition
+        /// \brief Reorder the range [first, last) such that all elements for
+        ///        which \a pred returns true precede all other elements. Each
+        ///        partition of the range is reordered concurrently, after that
+        ///        the elements which ended up on the wrong side of the overall
+        ///        partition point are exchanged (again concurrently). The
+        ///        relative order of the elements is not preserved.
+        /// \return the partition point
+        //------------------------------------------------------------------------
+        template <typename ExPolicy, typename RandomIt, typename Pred>
+        RandomIt parallel_partition(ExPolicy& policy, RandomIt first,
+            RandomIt last, Pred const& pred)
+        {
+            typedef std::pair<RandomIt, RandomIt> range_type;
+
+            std::size_t size = std::size_t(last - first);
+            std::size_t const cores = execution::processing_units_count(
+                policy.executor(), policy.parameters());
+            std::size_t const chunk_size = (std::max)(sort_limit_per_task,
+                (size + 4 * cores - 1) / (4 * cores));
+
+            std::vector<range_type> chunks;
+            std::vector<hpx::future<RandomIt> > workitems;
+            chunks.reserve(size / chunk_size + 1);
+            workitems.reserve(size / chunk_size + 1);
+
+            for (std::size_t base = 0; base < size; base += chunk_size)
+            {
+                RandomIt part_first = first + base;
+                RandomIt part_last =
+                    part_first + (std::min)(chunk_size, size - base);
+
+                chunks.push_back(range_type(part_first, part_last));
+                workitems.push_back(execution::async_execute(
+                    policy.executor(),
+                    [part_first, part_last, pred]() -> RandomIt
+                    {
+                        return std::partition(part_first, part_last, pred);
+                    }));
+            }
+
+            std::list<std::exception_ptr> errors;
+            hpx::wait_all(workitems);
+            util::detail::handle_local_exceptions<ExPolicy>::call(
+                workitems, errors);
+
+            // determine the overall partition point
+            std::vector<RandomIt> mids;
+            mids.reserve(workitems.size());
+
+            std::size_t count = 0;
+            for (std::size_t i = 0; i != workitems.size(); ++i)
+            {
+                mids.push_back(workitems[i].get());
+                count += std::size_t(mids.back() - chunks[i].first);
+            }
+
+            RandomIt boundary = first + count;
+
+            // collect the elements which are on the wrong side of the
+            // partition point, both sequences have the same length
+            std::vector<range_type> misplaced_true, misplaced_false;
+            for (std::size_t i = 0; i != chunks.size(); ++i)
+            {
+                RandomIt mid = mids[i];
+                if (mid < boundary)
+                {
+                    RandomIt end = (std::min)(chunks[i].second, boundary);
+                    if (mid != end)
+                        misplaced_false.push_back(range_type(mid, end));
+                }
+                else if (boundary < mid)
+                {
+                    RandomIt begin = (std::max)(chunks[i].first, boundary);
+                    if (begin != mid)
+                        misplaced_true.push_back(range_type(begin, mid));
+                }
+            }
+
+            // exchange the misplaced elements
+            std::vector<hpx::future<void> > swaps;
+
+            typename std::vector<range_type>::iterator f =
+                misplaced_false.begin();
+            typename std::vector<range_type>::iterator t =
+                misplaced_true.begin();
+            while (f != misplaced_false.end())
+            {
+                HPX_ASSERT(t != misplaced_true.end());
+
+                std::size_t num = (std::min)(sort_limit_per_task,
+                    (std::min)(std::size_t(f->second - f->first),
+                        std::size_t(t->second - t->first)));
+
+                RandomIt f_first = f->first;
+                RandomIt t_first = t->first;
+                swaps.push_back(execution::async_execute(
+                    policy.executor(),
+                    [f_first, t_first, num]()
+                    {
+                        std::swap_ranges(f_first, f_first + num, t_first);
+                    }));
+
+                f->first += num;
+                if (f->first == f->second)
+                    ++f;
+
+                t->first += num;
+                if (t->first == t->second)
+                    ++t;
+            }
+
+            hpx::wait_all(swaps);
+            util::detail::handle_local_exceptions<ExPolicy>::call(
+                swaps, errors);
+
+            return boundary;
+        }
+
+        //------------------------------------------------------------------------
+        //  function : nth_element_thread
+        /// \brief Quickselect which partitions large ranges concurrently. All
+        ///        elements equivalent to the pivot are grouped in the middle,
+        ///        which guarantees progress for ranges with many equivalent
+        ///        elements.
+        //------------------------------------------------------------------------
+        template <typename ExPolicy, typename RandomIt, typename Compare>
+        RandomIt nth_element_thread(ExPolicy policy, RandomIt first,
+            RandomIt nth, RandomIt last, Compare comp)
+        {
+            RandomIt const end = last;
+            if (nth == last)
+                return end;
+
+            while (std::size_t(last - first) > sort_limit_per_task)
+            {
+                //---------------------- pivot select ------------------------
+                std::size_t nx = std::size_t(last - first) >> 1;
+
+                RandomIt it_a = first + 1;
+                RandomIt it_b = first + nx;
+                RandomIt it_c = last - 1;
+
+                if (comp(*it_b, *it_a))
+                    std::iter_swap(it_a, it_b);
+
+                if (comp(*it_c, *it_b))
+                {
+                    std::iter_swap(it_c, it_b);
+                    if (comp(*it_b, *it_a))
+                        std::iter_swap(it_a, it_b);
+                }
+
+                std::iter_swap(first, it_b);
+
+                //---------------------- partition ---------------------------
+                // the pivot stays in place while the remaining elements are
+                // being partitioned
+                RandomIt mid = parallel_partition(policy, first + 1, last,
+                    less_than_pivot<RandomIt, Compare>{first, comp});
+
+                // move the pivot between the smaller and the other elements
+                --mid;
+                std::iter_swap(first, mid);
+
+                if (nth < mid)
+                {
+                    last = mid;
+                    continue;
+                }
+                if (nth == mid)
+                    return end;
+
+                RandomIt upper = parallel_partition(policy, mid + 1, last,
+                    not_greater_than_pivot<RandomIt, Compare>{mid, comp});
+
+                if (nth < upper)
+                    return end;
+
+                first = upper;
+            }
+
+            std::nth_element(first, nth, last, comp);
+            return end;
+        }
+
+        //------------------------------------------------------------------------
+        //  function : parallel_nth_element_async
+        //------------------------------------------------------------------------
+        template <typename ExPolicy, typename RandomIt, typename Compare>
+        hpx::future<RandomIt>
+        parallel_nth_element_async(ExPolicy && policy, RandomIt first,
+            RandomIt nth, RandomIt last, Compare comp)
+        {
+            typedef typename hpx::util::decay<ExPolicy>::type policy_type;
+
+            hpx::future<RandomIt> result;
+            try {
+                std::ptrdiff_t N = last - first;
+                HPX_ASSERT(N >= 0);
+
+                if (std::size_t(N) <= sort_limit_per_task)
+                {
+                    std::nth_element(first, nth, last, comp);
+                    return hpx::make_ready_future(last);
+                }
+
+                result = execution::async_execute(policy.executor(),
+                    &nth_element_thread<policy_type, RandomIt, Compare>,
+                    policy_type(policy), first, nth, last, comp);
+            }
+            catch (...) {
+                return detail::handle_exception<ExPolicy, RandomIt>::call(
+                    std::current_exception());
+            }
+
+            if (result.has_exception())
+            {
+                return detail::handle_exception<ExPolicy, RandomIt>::call(
+                    std::move(result));
+            }
+
+            return result;
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        // nth_element
+        template <typename RandomIt>
+        struct nth_element
+          : public detail::algorithm<nth_element<RandomIt>, RandomIt>
+        {
+            nth_element()
+              : nth_element::algorithm("nth_element")
+            {}
+
+            template <typename ExPolicy, typename Compare, typename Proj>
+            static RandomIt
+            sequential(ExPolicy, RandomIt first, RandomIt nth, RandomIt last,
+                Compare && comp, Proj && proj)
+            {
+                std::nth_element(first, nth, last,
+                    util::compare_projected<Compare, Proj>(
+                            std::forward<Compare>(comp),
+                            std::forward<Proj>(proj)
+                        ));
+                return last;
+            }
+
+            template <typename ExPolicy, typename Compare, typename Proj>
+            static typename util::detail::algorithm_result<
+                ExPolicy, RandomIt
+            >::type
+            parallel(ExPolicy && policy, RandomIt first, RandomIt nth,
+                RandomIt last, Compare && comp, Proj && proj)
+            {
+                return util::detail::algorithm_result<ExPolicy, RandomIt>::get(
+                    parallel_nth_element_async(std::forward<ExPolicy>(policy),
+                        first, nth, last,
+                        util::compare_projected<Compare, Proj>(
+                            std::forward<Compare>(comp),
+                            std::forward<Proj>(proj)
+                        )));
+            }
+        };
+        /// \endcond
+    }
+
+    //-----------------------------------------------------------------------------
+    /// Rearranges the elements in the range [first, last) such that the
+    /// element pointed at by \a nth is changed to whatever element would occur
+    /// in that position if [first, last) were sorted. All of the elements
+    /// before this new \a nth element are less than or equal to the elements
+    /// after the new \a nth element.
+    ///
+    /// \note   Complexity: Linear in std::distance(first, last) on average.
+    ///
+    /// \tparam ExPolicy    The type of the execution policy to use (deduced).
+    ///                     It describes the manner in which the execution
+    ///                     of the algorithm may be parallelized and the manner
+    ///                     in which it applies user-provided function objects.
+    /// \tparam RandomIt    The type of the source iterators used (deduced).
+    ///                     This iterator type must meet the requirements of a
+    ///                     random access iterator.
+    /// \tparam Comp        The type of the function/function object to use
+    ///                     (deduced).
+    /// \tparam Proj        The type of an optional projection function. This
+    ///                     defaults to \a util::projection_identity
+    ///
+    /// \param policy       The execution policy to use for the scheduling of
+    ///                     the iterations.
+    /// \param first        Refers to the beginning of the sequence of elements
+    ///                     the algorithm will be applied to.
+    /// \param nth          Refers to the element which defines the partition
+    ///                     point.
+    /// \param last         Refers to the end of the sequence of elements the
+    ///                     algorithm will be applied to.
+    /// \param comp         comp is a callable object. The return value of the
+    ///                     INVOKE operation applied to an object of type Comp,
+    ///                     when contextually converted to bool, yields true if
+    ///                     the first argument of the call is less than the
+    ///                     second, and false otherwise. It is assumed that comp
+    ///                     will not apply any non-constant function through the
+    ///                     dereferenced iterator.
+    /// \param proj         Specifies the function (or function object) which
+    ///                     will be invoked for each pair of elements as a
+    ///                     projection operation before the actual predicate
+    ///                     \a comp is invoked.
+    ///
+    /// \a comp has to induce a strict weak ordering on the values.
+    ///
+    /// The application of function objects in parallel algorithm
+    /// invoked with an execution policy object of type
+    /// \a sequenced_policy execute in sequential order in the
+    /// calling thread.
+    ///
+    /// The application of function objects in parallel algorithm
+    /// invoked with an execution policy object of type
+    /// \a parallel_policy or \a parallel_task_policy are
+    /// permitted to execute in an unordered fashion in unspecified
+    /// threads, and indeterminately sequenced within each thread.
+    ///
+    /// \returns  The \a nth_element algorithm returns a
+    ///           \a hpx::future<RandomIt> if the execution policy is of
+    ///           type
+    ///           \a sequenced_task_policy or
+    ///           \a parallel_task_policy and returns \a RandomIt
+    ///           otherwise.
+    ///           The algorithm returns an iterator pointing to the first
+    ///           element after the last element in the input sequence.
+    //-----------------------------------------------------------------------------
+    template <typename ExPolicy, typename RandomIt,
+        typename Proj = util::projection_identity,
+        typename Compare = detail::less,
+    HPX_CONCEPT_REQUIRES_(
+        execution::is_execution_policy<ExPolicy>::value &&
+        hpx::traits::is_iterator<RandomIt>::value &&
+        traits::is_projected<Proj, RandomIt>::value &&
+        traits::is_indirect_callable<
+            ExPolicy, Compare,
+                traits::projected<Proj, RandomIt>,
+                traits::projected<Proj, RandomIt>
+        >::value)>
+    typename util::detail::algorithm_result<ExPolicy, RandomIt>::type
+    nth_element(ExPolicy && policy, RandomIt first, RandomIt nth,
+        RandomIt last, Compare && comp = Compare(), Proj && proj = Proj())
+    {
+        static_assert(
+            (hpx::traits::is_random_access_iterator<RandomIt>::value),
+            "Requires a random access iterator.");
+
+        typedef execution::is_sequenced_execution_policy<ExPolicy> is_seq;
+
+        return detail::nth_element<RandomIt>().call(
+            std::forward<ExPolicy>(policy), is_seq(), first, nth, last,
+            std::forward<Compare>(comp), std::forward<Proj>(proj));
+    }
+}}}
+
+#endif
@@ -368,11 +368,14 @@ namespace hpx { namespace parallel { inline namespace v1
 
                 using hpx::util::get;
                 using hpx::util::make_zip_iterator;
-                typedef util::scan_partitioner<
+                typedef util::single_pass_scan_partitioner<
                         ExPolicy, hpx::util::tuple<FwdIter1, FwdIter2, FwdIter3>,
                         output_iterator_offset
                     > scan_partitioner_type;
 
+                // count the elements to copy to either destination, the
+                // evaluated predicate is stored in 'flags' to be reused when
+                // copying the elements
                 auto f1 =
                     [pred, proj, flags, policy]
                     (
@@ -399,69 +402,64 @@ namespace hpx { namespace parallel { inline namespace v1
                         return output_iterator_offset(
                             true_count, part_size - true_count);
                     };
-                auto f3 =
-                    [dest_true, dest_false, flags, policy](
+                // copy the elements given the number of elements copied by
+                // all partitions to the left
+                auto f2 =
+                    [pred, proj, dest_true, dest_false, flags](
                         zip_iterator part_begin, std::size_t part_size,
-                        hpx::shared_future<output_iterator_offset> curr,
-                        hpx::shared_future<output_iterator_offset> next
-                    ) mutable -> void
+                        output_iterator_offset offset, bool reduced
+                    ) mutable -> output_iterator_offset
                     {
                         HPX_UNUSED(flags);
-                        HPX_UNUSED(policy);
-
-                        next.get();     // rethrow exceptions
 
-                        output_iterator_offset offset = curr.get();
-                        std::size_t count_true = get<0>(offset);
-                        std::size_t count_false = get<1>(offset);
-                        std::advance(dest_true, count_true);
-                        std::advance(dest_false, count_false);
+                        FwdIter2 out_true = dest_true;
+                        FwdIter3 out_false = dest_false;
+                        std::advance(out_true, offset.first);
+                        std::advance(out_false, offset.second);
 
-                        util::loop_n<ExPolicy>(
-                            part_begin, part_size,
-                            [&dest_true, &dest_false](zip_iterator it) mutable
+                        for (/**/; part_size != 0; (void) --part_size, ++part_begin)
+                        {
+                            using hpx::util::invoke;
+                            if (reduced ? get<1>(*part_begin) :
+                                    invoke(pred, invoke(proj, get<0>(*part_begin))))
                             {
-                                if(get<1>(*it))
-                                    *dest_true++ = get<0>(*it);
-                                else
-                                    *dest_false++ = get<0>(*it);
-                            });
+                                *out_true++ = get<0>(*part_begin);
+                                ++offset.first;
+                            }
+                            else
+                            {
+                                *out_false++ = get<0>(*part_begin);
+                                ++offset.second;
+                            }
+                        }
+                        return offset;
                     };
 
                 return scan_partitioner_type::call(
                     std::forward<ExPolicy>(policy),
                     make_zip_iterator(first, flags.get()), count, init,
-                    // step 1 performs first part of scan algorithm
+                    // reduce a partition
                     std::move(f1),
-                    // step 2 propagates the partition results from left
-                    // to right
-                    hpx::util::unwrapping(
-                        [](output_iterator_offset const& prev_sum,
-                            output_iterator_offset const& curr)
-                        -> output_iterator_offset
-                        {
-                            return output_iterator_offset(
-                                get<0>(prev_sum) + get<0>(curr),
-                                get<1>(prev_sum) + get<1>(curr));
-                        }),
-                    // step 3 runs final accumulation on each partition
-                    std::move(f3),
-                    // step 4 use this return value
-                    [last, dest_true, dest_false, count, flags](
-                        std::vector<
-                            hpx::shared_future<output_iterator_offset>
-                        > && items,
-                        std::vector<hpx::future<void> > &&) mutable
+                    // combine the results of two partitions
+                    [](output_iterator_offset const& prev_sum,
+                        output_iterator_offset const& curr)
+                    -> output_iterator_offset
+                    {
+                        return output_iterator_offset(
+                            get<0>(prev_sum) + get<0>(curr),
+                            get<1>(prev_sum) + get<1>(curr));
+                    },
+                    // copy the elements of a partition
+                    std::move(f2),
+                    // use this return value
+                    [last, dest_true, dest_false, flags](
+                        output_iterator_offset const& count_pair) mutable
                     ->  hpx::util::tuple<FwdIter1, FwdIter2, FwdIter3>
                     {
                         HPX_UNUSED(flags);
-                        HPX_UNUSED(count);
 
-                        output_iterator_offset count_pair = items.back().get();
-                        std::size_t count_true = get<0>(count_pair);
-                        std::size_t count_false = get<1>(count_pair);
-                        std::advance(dest_true, count_true);
-                        std::advance(dest_false, count_false);
+                        std::advance(dest_true, count_pair.first);
+                        std::advance(dest_false, count_pair.second);
 
                         return hpx::util::make_tuple(last, dest_true, dest_false);
                     });
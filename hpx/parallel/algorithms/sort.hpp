@@ -17,6 +17,7 @@
 #include <hpx/util/invoke.hpp>
 
 #include <hpx/parallel/algorithms/detail/dispatch.hpp>
+#include <hpx/parallel/algorithms/detail/distribution_sort.hpp>
 #include <hpx/parallel/algorithms/detail/predicates.hpp>
 #include <hpx/parallel/exception_list.hpp>
 #include <hpx/parallel/execution_policy.hpp>
@@ -169,6 +170,104 @@ namespace hpx { namespace parallel { inline namespace v1
                 std::move(left), std::move(right));
         }
 
+        ///////////////////////////////////////////////////////////////////////
+        // Run one of the distribution sorts on a separate task. All exceptions
+        // except std::bad_alloc are reported as an exception_list.
+        template <typename ExPolicy, typename RandomIt, typename F>
+        hpx::future<RandomIt> distribution_sort_async(ExPolicy && policy,
+            RandomIt last, F && f)
+        {
+            typedef typename hpx::util::decay<ExPolicy>::type policy_type;
+
+            return execution::async_execute(policy.executor(),
+                [last](policy_type policy, typename hpx::util::decay<F>::type f)
+                ->  RandomIt
+                {
+                    try {
+                        f(policy);
+                    }
+                    catch (exception_list const&) {
+                        throw;
+                    }
+                    catch (...) {
+                        std::list<std::exception_ptr> errors;
+                        util::detail::handle_local_exceptions<policy_type>::
+                            call(std::current_exception(), errors);
+                        throw exception_list(std::move(errors));
+                    }
+                    return last;
+                },
+                policy_type(policy), std::forward<F>(f));
+        }
+
+        template <typename ExPolicy, typename RandomIt, typename Compare>
+        hpx::future<RandomIt>
+        parallel_sample_sort_async(std::true_type, ExPolicy && policy,
+            RandomIt first, RandomIt last, Compare comp)
+        {
+            typedef typename hpx::util::decay<ExPolicy>::type policy_type;
+
+            return distribution_sort_async(policy, last,
+                [first, last, comp](policy_type& policy)
+                {
+                    sample_sort(policy, first, last, comp);
+                });
+        }
+
+        // the sample sort is not available for the value type
+        template <typename ExPolicy, typename RandomIt, typename Compare>
+        hpx::future<RandomIt>
+        parallel_sample_sort_async(std::false_type, ExPolicy && policy,
+            RandomIt first, RandomIt last, Compare comp)
+        {
+            return execution::async_execute(policy.executor(),
+                &sort_thread<typename std::remove_reference<ExPolicy>::type,
+                    RandomIt, Compare>,
+                std::ref(policy), first, last, comp);
+        }
+
+        //------------------------------------------------------------------------
+        //  function : parallel_radix_sort_async
+        //------------------------------------------------------------------------
+        template <typename ExPolicy, typename RandomIt>
+        hpx::future<RandomIt>
+        parallel_radix_sort_async(ExPolicy && policy, RandomIt first,
+            RandomIt last)
+        {
+            typedef typename hpx::util::decay<ExPolicy>::type policy_type;
+
+            hpx::future<RandomIt> result;
+            try {
+                std::ptrdiff_t N = last - first;
+                HPX_ASSERT(N >= 0);
+
+                if (std::size_t(N) < radix_sort_limit)
+                {
+                    std::sort(first, last);
+                    return hpx::make_ready_future(last);
+                }
+
+                result = distribution_sort_async(policy, last,
+                    [first, last](policy_type& policy)
+                    {
+                        radix_sort_no_values values;
+                        radix_sort(policy, first, last, values);
+                    });
+            }
+            catch (...) {
+                return detail::handle_exception<ExPolicy, RandomIt>::call(
+                    std::current_exception());
+            }
+
+            if (result.has_exception())
+            {
+                return detail::handle_exception<ExPolicy, RandomIt>::call(
+                    std::move(result));
+            }
+
+            return result;
+        }
+
         //------------------------------------------------------------------------
         //  function : parallel_sort_async
         //------------------------------------------------------------------------
@@ -198,9 +297,18 @@ namespace hpx { namespace parallel { inline namespace v1
                 if (detail::is_sorted_sequential(first, last, comp))
                     return hpx::make_ready_future(last);
 
-                result = execution::async_execute(policy.executor(),
-                        &sort_thread<ExPolicy, RandomIt, Compare>,
-                        std::ref(policy), first, last, comp);
+                if (std::size_t(N) >= sample_sort_limit)
+                {
+                    result = parallel_sample_sort_async(
+                        use_sample_sort<RandomIt>(), policy, first, last,
+                        comp);
+                }
+                else
+                {
+                    result = execution::async_execute(policy.executor(),
+                            &sort_thread<ExPolicy, RandomIt, Compare>,
+                            std::ref(policy), first, last, comp);
+                }
             }
             catch (...) {
                 return detail::handle_exception<ExPolicy, RandomIt>::call(
@@ -227,15 +335,13 @@ namespace hpx { namespace parallel { inline namespace v1
 
             template <typename ExPolicy, typename Compare, typename Proj>
             static RandomIt
-            sequential(ExPolicy, RandomIt first, RandomIt last,
+            sequential(ExPolicy && policy, RandomIt first, RandomIt last,
                 Compare && comp, Proj && proj)
             {
-                std::sort(first, last,
-                    util::compare_projected<Compare, Proj>(
-                            std::forward<Compare>(comp),
-                            std::forward<Proj>(proj)
-                        ));
-                return last;
+                typedef use_radix_sort<RandomIt, Compare, Proj> use_radix;
+
+                return sequential(use_radix(), policy, first, last,
+                    std::forward<Compare>(comp), std::forward<Proj>(proj));
             }
 
             template <typename ExPolicy, typename Compare, typename Proj>
@@ -245,15 +351,66 @@ namespace hpx { namespace parallel { inline namespace v1
             parallel(ExPolicy && policy, RandomIt first, RandomIt last,
                 Compare && comp, Proj && proj)
             {
+                typedef use_radix_sort<RandomIt, Compare, Proj> use_radix;
+
                 // call the sort routine and return the right type,
                 // depending on execution policy
                 return util::detail::algorithm_result<ExPolicy, RandomIt>::get(
-                    parallel_sort_async(std::forward<ExPolicy>(policy),
-                        first, last,
-                        util::compare_projected<Compare, Proj>(
+                    parallel_async(use_radix(), std::forward<ExPolicy>(policy),
+                        first, last, std::forward<Compare>(comp),
+                        std::forward<Proj>(proj)));
+            }
+
+        private:
+            template <typename ExPolicy, typename Compare, typename Proj>
+            static RandomIt
+            sequential(std::true_type, ExPolicy& policy, RandomIt first,
+                RandomIt last, Compare && comp, Proj && proj)
+            {
+                if (std::size_t(last - first) < radix_sort_limit)
+                {
+                    return sequential(std::false_type(), policy, first, last,
+                        std::forward<Compare>(comp), std::forward<Proj>(proj));
+                }
+
+                radix_sort_no_values values;
+                radix_sort(policy, first, last, values);
+                return last;
+            }
+
+            template <typename ExPolicy, typename Compare, typename Proj>
+            static RandomIt
+            sequential(std::false_type, ExPolicy&, RandomIt first,
+                RandomIt last, Compare && comp, Proj && proj)
+            {
+                std::sort(first, last,
+                    util::compare_projected<Compare, Proj>(
                             std::forward<Compare>(comp),
                             std::forward<Proj>(proj)
-                        )));
+                        ));
+                return last;
+            }
+
+            template <typename ExPolicy, typename Compare, typename Proj>
+            static hpx::future<RandomIt>
+            parallel_async(std::true_type, ExPolicy && policy, RandomIt first,
+                RandomIt last, Compare &&, Proj &&)
+            {
+                return parallel_radix_sort_async(
+                    std::forward<ExPolicy>(policy), first, last);
+            }
+
+            template <typename ExPolicy, typename Compare, typename Proj>
+            static hpx::future<RandomIt>
+            parallel_async(std::false_type, ExPolicy && policy, RandomIt first,
+                RandomIt last, Compare && comp, Proj && proj)
+            {
+                return parallel_sort_async(std::forward<ExPolicy>(policy),
+                    first, last,
+                    util::compare_projected<Compare, Proj>(
+                        std::forward<Compare>(comp),
+                        std::forward<Proj>(proj)
+                    ));
             }
         };
         /// \endcond
@@ -306,6 +463,12 @@ namespace hpx { namespace parallel { inline namespace v1
     ///
     /// \a comp has to induce a strict weak ordering on the values.
     ///
+    /// Ranges of arithmetic values which are compared using operator<()
+    /// (\a std::less) without any projection are sorted using a radix
+    /// sort. Otherwise the parallel version of this algorithm uses a sample
+    /// sort for large ranges of \a DefaultConstructible values and a
+    /// quicksort for all other cases.
+    ///
     /// The application of function objects in parallel algorithm
     /// invoked with an execution policy object of type
     /// \a sequenced_policy execute in sequential order in the
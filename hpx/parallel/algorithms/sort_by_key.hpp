@@ -8,14 +8,21 @@
 #define HPX_PARALLEL_ALGORITHM_SORT_BY_KEY_DEC_2015
 
 #include <hpx/config.hpp>
+#include <hpx/lcos/future.hpp>
+#include <hpx/util/decay.hpp>
 #include <hpx/util/tagged_pair.hpp>
 #include <hpx/util/tuple.hpp>
 
+#include <hpx/parallel/algorithms/detail/dispatch.hpp>
+#include <hpx/parallel/algorithms/detail/distribution_sort.hpp>
 #include <hpx/parallel/algorithms/sort.hpp>
 #include <hpx/parallel/tagspec.hpp>
+#include <hpx/parallel/util/detail/algorithm_result.hpp>
 #include <hpx/parallel/util/zip_iterator.hpp>
 
 #include <algorithm>
+#include <cstddef>
+#include <exception>
 #include <iterator>
 #include <type_traits>
 #include <utility>
@@ -36,6 +43,120 @@ namespace hpx { namespace parallel { inline namespace v1
                 return hpx::util::get<0>(std::forward<Tuple>(t));
             }
         };
+
+        // The radix sort is used for arithmetic keys compared using
+        // operator<(), the values are moved through an auxiliary buffer.
+        template <typename KeyIter, typename ValueIter, typename Compare>
+        struct use_radix_sort_by_key
+          : std::integral_constant<bool,
+                use_radix_sort<KeyIter, Compare>::value &&
+                hpx::traits::is_random_access_iterator<ValueIter>::value &&
+                std::is_default_constructible<
+                    typename std::iterator_traits<ValueIter>::value_type
+                >::value>
+        {};
+
+        ///////////////////////////////////////////////////////////////////////
+        template <typename KeyIter, typename ValueIter>
+        struct radix_sort_by_key
+          : public detail::algorithm<
+                radix_sort_by_key<KeyIter, ValueIter>,
+                hpx::util::zip_iterator<KeyIter, ValueIter> >
+        {
+            typedef hpx::util::zip_iterator<KeyIter, ValueIter> result_type;
+
+            radix_sort_by_key()
+              : radix_sort_by_key::algorithm("sort_by_key")
+            {}
+
+            template <typename ExPolicy>
+            static result_type
+            sequential(ExPolicy && policy, KeyIter first, KeyIter last,
+                ValueIter value_first)
+            {
+                std::size_t size = std::size_t(last - first);
+
+                radix_sort_values<ValueIter> values(value_first, size);
+                radix_sort(policy, first, last, values);
+
+                return hpx::util::make_zip_iterator(last, value_first + size);
+            }
+
+            template <typename ExPolicy>
+            static typename util::detail::algorithm_result<
+                ExPolicy, result_type
+            >::type
+            parallel(ExPolicy && policy, KeyIter first, KeyIter last,
+                ValueIter value_first)
+            {
+                typedef typename hpx::util::decay<ExPolicy>::type policy_type;
+
+                hpx::future<result_type> result;
+                try {
+                    std::size_t size = std::size_t(last - first);
+                    result_type result_last =
+                        hpx::util::make_zip_iterator(last, value_first + size);
+
+                    result = distribution_sort_async(policy, result_last,
+                        [first, last, value_first, size](policy_type& policy)
+                        {
+                            radix_sort_values<ValueIter> values(
+                                value_first, size);
+                            radix_sort(policy, first, last, values);
+                        });
+                }
+                catch (...) {
+                    result = detail::handle_exception<ExPolicy, result_type>::
+                        call(std::current_exception());
+                }
+
+                return util::detail::algorithm_result<
+                        ExPolicy, result_type
+                    >::get(std::move(result));
+            }
+        };
+
+        ///////////////////////////////////////////////////////////////////////
+        template <typename ExPolicy, typename KeyIter, typename ValueIter,
+            typename Compare>
+        typename util::detail::algorithm_result<
+            ExPolicy, hpx::util::zip_iterator<KeyIter, ValueIter>
+        >::type
+        sort_by_key(std::true_type, ExPolicy && policy, KeyIter key_first,
+            KeyIter key_last, ValueIter value_first, Compare && comp)
+        {
+            if (std::size_t(key_last - key_first) < radix_sort_limit)
+            {
+                return sort_by_key(std::false_type(),
+                    std::forward<ExPolicy>(policy), key_first, key_last,
+                    value_first, std::forward<Compare>(comp));
+            }
+
+            typedef execution::is_sequenced_execution_policy<ExPolicy> is_seq;
+
+            return radix_sort_by_key<KeyIter, ValueIter>().call(
+                std::forward<ExPolicy>(policy), is_seq(),
+                key_first, key_last, value_first);
+        }
+
+        template <typename ExPolicy, typename KeyIter, typename ValueIter,
+            typename Compare>
+        typename util::detail::algorithm_result<
+            ExPolicy, hpx::util::zip_iterator<KeyIter, ValueIter>
+        >::type
+        sort_by_key(std::false_type, ExPolicy && policy, KeyIter key_first,
+            KeyIter key_last, ValueIter value_first, Compare && comp)
+        {
+            ValueIter value_last = value_first;
+            std::advance(value_last, std::distance(key_first, key_last));
+
+            return hpx::parallel::sort(
+                std::forward<ExPolicy>(policy),
+                hpx::util::make_zip_iterator(key_first, value_first),
+                hpx::util::make_zip_iterator(key_last, value_last),
+                std::forward<Compare>(comp),
+                detail::extract_key());
+        }
         /// \endcond
     }
 
@@ -90,6 +211,12 @@ namespace hpx { namespace parallel { inline namespace v1
     ///
     /// \a comp has to induce a strict weak ordering on the values.
     ///
+    /// Arithmetic keys which are compared using operator<() (\a std::less)
+    /// are sorted using a radix sort, which moves the values through an
+    /// auxiliary buffer. This requires the value type to be
+    /// \a DefaultConstructible, otherwise the keys are sorted as \a sort
+    /// would do.
+    ///
     /// The application of function objects in parallel algorithm
     /// invoked with an execution policy object of type
     /// \a sequenced_policy execute in sequential order in the
@@ -140,16 +267,13 @@ namespace hpx { namespace parallel { inline namespace v1
             (hpx::traits::is_random_access_iterator<ValueIter>::value),
             "Requires a random access iterator.");
 
-        ValueIter value_last = value_first;
-        std::advance(value_last, std::distance(key_first, key_last));
+        typedef detail::use_radix_sort_by_key<KeyIter, ValueIter, Compare>
+            use_radix;
 
         return detail::get_iter_tagged_pair<tag::in1, tag::in2>(
-            hpx::parallel::sort(
-                std::forward<ExPolicy>(policy),
-                hpx::util::make_zip_iterator(key_first, value_first),
-                hpx::util::make_zip_iterator(key_last, value_last),
-                std::forward<Compare>(comp),
-                detail::extract_key()));
+            detail::sort_by_key(use_radix(), std::forward<ExPolicy>(policy),
+                key_first, key_last, value_first,
+                std::forward<Compare>(comp)));
 #endif
     }
 }}}
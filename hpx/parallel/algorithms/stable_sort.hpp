@@ -0,0 +1,400 @@
+//  Copyright (c) 2026 agent
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file parallel/algorithms/stable_sort.hpp
+
+#if !defined(HPX_PARALLEL_ALGORITHMS_STABLE_SORT_HPP)
+#define HPX_PARALLEL_ALGORITHMS_STABLE_SORT_HPP
+
+#include <hpx/config.hpp>
+#include <hpx/dataflow.hpp>
+#include <hpx/lcos/future.hpp>
+#include <hpx/traits/concepts.hpp>
+#include <hpx/traits/is_iterator.hpp>
+#include <hpx/util/decay.hpp>
+
+#include <hpx/parallel/algorithms/detail/dispatch.hpp>
+#include <hpx/parallel/algorithms/detail/predicates.hpp>
+#include <hpx/parallel/algorithms/merge.hpp>
+#include <hpx/parallel/algorithms/sort.hpp>
+#include <hpx/parallel/exception_list.hpp>
+#include <hpx/parallel/execution_policy.hpp>
+#include <hpx/parallel/executors/execution.hpp>
+#include <hpx/parallel/traits/projected.hpp>
+#include <hpx/parallel/util/compare_projected.hpp>
+#include <hpx/parallel/util/detail/algorithm_result.hpp>
+#include <hpx/parallel/util/projection_identity.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <exception>
+#include <iterator>
+#include <memory>
+#include <type_traits>
+#include <utility>
+
+namespace hpx { namespace parallel { inline namespace v1
+{
+    ///////////////////////////////////////////////////////////////////////////
+    // stable_sort
+    namespace detail
+    {
+        /// \cond NOINTERNAL
+
+        //------------------------------------------------------------------------
+        //  function : stable_sort_thread
+        /// \brief Sort the range [first, last) by recursively sorting both
+        ///        halves and merging them concurrently. The sorted sequence
+        ///        ends up in the range itself or (if \a to_buffer is true) in
+        ///        the auxiliary buffer starting at \a buffer. Both halves are
+        ///        sorted into the respective other storage, this way every
+        ///        merge step moves the elements exactly once and the
+        ///        auxiliary buffer never needs to be larger than the input.
+        //------------------------------------------------------------------------
+        template <typename ExPolicy, typename RandomIt, typename BufferIt,
+            typename Compare>
+        hpx::future<void> stable_sort_thread(ExPolicy policy,
+            RandomIt first, RandomIt last, BufferIt buffer, bool to_buffer,
+            Compare comp)
+        {
+            std::size_t size = std::size_t(last - first);
+            if (size <= sort_limit_per_task)
+            {
+                return execution::async_execute(
+                    policy.executor(),
+                    [first, last, buffer, to_buffer, comp]()
+                    {
+                        std::stable_sort(first, last, comp);
+                        if (to_buffer)
+                            std::move(first, last, buffer);
+                    });
+            }
+
+            std::size_t mid_point = size / 2;
+            RandomIt mid = first + mid_point;
+
+            // spawn tasks for each sub section
+            hpx::future<void> left =
+                execution::async_execute(
+                    policy.executor(),
+                    &stable_sort_thread<ExPolicy, RandomIt, BufferIt, Compare>,
+                    policy, first, mid, buffer, !to_buffer, comp);
+
+            hpx::future<void> right =
+                execution::async_execute(
+                    policy.executor(),
+                    &stable_sort_thread<ExPolicy, RandomIt, BufferIt, Compare>,
+                    policy, mid, last, buffer + mid_point, !to_buffer, comp);
+
+            return hpx::dataflow(
+                policy.executor(),
+                [=](hpx::future<void> && left, hpx::future<void> && right)
+                ->  hpx::future<void>
+                {
+                    handle_merge_exceptions<ExPolicy>(left, right);
+
+                    // the sorted halves are located in the opposite storage
+                    if (to_buffer)
+                    {
+                        return parallel_merge_helper(policy,
+                            first, mid, mid, last, buffer, comp,
+                            move_merge());
+                    }
+
+                    BufferIt buffer_mid = buffer + mid_point;
+                    return parallel_merge_helper(policy,
+                        buffer, buffer_mid, buffer_mid, buffer + size, first,
+                        comp, move_merge());
+                },
+                std::move(left), std::move(right));
+        }
+
+        //------------------------------------------------------------------------
+        //  function : stable_sort_bounded
+        /// \brief Sort the range [first, last) using an auxiliary buffer
+        ///        which may be smaller than the range. Ranges fitting into
+        ///        the buffer are sorted by \a stable_sort_thread, larger ones
+        ///        are split in half and the sorted halves are merged in place
+        ///        by \a parallel_rotate_merge. The halves share the buffer,
+        ///        so they are sorted one after the other. Without a buffer
+        ///        both halves are sorted concurrently.
+        //------------------------------------------------------------------------
+        template <typename ExPolicy, typename RandomIt, typename Buffer,
+            typename Compare>
+        hpx::future<void> stable_sort_bounded(ExPolicy policy,
+            RandomIt first, RandomIt last,
+            std::shared_ptr<Buffer> const& buffer, Compare comp)
+        {
+            typedef typename Buffer::value_type value_type;
+
+            std::size_t size = std::size_t(last - first);
+            if (size <= sort_limit_per_task)
+            {
+                return execution::async_execute(
+                    policy.executor(),
+                    [first, last, comp]()
+                    {
+                        std::stable_sort(first, last, comp);
+                    });
+            }
+
+            if (buffer && size <= buffer->size())
+            {
+                // the elements are moved into the buffer and sorted back
+                // into the original sequence
+                value_type* data = buffer->assign(first, last);
+                return stable_sort_thread(policy, data, data + size, first,
+                    true, comp);
+            }
+
+            RandomIt mid = first + size / 2;
+
+            hpx::future<void> halves;
+            if (buffer)
+            {
+                halves = hpx::dataflow(
+                    policy.executor(),
+                    [=](hpx::future<void> && left) -> hpx::future<void>
+                    {
+                        left.get();
+                        return stable_sort_bounded(policy, mid, last, buffer,
+                            comp);
+                    },
+                    stable_sort_bounded(policy, first, mid, buffer, comp));
+            }
+            else
+            {
+                typedef hpx::future<void> (*sort_type)(ExPolicy, RandomIt,
+                    RandomIt, std::shared_ptr<Buffer> const&, Compare);
+                sort_type sort = &stable_sort_bounded<
+                    ExPolicy, RandomIt, Buffer, Compare>;
+
+                // spawn tasks for each sub section
+                halves = hpx::dataflow(
+                    policy.executor(),
+                    [](hpx::future<void> && left, hpx::future<void> && right)
+                    {
+                        handle_merge_exceptions<ExPolicy>(left, right);
+                    },
+                    execution::async_execute(policy.executor(), sort,
+                        policy, first, mid, buffer, comp),
+                    execution::async_execute(policy.executor(), sort,
+                        policy, mid, last, buffer, comp));
+            }
+
+            return hpx::dataflow(
+                policy.executor(),
+                [=](hpx::future<void> && halves) -> hpx::future<void>
+                {
+                    halves.get();
+                    return parallel_rotate_merge(policy, first, mid, last,
+                        comp);
+                },
+                std::move(halves));
+        }
+
+        //------------------------------------------------------------------------
+        //  function : parallel_stable_sort_async
+        //------------------------------------------------------------------------
+        template <typename ExPolicy, typename RandomIt, typename Compare>
+        hpx::future<RandomIt>
+        parallel_stable_sort_async(ExPolicy && policy, RandomIt first,
+            RandomIt last, Compare comp)
+        {
+            typedef typename hpx::util::decay<ExPolicy>::type policy_type;
+            typedef typename std::iterator_traits<RandomIt>::value_type
+                value_type;
+
+            hpx::future<RandomIt> result;
+            try {
+                std::ptrdiff_t N = last - first;
+                HPX_ASSERT(N >= 0);
+
+                if (std::size_t(N) <= sort_limit_per_task)
+                {
+                    std::stable_sort(first, last, comp);
+                    return hpx::make_ready_future(last);
+                }
+
+                // a single auxiliary buffer is used for all merge steps, it
+                // is capped at max_auxiliary_buffer_bytes, longer sequences
+                // are sorted in parts which are merged in place
+                typedef auxiliary_buffer<value_type> buffer_type;
+                std::shared_ptr<buffer_type> buffer =
+                    buffer_type::create(std::size_t(N));
+
+                hpx::future<void> sorted = stable_sort_bounded(
+                    policy_type(policy), first, last, buffer, comp);
+
+                result = sorted.then(
+                    [buffer, last](hpx::future<void> && f) -> RandomIt
+                    {
+                        // keep the auxiliary buffer alive until all merge
+                        // steps have finished
+                        f.get();
+                        return last;
+                    });
+            }
+            catch (...) {
+                return detail::handle_exception<ExPolicy, RandomIt>::call(
+                    std::current_exception());
+            }
+
+            if (result.has_exception())
+            {
+                return detail::handle_exception<ExPolicy, RandomIt>::call(
+                    std::move(result));
+            }
+
+            return result;
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        // stable_sort
+        template <typename RandomIt>
+        struct stable_sort
+          : public detail::algorithm<stable_sort<RandomIt>, RandomIt>
+        {
+            stable_sort()
+              : stable_sort::algorithm("stable_sort")
+            {}
+
+            template <typename ExPolicy, typename Compare, typename Proj>
+            static RandomIt
+            sequential(ExPolicy, RandomIt first, RandomIt last,
+                Compare && comp, Proj && proj)
+            {
+                std::stable_sort(first, last,
+                    util::compare_projected<Compare, Proj>(
+                            std::forward<Compare>(comp),
+                            std::forward<Proj>(proj)
+                        ));
+                return last;
+            }
+
+            template <typename ExPolicy, typename Compare, typename Proj>
+            static typename util::detail::algorithm_result<
+                ExPolicy, RandomIt
+            >::type
+            parallel(ExPolicy && policy, RandomIt first, RandomIt last,
+                Compare && comp, Proj && proj)
+            {
+                // call the sort routine and return the right type,
+                // depending on execution policy
+                return util::detail::algorithm_result<ExPolicy, RandomIt>::get(
+                    parallel_stable_sort_async(std::forward<ExPolicy>(policy),
+                        first, last,
+                        util::compare_projected<Compare, Proj>(
+                            std::forward<Compare>(comp),
+                            std::forward<Proj>(proj)
+                        )));
+            }
+        };
+        /// \endcond
+    }
+
+    //-----------------------------------------------------------------------------
+    /// Sorts the elements in the range [first, last) in ascending order. The
+    /// order of equal elements is guaranteed to be preserved. The function
+    /// uses the given comparison function object comp (defaults to using
+    /// operator<()).
+    ///
+    /// \note   Complexity: O(Nlog(N)), where N = std::distance(first, last)
+    ///                     comparisons.
+    ///
+    /// A sequence is sorted with respect to a comparator \a comp and a
+    /// projection \a proj if for every iterator i pointing to the sequence and
+    /// every non-negative integer n such that i + n is a valid iterator
+    /// pointing to an element of the sequence, and
+    /// INVOKE(comp, INVOKE(proj, *(i + n)), INVOKE(proj, *i)) == false.
+    ///
+    /// \tparam ExPolicy    The type of the execution policy to use (deduced).
+    ///                     It describes the manner in which the execution
+    ///                     of the algorithm may be parallelized and the manner
+    ///                     in which it applies user-provided function objects.
+    /// \tparam Iter        The type of the source iterators used (deduced).
+    ///                     This iterator type must meet the requirements of a
+    ///                     random access iterator.
+    /// \tparam Comp        The type of the function/function object to use
+    ///                     (deduced).
+    /// \tparam Proj        The type of an optional projection function. This
+    ///                     defaults to \a util::projection_identity
+    ///
+    /// \param policy       The execution policy to use for the scheduling of
+    ///                     the iterations.
+    /// \param first        Refers to the beginning of the sequence of elements
+    ///                     the algorithm will be applied to.
+    /// \param last         Refers to the end of the sequence of elements the
+    ///                     algorithm will be applied to.
+    /// \param comp         comp is a callable object. The return value of the
+    ///                     INVOKE operation applied to an object of type Comp,
+    ///                     when contextually converted to bool, yields true if
+    ///                     the first argument of the call is less than the
+    ///                     second, and false otherwise. It is assumed that comp
+    ///                     will not apply any non-constant function through the
+    ///                     dereferenced iterator.
+    /// \param proj         Specifies the function (or function object) which
+    ///                     will be invoked for each pair of elements as a
+    ///                     projection operation before the actual predicate
+    ///                     \a comp is invoked.
+    ///
+    /// \a comp has to induce a strict weak ordering on the values.
+    ///
+    /// The parallel version of this algorithm is a merge sort which uses a
+    /// single auxiliary buffer of std::distance(first, last) elements for all
+    /// of its (concurrently executed) merge steps. The elements of the buffer
+    /// are move constructed from the input sequence. The buffer is limited to
+    /// 1 GiB, longer sequences are sorted in parts fitting into the buffer
+    /// which are then merged in place (in parallel as well).
+    ///
+    /// The application of function objects in parallel algorithm
+    /// invoked with an execution policy object of type
+    /// \a sequenced_policy execute in sequential order in the
+    /// calling thread.
+    ///
+    /// The application of function objects in parallel algorithm
+    /// invoked with an execution policy object of type
+    /// \a parallel_policy or \a parallel_task_policy are
+    /// permitted to execute in an unordered fashion in unspecified
+    /// threads, and indeterminately sequenced within each thread.
+    ///
+    /// \returns  The \a stable_sort algorithm returns a
+    ///           \a hpx::future<RandomIt> if the execution policy is of
+    ///           type
+    ///           \a sequenced_task_policy or
+    ///           \a parallel_task_policy and returns \a RandomIt
+    ///           otherwise.
+    ///           The algorithm returns an iterator pointing to the first
+    ///           element after the last element in the input sequence.
+    //-----------------------------------------------------------------------------
+    template <typename ExPolicy, typename RandomIt,
+        typename Proj = util::projection_identity,
+        typename Compare = detail::less,
+    HPX_CONCEPT_REQUIRES_(
+        execution::is_execution_policy<ExPolicy>::value &&
+        hpx::traits::is_iterator<RandomIt>::value &&
+        traits::is_projected<Proj, RandomIt>::value &&
+        traits::is_indirect_callable<
+            ExPolicy, Compare,
+                traits::projected<Proj, RandomIt>,
+                traits::projected<Proj, RandomIt>
+        >::value)>
+    typename util::detail::algorithm_result<ExPolicy, RandomIt>::type
+    stable_sort(ExPolicy && policy, RandomIt first, RandomIt last,
+        Compare && comp = Compare(), Proj && proj = Proj())
+    {
+        static_assert(
+            (hpx::traits::is_random_access_iterator<RandomIt>::value),
+            "Requires a random access iterator.");
+
+        typedef execution::is_sequenced_execution_policy<ExPolicy> is_seq;
+
+        return detail::stable_sort<RandomIt>().call(
+            std::forward<ExPolicy>(policy), is_seq(), first, last,
+            std::forward<Compare>(comp), std::forward<Proj>(proj));
+    }
+}}}
+
+#endif
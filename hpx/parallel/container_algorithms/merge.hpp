@@ -0,0 +1,189 @@
+//  Copyright (c) 2026 agent
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file parallel/container_algorithms/merge.hpp
+
+#if !defined(HPX_PARALLEL_CONTAINER_ALGORITHMS_MERGE_HPP)
+#define HPX_PARALLEL_CONTAINER_ALGORITHMS_MERGE_HPP
+
+#include <hpx/config.hpp>
+#include <hpx/traits/concepts.hpp>
+#include <hpx/traits/is_iterator.hpp>
+#include <hpx/traits/is_range.hpp>
+#include <hpx/util/range.hpp>
+
+#include <hpx/parallel/algorithms/merge.hpp>
+#include <hpx/parallel/traits/projected_range.hpp>
+#include <hpx/parallel/util/projection_identity.hpp>
+
+#include <type_traits>
+#include <utility>
+
+namespace hpx { namespace parallel { inline namespace v1
+{
+    /// Merges two sorted ranges \a rng1 and \a rng2 into one sorted range
+    /// beginning at \a dest. The order of equivalent elements is preserved,
+    /// for equivalent elements in both input ranges the elements from
+    /// \a rng1 precede the elements from \a rng2. This algorithm expects
+    /// both input ranges to be sorted with the given binary predicate \a op.
+    ///
+    /// \note   Complexity: At most (N1 + N2 - 1) comparisons, where \a N1 is
+    ///         the length of the first sequence and \a N2 is the length of the
+    ///         second sequence.
+    ///
+    /// The resulting range cannot overlap with either of the input ranges.
+    ///
+    /// \tparam ExPolicy    The type of the execution policy to use (deduced).
+    ///                     It describes the manner in which the execution
+    ///                     of the algorithm may be parallelized and the manner
+    ///                     in which it applies user-provided function objects.
+    /// \tparam Rng1        The type of the first source range used (deduced).
+    ///                     The iterators extracted from this range type must
+    ///                     meet the requirements of a forward iterator.
+    /// \tparam Rng2        The type of the second source range used (deduced).
+    ///                     The iterators extracted from this range type must
+    ///                     meet the requirements of a forward iterator.
+    /// \tparam OutIter     The type of the iterator representing the
+    ///                     destination range (deduced).
+    ///                     This iterator type must meet the requirements of an
+    ///                     output iterator.
+    /// \tparam Pred        The type of an optional function/function object to
+    ///                     use. This defaults to std::less<>
+    ///
+    /// \param policy       The execution policy to use for the scheduling of
+    ///                     the iterations.
+    /// \param rng1         Refers to the first sorted sequence of elements the
+    ///                     algorithm will be applied to.
+    /// \param rng2         Refers to the second sorted sequence of elements
+    ///                     the algorithm will be applied to.
+    /// \param dest         Refers to the beginning of the destination range.
+    /// \param op           The binary predicate which returns true if the
+    ///                     first argument is less than the second.
+    ///
+    /// The application of function objects in parallel algorithm
+    /// invoked with a sequential execution policy object execute in sequential
+    /// order in the calling thread (\a sequenced_policy) or in a
+    /// single new thread spawned from the current thread
+    /// (for \a sequenced_task_policy).
+    ///
+    /// The application of function objects in parallel algorithm
+    /// invoked with an execution policy object of type
+    /// \a parallel_policy or \a parallel_task_policy are
+    /// permitted to execute in an unordered fashion in unspecified
+    /// threads, and indeterminately sequenced within each thread.
+    ///
+    /// \returns  The \a merge algorithm returns a \a hpx::future<OutIter>
+    ///           if the execution policy is of type
+    ///           \a sequenced_task_policy or
+    ///           \a parallel_task_policy and
+    ///           returns \a OutIter otherwise.
+    ///           The \a merge algorithm returns the output iterator to the
+    ///           element in the destination range, one past the last element
+    ///           copied.
+    template <typename ExPolicy, typename Rng1, typename Rng2,
+        typename OutIter, typename Pred = detail::less,
+    HPX_CONCEPT_REQUIRES_(
+        execution::is_execution_policy<ExPolicy>::value &&
+        hpx::traits::is_range<Rng1>::value &&
+        hpx::traits::is_range<Rng2>::value &&
+        hpx::traits::is_iterator<OutIter>::value)>
+    typename util::detail::algorithm_result<ExPolicy, OutIter>::type
+    merge(ExPolicy && policy, Rng1 && rng1, Rng2 && rng2, OutIter dest,
+        Pred && op = Pred())
+    {
+        return merge(std::forward<ExPolicy>(policy),
+            hpx::util::begin(rng1), hpx::util::end(rng1),
+            hpx::util::begin(rng2), hpx::util::end(rng2), dest,
+            std::forward<Pred>(op));
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// Merges two consecutive sorted ranges [begin(rng), middle) and
+    /// [middle, end(rng)) into one sorted range. The order of equivalent
+    /// elements is preserved, for equivalent elements in both input ranges
+    /// the elements from the first range precede the elements from the
+    /// second range.
+    ///
+    /// \note   Complexity: Exactly N-1 comparisons if enough additional memory
+    ///             is available, O(Nlog(N)) otherwise, where
+    ///             N = std::distance(begin(rng), end(rng)).
+    ///
+    /// \tparam ExPolicy    The type of the execution policy to use (deduced).
+    ///                     It describes the manner in which the execution
+    ///                     of the algorithm may be parallelized and the manner
+    ///                     in which it applies user-provided function objects.
+    /// \tparam Rng         The type of the source range used (deduced).
+    ///                     The iterators extracted from this range type must
+    ///                     meet the requirements of a random access iterator.
+    /// \tparam Comp        The type of the function/function object to use
+    ///                     (deduced).
+    /// \tparam Proj        The type of an optional projection function. This
+    ///                     defaults to \a util::projection_identity
+    ///
+    /// \param policy       The execution policy to use for the scheduling of
+    ///                     the iterations.
+    /// \param rng          Refers to the sequence of elements the algorithm
+    ///                     will be applied to.
+    /// \param middle       Refers to the end of the first sorted range and the
+    ///                     beginning of the second sorted range the algorithm
+    ///                     will be applied to.
+    /// \param comp         comp is a callable object. The return value of the
+    ///                     INVOKE operation applied to an object of type Comp,
+    ///                     when contextually converted to bool, yields true if
+    ///                     the first argument of the call is less than the
+    ///                     second, and false otherwise. It is assumed that comp
+    ///                     will not apply any non-constant function through the
+    ///                     dereferenced iterator.
+    /// \param proj         Specifies the function (or function object) which
+    ///                     will be invoked for each pair of elements as a
+    ///                     projection operation before the actual predicate
+    ///                     \a comp is invoked.
+    ///
+    /// \a comp has to induce a strict weak ordering on the values.
+    ///
+    /// The application of function objects in parallel algorithm
+    /// invoked with an execution policy object of type
+    /// \a sequenced_policy execute in sequential order in the
+    /// calling thread.
+    ///
+    /// The application of function objects in parallel algorithm
+    /// invoked with an execution policy object of type
+    /// \a parallel_policy or \a parallel_task_policy are
+    /// permitted to execute in an unordered fashion in unspecified
+    /// threads, and indeterminately sequenced within each thread.
+    ///
+    /// \returns  The \a inplace_merge algorithm returns a
+    ///           \a hpx::future<Iter> if the execution policy is of
+    ///           type
+    ///           \a sequenced_task_policy or
+    ///           \a parallel_task_policy and returns \a Iter
+    ///           otherwise.
+    ///           It returns \a last.
+    template <typename ExPolicy, typename Rng,
+        typename Proj = util::projection_identity,
+        typename Compare = detail::less,
+    HPX_CONCEPT_REQUIRES_(
+        execution::is_execution_policy<ExPolicy>::value &&
+        hpx::traits::is_range<Rng>::value &&
+        traits::is_projected_range<Proj, Rng>::value &&
+        traits::is_indirect_callable<
+            ExPolicy, Compare,
+                traits::projected_range<Proj, Rng>,
+                traits::projected_range<Proj, Rng>
+        >::value)>
+    typename util::detail::algorithm_result<
+        ExPolicy, typename hpx::traits::range_iterator<Rng>::type
+    >::type
+    inplace_merge(ExPolicy && policy, Rng && rng,
+        typename hpx::traits::range_iterator<Rng>::type middle,
+        Compare && comp = Compare(), Proj && proj = Proj())
+    {
+        return inplace_merge(std::forward<ExPolicy>(policy),
+            hpx::util::begin(rng), middle, hpx::util::end(rng),
+            std::forward<Compare>(comp), std::forward<Proj>(proj));
+    }
+}}}
+
+#endif
@@ -0,0 +1,442 @@
+//  Copyright (c) 2026 agent
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file parallel/executors/adaptive_chunk_size.hpp
+
+#if !defined(HPX_PARALLEL_EXECUTORS_ADAPTIVE_CHUNK_SIZE_HPP)
+#define HPX_PARALLEL_EXECUTORS_ADAPTIVE_CHUNK_SIZE_HPP
+
+#include <hpx/config.hpp>
+#include <hpx/lcos/local/spinlock.hpp>
+#include <hpx/runtime/serialization/serialize.hpp>
+#include <hpx/traits/is_executor_parameters.hpp>
+#include <hpx/util/decay.hpp>
+#include <hpx/util/demangle_helper.hpp>
+#include <hpx/util/high_resolution_clock.hpp>
+#include <hpx/util/steady_clock.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <typeindex>
+#include <typeinfo>
+#include <vector>
+
+namespace hpx { namespace parallel { inline namespace v3
+{
+    ///////////////////////////////////////////////////////////////////////////
+    /// The information \a adaptive_chunk_size has learned about a single call
+    /// site (a parallel algorithm invoked with a particular function object).
+    struct adaptive_chunk_size_statistics
+    {
+        /// The (implementation specific) name identifying the call site
+        std::string name_;
+
+        /// The number of invocations seen for this call site
+        std::uint64_t invocations_;
+
+        /// The number of invocations for which the execution time of a
+        /// single loop iteration was measured
+        std::uint64_t samples_;
+
+        /// The (averaged) execution time of a single loop iteration in
+        /// nanoseconds
+        double element_time_;
+
+        /// The (averaged) fraction of the available core time which was not
+        /// spent executing loop iterations while the algorithm was running
+        double idle_rate_;
+
+        /// The factor applied to the target chunk execution time
+        double scale_;
+
+        /// The chunk size returned for the most recent invocation
+        std::size_t chunk_size_;
+    };
+
+    /// \cond NOINTERNAL
+    namespace detail
+    {
+        ///////////////////////////////////////////////////////////////////////
+        // everything learned about one call site
+        struct adaptive_chunk_size_site
+        {
+            typedef hpx::lcos::local::spinlock mutex_type;
+
+            explicit adaptive_chunk_size_site(char const* name)
+              : name_(name), invocations_(0), samples_(0),
+                element_time_(0.), idle_rate_(-1.), scale_(1.),
+                direction_(1.), chunk_size_(0), force_sample_(true)
+            {}
+
+            adaptive_chunk_size_statistics get_statistics() const
+            {
+                std::lock_guard<mutex_type> l(mtx_);
+                adaptive_chunk_size_statistics s = {
+                    name_, invocations_, samples_, element_time_,
+                    (std::max)(idle_rate_, 0.), scale_, chunk_size_
+                };
+                return s;
+            }
+
+            mutable mutex_type mtx_;
+            std::string name_;
+            std::uint64_t invocations_;
+            std::uint64_t samples_;
+            double element_time_;       // nanoseconds per element
+            double idle_rate_;          // negative if not measured yet
+            double scale_;              // applied to the target time
+            double direction_;          // current direction of scale_ changes
+            std::size_t chunk_size_;
+            bool force_sample_;
+        };
+
+        ///////////////////////////////////////////////////////////////////////
+        // the call sites are shared by all adaptive_chunk_size instances
+        class adaptive_chunk_size_sites
+        {
+            typedef hpx::lcos::local::spinlock mutex_type;
+
+        public:
+            template <typename F>
+            adaptive_chunk_size_site& get_site()
+            {
+                std::type_index const key(typeid(F));
+
+                std::lock_guard<mutex_type> l(mtx_);
+                auto it = sites_.find(key);
+                if (it == sites_.end())
+                {
+                    it = sites_.insert(std::make_pair(key,
+                        std::make_shared<adaptive_chunk_size_site>(
+                            hpx::util::type_id<F>::typeid_.type_id()))).first;
+                }
+                return *it->second;
+            }
+
+            std::vector<adaptive_chunk_size_statistics> get_statistics() const
+            {
+                std::vector<adaptive_chunk_size_statistics> result;
+
+                std::lock_guard<mutex_type> l(mtx_);
+                result.reserve(sites_.size());
+                for (auto const& site : sites_)
+                    result.push_back(site.second->get_statistics());
+                return result;
+            }
+
+            // sites are never removed, algorithms might currently refer to
+            // them
+            void reset()
+            {
+                std::lock_guard<mutex_type> l(mtx_);
+                for (auto& site : sites_)
+                {
+                    adaptive_chunk_size_site& s = *site.second;
+
+                    std::lock_guard<mutex_type> ls(s.mtx_);
+                    s.invocations_ = 0;
+                    s.samples_ = 0;
+                    s.element_time_ = 0.;
+                    s.idle_rate_ = -1.;
+                    s.scale_ = 1.;
+                    s.direction_ = 1.;
+                    s.chunk_size_ = 0;
+                    s.force_sample_ = true;
+                }
+            }
+
+            static adaptive_chunk_size_sites& get()
+            {
+                static adaptive_chunk_size_sites sites;
+                return sites;
+            }
+
+        private:
+            mutable mutex_type mtx_;
+            std::map<
+                    std::type_index, std::shared_ptr<adaptive_chunk_size_site>
+                > sites_;
+        };
+
+        ///////////////////////////////////////////////////////////////////////
+        // The invocation currently measured, this is shared between all
+        // copies of an adaptive_chunk_size object (the algorithms copy the
+        // parameters object before calling mark_begin_execution).
+        struct adaptive_chunk_size_invocation
+        {
+            typedef hpx::lcos::local::spinlock mutex_type;
+
+            adaptive_chunk_size_invocation()
+              : active_(0), contended_(false), site_(nullptr),
+                start_(0), count_(0), cores_(0), chunk_size_(0)
+            {}
+
+            mutex_type mtx_;
+            std::size_t active_;        // number of running invocations
+            bool contended_;            // more than one invocation was running
+            adaptive_chunk_size_site* site_;
+            std::uint64_t start_;
+            std::size_t count_;
+            std::size_t cores_;
+            std::size_t chunk_size_;
+        };
+    }
+    /// \endcond
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// Loop iterations are divided into pieces and then assigned to threads.
+    /// The number of loop iterations combined is determined such that each
+    /// chunk runs for the specified amount of time. The execution time of a
+    /// single loop iteration is learned separately for each call site (each
+    /// combination of algorithm and function object type) from previous
+    /// invocations, and is re-measured periodically only.
+    ///
+    /// For each invocation the overall execution time is compared with the
+    /// time the loop iterations should have taken if all cores had been busy.
+    /// The resulting idle rate is fed back to adjust the chunk execution time
+    /// targeted for this call site until the idle rate stops improving.
+    ///
+    /// The learned information is shared by all instances of this type, it
+    /// can be inspected using \a get_statistics.
+    ///
+    struct adaptive_chunk_size : executor_parameters_tag
+    {
+    public:
+        /// Construct an \a adaptive_chunk_size executor parameters object
+        ///
+        /// \note Default constructed \a adaptive_chunk_size executor parameter
+        ///       types will target 80 microseconds as the execution time of
+        ///       each of the scheduled chunks and will re-measure the
+        ///       execution time of loop iterations for every 16th invocation.
+        ///
+        adaptive_chunk_size()
+          : invocation_(std::make_shared<detail::adaptive_chunk_size_invocation>()),
+            target_time_(80000), sample_interval_(16)
+        {}
+
+        /// Construct an \a adaptive_chunk_size executor parameters object
+        ///
+        /// \param rel_time     [in] The execution time each of the scheduled
+        ///                     chunks should approximately run for.
+        /// \param interval     [in] The number of invocations of a call site
+        ///                     after which the execution time of loop
+        ///                     iterations is re-measured.
+        ///
+        explicit adaptive_chunk_size(hpx::util::steady_duration const& rel_time,
+                std::size_t interval = 16)
+          : invocation_(std::make_shared<detail::adaptive_chunk_size_invocation>()),
+            target_time_(rel_time.value().count()),
+            sample_interval_(interval == 0 ? 1 : interval)
+        {}
+
+        /// Return the information learned so far for all call sites
+        static std::vector<adaptive_chunk_size_statistics> get_statistics()
+        {
+            return detail::adaptive_chunk_size_sites::get().get_statistics();
+        }
+
+        /// Forget everything learned so far
+        static void reset()
+        {
+            detail::adaptive_chunk_size_sites::get().reset();
+        }
+
+        /// \cond NOINTERNAL
+        template <typename Executor, typename F>
+        std::size_t get_chunk_size(Executor && exec, F && f, std::size_t cores,
+            std::size_t count)
+        {
+            typedef typename hpx::util::decay<F>::type site_type;
+
+            detail::adaptive_chunk_size_site& site =
+                detail::adaptive_chunk_size_sites::get().get_site<site_type>();
+
+            bool sample = false;
+            {
+                std::lock_guard<mutex_type> l(site.mtx_);
+                sample = site.force_sample_ ||
+                    (site.invocations_ % sample_interval_) == 0;
+                ++site.invocations_;
+            }
+
+            using hpx::util::high_resolution_clock;
+
+            // measure the execution time of the first 1% of the iterations
+            std::size_t test_chunk_size = 0;
+            if (sample && count > 100*cores)
+            {
+                std::uint64_t t = high_resolution_clock::now();
+                test_chunk_size = f();
+                if (test_chunk_size != 0)
+                {
+                    t = high_resolution_clock::now() - t;
+                    add_sample(site, double(t) / test_chunk_size);
+                }
+            }
+
+            std::size_t const remaining = count - test_chunk_size;
+            std::size_t const even = (remaining + cores - 1) / cores;
+
+            std::size_t chunk_size = even;
+            {
+                std::lock_guard<mutex_type> l(site.mtx_);
+                if (site.element_time_ > 0.)
+                {
+                    double const target = site.scale_ * target_time_;
+                    chunk_size = std::size_t(target / site.element_time_);
+                    chunk_size = (std::max)(std::size_t(1),
+                        (std::min)(chunk_size, even));
+                }
+                site.chunk_size_ = chunk_size;
+            }
+
+            // remember what was decided for the invocation currently measured
+            {
+                std::lock_guard<mutex_type> l(invocation_->mtx_);
+                if (invocation_->active_ == 1 && invocation_->site_ == nullptr)
+                {
+                    invocation_->site_ = &site;
+                    invocation_->count_ = remaining;
+                    invocation_->cores_ = cores;
+                    invocation_->chunk_size_ = chunk_size;
+                    invocation_->start_ = high_resolution_clock::now();
+                }
+            }
+
+            return chunk_size;
+        }
+
+        void mark_begin_execution()
+        {
+            std::lock_guard<mutex_type> l(invocation_->mtx_);
+            if (invocation_->active_++ == 0)
+            {
+                invocation_->contended_ = false;
+                invocation_->site_ = nullptr;
+            }
+            else
+            {
+                invocation_->contended_ = true;
+            }
+        }
+
+        void mark_end_execution()
+        {
+            detail::adaptive_chunk_size_site* site = nullptr;
+            std::uint64_t elapsed = 0;
+            std::size_t count = 0, cores = 0, chunk_size = 0;
+
+            {
+                std::lock_guard<mutex_type> l(invocation_->mtx_);
+                HPX_ASSERT(invocation_->active_ != 0);
+                if (--invocation_->active_ != 0 || invocation_->contended_ ||
+                    invocation_->site_ == nullptr)
+                {
+                    return;
+                }
+
+                site = invocation_->site_;
+                elapsed = hpx::util::high_resolution_clock::now() -
+                    invocation_->start_;
+                count = invocation_->count_;
+                cores = invocation_->cores_;
+                chunk_size = invocation_->chunk_size_;
+                invocation_->site_ = nullptr;
+            }
+
+            if (count != 0 && elapsed != 0)
+                add_feedback(*site, elapsed, count, cores, chunk_size);
+        }
+        /// \endcond
+
+    private:
+        /// \cond NOINTERNAL
+        typedef hpx::lcos::local::spinlock mutex_type;
+
+        static void add_sample(detail::adaptive_chunk_size_site& site,
+            double element_time)
+        {
+            std::lock_guard<mutex_type> l(site.mtx_);
+            if (site.samples_++ == 0)
+                site.element_time_ = element_time;
+            else
+                site.element_time_ += 0.25 * (element_time - site.element_time_);
+            site.force_sample_ = false;
+        }
+
+        static void add_feedback(detail::adaptive_chunk_size_site& site,
+            std::uint64_t elapsed, std::size_t count, std::size_t cores,
+            std::size_t chunk_size)
+        {
+            std::size_t const chunks = (count + chunk_size - 1) / chunk_size;
+            std::size_t const used_cores = (std::min)(cores, chunks);
+
+            std::lock_guard<mutex_type> l(site.mtx_);
+
+            // nothing is known about the iterations (small loops are never
+            // sampled), the overall time is an upper bound
+            if (site.element_time_ <= 0.)
+            {
+                site.element_time_ = double(elapsed) * used_cores / count;
+                return;
+            }
+
+            double const busy = site.element_time_ * count;
+            double idle_rate = 1. - busy / (double(elapsed) * used_cores);
+            idle_rate = (std::max)(0., (std::min)(1., idle_rate));
+
+            if (site.idle_rate_ < 0.)
+            {
+                site.idle_rate_ = idle_rate;
+                return;
+            }
+
+            // keep changing the targeted chunk execution time in the same
+            // direction as long as the idle rate improves
+            double const previous = site.idle_rate_;
+            site.idle_rate_ += 0.25 * (idle_rate - site.idle_rate_);
+
+            if (site.idle_rate_ > previous)
+                site.direction_ = -site.direction_;
+
+            if (site.idle_rate_ > 0.05)
+            {
+                double const factor = site.direction_ > 0 ? 1.25 : 0.8;
+                site.scale_ = (std::max)(1. / 16,
+                    (std::min)(16., site.scale_ * factor));
+            }
+
+            // the loop iterations have most likely changed their behavior
+            if (idle_rate > 0.5)
+                site.force_sample_ = true;
+        }
+        /// \endcond
+
+    private:
+        /// \cond NOINTERNAL
+        friend class hpx::serialization::access;
+
+        template <typename Archive>
+        void serialize(Archive & ar, const unsigned int version)
+        {
+            ar & target_time_ & sample_interval_;
+        }
+        /// \endcond
+
+    private:
+        /// \cond NOINTERNAL
+        std::shared_ptr<detail::adaptive_chunk_size_invocation> invocation_;
+        std::uint64_t target_time_;         // nanoseconds
+        std::size_t sample_interval_;
+        /// \endcond
+    };
+}}}
+
+#endif
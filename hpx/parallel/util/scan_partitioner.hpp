@@ -14,6 +14,7 @@
 #include <hpx/runtime/launch_policy.hpp>
 #include <hpx/util/bind.hpp>
 #include <hpx/util/decay.hpp>
+#include <hpx/util/detail/yield_k.hpp>
 #include <hpx/util/unused.hpp>
 
 #include <hpx/parallel/execution_policy.hpp>
@@ -25,6 +26,9 @@
 #include <hpx/parallel/util/detail/handle_local_exceptions.hpp>
 #include <hpx/parallel/util/detail/scoped_executor_parameters.hpp>
 
+#include <boost/atomic.hpp>
+#include <boost/optional.hpp>
+
 #include <algorithm>
 #include <cstddef>
 #include <exception>
@@ -353,6 +357,413 @@ namespace hpx { namespace parallel { namespace util
         {};
     }
 
+    ///////////////////////////////////////////////////////////////////////////
+    namespace detail
+    {
+        ///////////////////////////////////////////////////////////////////////
+        // Partitions of a single pass scan are kept small enough for their
+        // elements to be still in the cache if a partition has to be
+        // traversed twice.
+        static const std::size_t single_pass_scan_partition_size = 16384ul;
+
+        // The descriptor each partition of a single pass scan publishes its
+        // results through.
+        template <typename T>
+        struct scan_partition_descriptor
+        {
+            enum { cache_line_size = 64 };
+
+            enum state
+            {
+                empty = 0,          // nothing is known about the partition
+                aggregate = 1,      // the reduction of the partition is known
+                prefix = 2,         // the inclusive prefix is known
+                failed = 3          // this or a preceding partition failed
+            };
+
+            scan_partition_descriptor()
+              : state_(empty)
+            {}
+
+            boost::atomic<int> state_;
+            boost::optional<T> aggregate_;
+            boost::optional<T> prefix_;
+            char pad_[cache_line_size];
+        };
+
+        ///////////////////////////////////////////////////////////////////////
+        // Single pass scan using decoupled look-back. The partitions are
+        // claimed in order by a fixed number of tasks. A partition whose
+        // predecessor has already published its inclusive prefix is scanned
+        // right away (f2). Otherwise it publishes its own reduction (f1)
+        // first and then looks back over the preceding partitions,
+        // combining their reductions until a published prefix is found.
+        // As every claimed partition publishes its reduction without waiting
+        // for anything, the look-back always terminates.
+        //
+        // f1(part_begin, part_size) -> T:  reduce a partition
+        // op(T, T) -> T:                   combine two results
+        // f2(part_begin, part_size, T, reduced) -> T:
+        //      final scan of a partition given its exclusive prefix, returns
+        //      the inclusive prefix; 'reduced' is true if f1 was invoked for
+        //      the partition before
+        template <typename FwdIter, typename T, typename F1, typename Op,
+            typename F2>
+        struct single_pass_scan
+        {
+            typedef scan_partition_descriptor<T> descriptor_type;
+
+            template <typename F1_, typename Op_, typename F2_>
+            single_pass_scan(FwdIter first, std::size_t count,
+                    std::size_t chunk_size, T const& init, F1_ && f1,
+                    Op_ && op, F2_ && f2)
+              : count_(count), chunk_size_(chunk_size),
+                num_partitions_((count + chunk_size - 1) / chunk_size),
+                descriptors_(new descriptor_type[num_partitions_]),
+                next_partition_(0), failed_(false), init_(init),
+                f1_(std::forward<F1_>(f1)), op_(std::forward<Op_>(op)),
+                f2_(std::forward<F2_>(f2))
+            {
+                partitions_.reserve(num_partitions_);
+                for (std::size_t part = 0; part != num_partitions_; ++part)
+                {
+                    partitions_.push_back(first);
+                    if (part != num_partitions_ - 1)
+                        std::advance(first, chunk_size);
+                }
+            }
+
+            std::size_t size() const
+            {
+                return num_partitions_;
+            }
+
+            // run by each of the tasks, keeps claiming partitions until all
+            // of them are done
+            void operator()(std::size_t)
+            {
+                while (!failed_.load(boost::memory_order_relaxed))
+                {
+                    std::size_t const part = next_partition_++;
+                    if (part >= num_partitions_)
+                        break;
+
+                    try {
+                        scan_partition(part);
+                    }
+                    catch (...) {
+                        failed_.store(true);
+                        descriptors_[part].state_.store(
+                            descriptor_type::failed, boost::memory_order_release);
+                        throw;
+                    }
+                }
+            }
+
+            // the overall result
+            T get() const
+            {
+                descriptor_type const& d = descriptors_[num_partitions_ - 1];
+                HPX_ASSERT(d.state_.load() == descriptor_type::prefix);
+                return *d.prefix_;
+            }
+
+        private:
+            void publish_prefix(descriptor_type& d, T && prefix)
+            {
+                d.prefix_ = std::move(prefix);
+                d.state_.store(descriptor_type::prefix,
+                    boost::memory_order_release);
+            }
+
+            void scan_partition(std::size_t part)
+            {
+                descriptor_type& d = descriptors_[part];
+
+                FwdIter const part_begin = partitions_[part];
+                std::size_t const part_size = (std::min)(chunk_size_,
+                    count_ - part * chunk_size_);
+
+                if (part == 0)
+                {
+                    publish_prefix(d, f2_(part_begin, part_size, init_, false));
+                    return;
+                }
+
+                // the preceding partition is done already, no need to look
+                // any further
+                descriptor_type const& prev = descriptors_[part - 1];
+                int const state = prev.state_.load(boost::memory_order_acquire);
+                if (state == descriptor_type::prefix)
+                {
+                    publish_prefix(d,
+                        f2_(part_begin, part_size, *prev.prefix_, false));
+                    return;
+                }
+                if (state == descriptor_type::failed)
+                {
+                    d.state_.store(descriptor_type::failed,
+                        boost::memory_order_release);
+                    return;
+                }
+
+                d.aggregate_ = f1_(part_begin, part_size);
+                d.state_.store(descriptor_type::aggregate,
+                    boost::memory_order_release);
+
+                boost::optional<T> prefix = look_back(part);
+                if (!prefix)
+                {
+                    d.state_.store(descriptor_type::failed,
+                        boost::memory_order_release);
+                    return;
+                }
+
+                // publish the inclusive prefix before running the final scan
+                // to unblock the partitions waiting for this one
+                publish_prefix(d, op_(*prefix, *d.aggregate_));
+                f2_(part_begin, part_size, *prefix, true);
+            }
+
+            // combine the results of the preceding partitions, returns
+            // nothing if any of those has failed
+            boost::optional<T> look_back(std::size_t part)
+            {
+                boost::optional<T> aggregate;
+                while (part-- != 0)
+                {
+                    descriptor_type const& d = descriptors_[part];
+
+                    int state = d.state_.load(boost::memory_order_acquire);
+                    for (std::size_t k = 0; state == descriptor_type::empty; ++k)
+                    {
+                        hpx::util::detail::yield_k(k,
+                            "hpx::parallel::util::detail::single_pass_scan");
+                        state = d.state_.load(boost::memory_order_acquire);
+                    }
+
+                    if (state == descriptor_type::failed)
+                        return boost::none;
+
+                    if (state == descriptor_type::prefix)
+                    {
+                        if (!aggregate)
+                            return *d.prefix_;
+                        return op_(*d.prefix_, *aggregate);
+                    }
+
+                    if (!aggregate)
+                        aggregate = *d.aggregate_;
+                    else
+                        aggregate = op_(*d.aggregate_, *aggregate);
+                }
+
+                HPX_ASSERT(false);      // the first partition has a prefix
+                return boost::none;
+            }
+
+        private:
+            std::size_t count_;
+            std::size_t chunk_size_;
+            std::size_t num_partitions_;
+            std::vector<FwdIter> partitions_;
+            std::unique_ptr<descriptor_type[]> descriptors_;
+            boost::atomic<std::size_t> next_partition_;
+            boost::atomic<bool> failed_;
+            T init_;
+            F1 f1_;
+            Op op_;
+            F2 f2_;
+        };
+
+        ///////////////////////////////////////////////////////////////////////
+        template <typename ExPolicy, typename Scan>
+        std::vector<hpx::future<void> >
+        start_single_pass_scan(ExPolicy && policy, Scan& scan)
+        {
+            std::size_t const cores = execution::processing_units_count(
+                policy.executor(), policy.parameters());
+            std::size_t const tasks = (std::min)(cores, scan.size());
+
+            std::vector<hpx::future<void> > workitems;
+            workitems.reserve(tasks);
+            for (std::size_t task = 0; task != tasks; ++task)
+            {
+                workitems.push_back(execution::async_execute(
+                    policy.executor(), std::ref(scan), task));
+            }
+            return workitems;
+        }
+
+        template <typename ExPolicy>
+        std::size_t get_single_pass_scan_chunk_size(ExPolicy && policy,
+            std::size_t count)
+        {
+            typedef typename
+                hpx::util::decay<ExPolicy>::type::executor_parameters_type
+                parameters_type;
+            typedef executor_parameter_traits<parameters_type>
+                parameters_traits;
+
+            std::size_t const cores = execution::processing_units_count(
+                policy.executor(), policy.parameters());
+
+            std::size_t chunk_size = parameters_traits::get_chunk_size(
+                policy.parameters(), policy.executor(),
+                [](){ return 0; }, cores, count);
+
+            return (std::max)(std::size_t(1),
+                (std::min)(chunk_size, single_pass_scan_partition_size));
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        template <typename ExPolicy_, typename R, typename T>
+        struct single_pass_scan_partitioner
+        {
+            template <typename ExPolicy, typename FwdIter, typename F1,
+                typename Op, typename F2, typename F3>
+            static R call(ExPolicy && policy, FwdIter first,
+                std::size_t count, T const& init, F1 && f1, Op && op,
+                F2 && f2, F3 && f3)
+            {
+                typedef typename
+                    hpx::util::decay<ExPolicy>::type::executor_parameters_type
+                    parameters_type;
+                typedef single_pass_scan<
+                        FwdIter, T,
+                        typename hpx::util::decay<F1>::type,
+                        typename hpx::util::decay<Op>::type,
+                        typename hpx::util::decay<F2>::type
+                    > scan_type;
+
+                // inform parameter traits
+                scoped_executor_parameters<parameters_type> scoped_param(
+                    policy.parameters());
+
+                HPX_ASSERT(count > 0);
+
+                std::vector<hpx::future<void> > workitems;
+                std::list<std::exception_ptr> errors;
+                std::unique_ptr<scan_type> scan;
+
+                try {
+                    scan.reset(new scan_type(first, count,
+                        get_single_pass_scan_chunk_size(policy, count), init,
+                        std::forward<F1>(f1), std::forward<Op>(op),
+                        std::forward<F2>(f2)));
+
+                    workitems = start_single_pass_scan(policy, *scan);
+                }
+                catch (...) {
+                    handle_local_exceptions<ExPolicy>::call(
+                        std::current_exception(), errors);
+                }
+
+                // wait for all tasks to finish
+                hpx::wait_all(workitems);
+
+                // always rethrow if 'errors' is not empty or 'workitems' has
+                // an exceptional future
+                handle_local_exceptions<ExPolicy>::call(workitems, errors);
+
+                try {
+                    return f3(scan->get());
+                }
+                catch (...) {
+                    // rethrow either bad_alloc or exception_list
+                    handle_local_exceptions<ExPolicy>::call(
+                        std::current_exception());
+                }
+            }
+        };
+
+        template <typename R, typename T>
+        struct single_pass_scan_partitioner<
+            execution::parallel_task_policy, R, T>
+        {
+            template <typename ExPolicy, typename FwdIter, typename F1,
+                typename Op, typename F2, typename F3>
+            static hpx::future<R> call(ExPolicy && policy, FwdIter first,
+                std::size_t count, T const& init, F1 && f1, Op && op,
+                F2 && f2, F3 && f3)
+            {
+                typedef typename
+                    hpx::util::decay<ExPolicy>::type::executor_parameters_type
+                    parameters_type;
+                typedef scoped_executor_parameters<parameters_type>
+                    scoped_executor_parameters;
+                typedef single_pass_scan<
+                        FwdIter, T,
+                        typename hpx::util::decay<F1>::type,
+                        typename hpx::util::decay<Op>::type,
+                        typename hpx::util::decay<F2>::type
+                    > scan_type;
+
+                // inform parameter traits
+                std::shared_ptr<scoped_executor_parameters>
+                    scoped_param(std::make_shared<
+                            scoped_executor_parameters
+                        >(policy.parameters()));
+
+                HPX_ASSERT(count > 0);
+
+                std::vector<hpx::future<void> > workitems;
+                std::list<std::exception_ptr> errors;
+                std::shared_ptr<scan_type> scan;
+
+                try {
+                    scan = std::make_shared<scan_type>(first, count,
+                        get_single_pass_scan_chunk_size(policy, count), init,
+                        std::forward<F1>(f1), std::forward<Op>(op),
+                        std::forward<F2>(f2));
+
+                    workitems = start_single_pass_scan(policy, *scan);
+                }
+                catch (std::bad_alloc const&) {
+                    return hpx::make_exceptional_future<R>(
+                        std::current_exception());
+                }
+                catch (...) {
+                    errors.push_back(std::current_exception());
+                }
+
+                // wait for all tasks to finish
+                return dataflow(
+                    [errors, f3, scan, scoped_param](
+                        std::vector<hpx::future<void> >&& witems) mutable -> R
+                    {
+                        HPX_UNUSED(scoped_param);
+
+                        handle_local_exceptions<ExPolicy>::call(witems, errors);
+                        return f3(scan->get());
+                    },
+                    std::move(workitems));
+            }
+        };
+
+        template <typename Executor, typename Parameters, typename R,
+            typename T>
+        struct single_pass_scan_partitioner<
+                execution::parallel_task_policy_shim<Executor, Parameters>,
+                R, T>
+          : single_pass_scan_partitioner<execution::parallel_task_policy, R, T>
+        {};
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    // The single pass scan partitioner reads the input sequence only once
+    // (partitions which are traversed twice are small enough to still be in
+    // the cache).
+    //
+    // ExPolicy: execution policy
+    // R:        overall result type
+    // T:        type of the partition results
+    template <typename ExPolicy, typename R = void, typename T = R>
+    struct single_pass_scan_partitioner
+      : detail::single_pass_scan_partitioner<
+            typename hpx::util::decay<ExPolicy>::type, R, T>
+    {};
+
     ///////////////////////////////////////////////////////////////////////////
     template <typename ExPolicy, typename R = void, typename Result1 = R,
         typename Result2 = void,
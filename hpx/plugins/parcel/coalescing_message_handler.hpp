@@ -78,6 +78,17 @@ namespace hpx { namespace plugins { namespace parcel
 
         void update_num_messages();
         void update_interval();
+        void update_target_latency();
+
+        // adjust the number of coalesced parcels to the current parcel rate
+        void adapt_parameters(std::int64_t time_since_last_parcel);
+
+        // return the handler shared by all actions sent to the given
+        // destination
+        static std::shared_ptr<coalescing_message_handler>
+            get_destination_handler(parcelset::locality const& dest,
+                parcelset::parcelport* pp, std::size_t num,
+                std::size_t interval);
 
     private:
         mutable mutex_type mtx_;
@@ -110,6 +121,19 @@ namespace hpx { namespace plugins { namespace parcel
         std::int64_t histogram_min_boundary_;
         std::int64_t histogram_max_boundary_;
         std::int64_t histogram_num_buckets_;
+
+        // adaptive coalescing: the number of parcels to coalesce is derived
+        // from the (exponentially weighted) average time between parcels
+        // such that no parcel is delayed by more than target_latency_ [us]
+        bool adaptive_;
+        std::size_t target_latency_;
+        double average_time_between_parcels_;
+        std::size_t adaptive_num_coalesced_parcels_;
+
+        // per-destination coalescing: parcels of all actions sent to the
+        // same destination are buffered by a shared handler
+        bool per_destination_;
+        std::shared_ptr<coalescing_message_handler> destination_handler_;
     };
 }}}
 
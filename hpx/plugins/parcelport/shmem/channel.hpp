@@ -0,0 +1,276 @@
+//  Copyright (c) 2026 agent
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef HPX_PARCELSET_POLICIES_SHMEM_CHANNEL_HPP
+#define HPX_PARCELSET_POLICIES_SHMEM_CHANNEL_HPP
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_PARCELPORT_SHMEM)
+
+#include <hpx/plugins/parcelport/shmem/segment.hpp>
+#include <hpx/throw_exception.hpp>
+#include <hpx/util/assert.hpp>
+
+#include <boost/atomic.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <new>
+#include <string>
+#include <utility>
+
+namespace hpx { namespace parcelset { namespace policies { namespace shmem
+{
+    namespace detail
+    {
+        std::size_t const cache_line_size = 64;
+
+        inline std::uint64_t align(std::uint64_t size)
+        {
+            return (size + cache_line_size - 1) & ~std::uint64_t(cache_line_size - 1);
+        }
+
+        // The control block at the beginning of each channel segment. The
+        // read and write positions are counted in bytes since the creation
+        // of the channel.
+        struct channel_header
+        {
+            channel_header(std::uint64_t ring_size, std::uint64_t heap_size)
+              : head_(0), tail_(0)
+              , ring_size_(ring_size), heap_size_(heap_size)
+            {}
+
+            boost::atomic<std::uint64_t> head_;
+            char pad0_[cache_line_size - sizeof(boost::atomic<std::uint64_t>)];
+            boost::atomic<std::uint64_t> tail_;
+            char pad1_[cache_line_size - sizeof(boost::atomic<std::uint64_t>)];
+
+            std::uint64_t ring_size_;
+            std::uint64_t heap_size_;
+        };
+
+        // Each allocation in the shared heap is preceded by this header. The
+        // receiving locality sets the released flag once it is done with the
+        // data.
+        struct block_header
+        {
+            boost::atomic<std::uint32_t> released_;
+            std::uint32_t reserved_;
+            std::uint64_t size_;
+        };
+    }
+
+    // A channel connects exactly one sending with one receiving locality. It
+    // consists of a byte ring buffer carrying the messages in order, and of a
+    // heap the sender places large zero-copy chunks into. The receiver
+    // de-serializes those chunks directly from the shared memory and releases
+    // them afterwards.
+    //
+    // All producer functions (write, allocate, heap_data) have to be called
+    // by one thread at a time only, the same applies to the consumer
+    // functions (read, heap_data). The function release may be called
+    // concurrently.
+    class channel
+    {
+    public:
+        static std::uint64_t const npos = std::uint64_t(-1);
+
+        // create a new channel (this is done by the sending locality)
+        static channel create(std::string const& name,
+            std::size_t ring_size, std::size_t heap_size)
+        {
+            std::uint64_t ring = detail::align(ring_size);
+            std::uint64_t heap = detail::align(heap_size);
+
+            segment seg = segment::create(name, static_cast<std::size_t>(
+                header_size() + ring + heap));
+            new (seg.data()) detail::channel_header(ring, heap);
+
+            return channel(std::move(seg));
+        }
+
+        // map an existing channel (this is done by the receiving locality)
+        static channel open(std::string const& name)
+        {
+            segment seg = segment::open(name);
+            if (!seg || seg.size() < header_size())
+            {
+                HPX_THROW_EXCEPTION(network_error,
+                    "shmem::channel::open",
+                    "could not open shared memory channel " + name);
+            }
+            return channel(std::move(seg));
+        }
+
+        channel(channel && rhs) = default;
+
+        // remove the name of the channel, the receiver does so once the
+        // channel has been mapped
+        void unlink()
+        {
+            segment_.unlink();
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        // Append (parts of) the given data to the ring buffer, returns the
+        // number of bytes written.
+        std::size_t write(char const* data, std::size_t size)
+        {
+            std::uint64_t head = header_->head_.load(boost::memory_order_relaxed);
+            std::uint64_t tail = header_->tail_.load(boost::memory_order_acquire);
+
+            std::size_t count = static_cast<std::size_t>((std::min)(
+                std::uint64_t(size), ring_size_ - (head - tail)));
+            if (count == 0)
+                return 0;
+
+            std::size_t pos = static_cast<std::size_t>(head % ring_size_);
+            std::size_t first = (std::min)(count,
+                static_cast<std::size_t>(ring_size_ - pos));
+
+            std::memcpy(ring_ + pos, data, first);
+            std::memcpy(ring_, data + first, count - first);
+
+            header_->head_.store(head + count, boost::memory_order_release);
+            return count;
+        }
+
+        // Extract (parts of) the requested number of bytes from the ring
+        // buffer, returns the number of bytes read.
+        std::size_t read(char* data, std::size_t size)
+        {
+            std::uint64_t tail = header_->tail_.load(boost::memory_order_relaxed);
+            std::uint64_t head = header_->head_.load(boost::memory_order_acquire);
+
+            std::size_t count = static_cast<std::size_t>((std::min)(
+                std::uint64_t(size), head - tail));
+            if (count == 0)
+                return 0;
+
+            std::size_t pos = static_cast<std::size_t>(tail % ring_size_);
+            std::size_t first = (std::min)(count,
+                static_cast<std::size_t>(ring_size_ - pos));
+
+            std::memcpy(data, ring_ + pos, first);
+            std::memcpy(data + first, ring_, count - first);
+
+            header_->tail_.store(tail + count, boost::memory_order_release);
+            return count;
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        // Allocate a block of the given size from the shared heap, returns
+        // the offset of the block or npos if the heap is exhausted.
+        std::uint64_t allocate(std::size_t size)
+        {
+            reclaim();
+
+            std::uint64_t block_size =
+                detail::align(sizeof(detail::block_header) + size);
+            if (heap_size_ == 0 || block_size > heap_size_)
+                return npos;
+
+            // blocks are never wrapped around the end of the heap, the
+            // remaining space is skipped instead
+            std::uint64_t pos = heap_head_ % heap_size_;
+            std::uint64_t padding = 0;
+            if (pos + block_size > heap_size_)
+                padding = heap_size_ - pos;
+
+            if (heap_size_ - (heap_head_ - heap_tail_) < padding + block_size)
+                return npos;
+
+            if (padding != 0)
+            {
+                detail::block_header* b = block(pos);
+                b->size_ = padding;
+                b->released_.store(1, boost::memory_order_relaxed);
+                heap_head_ += padding;
+                pos = 0;
+            }
+
+            detail::block_header* b = block(pos);
+            b->size_ = block_size;
+            b->released_.store(0, boost::memory_order_relaxed);
+            heap_head_ += block_size;
+
+            return pos + sizeof(detail::block_header);
+        }
+
+        char* heap_data(std::uint64_t offset) const
+        {
+            HPX_ASSERT(offset < heap_size_);
+            return heap_ + offset;
+        }
+
+        // Give the block at the given offset back to the sender
+        void release(std::uint64_t offset)
+        {
+            block(offset - sizeof(detail::block_header))->released_.store(
+                1, boost::memory_order_release);
+        }
+
+    private:
+        explicit channel(segment && seg)
+          : segment_(std::move(seg))
+          , header_(reinterpret_cast<detail::channel_header*>(segment_.data()))
+          , ring_(segment_.data() + header_size())
+          , heap_(ring_ + header_->ring_size_)
+          , ring_size_(header_->ring_size_)
+          , heap_size_(header_->heap_size_)
+          , heap_head_(0), heap_tail_(0)
+        {
+            HPX_ASSERT(header_->head_.is_lock_free());
+            if (segment_.size() < header_size() + ring_size_ + heap_size_)
+            {
+                HPX_THROW_EXCEPTION(network_error,
+                    "shmem::channel::channel",
+                    "shared memory channel " + segment_.name() +
+                        " is corrupted");
+            }
+        }
+
+        static std::uint64_t header_size()
+        {
+            return detail::align(sizeof(detail::channel_header));
+        }
+
+        detail::block_header* block(std::uint64_t pos) const
+        {
+            return reinterpret_cast<detail::block_header*>(heap_ + pos);
+        }
+
+        // Make all blocks available again which have been released by the
+        // receiver, blocks are released roughly in order of their allocation.
+        void reclaim()
+        {
+            while (heap_tail_ != heap_head_)
+            {
+                detail::block_header* b = block(heap_tail_ % heap_size_);
+                if (!b->released_.load(boost::memory_order_acquire))
+                    break;
+                heap_tail_ += b->size_;
+            }
+        }
+
+        segment segment_;
+        detail::channel_header* header_;
+        char* ring_;
+        char* heap_;
+        std::uint64_t ring_size_;
+        std::uint64_t heap_size_;
+
+        // allocation state of the shared heap, this is used by the sender only
+        std::uint64_t heap_head_;
+        std::uint64_t heap_tail_;
+    };
+}}}}
+
+#endif
+
+#endif
@@ -0,0 +1,132 @@
+//  Copyright (c) 2026 agent
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef HPX_PARCELSET_POLICIES_SHMEM_MAILBOX_HPP
+#define HPX_PARCELSET_POLICIES_SHMEM_MAILBOX_HPP
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_PARCELPORT_SHMEM)
+
+#include <hpx/plugins/parcelport/shmem/segment.hpp>
+
+#include <boost/atomic.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <new>
+#include <string>
+#include <utility>
+
+namespace hpx { namespace parcelset { namespace policies { namespace shmem
+{
+    namespace detail
+    {
+        struct mailbox_slot
+        {
+            boost::atomic<std::uint32_t> ready_;
+            std::int32_t pid_;
+        };
+
+        struct mailbox_header
+        {
+            static std::uint32_t const max_senders = 256;
+
+            mailbox_header()
+              : next_slot_(0)
+            {
+                for (mailbox_slot& s : slots_)
+                {
+                    s.ready_.store(0, boost::memory_order_relaxed);
+                    s.pid_ = 0;
+                }
+            }
+
+            boost::atomic<std::uint32_t> next_slot_;
+            mailbox_slot slots_[max_senders];
+        };
+    }
+
+    // Each locality owns a mailbox which is used by the other localities on
+    // the same node to announce the channels they have created for sending
+    // messages to this locality.
+    class mailbox
+    {
+    public:
+        mailbox()
+          : header_(nullptr)
+        {}
+
+        // create the mailbox of this locality
+        static mailbox create(std::int32_t pid)
+        {
+            segment seg = segment::create(mailbox_name(pid),
+                sizeof(detail::mailbox_header));
+            new (seg.data()) detail::mailbox_header();
+            return mailbox(std::move(seg));
+        }
+
+        // map the mailbox of another locality, returns an empty mailbox if
+        // the given locality can't be reached through shared memory
+        static mailbox open(std::int32_t pid)
+        {
+            segment seg = segment::open(mailbox_name(pid));
+            if (!seg || seg.size() < sizeof(detail::mailbox_header))
+                return mailbox();
+            return mailbox(std::move(seg));
+        }
+
+        explicit operator bool() const noexcept
+        {
+            return header_ != nullptr;
+        }
+
+        void unlink()
+        {
+            segment_.unlink();
+        }
+
+        // Announce the channel created by the given locality, returns false
+        // if the mailbox is full.
+        bool post(std::int32_t pid)
+        {
+            std::uint32_t idx =
+                header_->next_slot_.fetch_add(1, boost::memory_order_relaxed);
+            if (idx >= detail::mailbox_header::max_senders)
+                return false;
+
+            detail::mailbox_slot& s = header_->slots_[idx];
+            s.pid_ = pid;
+            s.ready_.store(1, boost::memory_order_release);
+            return true;
+        }
+
+        // Retrieve the locality announced in the given slot, returns zero if
+        // the slot has not been used yet.
+        std::int32_t get(std::size_t idx) const
+        {
+            if (idx >= detail::mailbox_header::max_senders)
+                return 0;
+
+            detail::mailbox_slot const& s = header_->slots_[idx];
+            if (!s.ready_.load(boost::memory_order_acquire))
+                return 0;
+            return s.pid_;
+        }
+
+    private:
+        explicit mailbox(segment && seg)
+          : segment_(std::move(seg))
+          , header_(reinterpret_cast<detail::mailbox_header*>(segment_.data()))
+        {}
+
+        segment segment_;
+        detail::mailbox_header* header_;
+    };
+}}}}
+
+#endif
+
+#endif
@@ -0,0 +1,129 @@
+//  Copyright (c) 2026 agent
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef HPX_PARCELSET_POLICIES_SHMEM_RECEIVER_HPP
+#define HPX_PARCELSET_POLICIES_SHMEM_RECEIVER_HPP
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_PARCELPORT_SHMEM)
+
+#include <hpx/exception.hpp>
+#include <hpx/lcos/local/spinlock.hpp>
+#include <hpx/plugins/parcelport/shmem/channel.hpp>
+#include <hpx/plugins/parcelport/shmem/mailbox.hpp>
+#include <hpx/plugins/parcelport/shmem/receiver_connection.hpp>
+#include <hpx/util/logging.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <utility>
+
+namespace hpx { namespace parcelset { namespace policies { namespace shmem
+{
+    template <typename Parcelport>
+    struct receiver
+    {
+        typedef hpx::lcos::local::spinlock mutex_type;
+        typedef
+            receiver_connection<Parcelport>
+            connection_type;
+        typedef std::shared_ptr<connection_type> connection_ptr;
+        typedef std::deque<connection_ptr> connection_list;
+
+        receiver(Parcelport & pp, std::int32_t pid)
+          : pp_(pp)
+          , pid_(pid)
+          , next_slot_(0)
+        {}
+
+        ~receiver()
+        {
+            mailbox_.unlink();
+        }
+
+        void run()
+        {
+            mailbox_ = mailbox::create(pid_);
+        }
+
+        bool background_work(std::size_t num_thread)
+        {
+            // We first try to accept a new connection
+            connection_ptr connection = accept();
+
+            // If we don't have a new connection, try to handle one of the
+            // already accepted ones.
+            if (!connection)
+            {
+                std::unique_lock<mutex_type> l(connections_mtx_, std::try_to_lock);
+                if(l && !connections_.empty())
+                {
+                    connection = std::move(connections_.front());
+                    connections_.pop_front();
+                }
+            }
+
+            if(connection)
+            {
+                bool has_work = connection->receive(num_thread);
+
+                // connections are kept alive as long as the parcelport
+                std::unique_lock<mutex_type> l(connections_mtx_);
+                connections_.push_back(std::move(connection));
+                return has_work;
+            }
+
+            return false;
+        }
+
+    private:
+        // Attach to the next channel announced in our mailbox
+        connection_ptr accept()
+        {
+            std::unique_lock<mutex_type> l(accept_mtx_, std::try_to_lock);
+            if (!l || !mailbox_)
+                return connection_ptr();
+
+            std::int32_t src = mailbox_.get(next_slot_);
+            if (src == 0)
+                return connection_ptr();
+
+            ++next_slot_;
+
+            try {
+                channel c = channel::open(channel_name(src, pid_));
+
+                // the channel stays mapped by both sides, its name is not
+                // needed anymore
+                c.unlink();
+
+                return std::make_shared<connection_type>(std::move(c), pp_);
+            }
+            catch (hpx::exception const& e) {
+                LPT_(error)
+                    << "shmem::receiver::accept: " << e.what();
+            }
+            return connection_ptr();
+        }
+
+        Parcelport & pp_;
+        std::int32_t pid_;
+
+        mutex_type accept_mtx_;
+        mailbox mailbox_;
+        std::size_t next_slot_;
+
+        mutex_type connections_mtx_;
+        connection_list connections_;
+    };
+}}}}
+
+#endif
+
+#endif
@@ -0,0 +1,330 @@
+//  Copyright (c) 2026 agent
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef HPX_PARCELSET_POLICIES_SHMEM_RECEIVER_CONNECTION_HPP
+#define HPX_PARCELSET_POLICIES_SHMEM_RECEIVER_CONNECTION_HPP
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_PARCELPORT_SHMEM)
+
+#include <hpx/plugins/parcelport/shmem/channel.hpp>
+#include <hpx/runtime/parcelset/decode_parcels.hpp>
+#include <hpx/runtime/parcelset/parcel_buffer.hpp>
+#include <hpx/util/high_resolution_timer.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <utility>
+#include <vector>
+
+namespace hpx { namespace parcelset { namespace policies { namespace shmem
+{
+    // A zero-copy chunk of a received message. The data either refers to a
+    // block in the shared heap of the channel, which is given back to the
+    // sender once the chunk is destroyed, or it is held by the chunk itself.
+    class shared_chunk
+    {
+    public:
+        shared_chunk()
+          : data_(nullptr), size_(0)
+          , channel_(nullptr), offset_(channel::npos)
+        {}
+
+        shared_chunk(channel& c, std::uint64_t offset, std::size_t size)
+          : data_(c.heap_data(offset)), size_(size)
+          , channel_(&c), offset_(offset)
+        {}
+
+        shared_chunk(shared_chunk && rhs)
+          : storage_(std::move(rhs.storage_))
+          , data_(rhs.data_), size_(rhs.size_)
+          , channel_(rhs.channel_), offset_(rhs.offset_)
+        {
+            rhs.reset();
+        }
+
+        shared_chunk& operator=(shared_chunk && rhs)
+        {
+            if (this != &rhs)
+            {
+                release();
+                storage_ = std::move(rhs.storage_);
+                data_ = rhs.data_;
+                size_ = rhs.size_;
+                channel_ = rhs.channel_;
+                offset_ = rhs.offset_;
+                rhs.reset();
+            }
+            return *this;
+        }
+
+        ~shared_chunk()
+        {
+            release();
+        }
+
+        // allocate local memory for a chunk which was transferred through
+        // the ring buffer
+        void resize(std::size_t size)
+        {
+            release();
+            storage_.resize(size);
+            data_ = storage_.data();
+            size_ = size;
+        }
+
+        char* data() const
+        {
+            return data_;
+        }
+
+        std::size_t size() const
+        {
+            return size_;
+        }
+
+    private:
+        void release()
+        {
+            if (channel_ != nullptr)
+                channel_->release(offset_);
+            reset();
+        }
+
+        void reset()
+        {
+            data_ = nullptr;
+            size_ = 0;
+            channel_ = nullptr;
+            offset_ = channel::npos;
+        }
+
+        std::vector<char> storage_;
+        char* data_;
+        std::size_t size_;
+        channel* channel_;
+        std::uint64_t offset_;
+    };
+
+    // Receives all messages sent through one channel
+    template <typename Parcelport>
+    struct receiver_connection
+    {
+    private:
+        enum connection_state
+        {
+            initialized
+          , rcvd_header
+          , rcvd_transmission_chunks
+          , rcvd_data
+          , rcvd_chunk_offset
+        };
+
+        typedef std::vector<char> data_type;
+        typedef parcel_buffer<data_type, shared_chunk> buffer_type;
+
+        // size of the message header: size_, data_size_, and num_chunks_
+        static std::size_t const header_size = 24;
+
+    public:
+        receiver_connection(channel && c, Parcelport & pp)
+          : state_(initialized)
+          , channel_(std::move(c))
+          , offset_(0)
+          , chunks_idx_(0)
+          , chunk_offset_(0)
+          , has_work_(false)
+          , pp_(pp)
+        {
+        }
+
+        // Read whatever is available from the ring buffer and decode all
+        // completely received messages, returns whether any data was read.
+        bool receive(std::size_t num_thread = -1)
+        {
+            has_work_ = false;
+            while (receive_step(num_thread))
+                /**/;
+            return has_work_;
+        }
+
+    private:
+        bool receive_step(std::size_t num_thread)
+        {
+            switch (state_)
+            {
+                case initialized:
+                    return receive_header();
+                case rcvd_header:
+                    return receive_transmission_chunks();
+                case rcvd_transmission_chunks:
+                    return receive_data();
+                case rcvd_data:
+                    return receive_chunk_offset(num_thread);
+                case rcvd_chunk_offset:
+                    return receive_chunk_data();
+                default:
+                    HPX_ASSERT(false);
+            }
+            return false;
+        }
+
+        bool receive_header()
+        {
+            if (!read(header_, header_size))
+                return false;
+
+            // the header fields are stored in their wire format
+            std::memcpy(static_cast<void*>(&buffer_.size_), header_, 8);
+            std::memcpy(static_cast<void*>(&buffer_.data_size_), header_ + 8, 8);
+            std::memcpy(static_cast<void*>(&buffer_.num_chunks_), header_ + 16, 8);
+
+            std::size_t inbound_size =
+                static_cast<std::size_t>(buffer_.size_);
+
+            performance_counters::parcels::data_point& data =
+                buffer_.data_point_;
+            data.time_ = timer_.elapsed_nanoseconds();
+            data.bytes_ = inbound_size;
+
+            buffer_.data_ = pp_.get_buffer(inbound_size);
+            buffer_.data_.resize(inbound_size);
+
+            std::size_t num_zero_copy_chunks =
+                static_cast<std::size_t>(
+                    static_cast<std::uint32_t>(buffer_.num_chunks_.first));
+            std::size_t num_non_zero_copy_chunks =
+                static_cast<std::size_t>(
+                    static_cast<std::uint32_t>(buffer_.num_chunks_.second));
+
+            if (num_zero_copy_chunks != 0)
+            {
+                buffer_.transmission_chunks_.resize(
+                    num_zero_copy_chunks + num_non_zero_copy_chunks);
+                buffer_.chunks_.resize(num_zero_copy_chunks);
+                state_ = rcvd_header;
+            }
+            else
+            {
+                state_ = rcvd_transmission_chunks;
+            }
+            return true;
+        }
+
+        bool receive_transmission_chunks()
+        {
+            std::vector<buffer_type::transmission_chunk_type>& chunks =
+                buffer_.transmission_chunks_;
+            if (!read(chunks.data(),
+                    chunks.size() * sizeof(buffer_type::transmission_chunk_type)))
+            {
+                return false;
+            }
+
+            state_ = rcvd_transmission_chunks;
+            return true;
+        }
+
+        bool receive_data()
+        {
+            if (!read(buffer_.data_.data(), buffer_.data_.size()))
+                return false;
+
+            state_ = rcvd_data;
+            chunks_idx_ = 0;
+            return true;
+        }
+
+        bool receive_chunk_offset(std::size_t num_thread)
+        {
+            if (chunks_idx_ == buffer_.chunks_.size())
+                return done(num_thread);
+
+            if (!read(&chunk_offset_, sizeof(chunk_offset_)))
+                return false;
+
+            std::size_t chunk_size = static_cast<std::size_t>(
+                buffer_.transmission_chunks_[chunks_idx_].second);
+
+            if (chunk_offset_ == channel::npos)
+            {
+                // the chunk data follows in the ring buffer
+                buffer_.chunks_[chunks_idx_].resize(chunk_size);
+                state_ = rcvd_chunk_offset;
+            }
+            else
+            {
+                // the chunk data is placed in the shared heap
+                buffer_.chunks_[chunks_idx_] =
+                    shared_chunk(channel_, chunk_offset_, chunk_size);
+                ++chunks_idx_;
+            }
+            return true;
+        }
+
+        bool receive_chunk_data()
+        {
+            shared_chunk& c = buffer_.chunks_[chunks_idx_];
+            if (!read(c.data(), c.size()))
+                return false;
+
+            ++chunks_idx_;
+            state_ = rcvd_data;
+            return true;
+        }
+
+        bool done(std::size_t num_thread)
+        {
+            performance_counters::parcels::data_point& data = buffer_.data_point_;
+            data.time_ = timer_.elapsed_nanoseconds() - data.time_;
+
+            // all heap blocks are released as soon as the message has been
+            // decoded
+            decode_parcels(pp_, std::move(buffer_), num_thread);
+
+            buffer_.clear();
+            state_ = initialized;
+            return true;
+        }
+
+        // Read the remainder of the given number of bytes, returns true if
+        // all bytes have been read.
+        bool read(void* data, std::size_t size)
+        {
+            std::size_t count = channel_.read(
+                static_cast<char*>(data) + offset_, size - offset_);
+            if (count != 0)
+                has_work_ = true;
+
+            offset_ += count;
+            if (offset_ != size)
+                return false;
+
+            offset_ = 0;
+            return true;
+        }
+
+        util::high_resolution_timer timer_;
+
+        connection_state state_;
+        channel channel_;
+
+        char header_[header_size];
+        buffer_type buffer_;
+
+        std::size_t offset_;
+        std::size_t chunks_idx_;
+        std::uint64_t chunk_offset_;
+        bool has_work_;
+
+        Parcelport & pp_;
+    };
+}}}}
+
+#endif
+
+#endif
@@ -0,0 +1,193 @@
+//  Copyright (c) 2026 agent
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef HPX_PARCELSET_POLICIES_SHMEM_SEGMENT_HPP
+#define HPX_PARCELSET_POLICIES_SHMEM_SEGMENT_HPP
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_PARCELPORT_SHMEM)
+
+#include <hpx/throw_exception.hpp>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <cerrno>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <utility>
+
+namespace hpx { namespace parcelset { namespace policies { namespace shmem
+{
+    // A named POSIX shared memory segment mapped into the address space of
+    // this process. The memory stays mapped until the segment object is
+    // destroyed, removing the name of the segment does not affect existing
+    // mappings.
+    class segment
+    {
+    public:
+        segment()
+          : data_(nullptr), size_(0)
+        {}
+
+        segment(segment && rhs)
+          : name_(std::move(rhs.name_)), data_(rhs.data_), size_(rhs.size_)
+        {
+            rhs.data_ = nullptr;
+            rhs.size_ = 0;
+        }
+
+        segment& operator=(segment && rhs)
+        {
+            if (this != &rhs)
+            {
+                unmap();
+                name_ = std::move(rhs.name_);
+                data_ = rhs.data_;
+                size_ = rhs.size_;
+                rhs.data_ = nullptr;
+                rhs.size_ = 0;
+            }
+            return *this;
+        }
+
+        ~segment()
+        {
+            unmap();
+        }
+
+        // Create a new zero-initialized segment of the given size, a stale
+        // segment of the same name (left behind by a terminated process) is
+        // replaced.
+        static segment create(std::string const& name, std::size_t size)
+        {
+            int fd = ::shm_open(name.c_str(), O_RDWR | O_CREAT | O_EXCL, 0600);
+            if (fd == -1 && errno == EEXIST)
+            {
+                ::shm_unlink(name.c_str());
+                fd = ::shm_open(name.c_str(), O_RDWR | O_CREAT | O_EXCL, 0600);
+            }
+            if (fd == -1)
+            {
+                HPX_THROW_EXCEPTION(network_error,
+                    "shmem::segment::create",
+                    "could not create shared memory segment " + name + ": " +
+                        std::strerror(errno));
+            }
+
+            if (::ftruncate(fd, static_cast<off_t>(size)) == -1)
+            {
+                int err = errno;
+                ::close(fd);
+                ::shm_unlink(name.c_str());
+                HPX_THROW_EXCEPTION(network_error,
+                    "shmem::segment::create",
+                    "could not resize shared memory segment " + name + ": " +
+                        std::strerror(err));
+            }
+
+            return segment(name, fd, size);
+        }
+
+        // Map an existing segment, returns an empty segment if there is no
+        // segment of the given name.
+        static segment open(std::string const& name)
+        {
+            int fd = ::shm_open(name.c_str(), O_RDWR, 0600);
+            if (fd == -1)
+                return segment();
+
+            struct stat st;
+            if (::fstat(fd, &st) == -1 || st.st_size == 0)
+            {
+                ::close(fd);
+                return segment();
+            }
+
+            return segment(name, fd, static_cast<std::size_t>(st.st_size));
+        }
+
+        // remove the name of the segment from the system
+        void unlink()
+        {
+            if (!name_.empty())
+                ::shm_unlink(name_.c_str());
+        }
+
+        char* data() const
+        {
+            return data_;
+        }
+
+        std::size_t size() const
+        {
+            return size_;
+        }
+
+        std::string const& name() const
+        {
+            return name_;
+        }
+
+        explicit operator bool() const noexcept
+        {
+            return data_ != nullptr;
+        }
+
+    private:
+        segment(std::string const& name, int fd, std::size_t size)
+          : name_(name), data_(nullptr), size_(size)
+        {
+            void* p = ::mmap(nullptr, size, PROT_READ | PROT_WRITE,
+                MAP_SHARED, fd, 0);
+            int err = errno;
+            ::close(fd);
+
+            if (p == MAP_FAILED)
+            {
+                HPX_THROW_EXCEPTION(network_error,
+                    "shmem::segment::segment",
+                    "could not map shared memory segment " + name + ": " +
+                        std::strerror(err));
+            }
+            data_ = static_cast<char*>(p);
+        }
+
+        void unmap()
+        {
+            if (data_ != nullptr)
+            {
+                ::munmap(data_, size_);
+                data_ = nullptr;
+                size_ = 0;
+            }
+        }
+
+        std::string name_;
+        char* data_;
+        std::size_t size_;
+    };
+
+    // The names of the segments used by the parcelport are derived from the
+    // process ids of the participating localities
+    inline std::string mailbox_name(std::int32_t pid)
+    {
+        return "/hpx_shmem_" + std::to_string(pid);
+    }
+
+    inline std::string channel_name(std::int32_t src, std::int32_t dest)
+    {
+        return "/hpx_shmem_" + std::to_string(src) + "_" + std::to_string(dest);
+    }
+}}}}
+
+#endif
+
+#endif
@@ -0,0 +1,203 @@
+//  Copyright (c) 2026 agent
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef HPX_PARCELSET_POLICIES_SHMEM_SENDER_HPP
+#define HPX_PARCELSET_POLICIES_SHMEM_SENDER_HPP
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_PARCELPORT_SHMEM)
+
+#include <hpx/error_code.hpp>
+#include <hpx/lcos/local/spinlock.hpp>
+#include <hpx/plugins/parcelport/shmem/channel.hpp>
+#include <hpx/plugins/parcelport/shmem/locality.hpp>
+#include <hpx/plugins/parcelport/shmem/mailbox.hpp>
+#include <hpx/plugins/parcelport/shmem/sender_connection.hpp>
+#include <hpx/throw_exception.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <utility>
+
+namespace hpx { namespace parcelset { namespace policies { namespace shmem
+{
+    struct sender
+    {
+        typedef
+            sender_connection
+            connection_type;
+        typedef std::shared_ptr<connection_type> connection_ptr;
+        typedef std::deque<connection_ptr> connection_list;
+
+        typedef hpx::lcos::local::spinlock mutex_type;
+
+        sender(std::int32_t pid, std::size_t ring_size, std::size_t heap_size,
+                std::size_t zero_copy_threshold)
+          : pid_(pid)
+          , ring_size_(ring_size)
+          , heap_size_(heap_size)
+          , zero_copy_threshold_(zero_copy_threshold)
+        {
+        }
+
+        ~sender()
+        {
+            // remove the names of all channels which have not been picked up
+            // by the receiving locality
+            for (auto& c : channels_)
+                c.second->channel_.unlink();
+        }
+
+        // Check whether the given locality on this node can be reached
+        // through shared memory, the result is cached.
+        bool can_connect(std::int32_t dest)
+        {
+            std::unique_lock<mutex_type> l(channels_mtx_);
+            auto it = reachable_.find(dest);
+            if (it != reachable_.end())
+                return it->second;
+
+            l.unlock();
+            bool result = static_cast<bool>(mailbox::open(dest));
+
+            l.lock();
+            reachable_[dest] = result;
+            return result;
+        }
+
+        connection_ptr create_connection(locality const& there,
+            parcelset::parcelport* pp, error_code& ec)
+        {
+            std::shared_ptr<sender_channel> c = get_channel(there.pid(), ec);
+            if (!c)
+                return connection_ptr();
+
+            return std::make_shared<connection_type>(
+                this, c, there, zero_copy_threshold_, pp);
+        }
+
+        void add(connection_ptr const & ptr)
+        {
+            std::unique_lock<mutex_type> l(connections_mtx_);
+            connections_.push_back(ptr);
+        }
+
+        void send_messages(
+            connection_ptr connection
+        )
+        {
+            // Check if sending has been completed....
+            if (connection->send())
+            {
+                error_code ec;
+                util::unique_function_nonser<
+                    void(
+                        error_code const&
+                      , parcelset::locality const&
+                      , connection_ptr
+                    )
+                > postprocess_handler;
+                std::swap(postprocess_handler, connection->postprocess_handler_);
+                postprocess_handler(
+                    ec, connection->destination(), connection);
+            }
+            else
+            {
+                std::unique_lock<mutex_type> l(connections_mtx_);
+                connections_.push_back(std::move(connection));
+            }
+        }
+
+        bool background_work()
+        {
+            connection_ptr connection;
+            {
+                std::unique_lock<mutex_type> l(connections_mtx_, std::try_to_lock);
+                if(l && !connections_.empty())
+                {
+                    connection = std::move(connections_.front());
+                    connections_.pop_front();
+                }
+            }
+            bool has_work = false;
+            if(connection)
+            {
+                send_messages(std::move(connection));
+                has_work = true;
+            }
+            return has_work;
+        }
+
+    private:
+        // Return the channel to the given locality, the channel is created
+        // and announced to the receiving locality on first use.
+        std::shared_ptr<sender_channel> get_channel(std::int32_t dest,
+            error_code& ec)
+        {
+            std::unique_lock<mutex_type> l(channels_mtx_);
+
+            auto it = channels_.find(dest);
+            if (it != channels_.end())
+            {
+                if (&ec != &throws)
+                    ec = make_success_code();
+                return it->second;
+            }
+
+            mailbox m = mailbox::open(dest);
+            if (!m)
+            {
+                l.unlock();
+                HPX_THROWS_IF(ec, network_error,
+                    "shmem::sender::get_channel",
+                    "could not open the shared memory mailbox of locality " +
+                        std::to_string(dest));
+                return std::shared_ptr<sender_channel>();
+            }
+
+            std::shared_ptr<sender_channel> c =
+                std::make_shared<sender_channel>(channel::create(
+                    channel_name(pid_, dest), ring_size_, heap_size_));
+
+            if (!m.post(pid_))
+            {
+                c->channel_.unlink();
+                l.unlock();
+                HPX_THROWS_IF(ec, network_error,
+                    "shmem::sender::get_channel",
+                    "the shared memory mailbox of locality " +
+                        std::to_string(dest) + " is full");
+                return std::shared_ptr<sender_channel>();
+            }
+
+            channels_.insert(std::make_pair(dest, c));
+
+            if (&ec != &throws)
+                ec = make_success_code();
+            return c;
+        }
+
+        std::int32_t pid_;
+        std::size_t ring_size_;
+        std::size_t heap_size_;
+        std::size_t zero_copy_threshold_;
+
+        mutex_type channels_mtx_;
+        std::map<std::int32_t, std::shared_ptr<sender_channel> > channels_;
+        std::map<std::int32_t, bool> reachable_;
+
+        mutex_type connections_mtx_;
+        connection_list connections_;
+    };
+}}}}
+
+#endif
+
+#endif
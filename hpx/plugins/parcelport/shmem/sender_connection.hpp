@@ -0,0 +1,279 @@
+//  Copyright (c) 2026 agent
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef HPX_PARCELSET_POLICIES_SHMEM_SENDER_CONNECTION_HPP
+#define HPX_PARCELSET_POLICIES_SHMEM_SENDER_CONNECTION_HPP
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_PARCELPORT_SHMEM)
+
+#include <hpx/performance_counters/parcels/gatherer.hpp>
+#include <hpx/plugins/parcelport/shmem/channel.hpp>
+#include <hpx/plugins/parcelport/shmem/locality.hpp>
+#include <hpx/runtime/parcelset/parcelport.hpp>
+#include <hpx/runtime/parcelset/parcelport_connection.hpp>
+#include <hpx/runtime/parcelset_fwd.hpp>
+#include <hpx/runtime/serialization/serialization_chunk.hpp>
+#include <hpx/util/high_resolution_timer.hpp>
+#include <hpx/util/unique_function.hpp>
+
+#include <boost/atomic.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <utility>
+#include <vector>
+
+namespace hpx { namespace parcelset { namespace policies { namespace shmem
+{
+    struct sender;
+    struct sender_connection;
+
+    void add_connection(sender *, std::shared_ptr<sender_connection> const&);
+
+    // The sending end of a channel, all connections to the same destination
+    // share the channel. A message is always written as a whole before the
+    // channel can be used by the next connection.
+    struct sender_channel
+    {
+        explicit sender_channel(channel && c)
+          : channel_(std::move(c)), owner_(nullptr)
+        {}
+
+        bool acquire(void const* owner)
+        {
+            void const* expected = nullptr;
+            return owner_.compare_exchange_strong(expected, owner,
+                    boost::memory_order_acquire) ||
+                expected == owner;
+        }
+
+        void release()
+        {
+            owner_.store(nullptr, boost::memory_order_release);
+        }
+
+        channel channel_;
+        boost::atomic<void const*> owner_;
+    };
+
+    struct sender_connection
+      : parcelset::parcelport_connection<
+            sender_connection
+          , std::vector<char>
+        >
+    {
+    private:
+        typedef sender sender_type;
+
+        typedef std::vector<char> data_type;
+
+        typedef
+            parcelset::parcelport_connection<sender_connection, data_type>
+            base_type;
+
+        // a contiguous part of the message which has to be written to the
+        // ring buffer
+        struct piece
+        {
+            char const* data_;
+            std::size_t size_;
+        };
+
+    public:
+        sender_connection(
+            sender_type * s
+          , std::shared_ptr<sender_channel> const& c
+          , locality const& there
+          , std::size_t zero_copy_threshold
+          , parcelset::parcelport* pp
+        )
+          : sender_(s)
+          , channel_(c)
+          , zero_copy_threshold_(zero_copy_threshold)
+          , piece_idx_(0)
+          , piece_offset_(0)
+          , pp_(pp)
+          , there_(parcelset::locality(there))
+        {
+        }
+
+        parcelset::locality const& destination() const
+        {
+            return there_;
+        }
+
+        void verify(parcelset::locality const & parcel_locality_id) const
+        {
+        }
+
+        template <typename Handler, typename ParcelPostprocess>
+        void async_write(Handler && handler, ParcelPostprocess && parcel_postprocess)
+        {
+            HPX_ASSERT(!handler_);
+            HPX_ASSERT(!postprocess_handler_);
+            HPX_ASSERT(!buffer_.data_.empty());
+
+            buffer_.data_point_.time_ = timer_.elapsed_nanoseconds();
+            pieces_.clear();
+            piece_idx_ = 0;
+            piece_offset_ = 0;
+
+            handler_ = std::forward<Handler>(handler);
+
+            if(!send())
+            {
+                postprocess_handler_
+                    = std::forward<ParcelPostprocess>(parcel_postprocess);
+                add_connection(sender_, shared_from_this());
+            }
+            else
+            {
+                HPX_ASSERT(!handler_);
+                error_code ec;
+                parcel_postprocess(ec, there_, shared_from_this());
+            }
+        }
+
+        // Write as much of the message as the ring buffer can take, returns
+        // true if the whole message has been written.
+        bool send()
+        {
+            if (!channel_->acquire(this))
+                return false;       // another message is being written
+
+            if (pieces_.empty())
+                prepare();
+
+            channel& c = channel_->channel_;
+            while (piece_idx_ != pieces_.size())
+            {
+                piece const& p = pieces_[piece_idx_];
+                piece_offset_ += c.write(p.data_ + piece_offset_,
+                    p.size_ - piece_offset_);
+
+                if (piece_offset_ != p.size_)
+                    return false;   // the ring buffer is full
+
+                ++piece_idx_;
+                piece_offset_ = 0;
+            }
+
+            channel_->release();
+            return done();
+        }
+
+        bool done()
+        {
+            error_code ec;
+            handler_(ec);
+            handler_.reset();
+            buffer_.data_point_.time_ =
+                timer_.elapsed_nanoseconds() - buffer_.data_point_.time_;
+            pp_->add_sent_data(buffer_.data_point_);
+            pp_->reclaim_buffer(std::move(buffer_.data_));
+            buffer_.clear();
+            pieces_.clear();
+            offsets_.clear();
+
+            return true;
+        }
+
+        util::unique_function_nonser<
+            void(
+                error_code const&
+              , parcelset::locality const&
+              , std::shared_ptr<sender_connection>
+            )
+        > postprocess_handler_;
+
+    private:
+        // Collect the parts of the message, the layout is the same as used by
+        // the TCP parcelport. Each zero-copy chunk is preceded by the offset
+        // of the heap block holding its data, chunks which could not be
+        // placed into the heap are written to the ring buffer directly.
+        void prepare()
+        {
+            add_piece(&buffer_.size_, sizeof(buffer_.size_));
+            add_piece(&buffer_.data_size_, sizeof(buffer_.data_size_));
+            add_piece(&buffer_.num_chunks_, sizeof(buffer_.num_chunks_));
+
+            std::vector<parcel_buffer_type::transmission_chunk_type>& chunks =
+                buffer_.transmission_chunks_;
+            if (!chunks.empty())
+            {
+                add_piece(chunks.data(), chunks.size() *
+                    sizeof(parcel_buffer_type::transmission_chunk_type));
+            }
+
+            add_piece(buffer_.data_.data(), buffer_.data_.size());
+
+            if (!chunks.empty())
+            {
+                // the offsets are referenced by the pieces, they may not be
+                // reallocated
+                offsets_.reserve(chunks.size());
+
+                channel& c = channel_->channel_;
+                for (serialization::serialization_chunk& sc : buffer_.chunks_)
+                {
+                    if (sc.type_ != serialization::chunk_type_pointer)
+                        continue;
+
+                    std::uint64_t offset = channel::npos;
+                    if (sc.size_ >= zero_copy_threshold_)
+                    {
+                        offset = c.allocate(sc.size_);
+                        if (offset != channel::npos)
+                        {
+                            std::memcpy(c.heap_data(offset), sc.data_.cpos_,
+                                sc.size_);
+                        }
+                    }
+
+                    offsets_.push_back(offset);
+                    add_piece(&offsets_.back(), sizeof(std::uint64_t));
+
+                    if (offset == channel::npos)
+                        add_piece(sc.data_.cpos_, sc.size_);
+                }
+            }
+        }
+
+        void add_piece(void const* data, std::size_t size)
+        {
+            piece p = { static_cast<char const*>(data), size };
+            pieces_.push_back(p);
+        }
+
+        sender_type * sender_;
+        std::shared_ptr<sender_channel> channel_;
+        std::size_t zero_copy_threshold_;
+
+        util::unique_function_nonser<
+            void(
+                error_code const&
+            )
+        > handler_;
+
+        std::vector<piece> pieces_;
+        std::vector<std::uint64_t> offsets_;
+        std::size_t piece_idx_;
+        std::size_t piece_offset_;
+
+        util::high_resolution_timer timer_;
+
+        parcelset::parcelport* pp_;
+
+        parcelset::locality there_;
+    };
+}}}}
+
+#endif
+
+#endif
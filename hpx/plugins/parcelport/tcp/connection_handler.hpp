@@ -48,6 +48,7 @@ namespace hpx { namespace parcelset
         typedef std::true_type  send_early_parcel;
         typedef std::false_type do_background_work;
         typedef std::false_type send_immediate_parcels;
+        typedef std::true_type  send_multiple_messages;
 
         static const char * type()
         {
@@ -118,6 +119,9 @@ namespace hpx { namespace parcelset
             /// Acceptor used to listen for incoming connections.
             boost::asio::ip::tcp::acceptor* acceptor_;
 
+            /// Number of unacknowledged messages allowed per connection
+            std::size_t pipeline_window_;
+
             /// The list of accepted connections
             mutable lcos::local::spinlock connections_mtx_;
 
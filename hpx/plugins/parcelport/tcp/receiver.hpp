@@ -33,6 +33,7 @@
 #include <boost/asio/write.hpp>
 #include <boost/atomic.hpp>
 
+#include <algorithm>
 #include <cstddef>
 #include <cstdint>
 #include <memory>
@@ -45,21 +46,31 @@ namespace hpx { namespace parcelset { namespace policies { namespace tcp
 {
     class connection_handler;
 
+    // Every received message is acknowledged by a single byte. The
+    // acknowledgments are written asynchronously while the next message is
+    // being read already, acknowledgments which accumulate while a write is
+    // in flight are coalesced into a single write. This allows for the
+    // sender to keep more than one message in flight on a connection.
     class receiver
       : public parcelport_connection<receiver, std::vector<char>, std::vector<char> >
     {
         typedef hpx::lcos::local::spinlock mutex_type;
+        enum { ack_buffer_size = 64 };
+
     public:
         receiver(boost::asio::io_service& io_service, std::uint64_t max_inbound_size,
             connection_handler& parcelport)
           : socket_(io_service)
           , max_inbound_size_(max_inbound_size)
-          , ack_(0)
           , parcelport_(parcelport)
           , timer_()
           , mtx_()
           , operation_in_flight_(0)
-        {}
+          , acks_pending_(0)
+          , ack_write_in_flight_(false)
+        {
+            std::fill(acks_, acks_ + ack_buffer_size, char(1));
+        }
 
         ~receiver()
         {
@@ -122,14 +133,20 @@ namespace hpx { namespace parcelset { namespace policies { namespace tcp
 
         void shutdown()
         {
-            std::lock_guard<mutex_type> lk(mtx_);
-            // gracefully and portably shutdown the socket
-            boost::system::error_code ec;
-            if (socket_.is_open()) {
-                socket_.shutdown(boost::asio::ip::tcp::socket::shutdown_both, ec);
-                socket_.close(ec);    // close the socket to give it back to the OS
+            {
+                std::lock_guard<mutex_type> lk(mtx_);
+                // gracefully and portably shutdown the socket
+                boost::system::error_code ec;
+                if (socket_.is_open()) {
+                    socket_.shutdown(
+                        boost::asio::ip::tcp::socket::shutdown_both, ec);
+                    // close the socket to give it back to the OS
+                    socket_.close(ec);
+                }
             }
 
+            // pending handlers might need to acquire the lock
+
             while(operation_in_flight_ != 0)
             {
                 if(threads::get_self_ptr())
@@ -145,7 +162,8 @@ namespace hpx { namespace parcelset { namespace policies { namespace tcp
         void handle_read_header(boost::system::error_code const& e,
             std::size_t bytes_transferred, Handler handler)
         {
-            HPX_ASSERT(operation_in_flight_ == 0);
+            // an acknowledgment might be written concurrently
+            HPX_ASSERT(operation_in_flight_ <= 1);
             if (e) {
                 handler(e);
 
@@ -167,6 +185,14 @@ namespace hpx { namespace parcelset { namespace policies { namespace tcp
 
                 buffer_.data_point_.bytes_ = static_cast<std::size_t>(inbound_size);
 
+                // take the buffer for the main message from the pool of
+                // recycled buffers of the parcelport
+                if (buffer_.data_.capacity() < inbound_size)
+                {
+                    buffer_.data_ = parcelport_.get_buffer(
+                        static_cast<std::size_t>(inbound_size));
+                }
+
                 // receive buffers
                 std::vector<boost::asio::mutable_buffer> buffers;
 
@@ -310,16 +336,12 @@ namespace hpx { namespace parcelset { namespace policies { namespace tcp
                 buffer_.data_point_.time_ = timer_.elapsed_nanoseconds() -
                     buffer_.data_point_.time_;
 
-                // now send acknowledgment byte
-                void (receiver::*f)(boost::system::error_code const&,
-                        Handler)
-                    = &receiver::handle_write_ack<Handler>;
-
-                // decode the received parcels.
+                // decode the received parcels, the buffer is handed over
+                // without copying the received data
                 decode_parcels(parcelport_, std::move(buffer_), -1);
                 buffer_ = parcel_buffer_type();
 
-                ack_ = true;
+                // now send acknowledgment byte
                 {
                     std::unique_lock<mutex_type> lk(mtx_);
                     if(!socket_.is_open())
@@ -328,41 +350,94 @@ namespace hpx { namespace parcelset { namespace policies { namespace tcp
                         // report this problem back to the handler
                         handler(boost::asio::error::make_error_code(
                             boost::asio::error::not_connected));
+                        --operation_in_flight_;
                         return;
                     }
-                    boost::asio::async_write(socket_,
-                        boost::asio::buffer(&ack_, sizeof(ack_)),
-                        util::bind(f, shared_from_this(),
-                            boost::asio::placeholders::error,
-                            util::protect(handler)));
+
+                    ++acks_pending_;
+                    if (!ack_write_in_flight_)
+                        write_acks_locked(handler);
                 }
+
+                // Inform caller that data has been received ok.
+                handler(e);
+                --operation_in_flight_;
+
+                // Issue a read operation to read the next parcel, this does
+                // not wait for the acknowledgment to be written.
+                async_read(handler);
             }
         }
 
+        // write all pending acknowledgments, mtx_ must be held
         template <typename Handler>
-        void handle_write_ack(boost::system::error_code const& e,
+        void write_acks_locked(Handler handler)
+        {
+            HPX_ASSERT(acks_pending_ != 0);
+
+            std::size_t count = (std::min)(acks_pending_,
+                std::size_t(ack_buffer_size));
+            acks_pending_ -= count;
+
+            ack_write_in_flight_ = true;
+            ++operation_in_flight_;
+
+            void (receiver::*f)(boost::system::error_code const&, Handler)
+                = &receiver::handle_write_acks<Handler>;
+
+            boost::asio::async_write(socket_,
+                boost::asio::buffer(acks_, count),
+                util::bind(f, shared_from_this(),
+                    boost::asio::placeholders::error,
+                    util::protect(handler)));
+        }
+
+        template <typename Handler>
+        void handle_write_acks(boost::system::error_code const& e,
             Handler handler)
         {
             HPX_ASSERT(operation_in_flight_ != 0);
-            // Inform caller that data has been received ok.
-            handler(e);
-            --operation_in_flight_;
+            if (e)
+            {
+                {
+                    // the sender would wait for the lost acknowledgments,
+                    // close the connection which aborts the pending read
+                    // operation as well
+                    std::lock_guard<mutex_type> lk(mtx_);
+                    ack_write_in_flight_ = false;
+                    acks_pending_ = 0;
+
+                    boost::system::error_code ec;
+                    if (socket_.is_open()) {
+                        socket_.shutdown(
+                            boost::asio::ip::tcp::socket::shutdown_both, ec);
+                        socket_.close(ec);
+                    }
+                }
+
+                // report this problem back to the handler
+                handler(e);
+                --operation_in_flight_;
+                return;
+            }
 
-            // Issue a read operation to read the next parcel.
-            if (!e)
             {
-                async_read(handler);
+                std::lock_guard<mutex_type> lk(mtx_);
+                ack_write_in_flight_ = false;
+
+                // send the acknowledgments which have accumulated meanwhile
+                if (acks_pending_ != 0 && socket_.is_open())
+                    write_acks_locked(handler);
             }
-        }
 
+            --operation_in_flight_;
+        }
 
         /// Socket for the parcelport_connection.
         boost::asio::ip::tcp::socket socket_;
 
         std::uint64_t max_inbound_size_;
 
-        bool ack_;
-
         /// The handler used to process the incoming request.
         connection_handler& parcelport_;
 
@@ -371,6 +446,11 @@ namespace hpx { namespace parcelset { namespace policies { namespace tcp
 
         mutex_type mtx_;
         hpx::util::atomic_count operation_in_flight_;
+
+        /// Acknowledgments not written yet, protected by mtx_.
+        std::size_t acks_pending_;
+        bool ack_write_in_flight_;
+        char acks_[ack_buffer_size];
     };
 }}}}
 
@@ -24,15 +24,21 @@
 #include <hpx/util/high_resolution_timer.hpp>
 #include <hpx/util/unique_function.hpp>
 #include <hpx/util/asio_util.hpp>
+#include <hpx/util/steady_clock.hpp>
 
+#include <boost/asio/basic_waitable_timer.hpp>
 #include <boost/asio/buffer.hpp>
+#include <boost/asio/error.hpp>
 #include <boost/asio/io_service.hpp>
+#include <boost/asio/io_service_strand.hpp>
 #include <boost/asio/ip/tcp.hpp>
 #include <boost/asio/placeholders.hpp>
 #include <boost/asio/read.hpp>
 #include <boost/asio/write.hpp>
 #include <boost/atomic.hpp>
 
+#include <algorithm>
+#include <chrono>
 #include <cstddef>
 #include <memory>
 #include <utility>
@@ -40,19 +46,143 @@
 
 namespace hpx { namespace parcelset { namespace policies { namespace tcp
 {
+    namespace detail
+    {
+        // Consumes the acknowledgments which are still outstanding on a
+        // connection being closed. Closing the socket right away resets the
+        // connection and might discard messages not received by the other
+        // end yet. The socket is closed as soon as all acknowledgments have
+        // arrived, on error, or after the given deadline has expired.
+        class ack_drainer
+          : public std::enable_shared_from_this<ack_drainer>
+        {
+            enum { ack_buffer_size = 64 };
+
+            typedef boost::asio::basic_waitable_timer<
+                util::steady_clock> deadline_timer;
+
+        public:
+            ack_drainer(boost::asio::io_service& io_service,
+                    boost::asio::ip::tcp::socket&& socket,
+                    std::size_t unacknowledged)
+              : socket_(std::move(socket))
+              , timer_(io_service)
+              , strand_(io_service)
+              , unacknowledged_(unacknowledged)
+            {
+            }
+
+            ~ack_drainer()
+            {
+                close();
+            }
+
+            void start(util::steady_duration const& timeout)
+            {
+                timer_.expires_from_now(timeout.value());
+
+                // all handlers run on the strand, the timer and the read
+                // operation may complete concurrently otherwise
+                void (ack_drainer::*f)() = &ack_drainer::read_acks;
+                strand_.dispatch(util::bind(f, shared_from_this()));
+
+                void (ack_drainer::*on_timeout)(
+                    boost::system::error_code const&) =
+                        &ack_drainer::handle_timeout;
+
+                using util::placeholders::_1;
+                timer_.async_wait(strand_.wrap(
+                    util::bind(on_timeout, shared_from_this(), _1)));
+            }
+
+        private:
+            void read_acks()
+            {
+                if (!socket_.is_open())
+                    return;
+
+                void (ack_drainer::*f)(boost::system::error_code const&,
+                    std::size_t) = &ack_drainer::handle_read_ack;
+
+                using util::placeholders::_1;
+                using util::placeholders::_2;
+                socket_.async_read_some(
+                    boost::asio::buffer(acks_, (std::min)(
+                        unacknowledged_, std::size_t(ack_buffer_size))),
+                    strand_.wrap(util::bind(f, shared_from_this(), _1, _2)));
+            }
+
+            void handle_read_ack(boost::system::error_code const& e,
+                std::size_t bytes)
+            {
+                HPX_ASSERT(bytes <= unacknowledged_);
+                unacknowledged_ -= bytes;
+
+                if (e || unacknowledged_ == 0)
+                {
+                    close();
+                    return;
+                }
+                read_acks();
+            }
+
+            void handle_timeout(boost::system::error_code const& e)
+            {
+                // the timer is canceled once the socket has been closed
+                if (e != boost::asio::error::operation_aborted)
+                    close();
+            }
+
+            void close()
+            {
+                boost::system::error_code ec;
+                timer_.cancel(ec);
+
+                // gracefully and portably shutdown the socket, this aborts
+                // the pending read operation, if any
+                if (socket_.is_open())
+                {
+                    socket_.shutdown(
+                        boost::asio::ip::tcp::socket::shutdown_both, ec);
+                    socket_.close(ec);
+                }
+            }
+
+            boost::asio::ip::tcp::socket socket_;
+            deadline_timer timer_;
+            boost::asio::io_service::strand strand_;
+            std::size_t unacknowledged_;
+            char acks_[ack_buffer_size];
+        };
+    }
+
+    // The receiver acknowledges every message with a single byte. The sender
+    // keeps up to pipeline_window messages in flight on a connection before
+    // waiting for acknowledgments. A window of one results in stop-and-wait
+    // behavior, i.e. a connection is not reused before the previous message
+    // has been acknowledged.
     class sender
       : public parcelset::parcelport_connection<sender, std::vector<char> >
     {
+        enum { ack_buffer_size = 64 };
+
+        // the time (in milliseconds) granted to outstanding acknowledgments
+        // after the connection has been released
+        enum { ack_drain_timeout = 1000 };
+
     public:
         /// Construct a sending parcelport_connection with the given io_service.
         sender(boost::asio::io_service& io_service,
                 parcelset::locality const& locality_id,
-                parcelset::parcelport* pp)
-          : socket_(io_service)
-          , ack_(0)
+                parcelset::parcelport* pp,
+                std::size_t pipeline_window = HPX_PARCEL_TCP_PIPELINE_WINDOW)
+          : io_service_(io_service)
+          , socket_(io_service)
           , there_(locality_id)
           , timer_()
           , pp_(pp)
+          , pipeline_window_((std::max)(pipeline_window, std::size_t(1)))
+          , unacknowledged_(0)
         {
         }
 
@@ -60,7 +190,19 @@ namespace hpx { namespace parcelset { namespace policies { namespace tcp
         {
             // gracefully and portably shutdown the socket
             if (socket_.is_open()) {
+                // closing the socket might discard messages not received by
+                // the other end yet, the remaining acknowledgments are
+                // consumed asynchronously (with a deadline) before closing it
                 boost::system::error_code ec;
+                read_available_acks(ec);
+                if (!ec && unacknowledged_ != 0)
+                {
+                    std::make_shared<detail::ack_drainer>(io_service_,
+                        std::move(socket_), unacknowledged_
+                    )->start(std::chrono::milliseconds(ack_drain_timeout));
+                    return;
+                }
+
                 socket_.shutdown(boost::asio::ip::tcp::socket::shutdown_both, ec);
                 socket_.close(ec);    // close the socket to give it back to the OS
             }
@@ -118,29 +260,60 @@ namespace hpx { namespace parcelset { namespace policies { namespace tcp
             buffer_.data_point_.time_ = timer_.elapsed_nanoseconds();
 
             // Write the serialized data to the socket. We use "gather-write"
-            // to send both the header and the data in a single write operation.
+            // to send both the header and the data of all messages in a
+            // single write operation.
             std::vector<boost::asio::const_buffer> buffers;
-            buffers.push_back(boost::asio::buffer(&buffer_.size_,
-                sizeof(buffer_.size_)));
-            buffers.push_back(boost::asio::buffer(&buffer_.data_size_,
-                sizeof(buffer_.data_size_)));
+            add_message_buffers(buffers, buffer_);
+            for (parcel_buffer_type& segment : segments_)
+            {
+                segment.data_point_.time_ = buffer_.data_point_.time_;
+                add_message_buffers(buffers, segment);
+            }
+
+            // this additional wrapping of the handler into a bind object is
+            // needed to keep  this parcelport_connection object alive for the whole
+            // write operation
+            void (sender::*f)(boost::system::error_code const&, std::size_t)
+                = &sender::handle_write;
+
+            using util::placeholders::_1;
+            using util::placeholders::_2;
+            boost::asio::async_write(socket_, buffers,
+                util::bind(f, shared_from_this(), _1, _2));
+        }
+
+        /// additional messages which are written together with buffer_, these
+        /// are received as separate messages in the same order
+        std::vector<parcel_buffer_type> segments_;
+
+    private:
+        // add the header and the data of the given message to the list of
+        // buffers to write
+        static void add_message_buffers(
+            std::vector<boost::asio::const_buffer>& buffers,
+            parcel_buffer_type& buffer)
+        {
+            buffers.push_back(boost::asio::buffer(&buffer.size_,
+                sizeof(buffer.size_)));
+            buffers.push_back(boost::asio::buffer(&buffer.data_size_,
+                sizeof(buffer.data_size_)));
 
             // add chunk description
-            buffers.push_back(boost::asio::buffer(&buffer_.num_chunks_,
-                sizeof(buffer_.num_chunks_)));
+            buffers.push_back(boost::asio::buffer(&buffer.num_chunks_,
+                sizeof(buffer.num_chunks_)));
 
             std::vector<parcel_buffer_type::transmission_chunk_type>& chunks =
-                buffer_.transmission_chunks_;
+                buffer.transmission_chunks_;
             if (!chunks.empty()) {
                 buffers.push_back(
                     boost::asio::buffer(chunks.data(), chunks.size() *
                         sizeof(parcel_buffer_type::transmission_chunk_type)));
 
                 // add main buffer holding data which was serialized normally
-                buffers.push_back(boost::asio::buffer(buffer_.data_));
+                buffers.push_back(boost::asio::buffer(buffer.data_));
 
                 // now add chunks themselves, those hold zero-copy serialized chunks
-                for (serialization::serialization_chunk& c : buffer_.chunks_)
+                for (serialization::serialization_chunk& c : buffer.chunks_)
                 {
                     if (c.type_ == serialization::chunk_type_pointer)
                         buffers.push_back(boost::asio::buffer(c.data_.cpos_, c.size_));
@@ -148,22 +321,10 @@ namespace hpx { namespace parcelset { namespace policies { namespace tcp
             }
             else {
                 // add main buffer holding data which was serialized normally
-                buffers.push_back(boost::asio::buffer(buffer_.data_));
+                buffers.push_back(boost::asio::buffer(buffer.data_));
             }
-
-            // this additional wrapping of the handler into a bind object is
-            // needed to keep  this parcelport_connection object alive for the whole
-            // write operation
-            void (sender::*f)(boost::system::error_code const&, std::size_t)
-                = &sender::handle_write;
-
-            using util::placeholders::_1;
-            using util::placeholders::_2;
-            boost::asio::async_write(socket_, buffers,
-                util::bind(f, shared_from_this(), _1, _2));
         }
 
-    private:
         /// handle completed write operation
         void handle_write(boost::system::error_code const& e, std::size_t bytes)
         {
@@ -193,28 +354,88 @@ namespace hpx { namespace parcelset { namespace policies { namespace tcp
                 timer_.elapsed_nanoseconds() - buffer_.data_point_.time_;
             pp_->add_sent_data(buffer_.data_point_);
 
-            // now handle the acknowledgment byte which is sent by the receiver
+            // the message is owned by the socket now, the buffer can be reused
+            pp_->reclaim_buffer(std::move(buffer_.data_));
+            buffer_.clear();
+            ++unacknowledged_;
+
+            // the same applies to all additional messages written along
+            for (parcel_buffer_type& segment : segments_)
+            {
+                segment.data_point_.time_ =
+                    timer_.elapsed_nanoseconds() - segment.data_point_.time_;
+                pp_->add_sent_data(segment.data_point_);
+                pp_->reclaim_buffer(std::move(segment.data_));
+                ++unacknowledged_;
+            }
+            segments_.clear();
+
+            // consume all acknowledgments which have arrived in the meantime
+            boost::system::error_code ec;
+            read_available_acks(ec);
+
+            if (!ec && unacknowledged_ < pipeline_window_)
+            {
+                // the connection can be reused right away
+                call_postprocess_handler(ec);
+                return;
+            }
+
+            // now handle the acknowledgment bytes which are sent by the
+            // receiver
 #if defined(__linux) || defined(linux) || defined(__linux__)
             boost::asio::detail::socket_option::boolean<
                 IPPROTO_TCP, TCP_QUICKACK> quickack(true);
-            socket_.set_option(quickack);
+            socket_.set_option(quickack, ec);
 #endif
 
-            void (sender::*f)(boost::system::error_code const&)
+            void (sender::*f)(boost::system::error_code const&, std::size_t)
                 = &sender::handle_read_ack;
 
             using util::placeholders::_1;
-            boost::asio::async_read(socket_,
-                boost::asio::buffer(&ack_, sizeof(ack_)),
-                util::bind(f, shared_from_this(), _1));
+            using util::placeholders::_2;
+            socket_.async_read_some(
+                boost::asio::buffer(acks_, (std::min)(
+                    unacknowledged_, std::size_t(ack_buffer_size))),
+                util::bind(f, shared_from_this(), _1, _2));
         }
 
-        void handle_read_ack(boost::system::error_code const& e)
+        void handle_read_ack(boost::system::error_code const& e,
+            std::size_t bytes)
         {
 #if defined(HPX_TRACK_STATE_OF_OUTGOING_TCP_CONNECTION)
             state_ = state_handle_read_ack;
 #endif
-            buffer_.clear();
+            HPX_ASSERT(bytes <= unacknowledged_);
+            unacknowledged_ -= bytes;
+
+            call_postprocess_handler(e);
+        }
+
+        // consume the acknowledgments which can be read without blocking
+        void read_available_acks(boost::system::error_code& ec)
+        {
+            while (unacknowledged_ != 0)
+            {
+                std::size_t available = socket_.available(ec);
+                if (ec || available == 0)
+                    return;
+
+                std::size_t bytes = socket_.read_some(
+                    boost::asio::buffer(acks_, (std::min)(available,
+                        (std::min)(unacknowledged_,
+                            std::size_t(ack_buffer_size)))),
+                    ec);
+                if (ec)
+                    return;
+
+                HPX_ASSERT(bytes <= unacknowledged_);
+                unacknowledged_ -= bytes;
+            }
+        }
+
+        void call_postprocess_handler(boost::system::error_code const& e)
+        {
             // Call post-processing handler, which will send remaining pending
             // parcels. Pass along the connection so it can be reused if more
             // parcels have to be sent.
@@ -229,11 +450,12 @@ namespace hpx { namespace parcelset { namespace policies { namespace tcp
             postprocess_handler(e, there_, shared_from_this());
         }
 
+        /// the io_service the connection is associated with
+        boost::asio::io_service& io_service_;
+
         /// Socket for the parcelport_connection.
         boost::asio::ip::tcp::socket socket_;
 
-        bool ack_;
-
         /// the other (receiving) end of this connection
         parcelset::locality there_;
 
@@ -241,6 +463,13 @@ namespace hpx { namespace parcelset { namespace policies { namespace tcp
         util::high_resolution_timer timer_;
         parcelset::parcelport* pp_;
 
+        /// Flow control, the number of messages which have been sent but
+        /// not acknowledged yet. This is accessed only by the current owner
+        /// of the connection.
+        std::size_t pipeline_window_;
+        std::size_t unacknowledged_;
+        char acks_[ack_buffer_size];
+
         util::unique_function_nonser<
             void(
                 boost::system::error_code const&
@@ -96,6 +96,11 @@ namespace hpx { namespace plugins
                 "max_outbound_message_size =  ${HPX_PARCEL_" + name_uc +
                     "_MAX_OUTBOUND_MESSAGE_SIZE"
                     + ":$[hpx.parcel.max_outbound_message_size]}",
+                "buffer_pool_size =  ${HPX_PARCEL_" + name_uc +
+                    "_BUFFER_POOL_SIZE:$[hpx.parcel.buffer_pool_size]}",
+                "parallel_encoding_segment_size =  ${HPX_PARCEL_" + name_uc +
+                    "_PARALLEL_ENCODING_SEGMENT_SIZE"
+                    ":$[hpx.parcel.parallel_encoding_segment_size]}",
                 "array_optimization = ${HPX_PARCEL_" + name_uc +
                     "_ARRAY_OPTIMIZATION:$[hpx.parcel.array_optimization]}",
                 "zero_copy_optimization = ${HPX_PARCEL_" + name_uc +
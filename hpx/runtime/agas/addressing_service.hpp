@@ -26,10 +26,16 @@
 #include <hpx/runtime/naming/name.hpp>
 #include <hpx/runtime/parcelset_fwd.hpp>
 #include <hpx/state.hpp>
+#if defined(HPX_HAVE_AGAS_SHARDED_GVA_CACHE)
+#include <hpx/lcos/local/no_mutex.hpp>
+#include <hpx/util/cache/sharded_cache.hpp>
+#else
 #include <hpx/util/cache/lru_cache.hpp>
 #include <hpx/util/cache/statistics/local_full_statistics.hpp>
+#endif
 #include <hpx/util_fwd.hpp>
 #include <hpx/util/function.hpp>
+#include <hpx/util/tuple.hpp>
 
 #include <boost/atomic.hpp>
 #include <boost/dynamic_bitset.hpp>
@@ -75,17 +81,30 @@ public:
     // {{{ gva cache
     struct gva_cache_key;
 
+#if defined(HPX_HAVE_AGAS_SHARDED_GVA_CACHE)
+    struct gva_cache_key_blocks;
+
+    // the sharded cache synchronizes concurrent accesses itself
+    typedef hpx::util::cache::sharded_cache<
+        gva_cache_key
+      , gva
+      , gva_cache_key_blocks
+    > gva_cache_type;
+    typedef hpx::lcos::local::no_mutex gva_cache_mutex_type;
+#else
     typedef hpx::util::cache::lru_cache<
         gva_cache_key
       , gva
       , hpx::util::cache::statistics::local_full_statistics
     > gva_cache_type;
+    typedef mutex_type gva_cache_mutex_type;
+#endif
     // }}}
 
     typedef std::set<naming::gid_type> migrated_objects_table_type;
     typedef std::map<naming::gid_type, std::int64_t> refcnt_requests_type;
 
-    mutable mutex_type gva_cache_mtx_;
+    mutable gva_cache_mutex_type gva_cache_mtx_;
     std::shared_ptr<gva_cache_type> gva_cache_;
 
     mutable mutex_type migrated_objects_mtx_;
@@ -234,6 +253,18 @@ protected:
       , naming::gid_type const& id
       , gva const& g
         );
+    std::vector<bool> bind_many_postproc(
+        future<std::vector<bool> > f
+      , std::vector<primary_namespace::bind_gid_request_type> const& requests
+        );
+    std::vector<naming::address> resolve_full_many_postproc(
+        future<std::vector<primary_namespace::resolved_type> > f
+      , std::vector<naming::gid_type> const& ids
+        );
+    std::vector<std::int64_t> incref_many_postproc(
+        future<std::vector<std::int64_t> > f
+      , std::vector<std::int64_t> const& compensated_credits
+        );
 
     /// Maintain list of migrated objects
     bool was_object_migrated_locked(
@@ -666,6 +697,25 @@ public:
             naming::get_gid_from_locality_id(locality_id));
     }
 
+    /// \brief Bind multiple ranges of global ids to local addresses
+    ///
+    /// Each request holds the arguments of a call to \a bind_range_async:
+    /// the lower id, the count, the base address, the offset, and the
+    /// locality the range is bound to. All requests which are managed by
+    /// the same locality are sent in one message, the bound ranges are put
+    /// into the local cache.
+    ///
+    /// \returns         A future referring to the results of the individual
+    ///                   bind operations (in the order of the requests).
+    typedef hpx::util::tuple<
+            naming::gid_type, std::uint64_t, naming::address, std::uint64_t,
+            naming::gid_type
+        > bind_range_request_type;
+
+    hpx::future<std::vector<bool> > bind_range_many(
+        std::vector<bind_range_request_type> const& requests
+        );
+
     /// \brief Unbind a global address
     ///
     /// Remove the association of the given global address with any local
@@ -993,6 +1043,22 @@ public:
         return resolve_async(id.get_gid());
     }
 
+    /// \brief Resolve multiple global addresses
+    ///
+    /// The ids which can't be resolved from the local cache are resolved
+    /// using one request per locality managing some of them. The resolved
+    /// addresses are put into the local cache.
+    ///
+    /// \returns         A future referring to the local addresses of the
+    ///                   given ids (in the order of the ids).
+    hpx::future<std::vector<naming::address> > resolve_async(
+        std::vector<naming::gid_type> const& ids
+        );
+
+    hpx::future<std::vector<naming::address> > resolve_async(
+        std::vector<naming::id_type> const& ids
+        );
+
     ///////////////////////////////////////////////////////////////////////////
     hpx::future<naming::id_type> get_colocation_id_async(
         naming::id_type const& id
@@ -1180,6 +1246,26 @@ public:
       , error_code& ec = throws
         );
 
+    /// \brief Increment the global reference counts for the given ids
+    ///
+    /// This is the bulk version of \a incref_async, the requests hold the
+    /// ids and the number of credits to add for each of them. All requests
+    /// which have to be sent to the same locality are sent in one message.
+    /// The caller has to keep the referenced objects alive until the
+    /// returned future becomes ready.
+    lcos::future<std::vector<std::int64_t> > incref_many(
+        std::vector<std::pair<naming::gid_type, std::int64_t> > const& requests
+        );
+
+    /// \brief Decrement the global reference counts for the given ids
+    ///
+    /// This is the bulk version of \a decref, the requests hold the ids and
+    /// the number of credits to remove for each of them.
+    void decref_many(
+        std::vector<std::pair<naming::gid_type, std::int64_t> > const& requests
+      , error_code& ec = throws
+        );
+
     /// \brief Invoke the supplied \a hpx#function for every registered global
     ///        name.
     ///
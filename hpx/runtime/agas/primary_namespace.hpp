@@ -30,6 +30,10 @@ struct HPX_EXPORT primary_namespace
 {
     typedef hpx::util::tuple<naming::gid_type, gva, naming::gid_type>
         resolved_type;
+    typedef hpx::util::tuple<gva, naming::gid_type, naming::gid_type>
+        bind_gid_request_type;
+    typedef hpx::util::tuple<std::int64_t, naming::gid_type, naming::gid_type>
+        credit_request_type;
 
     static naming::gid_type get_service_instance(std::uint32_t service_locality_id);
 
@@ -81,6 +85,18 @@ struct HPX_EXPORT primary_namespace
       , naming::gid_type upper
         );
 
+    // Bulk operations: all requests are sent to the service instance
+    // managing the first id, i.e. all ids have to be managed by the same
+    // locality.
+    future<std::vector<bool> > bind_gids_async(
+        std::vector<bind_gid_request_type> requests);
+
+    future<std::vector<resolved_type> > resolve_full(
+        std::vector<naming::gid_type> ids);
+
+    future<std::vector<std::int64_t> > increment_credits(
+        std::vector<credit_request_type> requests);
+
     std::pair<naming::gid_type, naming::gid_type> allocate(std::uint64_t count);
 
     void set_local_locality(naming::gid_type const& g);
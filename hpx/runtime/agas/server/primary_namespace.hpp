@@ -133,12 +133,43 @@ struct HPX_EXPORT primary_namespace
     // }}}
 
   private:
-    // REVIEW: Separate mutexes might reduce contention here. This has to be
-    // investigated carefully.
-    mutex_type mutex_;
+    // The GVA table and the reference count table are split into shards,
+    // each of which is protected by its own mutex. Ids are assigned to the
+    // shards in blocks of 2^shard_block_bits consecutive ids. GVA ranges
+    // spanning more than one block are stored in a separate table instead
+    // (wide_gvas_), which is consulted only if it is not empty.
+    //
+    // Lock order: GVA shard, wide GVA table. The migration table and the
+    // reference count shards are never locked together with any other lock.
+    enum { num_shards = 64 };
+    enum { shard_block_bits = 8 };
+    enum { cache_line_size = 64 };
+
+    struct gva_shard
+    {
+        mutex_type mutex_;
+        gva_table_type gvas_;
+
+        // avoid false sharing between shards
+        char pad_[cache_line_size];
+    };
+
+    struct refcnt_shard
+    {
+        mutex_type mutex_;
+        refcnt_table_type refcnts_;
+
+        // avoid false sharing between shards
+        char pad_[cache_line_size];
+    };
+
+    gva_shard gva_shards_[num_shards];
+    refcnt_shard refcnt_shards_[num_shards];
+
+    mutex_type wide_gvas_mtx_;
+    gva_table_type wide_gvas_;
+    boost::atomic<std::size_t> wide_gvas_count_;
 
-    gva_table_type gvas_;
-    refcnt_table_type refcnts_;
     typedef std::map<
             naming::gid_type,
             hpx::util::tuple<bool, std::size_t, lcos::local::condition_variable_any>
@@ -147,7 +178,10 @@ struct HPX_EXPORT primary_namespace
     std::string instance_name_;
     naming::gid_type next_id_;      // next available gid
     naming::gid_type locality_;     // our locality id
+
+    mutex_type migration_mtx_;
     migration_table_type migrating_objects_;
+    boost::atomic<std::size_t> migrating_objects_count_;
 
     struct update_time_on_exit;
 
@@ -223,19 +257,27 @@ struct HPX_EXPORT primary_namespace
     counter_data counter_data_;
 
 #if defined(HPX_HAVE_AGAS_DUMP_REFCNT_ENTRIES)
-    /// Dump the credit counts of all matching ranges. Expects that \p l
-    /// is locked.
+    /// Dump the credit counts of all matching ranges.
     void dump_refcnt_matches(
-        refcnt_table_type::iterator lower_it
-      , refcnt_table_type::iterator upper_it
-      , naming::gid_type const& lower
+        naming::gid_type const& lower
       , naming::gid_type const& upper
-      , std::unique_lock<mutex_type>& l
       , const char* func_name
         );
 #endif
 
-    // helper function
+    // helper functions
+    static std::size_t get_shard(naming::gid_type const& id);
+    static bool is_wide_range(naming::gid_type const& id, std::uint64_t count);
+
+    static gva_table_type::iterator find_range(
+        gva_table_type& gvas
+      , naming::gid_type const& id
+        );
+
+    void wait_for_migration(
+        naming::gid_type id
+      , error_code& ec);
+
     void wait_for_migration_locked(
         std::unique_lock<mutex_type>& l
       , naming::gid_type id
@@ -244,10 +286,11 @@ struct HPX_EXPORT primary_namespace
   public:
     primary_namespace()
       : base_type(HPX_AGAS_PRIMARY_NS_MSB, HPX_AGAS_PRIMARY_NS_LSB)
-      , mutex_()
+      , wide_gvas_count_(0)
       , instance_name_()
       , next_id_(naming::invalid_gid)
       , locality_(naming::invalid_gid)
+      , migrating_objects_count_(0)
     {}
 
     void finalize();
@@ -309,14 +352,38 @@ struct HPX_EXPORT primary_namespace
         > requests
         );
 
+    // bulk versions of the operations above, all requests have to refer to
+    // ids managed by this instance
+    std::vector<bool> bind_gids(
+        std::vector<
+            hpx::util::tuple<gva, naming::gid_type, naming::gid_type>
+        > requests
+        );
+
+    std::vector<resolved_type> resolve_gids(
+        std::vector<naming::gid_type> ids
+        );
+
+    std::vector<std::int64_t> increment_credits(
+        std::vector<
+            hpx::util::tuple<std::int64_t, naming::gid_type, naming::gid_type>
+        > requests
+        );
+
     std::pair<naming::gid_type, naming::gid_type> allocate(std::uint64_t count);
 
     naming::gid_type statistics_counter(std::string const& name);
 
   private:
+    resolved_type resolve_gid_impl(
+        naming::gid_type const& gid
+      , error_code& ec
+        );
+
     resolved_type resolve_gid_locked(
         std::unique_lock<mutex_type>& l
-      , naming::gid_type const& gid
+      , gva_table_type& gvas
+      , naming::gid_type const& id
       , error_code& ec
         );
 
@@ -341,8 +408,7 @@ struct HPX_EXPORT primary_namespace
     };
 
     void resolve_free_list(
-        std::unique_lock<mutex_type>& l
-      , std::list<refcnt_table_type::iterator> const& free_list
+        std::list<naming::gid_type> const& free_list
       , std::list<free_entry>& free_entry_list
       , naming::gid_type const& lower
       , naming::gid_type const& upper
@@ -367,12 +433,15 @@ struct HPX_EXPORT primary_namespace
   public:
     HPX_DEFINE_COMPONENT_ACTION(primary_namespace, allocate);
     HPX_DEFINE_COMPONENT_ACTION(primary_namespace, bind_gid);
+    HPX_DEFINE_COMPONENT_ACTION(primary_namespace, bind_gids);
     HPX_DEFINE_COMPONENT_ACTION(primary_namespace, begin_migration);
     HPX_DEFINE_COMPONENT_ACTION(primary_namespace, colocate);
     HPX_DEFINE_COMPONENT_ACTION(primary_namespace, end_migration);
     HPX_DEFINE_COMPONENT_ACTION(primary_namespace, decrement_credit);
     HPX_DEFINE_COMPONENT_ACTION(primary_namespace, increment_credit);
+    HPX_DEFINE_COMPONENT_ACTION(primary_namespace, increment_credits);
     HPX_DEFINE_COMPONENT_ACTION(primary_namespace, resolve_gid);
+    HPX_DEFINE_COMPONENT_ACTION(primary_namespace, resolve_gids);
     HPX_DEFINE_COMPONENT_ACTION(primary_namespace, unbind_gid);
     HPX_DEFINE_COMPONENT_ACTION(primary_namespace, route);
     HPX_DEFINE_COMPONENT_ACTION(primary_namespace, statistics_counter);
@@ -404,6 +473,13 @@ HPX_REGISTER_ACTION_DECLARATION(
     hpx::agas::server::primary_namespace::bind_gid_action,
     primary_namespace_bind_gid_action)
 
+HPX_ACTION_USES_MEDIUM_STACK(
+    hpx::agas::server::primary_namespace::bind_gids_action)
+
+HPX_REGISTER_ACTION_DECLARATION(
+    hpx::agas::server::primary_namespace::bind_gids_action,
+    primary_namespace_bind_gids_action)
+
 HPX_ACTION_USES_MEDIUM_STACK(
     hpx::agas::server::primary_namespace::begin_migration_action)
 
@@ -432,6 +508,13 @@ HPX_REGISTER_ACTION_DECLARATION(
     hpx::agas::server::primary_namespace::increment_credit_action,
     primary_namespace_increment_credit_action)
 
+HPX_ACTION_USES_MEDIUM_STACK(
+    hpx::agas::server::primary_namespace::increment_credits_action)
+
+HPX_REGISTER_ACTION_DECLARATION(
+    hpx::agas::server::primary_namespace::increment_credits_action,
+    primary_namespace_increment_credits_action)
+
 HPX_ACTION_USES_MEDIUM_STACK(
     hpx::agas::server::primary_namespace::resolve_gid_action)
 
@@ -439,6 +522,13 @@ HPX_REGISTER_ACTION_DECLARATION(
     hpx::agas::server::primary_namespace::resolve_gid_action,
     primary_namespace_resolve_gid_action)
 
+HPX_ACTION_USES_MEDIUM_STACK(
+    hpx::agas::server::primary_namespace::resolve_gids_action)
+
+HPX_REGISTER_ACTION_DECLARATION(
+    hpx::agas::server::primary_namespace::resolve_gids_action,
+    primary_namespace_resolve_gids_action)
+
 HPX_ACTION_USES_MEDIUM_STACK(
     hpx::agas::server::primary_namespace::colocate_action)
 
@@ -474,6 +564,8 @@ typedef hpx::util::tuple<
     > gva_tuple_type;
 HPX_REGISTER_BASE_LCO_WITH_VALUE_DECLARATION(
     gva_tuple_type, gva_tuple)
+HPX_REGISTER_BASE_LCO_WITH_VALUE_DECLARATION(
+    std::vector<gva_tuple_type>, vector_gva_tuple)
 typedef std::pair<hpx::naming::id_type, hpx::naming::address>
     std_pair_address_id_type;
 HPX_REGISTER_BASE_LCO_WITH_VALUE_DECLARATION(
@@ -19,8 +19,10 @@
 #include <hpx/util/unlock_guard.hpp>
 
 #include <boost/aligned_storage.hpp>
+#include <boost/atomic.hpp>
 #include <boost/type_traits/alignment_of.hpp>
 
+#include <algorithm>
 #include <cstddef>
 #include <cstdint>
 #include <memory>
@@ -63,6 +65,12 @@ namespace hpx { namespace components { namespace detail
 #endif
 
     ///////////////////////////////////////////////////////////////////////////////
+    // Objects are allocated from the heap by atomically advancing the pointer
+    // to the first free slot, the number of free slots is maintained
+    // atomically as well. The mutex is acquired only for releasing the heap
+    // and for registering its global ids. Slots are never reused as their
+    // global ids are derived from their position in the heap (a migrated
+    // object keeps its id).
     template<typename T, typename Allocator, typename Mutex = hpx::lcos::local::spinlock>
     class wrapper_heap
     {
@@ -152,6 +160,8 @@ namespace hpx { namespace components { namespace detail
         std::size_t size() const
         {
             util::itt::heap_internal_access hia; HPX_UNUSED(hia);
+            if (nullptr == pool_.load(boost::memory_order_acquire))
+                return 0;
             return size_ - free_size_;
         }
         std::size_t free_size() const
@@ -162,12 +172,15 @@ namespace hpx { namespace components { namespace detail
         bool is_empty() const
         {
             util::itt::heap_internal_access hia; HPX_UNUSED(hia);
-            return nullptr == pool_;
+            return nullptr == pool_.load(boost::memory_order_acquire);
         }
         bool has_allocatable_slots() const
         {
             util::itt::heap_internal_access hia; HPX_UNUSED(hia);
-            return first_free_ < pool_+size_;
+            storage_type* pool = pool_.load(boost::memory_order_acquire);
+            if (nullptr == pool)
+                return false;
+            return first_free_.load(boost::memory_order_relaxed) < pool+size_;
         }
 
         bool alloc(T** result, std::size_t count = 1)
@@ -176,23 +189,32 @@ namespace hpx { namespace components { namespace detail
                 heap_alloc_function_, result, count*sizeof(storage_type),
                 HPX_WRAPPER_HEAP_INITIALIZED_MEMORY);
 
-            scoped_lock l(mtx_);
-
-            if (!ensure_pool(count))
+            // Reserve the slots before claiming them, this prevents the heap
+            // from being released while the allocation is in flight.
+            if (free_size_.fetch_sub(count) < count)
+            {
+                cancel_alloc(count);
                 return false;
+            }
+
+            storage_type* first_free =
+                first_free_.load(boost::memory_order_relaxed);
+            do {
+                if (!ensure_pool(first_free, count))
+                {
+                    cancel_alloc(count);
+                    return false;
+                }
+            } while (!first_free_.compare_exchange_weak(
+                first_free, first_free + count));
 
 #if defined(HPX_DEBUG)
             alloc_count_ += count;
 #endif
 
-            value_type* p = static_cast<value_type*>(first_free_->address()); //-V707
+            value_type* p = static_cast<value_type*>(first_free->address()); //-V707
             HPX_ASSERT(p != nullptr);
 
-            first_free_ += count;
-
-            HPX_ASSERT(free_size_ >= count);
-            free_size_ -= count;
-
 #if HPX_DEBUG_WRAPPER_HEAP != 0
             // init memory blocks
             debug::fill_bytes(p, initial_value, count*sizeof(storage_type));
@@ -202,21 +224,45 @@ namespace hpx { namespace components { namespace detail
             return true;
         }
 
+        // Allocate up to count consecutive objects, returns the number of
+        // objects actually allocated (zero if the heap is exhausted).
+        std::size_t alloc_some(T** result, std::size_t count)
+        {
+            // the pool might be released concurrently
+            storage_type* pool = pool_.load(boost::memory_order_acquire);
+            if (nullptr == pool)
+                return 0;
+
+            storage_type* first_free =
+                first_free_.load(boost::memory_order_relaxed);
+            if (first_free >= pool+size_)
+                return 0;
+
+            count = (std::min)(count,
+                static_cast<std::size_t>(pool+size_ - first_free));
+            if (count != 0 && alloc(result, count))
+                return count;
+
+            // the remaining slots were claimed concurrently, try a single one
+            if (count > 1 && alloc(result, 1))
+                return 1;
+
+            return 0;
+        }
+
         void free(void *p, std::size_t count = 1)
         {
             util::itt::heap_free heap_free(heap_free_function_, p);
 
 #if HPX_DEBUG_WRAPPER_HEAP != 0
             HPX_ASSERT(did_alloc(p));
-#endif
-            scoped_lock l(mtx_);
 
-#if HPX_DEBUG_WRAPPER_HEAP != 0
             storage_type* p1 = static_cast<storage_type*>(p);
+            storage_type* pool = pool_.load(boost::memory_order_acquire);
 
-            HPX_ASSERT(nullptr != pool_ && p1 >= pool_);
-            HPX_ASSERT(nullptr != pool_ && p1 + count <= pool_ + size_);
-            HPX_ASSERT(first_free_ == nullptr || p1 != first_free_);
+            HPX_ASSERT(nullptr != pool && p1 >= pool);
+            HPX_ASSERT(nullptr != pool && p1 + count <= pool + size_);
+            HPX_ASSERT(p1 + count <= first_free_.load());
             HPX_ASSERT(free_size_ + count <= size_);
             // make sure this has not been freed yet
             HPX_ASSERT(!debug::test_fill_bytes(p1->address(), freed_value,
@@ -231,16 +277,21 @@ namespace hpx { namespace components { namespace detail
 #if defined(HPX_DEBUG)
             free_count_ += count;
 #endif
-            free_size_ += count;
-
             // release the pool if this one was the last allocated item
-            test_release(l);
+            if (free_size_.fetch_add(count) + count == size_)
+            {
+                scoped_lock l(mtx_);
+                test_release(l);
+            }
         }
         bool did_alloc (void *p) const
         {
-            // no lock is necessary here as all involved variables are immutable
+            // no lock is necessary here as size_ is immutable and the pool
+            // is only released once all objects have been freed
             util::itt::heap_internal_access hia; HPX_UNUSED(hia);
-            return nullptr != pool_ && nullptr != p && pool_ <= p && p < pool_ + size_;
+            storage_type* pool = pool_.load(boost::memory_order_acquire);
+            return nullptr != pool && nullptr != p && pool <= p &&
+                p < pool + size_;
         }
 
         /// \brief Get the global id of the managed_component instance
@@ -257,7 +308,8 @@ namespace hpx { namespace components { namespace detail
             HPX_ASSERT(did_alloc(p));
 
             scoped_lock l(mtx_);
-            value_type* addr = static_cast<value_type*>(pool_->address());
+            value_type* addr = static_cast<value_type*>(
+                pool_.load(boost::memory_order_relaxed)->address());
 
             if (!base_gid_) {
                 naming::gid_type base_gid;
@@ -309,17 +361,34 @@ namespace hpx { namespace components { namespace detail
         {
             util::itt::heap_internal_access hia; HPX_UNUSED(hia);
 
-            value_type* addr = static_cast<value_type*>(pool_->address());
+            value_type* addr = static_cast<value_type*>(
+                pool_.load(boost::memory_order_acquire)->address());
             return naming::address(get_locality(),
                  components::get_component_type<typename value_type::type_holder>(),
                  addr);
         }
 
     protected:
+        // give back slots reserved by a failed allocation
+        void cancel_alloc(std::size_t count)
+        {
+            if (free_size_.fetch_add(count) + count == size_)
+            {
+                scoped_lock l(mtx_);
+                test_release(l);
+            }
+        }
+
         bool test_release(scoped_lock& lk)
         {
-            if (pool_ == nullptr || free_size_ < size_ || first_free_ < pool_+size_)
+            // free_size_ may be temporarily out of range while allocations
+            // are being canceled, compare for equality only
+            storage_type* pool = pool_.load(boost::memory_order_relaxed);
+            if (pool == nullptr || free_size_ != size_ ||
+                    first_free_.load() < pool+size_)
+            {
                 return false;
+            }
             HPX_ASSERT(free_size_ == size_);
 
             // unbind in AGAS service
@@ -335,11 +404,12 @@ namespace hpx { namespace components { namespace detail
             return true;
         }
 
-        bool ensure_pool(std::size_t count)
+        bool ensure_pool(storage_type* first_free, std::size_t count) const
         {
-            if (nullptr == pool_)
+            storage_type* pool = pool_.load(boost::memory_order_acquire);
+            if (nullptr == pool)
                 return false;
-            if (first_free_ + count > pool_+size_)
+            if (first_free + count > pool+size_)
                 return false;
             return true;
         }
@@ -350,18 +420,20 @@ namespace hpx { namespace components { namespace detail
             HPX_ASSERT(first_free_ == nullptr);
 
             std::size_t s = step_ * heap_size; //-V104 //-V707
-            pool_ = static_cast<storage_type*>(Allocator::alloc(s));
-            if (nullptr == pool_)
+            storage_type* pool =
+                static_cast<storage_type*>(Allocator::alloc(s));
+            if (nullptr == pool)
                 return false;
 
-            first_free_ = pool_;
+            first_free_ = pool;
             size_ = s / heap_size; //-V104
             free_size_ = size_;
+            pool_.store(pool, boost::memory_order_release);
 
             LOSH_(info) //-V128
                 << "wrapper_heap ("
                 << (!class_name_.empty() ? class_name_.c_str() : "<Unknown>")
-                << "): init_pool (" << std::hex << pool_ << ")"
+                << "): init_pool (" << std::hex << pool << ")"
                 << " size: " << s << ".";
 
             return true;
@@ -369,7 +441,8 @@ namespace hpx { namespace components { namespace detail
 
         void tidy()
         {
-            if (pool_ != nullptr) {
+            storage_type* pool = pool_.load(boost::memory_order_relaxed);
+            if (pool != nullptr) {
                 LOSH_(debug) //-V128
                     << "wrapper_heap ("
                     << (!class_name_.empty() ? class_name_.c_str() : "<Unknown>")
@@ -388,22 +461,26 @@ namespace hpx { namespace components { namespace detail
                     LOSH_(warning) //-V128
                         << "wrapper_heap ("
                         << (!class_name_.empty() ? class_name_.c_str() : "<Unknown>")
-                        << "): releasing heap (" << std::hex << pool_ << ")"
+                        << "): releasing heap (" << std::hex << pool << ")"
                         << " with " << size_-free_size_ << " allocated object(s)!";
                 }
 
-                Allocator::free(pool_);
-                pool_ = first_free_ = nullptr;
-                size_ = free_size_ = 0;
+                // first_free_ is left untouched, it still points past the
+                // end of the released pool which makes concurrent
+                // allocation attempts fail. size_ is left untouched as well,
+                // it is read without holding the lock.
+                pool_.store(nullptr, boost::memory_order_release);
+                free_size_ = 0;
+                Allocator::free(pool);
             }
         }
 
     private:
-        storage_type* pool_;
-        storage_type* first_free_;
+        boost::atomic<storage_type*> pool_;
+        boost::atomic<storage_type*> first_free_;
         std::size_t step_;
         std::size_t size_;
-        std::size_t free_size_;
+        boost::atomic<std::size_t> free_size_;
 
         // these values are used for AGAS registration of all elements of this
         // managed_component heap
@@ -414,8 +491,8 @@ namespace hpx { namespace components { namespace detail
     public:
         std::string const class_name_;
 #if defined(HPX_DEBUG)
-        std::size_t alloc_count_;
-        std::size_t free_count_;
+        boost::atomic<std::size_t> alloc_count_;
+        boost::atomic<std::size_t> free_count_;
         std::size_t heap_count_;
 #endif
 
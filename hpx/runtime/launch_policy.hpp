@@ -25,11 +25,16 @@ namespace hpx
             sync = 0x08,
             fork = 0x10,  // same as async, but forces continuation stealing
             apply = 0x20,
+            sync_if_cheap = 0x40,   // same as sync, but falls back to async
+                                    // on foreign threads or deep recursion
+            nostack = 0x80,         // same as async, but the new thread is
+                                    // run to completion without a stack
 
             sync_policies = 0x0a,       // sync | deferred
-            async_policies = 0x15,      // async | task | fork
-            all = 0x3f                  // async | deferred | task | sync |
-                                        // fork | apply
+            async_policies = 0x95,      // async | task | fork | nostack
+            all = 0xff                  // async | deferred | task | sync |
+                                        // fork | apply | sync_if_cheap |
+                                        // nostack
         };
 
         struct policy_holder
@@ -96,6 +101,20 @@ namespace hpx
             }
         };
 
+        struct nostack_policy : policy_holder
+        {
+            HPX_CONSTEXPR nostack_policy(threads::thread_priority priority =
+                    threads::thread_priority_default) noexcept
+              : policy_holder(launch_policy::nostack, priority)
+            {}
+
+            HPX_CONSTEXPR nostack_policy operator()(
+                threads::thread_priority priority) const noexcept
+            {
+                return nostack_policy(priority);
+            }
+        };
+
         struct sync_policy : policy_holder
         {
             HPX_CONSTEXPR sync_policy() noexcept
@@ -103,6 +122,20 @@ namespace hpx
             {}
         };
 
+        struct sync_if_cheap_policy : policy_holder
+        {
+            HPX_CONSTEXPR sync_if_cheap_policy(threads::thread_priority priority =
+                    threads::thread_priority_default) noexcept
+              : policy_holder(launch_policy::sync_if_cheap, priority)
+            {}
+
+            HPX_CONSTEXPR sync_if_cheap_policy operator()(
+                threads::thread_priority priority) const noexcept
+            {
+                return sync_if_cheap_policy(priority);
+            }
+        };
+
         struct deferred_policy : policy_holder
         {
             HPX_CONSTEXPR deferred_policy() noexcept
@@ -213,11 +246,24 @@ namespace hpx
           : detail::policy_holder{detail::launch_policy::fork}
         {}
 
+        /// Create a launch policy representing asynchronous execution on the
+        /// stack of the scheduler
+        HPX_CONSTEXPR launch(detail::nostack_policy p) noexcept
+          : detail::policy_holder{detail::launch_policy::nostack, p.priority()}
+        {}
+
         /// Create a launch policy representing synchronous execution
         HPX_CONSTEXPR launch(detail::sync_policy) noexcept
           : detail::policy_holder{detail::launch_policy::sync}
         {}
 
+        /// Create a launch policy representing synchronous execution if this
+        /// is cheap, asynchronous execution otherwise
+        HPX_CONSTEXPR launch(detail::sync_if_cheap_policy p) noexcept
+          : detail::policy_holder{detail::launch_policy::sync_if_cheap,
+                p.priority()}
+        {}
+
         /// Create a launch policy representing deferred execution
         HPX_CONSTEXPR launch(detail::deferred_policy) noexcept
           : detail::policy_holder{detail::launch_policy::deferred}
@@ -232,7 +278,9 @@ namespace hpx
         /// \cond NOINTERNAL
         using async_policy = detail::async_policy;
         using fork_policy = detail::fork_policy;
+        using nostack_policy = detail::nostack_policy;
         using sync_policy = detail::sync_policy;
+        using sync_if_cheap_policy = detail::sync_if_cheap_policy;
         using deferred_policy = detail::deferred_policy;
         using apply_policy = detail::apply_policy;
         /// \endcond
@@ -245,9 +293,27 @@ namespace hpx
         /// new thread is executed in a preferred way
         HPX_EXPORT static const detail::fork_policy fork;
 
+        /// Predefined launch policy representing asynchronous execution. The
+        /// new thread doesn't get a stack of its own, it is run to completion
+        /// directly on the stack of the scheduler, which avoids allocating a
+        /// stack and switching contexts. The function must not suspend: the
+        /// thread can't be resumed later on, any attempt to suspend it throws
+        /// an exception (error code invalid_status) instead. Yielding returns
+        /// immediately. Continuations (future::then), dataflow and hpx::apply
+        /// honor this policy, actions use the stack size configured for the
+        /// action instead.
+        HPX_EXPORT static const detail::nostack_policy nostack;
+
         /// Predefined launch policy representing synchronous execution
         HPX_EXPORT static const detail::sync_policy sync;
 
+        /// Predefined launch policy representing synchronous execution on the
+        /// calling thread if it is an HPX thread which has not exceeded the
+        /// maximal continuation recursion depth (see
+        /// hpx.continuations.max_inline_depth), asynchronous execution on a
+        /// new HPX thread otherwise
+        HPX_EXPORT static const detail::sync_if_cheap_policy sync_if_cheap;
+
         /// Predefined launch policy representing deferred execution
         HPX_EXPORT static const detail::deferred_policy deferred;
 
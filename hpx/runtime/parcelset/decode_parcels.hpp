@@ -100,6 +100,23 @@ namespace hpx { namespace parcelset
         return chunks;
     }
 
+    namespace detail
+    {
+        // Give the memory of a received message back to the parcelport once
+        // all parcels have been de-serialized. Only plain byte vectors are
+        // recycled through the buffer pool.
+        template <typename Parcelport, typename Container>
+        void reclaim_buffer(Parcelport&, Container&)
+        {
+        }
+
+        template <typename Parcelport>
+        void reclaim_buffer(Parcelport& pp, std::vector<char>& data)
+        {
+            pp.reclaim_buffer(std::move(data));
+        }
+    }
+
     ///////////////////////////////////////////////////////////////////////////
     template <typename Parcelport, typename Buffer>
     void decode_message_with_chunks(
@@ -263,6 +280,8 @@ namespace hpx { namespace parcelset
                 << "decode_message: caught unknown exception.";
             hpx::report_error(std::current_exception());
         }
+
+        detail::reclaim_buffer(pp, buffer.data_);
     }
 
     ///////////////////////////////////////////////////////////////////////////
@@ -13,24 +13,30 @@
 #include <hpx/config.hpp>
 #include <hpx/exception.hpp>
 #include <hpx/exception_info.hpp>
+#include <hpx/lcos/local/latch.hpp>
 #include <hpx/runtime/actions/basic_action.hpp>
+#include <hpx/runtime/get_os_thread_count.hpp>
 #include <hpx/runtime/parcelset/parcel.hpp>
 #include <hpx/runtime/parcelset/parcel_buffer.hpp>
 #include <hpx/runtime/parcelset/parcelport.hpp>
 #include <hpx/runtime/parcelset_fwd.hpp>
 #include <hpx/runtime/serialization/serialize.hpp>
+#include <hpx/runtime/threads/thread_helpers.hpp>
 #include <hpx/runtime_fwd.hpp>
+#include <hpx/traits/serialized_size.hpp>
 #include <hpx/util/high_resolution_timer.hpp>
 #include <hpx/util/integer/endian.hpp>
 #include <hpx/util/logging.hpp>
 
 #include <boost/exception/exception.hpp>
 
+#include <algorithm>
 #include <cstddef>
 #include <cstdint>
 #include <exception>
 #include <memory>
 #include <string>
+#include <utility>
 #include <vector>
 
 namespace hpx
@@ -75,6 +81,25 @@ namespace hpx
                 return result;
             }
 
+            // Make sure the given container is able to hold at least the
+            // given number of bytes. Plain byte vectors are taken from the
+            // buffer pool of the parcelport, if necessary.
+            template <typename Container>
+            void reserve_buffer(parcelport&, Container& data, std::size_t size)
+            {
+                data.reserve(size);
+            }
+
+            inline void reserve_buffer(parcelport& pp, std::vector<char>& data,
+                std::size_t size)
+            {
+                if (data.capacity() < size)
+                {
+                    pp.reclaim_buffer(std::move(data));
+                    data = pp.get_buffer(size);
+                }
+            }
+
             template <typename Buffer>
             void encode_finalize(Buffer & buffer, std::size_t arg_size)
             {
@@ -141,7 +166,10 @@ namespace hpx
 
             if(num_parcels != std::size_t(-1))
             {
-                arg_size = sizeof(std::int64_t);
+                // number of parcels stored in front of the parcel data
+                arg_size = traits::serialized_size<
+                        decltype(parcels_sent)
+                    >::value;
                 parcels_size = num_parcels;
             }
 
@@ -156,7 +184,9 @@ namespace hpx
                         archive_flags |= serialization::enable_compression;
 
 
-                    // preallocate data
+                    // preallocate data, this is an upper bound as the size of
+                    // each parcel includes the header of the archive it was
+                    // measured with
                     for (/**/; parcels_sent != parcels_size; ++parcels_sent)
                     {
                         if (arg_size >= max_outbound_size)
@@ -165,7 +195,7 @@ namespace hpx
                         num_chunks += ps[parcels_sent].num_chunks();
                     }
 
-                    buffer.data_.reserve(arg_size);
+                    detail::reserve_buffer(pp, buffer.data_, arg_size);
 
                     buffer.chunks_.reserve(num_chunks);
 
@@ -262,6 +292,153 @@ namespace hpx
 
             return parcels_sent;
         }
+
+        ///////////////////////////////////////////////////////////////////////
+        // Encode a large batch of parcels concurrently. The batch is split
+        // into segments holding roughly the same number of bytes. Every
+        // segment is encoded into a separate (self-contained) message on its
+        // own HPX thread. The first message is stored in 'buffer', all others
+        // are appended to 'segments' in the order of the parcels they hold.
+        // Small batches are encoded on the calling thread, just as if
+        // encode_parcels was invoked.
+        template <typename Buffer>
+        std::size_t
+        encode_parcels_parallel(parcelport& pp,
+            parcel const * ps, std::size_t num_parcels, Buffer & buffer,
+            std::vector<Buffer> & segments, int archive_flags,
+            std::uint64_t max_outbound_size)
+        {
+            HPX_ASSERT(buffer.data_.empty() && segments.empty());
+
+            std::size_t segment_size = pp.get_parallel_encoding_segment_size();
+            if (segment_size == 0 || num_parcels < 2 ||
+                threads::get_self_ptr() == nullptr)
+            {
+                return encode_parcels(pp, ps, num_parcels, buffer,
+                    archive_flags, max_outbound_size);
+            }
+
+            // determine the parcels which fit into the outbound message size
+            // (using the same criteria as encode_parcels)
+            std::size_t arg_size = traits::serialized_size<
+                    decltype(num_parcels)
+                >::value;
+            std::size_t parcels_size = 0;
+            for (/**/; parcels_size != num_parcels; ++parcels_size)
+            {
+                if (arg_size >= max_outbound_size)
+                    break;
+                arg_size += ps[parcels_size].size();
+            }
+
+            std::size_t num_segments = (std::min)(
+                (std::min)(arg_size / segment_size, parcels_size),
+                get_os_thread_count());
+            if (num_segments < 2)
+            {
+                return encode_parcels(pp, ps, num_parcels, buffer,
+                    archive_flags, max_outbound_size);
+            }
+
+            // split the parcels into segments of similar size
+            std::vector<std::size_t> bounds;
+            bounds.reserve(num_segments + 1);
+            bounds.push_back(0);
+
+            std::size_t const target_size = arg_size / num_segments;
+            std::size_t current_size = 0;
+            for (std::size_t i = 0; i != parcels_size - 1; ++i)
+            {
+                current_size += ps[i].size();
+                if (current_size >= target_size)
+                {
+                    bounds.push_back(i + 1);
+                    if (bounds.size() == num_segments)
+                        break;
+                    current_size = 0;
+                }
+            }
+            bounds.push_back(parcels_size);
+            num_segments = bounds.size() - 1;
+
+            // encode all segments but the first one on new HPX threads
+            segments.resize(num_segments - 1);
+
+            std::vector<std::size_t> encoded(num_segments, 0);
+            std::vector<std::exception_ptr> errors(num_segments);
+
+            auto encode_segment =
+                [&](std::size_t k, Buffer& segment_buffer)
+                {
+                    try {
+                        encoded[k] = encode_parcels(pp, ps + bounds[k],
+                            bounds[k + 1] - bounds[k], segment_buffer,
+                            archive_flags, std::uint64_t(-1));
+                    }
+                    catch (...) {
+                        errors[k] = std::current_exception();
+                    }
+                };
+
+            lcos::local::latch l(static_cast<std::ptrdiff_t>(num_segments));
+            for (std::size_t k = 1; k != num_segments; ++k)
+            {
+                error_code ec(lightweight);
+                hpx::applier::register_thread_nullary(
+                    [&, k]()
+                    {
+                        encode_segment(k, segments[k - 1]);
+                        l.count_down(1);
+                    },
+                    "encode_parcels", threads::pending, true,
+                    threads::thread_priority_boost, std::size_t(-1),
+                    threads::thread_stacksize_default, ec);
+
+                if (ec)
+                {
+                    // encode this segment directly if no thread was created
+                    encode_segment(k, segments[k - 1]);
+                    l.count_down(1);
+                }
+            }
+
+            encode_segment(0, buffer);
+            l.count_down_and_wait();
+
+            // report the first error, nothing will be sent in this case
+            for (std::exception_ptr const& e : errors)
+            {
+                if (e)
+                {
+                    segments.clear();
+                    std::rethrow_exception(e);
+                }
+            }
+
+            // send only those segments which precede the first segment which
+            // could not be encoded completely, along with the parcels of that
+            // segment which were encoded successfully (if any)
+            std::size_t parcels_sent = 0;
+            for (std::size_t k = 0; k != num_segments; ++k)
+            {
+                parcels_sent += encoded[k];
+                if (encoded[k] != bounds[k + 1] - bounds[k])
+                {
+                    // number of messages to keep, the first message is
+                    // stored in 'buffer'
+                    std::size_t const keep = (encoded[k] != 0) ? k + 1 : k;
+                    if (keep == 0)
+                        buffer.clear();
+
+                    segments.erase(
+                        segments.begin() + (keep == 0 ? 0 : keep - 1),
+                        segments.end());
+                    break;
+                }
+            }
+
+            return parcels_sent;
+        }
     }
 }
 
@@ -406,6 +406,10 @@ namespace hpx { namespace parcelset
         std::int64_t get_connection_cache_statistics(std::string const& pp_type,
             parcelport::connection_cache_statistics_type stat_type, bool) const;
 
+        //
+        std::int64_t get_buffer_pool_statistics(std::string const& pp_type,
+            parcelport::buffer_pool_statistics_type stat_type, bool) const;
+
         void list_parcelports(std::ostringstream& strm) const;
         void list_parcelport(std::ostringstream& strm,
             std::string const& ppname, int priority, bool bootstrap) const;
@@ -443,6 +447,7 @@ namespace hpx { namespace parcelset
 
         void register_counter_types(std::string const& pp_type);
         void register_connection_cache_counter_types(std::string const& pp_type);
+        void register_buffer_pool_counter_types(std::string const& pp_type);
 
     private:
         int get_priority(std::string const& name) const
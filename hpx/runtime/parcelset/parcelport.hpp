@@ -18,6 +18,7 @@
 #include <hpx/runtime/parcelset/detail/per_action_data_counter.hpp>
 #include <hpx/runtime/parcelset/locality.hpp>
 #include <hpx/runtime/parcelset/parcel.hpp>
+#include <hpx/util/buffer_pool.hpp>
 #include <hpx/util/function.hpp>
 #include <hpx/util/tuple.hpp>
 #include <hpx/util_fwd.hpp>
@@ -242,6 +243,17 @@ namespace hpx { namespace parcelset
         std::int64_t get_buffer_allocate_time_sent(bool reset);
         std::int64_t get_buffer_allocate_time_received(bool reset);
 
+        /// Return the given buffer pool statistic
+        enum buffer_pool_statistics_type
+        {
+            buffer_pool_hits = 0,
+            buffer_pool_misses = 1,
+            buffer_pool_retained_bytes = 2
+        };
+
+        std::int64_t get_buffer_pool_statistics(
+            buffer_pool_statistics_type t, bool reset);
+
         std::int64_t get_pending_parcels_count(bool /*reset*/);
 
 #if defined(HPX_HAVE_PARCELPORT_ACTION_COUNTERS)
@@ -305,6 +317,27 @@ namespace hpx { namespace parcelset
             return max_outbound_message_size_;
         }
 
+        /// Return the minimal number of bytes per segment for encoding large
+        /// batches of parcels concurrently (zero disables this)
+        std::size_t get_parallel_encoding_segment_size() const
+        {
+            return parallel_encoding_segment_size_;
+        }
+
+        /// Return an empty buffer able to hold at least the given number of
+        /// bytes, the buffer is taken from the pool of recycled buffers if
+        /// possible
+        std::vector<char> get_buffer(std::size_t size)
+        {
+            return buffer_pool_.get(size);
+        }
+
+        /// Give a buffer which is not needed anymore back to the pool
+        void reclaim_buffer(std::vector<char> && buffer)
+        {
+            buffer_pool_.reclaim(std::move(buffer));
+        }
+
         /// Return whether it is allowed to apply array optimizations
         bool allow_array_optimizations() const
         {
@@ -356,10 +389,16 @@ namespace hpx { namespace parcelset
         std::int64_t const max_inbound_message_size_;
         std::int64_t const max_outbound_message_size_;
 
+        /// The minimal size of segments encoded concurrently
+        std::size_t const parallel_encoding_segment_size_;
+
         /// Overall parcel statistics
         performance_counters::parcels::gatherer parcels_sent_;
         performance_counters::parcels::gatherer parcels_received_;
 
+        /// Recycled buffers used for encoding and receiving messages
+        util::buffer_pool<char> buffer_pool_;
+
 #if defined(HPX_HAVE_PARCELPORT_ACTION_COUNTERS)
         // Per-action based parcel statistics
         detail::per_action_data_counter action_parcels_sent_;
@@ -869,6 +869,39 @@ namespace hpx { namespace parcelset
             get_connection_and_send_parcels(locality_id);
         }
 
+        // Connections which are able to send several messages at once allow
+        // for large batches of parcels to be encoded concurrently.
+        template <typename ConnectionHandler_>
+        typename std::enable_if<
+            connection_handler_traits<
+                ConnectionHandler_
+            >::send_multiple_messages::value,
+            std::size_t
+        >::type
+        encode_pending_parcels(connection& sender_connection,
+            std::vector<parcel>& parcels)
+        {
+            return encode_parcels_parallel(*this, parcels.data(),
+                parcels.size(), sender_connection.buffer_,
+                sender_connection.segments_, archive_flags_,
+                this->get_max_outbound_message_size());
+        }
+
+        template <typename ConnectionHandler_>
+        typename std::enable_if<
+           !connection_handler_traits<
+                ConnectionHandler_
+            >::send_multiple_messages::value,
+            std::size_t
+        >::type
+        encode_pending_parcels(connection& sender_connection,
+            std::vector<parcel>& parcels)
+        {
+            return encode_parcels(*this, parcels.data(), parcels.size(),
+                sender_connection.buffer_, archive_flags_,
+                this->get_max_outbound_message_size());
+        }
+
         void send_pending_parcels(
             parcelset::locality const & parcel_locality_id,
             std::shared_ptr<connection> sender_connection,
@@ -885,10 +918,9 @@ namespace hpx { namespace parcelset
             sender_connection->verify(parcel_locality_id);
 #endif
             // encode the parcels
-            std::size_t num_parcels = encode_parcels(*this, &parcels[0],
-                    parcels.size(), sender_connection->buffer_,
-                    archive_flags_,
-                    this->get_max_outbound_message_size());
+            std::size_t num_parcels =
+                encode_pending_parcels<ConnectionHandler>(
+                    *sender_connection, parcels);
 
             using hpx::parcelset::detail::call_for_each;
             using hpx::util::placeholders::_1;
@@ -20,6 +20,33 @@
 #include <cstddef>
 #include <type_traits>
 
+namespace hpx { namespace traits
+{
+    // Fixed size arrays of bitwise serializable elements are stored as a
+    // single block of memory as long as they are too small to be sent as a
+    // separate (zero-copy) chunk. This allows for aggregates holding small
+    // arrays (and containers of those) to be stored with one copy operation.
+    template <typename T, std::size_t N>
+    struct is_bitwise_serializable<boost::array<T, N> >
+      : std::integral_constant<bool,
+            is_bitwise_serializable<
+                typename std::remove_const<T>::type
+            >::value && N != 0 &&
+            (sizeof(T) * N < HPX_ZERO_COPY_SERIALIZATION_THRESHOLD)>
+    {};
+
+#ifdef HPX_HAVE_CXX11_STD_ARRAY
+    template <typename T, std::size_t N>
+    struct is_bitwise_serializable<std::array<T, N> >
+      : std::integral_constant<bool,
+            is_bitwise_serializable<
+                typename std::remove_const<T>::type
+            >::value && N != 0 &&
+            (sizeof(T) * N < HPX_ZERO_COPY_SERIALIZATION_THRESHOLD)>
+    {};
+#endif
+}}
+
 namespace hpx { namespace serialization
 {
     template <class T>
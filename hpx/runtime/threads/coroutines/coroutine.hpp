@@ -144,6 +144,13 @@ namespace hpx { namespace threads { namespace coroutines
             return std::move(*m_pimpl->result());
         }
 
+        // run a coroutine which doesn't own a stack on the stack of the caller
+        HPX_FORCEINLINE result_type invoke_stackless(arg_type arg = arg_type())
+        {
+            HPX_ASSERT(m_pimpl);
+            return m_pimpl->invoke_stackless(arg);
+        }
+
         explicit operator bool() const
         {
             return good();
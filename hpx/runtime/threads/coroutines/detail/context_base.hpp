@@ -89,6 +89,10 @@ namespace hpx { namespace threads { namespace coroutines { namespace detail
     /////////////////////////////////////////////////////////////////////////////
     std::ptrdiff_t const default_stack_size = -1;
 
+    // contexts created with this stack size don't own a stack, they are run
+    // directly on the stack of their caller (see coroutine_impl::invoke_stackless)
+    std::ptrdiff_t const no_stack_size = 0;
+
     class context_base : public default_context_impl
     {
     public:
@@ -444,7 +448,13 @@ namespace hpx { namespace threads { namespace coroutines { namespace detail
             HPX_ASSERT(!running());
             try {
                 if (!exited())
-                    exit();
+                {
+                    // a context without a stack has nothing to unwind
+                    if (get_stacksize() != no_stack_size)
+                        exit();
+                    else
+                        m_state = ctx_exited;
+                }
                 HPX_ASSERT(exited());
                 m_thread_id = nullptr;
             }
@@ -200,13 +200,18 @@ namespace hpx { namespace threads { namespace coroutines
                             % m_stack_size % EXEC_PAGESIZE));
                 }
 
-                if (0 >= m_stack_size)
+                if (0 > m_stack_size)
                 {
                     throw std::runtime_error(
                         boost::str(boost::format("stack size of %1% is invalid") %
                             m_stack_size));
                 }
 
+                // no stack is allocated for contexts which are run directly
+                // on the stack of their caller
+                if (0 == m_stack_size)
+                    return;
+
                 m_stack = posix::alloc_stack(static_cast<std::size_t>(m_stack_size));
                 HPX_ASSERT(m_stack);
                 posix::watermark_stack(m_stack, static_cast<std::size_t>(m_stack_size));
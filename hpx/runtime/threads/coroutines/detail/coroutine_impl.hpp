@@ -123,6 +123,16 @@ namespace hpx { namespace threads { namespace coroutines { namespace detail
 
         HPX_EXPORT void operator()();
 
+        // Coroutines created with no_stack_size don't own a stack. Their
+        // function is run to completion directly on the stack of the caller
+        // (the scheduler), without any context switch.
+        bool is_stackless() const
+        {
+            return this->get_stacksize() == no_stack_size;
+        }
+
+        HPX_EXPORT result_type invoke_stackless(arg_type arg);
+
     public:
         result_type * result()
         {
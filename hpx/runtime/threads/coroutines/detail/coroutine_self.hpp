@@ -90,6 +90,10 @@ namespace hpx { namespace threads { namespace coroutines { namespace detail
         {
             HPX_ASSERT(m_pimpl);
 
+            // coroutines without a stack of their own can't be suspended
+            if (HPX_UNLIKELY(m_pimpl->is_stackless()))
+                return yield_stackless(std::move(arg));
+
             this->m_pimpl->bind_result(&arg);
 
             {
@@ -159,6 +163,10 @@ namespace hpx { namespace threads { namespace coroutines { namespace detail
         std::ptrdiff_t get_available_stack_space()
         {
 #if defined(HPX_HAVE_THREADS_GET_STACK_POINTER)
+            // stackless coroutines run on the stack of the scheduler, which is
+            // assumed to be sufficiently large
+            if (m_pimpl->is_stackless())
+                return (std::numeric_limits<std::ptrdiff_t>::max)();
             return m_pimpl->get_available_stack_space();
 #else
             return (std::numeric_limits<std::ptrdiff_t>::max)();
@@ -216,6 +224,11 @@ namespace hpx { namespace threads { namespace coroutines { namespace detail
 #endif
 
     private:
+        // A stackless coroutine is run to completion. Yielding in pending
+        // state returns immediately (after scheduling the thread to switch
+        // to, if any), everything else throws.
+        HPX_EXPORT arg_type yield_stackless(result_type arg);
+
         yield_decorator_type yield_decorator_;
 
         impl_ptr get_impl()
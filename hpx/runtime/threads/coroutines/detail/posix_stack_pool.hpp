@@ -0,0 +1,63 @@
+//  Copyright (c) 2026 agent
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#if !defined(HPX_RUNTIME_THREADS_COROUTINES_DETAIL_POSIX_STACK_POOL_HPP)
+#define HPX_RUNTIME_THREADS_COROUTINES_DETAIL_POSIX_STACK_POOL_HPP
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_THREAD_STACK_POOL)
+
+#include <cstddef>
+
+///////////////////////////////////////////////////////////////////////////////
+// Pooled allocation of coroutine stacks.
+//
+// Stacks are carved out of large slabs which are mapped per OS thread and
+// stack size. An OS thread running out of cached stacks carves as many stacks
+// from its own slab as its cache is refilled with, which does not require any
+// synchronization. It protects their guard pages and writes to all of their
+// pages, which faults them in on the NUMA domain the thread runs on.
+// Every OS thread caches a limited number of free stacks per stack size,
+// allocating and freeing a stack from this cache does not involve any system
+// call or synchronization. Stacks exceeding the cache capacity are returned to
+// the free list of the NUMA domain the thread runs on, at which point all
+// pages they used except for the topmost one are released to the OS
+// (madvise(MADV_DONTNEED)). The same happens to all cached stacks when an OS
+// thread exits or when a worker thread has been idle for a while. Threads
+// refill their caches from the free list of their NUMA domain before carving
+// new stacks.
+//
+// Slabs are never unmapped, the memory is reclaimed at process exit only. The
+// uncarved remainder of the slabs of exiting OS threads is left unused.
+namespace hpx { namespace threads { namespace coroutines { namespace detail {
+namespace posix
+{
+    // These global variables control the behavior of the stack pool. They
+    // are set once by the runtime configuration startup code.
+    HPX_EXPORT extern bool use_stack_pool;
+    HPX_EXPORT extern bool use_stack_pool_huge_pages;
+    HPX_EXPORT extern std::size_t stack_pool_slab_size;
+    HPX_EXPORT extern std::size_t stack_pool_cache_size;
+
+    // Return a stack of the given size from the pool, returns nullptr if the
+    // pool can't serve the request (the caller should fall back to allocating
+    // the stack directly).
+    HPX_EXPORT void* pool_alloc_stack(std::size_t size);
+
+    // Return the given stack to the pool, returns false if the stack was not
+    // taken over by the pool.
+    HPX_EXPORT bool pool_free_stack(void* stack, std::size_t size);
+
+    // Move all stacks cached by the calling OS thread to the free lists of
+    // its NUMA domain (releasing their used pages), returns the number of
+    // stacks moved. This is called by the scheduling loop of idle worker
+    // threads.
+    HPX_EXPORT std::size_t trim_stack_pool();
+}
+}}}}
+
+#endif
+#endif
@@ -31,6 +31,7 @@
 #define HPX_RUNTIME_THREADS_COROUTINES_DETAIL_POSIX_UTILITY_HPP
 
 #include <hpx/config.hpp>
+#include <hpx/runtime/threads/coroutines/detail/posix_stack_pool.hpp>
 #include <hpx/util/assert.hpp>
 
 // include unist.d conditionally to check for POSIX version. Not all OSs have the
@@ -82,6 +83,15 @@ namespace posix
 
     inline void* alloc_stack(std::size_t size)
     {
+#if defined(HPX_HAVE_THREAD_STACK_POOL)
+        if (use_stack_pool)
+        {
+            void* stack = pool_alloc_stack(size);
+            if (stack != nullptr)
+                return stack;
+        }
+#endif
+
         void* real_stack = ::mmap(nullptr,
             size + EXEC_PAGESIZE,
             PROT_EXEC | PROT_READ | PROT_WRITE,
@@ -151,6 +161,12 @@ namespace posix
 
     inline void free_stack(void* stack, std::size_t size)
     {
+#if defined(HPX_HAVE_THREAD_STACK_POOL)
+        // stacks of pooled sizes are always handed back to the pool
+        if (pool_free_stack(stack, size))
+            return;
+#endif
+
 #if defined(HPX_HAVE_THREAD_GUARD_PAGE)
         if (use_guard_pages) {
             void** real_stack =
@@ -10,7 +10,13 @@
 #include <hpx/runtime/agas/interface.hpp>
 #include <hpx/runtime/config_entry.hpp>
 #include <hpx/runtime/get_thread_name.hpp>
+#if defined(HPX_HAVE_THREAD_STACK_POOL)
+#include <hpx/runtime/threads/coroutines/detail/posix_stack_pool.hpp>
+#endif
 #include <hpx/runtime/threads/detail/periodic_maintenance.hpp>
+#if defined(HPX_HAVE_THREAD_TIMER_WHEEL)
+#include <hpx/runtime/threads/detail/set_thread_state.hpp>
+#endif
 #include <hpx/runtime/threads/thread_data.hpp>
 #include <hpx/state.hpp>
 #include <hpx/util/assert.hpp>
@@ -458,6 +464,12 @@ namespace hpx { namespace threads { namespace detail
         }
 
         while (true) {
+#if defined(HPX_HAVE_THREAD_TIMER_WHEEL)
+            // wake up the threads whose timers have expired (timed
+            // suspension, timed executors)
+            detail::expire_thread_timers(scheduler);
+#endif
+
             // Get the next HPX thread from the queue
             thrd = next_thrd;
             bool running = this_state.load(
@@ -472,6 +484,12 @@ namespace hpx { namespace threads { namespace detail
                 idle_loop_count = 0;
                 ++busy_loop_count;
 
+                if (scheduler.get_scheduler_mode() &
+                        policies::enable_idle_backoff)
+                {
+                    scheduler.SchedulingPolicy::reset_idle_backoff(num_thread);
+                }
+
                 may_exit = false;
 
                 // Only pending HPX threads will be executed.
@@ -706,6 +724,16 @@ namespace hpx { namespace threads { namespace detail
                 // call back into invoking context
                 if (!params.inner_.empty())
                     params.inner_();
+
+                // spin, yield, or park this worker if there is still nothing
+                // to do
+                if (next_thrd == nullptr &&
+                    (scheduler.get_scheduler_mode() &
+                        policies::enable_idle_backoff))
+                {
+                    scheduler.SchedulingPolicy::idle_backoff(num_thread,
+                        running && !may_exit, background_thread != nullptr);
+                }
             }
 
             // something went badly wrong, give up
@@ -736,7 +764,9 @@ namespace hpx { namespace threads { namespace detail
                 idle_loop_count > params.max_idle_loop_count_ || may_exit)
             {
                 // clean up terminated threads
-                if (idle_loop_count > params.max_idle_loop_count_)
+                bool const idle =
+                    idle_loop_count > params.max_idle_loop_count_;
+                if (idle)
                     idle_loop_count = 0;
 
                 // call back into invoking context
@@ -756,6 +786,13 @@ namespace hpx { namespace threads { namespace detail
                 else
                 {
                     scheduler.SchedulingPolicy::cleanup_terminated(true);
+
+#if defined(HPX_HAVE_THREAD_STACK_POOL)
+                    // hand the stacks cached by this worker back to the pool
+                    // (releasing their memory) if it has been idle for a while
+                    if (idle)
+                        coroutines::detail::posix::trim_stack_pool();
+#endif
                 }
             }
         }
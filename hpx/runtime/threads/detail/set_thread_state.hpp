@@ -7,21 +7,28 @@
 #define HPX_RUNTIME_THREADS_DETAIL_SET_THREAD_STATE_JAN_13_2013_0518PM
 
 #include <hpx/config.hpp>
+#if !defined(HPX_HAVE_THREAD_TIMER_WHEEL)
 #include <hpx/config/asio.hpp>
+#endif
 #include <hpx/error_code.hpp>
 #include <hpx/runtime/threads/coroutines/coroutine.hpp>
 #include <hpx/runtime/threads/detail/create_thread.hpp>
 #include <hpx/runtime/threads/detail/create_work.hpp>
+#include <hpx/runtime/threads/policies/scheduler_base.hpp>
 #include <hpx/runtime/threads/thread_data.hpp>
 #include <hpx/runtime/threads/thread_helpers.hpp>
 #include <hpx/runtime_fwd.hpp>
 #include <hpx/throw_exception.hpp>
 #include <hpx/util/bind.hpp>
+#if !defined(HPX_HAVE_THREAD_TIMER_WHEEL)
 #include <hpx/util/io_service_pool.hpp>
+#endif
 #include <hpx/util/logging.hpp>
 #include <hpx/util/steady_clock.hpp>
 
+#if !defined(HPX_HAVE_THREAD_TIMER_WHEEL)
 #include <boost/asio/basic_waitable_timer.hpp>
+#endif
 #include <boost/atomic.hpp>
 
 #include <chrono>
@@ -236,6 +243,65 @@ namespace hpx { namespace threads { namespace detail
         return previous_state;
     }
 
+#if defined(HPX_HAVE_THREAD_TIMER_WHEEL)
+    ///////////////////////////////////////////////////////////////////////////
+    /// Arm a timer in the timer wheel of the given scheduler which sets the
+    /// state of the given \a thread to the given new value after it expired
+    /// (at the given time). The returned handle can be used to cancel the
+    /// timer (see scheduler_base::cancel_thread_timer).
+    inline policies::detail::thread_timer_wheel::handle add_thread_timer(
+        policies::scheduler_base& scheduler,
+        util::steady_time_point const& abs_time, thread_id_type const& thrd,
+        thread_state_enum newstate, thread_state_ex_enum newstate_ex,
+        thread_priority priority, error_code& ec)
+    {
+        if (HPX_UNLIKELY(!thrd)) {
+            HPX_THROWS_IF(ec, null_thread_id,
+                "threads::detail::add_thread_timer",
+                "null thread id encountered");
+            return policies::detail::thread_timer_wheel::handle();
+        }
+
+        policies::detail::thread_timer_data data =
+            { thrd, newstate, newstate_ex, priority };
+
+        policies::detail::thread_timer_wheel::handle h =
+            scheduler.add_thread_timer(abs_time.value(), std::move(data));
+
+        if (&ec != &throws)
+            ec = make_success_code();
+
+        return h;
+    }
+
+    /// This function is invoked by the scheduling loop to perform the state
+    /// changes of all expired timers.
+    template <typename SchedulingPolicy>
+    std::size_t expire_thread_timers(SchedulingPolicy& scheduler)
+    {
+        return scheduler.get_thread_timers().expire(
+            [](policies::detail::thread_timer_data& t)
+            {
+                error_code ec(lightweight);    // do not throw
+                detail::set_thread_state(t.thrd_, t.newstate_, t.newstate_ex_,
+                    t.priority_, std::size_t(-1), ec);
+            });
+    }
+
+    /// Set a timer to set the state of the given \a thread to the given
+    /// new value after it expired (at the given time)
+    template <typename SchedulingPolicy>
+    thread_id_type set_thread_state_timed(SchedulingPolicy& scheduler,
+        util::steady_time_point const& abs_time, thread_id_type const& thrd,
+        thread_state_enum newstate, thread_state_ex_enum newstate_ex,
+        thread_priority priority, std::size_t thread_num, error_code& ec)
+    {
+        // the timer is managed by the scheduler, no helper thread is created
+        add_thread_timer(scheduler, abs_time, thrd, newstate, newstate_ex,
+            priority, ec);
+        return invalid_thread_id;
+    }
+#else
     ///////////////////////////////////////////////////////////////////////////
     /// This thread function is used by the at_timer thread below to trigger
     /// the required action.
@@ -366,6 +432,7 @@ namespace hpx { namespace threads { namespace detail
         create_thread(&scheduler, data, newid, pending, true, ec); //-V601
         return newid;
     }
+#endif
 
     template <typename SchedulingPolicy>
     thread_id_type set_thread_state_timed(SchedulingPolicy& scheduler,
@@ -15,6 +15,7 @@
 #include <hpx/runtime/threads/policies/affinity_data.hpp>
 #include <hpx/runtime/threads/policies/callback_notifier.hpp>
 #include <hpx/runtime/threads/policies/scheduler_mode.hpp>
+#include <hpx/runtime/threads/policies/steal_level.hpp>
 #include <hpx/runtime/threads/thread_init_data.hpp>
 #include <hpx/runtime/threads/topology.hpp>
 #include <hpx/state.hpp>
@@ -128,6 +129,13 @@ namespace hpx { namespace threads { namespace detail
         std::int64_t get_num_stolen_to_pending(std::size_t num, bool reset);
         std::int64_t get_num_stolen_from_staged(std::size_t num, bool reset);
         std::int64_t get_num_stolen_to_staged(std::size_t num, bool reset);
+        std::int64_t get_num_stolen_at_level(policies::steal_level level,
+            std::size_t num, bool reset);
+#endif
+
+#if defined(HPX_HAVE_THREAD_MANAGER_IDLE_BACKOFF)
+        std::int64_t get_num_parks(std::size_t num, bool reset);
+        std::int64_t get_num_unparks(std::size_t num, bool reset);
 #endif
 
         std::int64_t get_thread_count(thread_state_enum state,
@@ -99,6 +99,12 @@ namespace hpx { namespace threads
           , error_code& ec = throws
             ) const;
 
+        mask_cref_type get_cache_affinity_mask(
+            std::size_t num_thread
+          , bool numa_sensitive
+          , error_code& ec = throws
+            ) const;
+
         mask_cref_type get_thread_affinity_mask(
             std::size_t num_thread
           , bool numa_sensitive = false
@@ -121,6 +127,20 @@ namespace hpx { namespace threads
           , error_code& ec = throws
             ) const;
 
+        void set_area_membind(
+            void const* addr
+          , std::size_t len
+          , mask_cref_type mask
+          , membind_policy policy
+          , bool migrate
+          , error_code& ec = throws
+            ) const;
+
+        mask_type get_area_memlocation(
+            void const* addr
+          , error_code& ec = throws
+            ) const;
+
         ///////////////////////////////////////////////////////////////////////
         mask_type init_socket_affinity_mask_from_socket(
             std::size_t num_socket
@@ -131,6 +151,7 @@ namespace hpx { namespace threads
         mask_type init_core_affinity_mask_from_core(
             std::size_t num_core, mask_cref_type default_mask = mask_type()
             ) const;
+        mask_type init_cache_affinity_mask(std::size_t num_thread) const;
         mask_type init_thread_affinity_mask(std::size_t num_thread) const;
         mask_type init_thread_affinity_mask(
             std::size_t num_core
@@ -232,6 +253,9 @@ namespace hpx { namespace threads
 
         void init_num_of_pus();
 
+        hwloc_bitmap_t mask_to_cpuset(mask_cref_type mask) const;
+        mask_type cpuset_to_mask(hwloc_const_bitmap_t cpuset) const;
+
         hwloc_topology_t topo;
 
         // We need to define a constant pu offset.
@@ -258,6 +282,7 @@ namespace hpx { namespace threads
         std::vector<mask_type> socket_affinity_masks_;
         std::vector<mask_type> numa_node_affinity_masks_;
         std::vector<mask_type> core_affinity_masks_;
+        std::vector<mask_type> cache_affinity_masks_;
         std::vector<mask_type> thread_affinity_masks_;
     };
 
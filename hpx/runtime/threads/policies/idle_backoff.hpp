@@ -0,0 +1,229 @@
+//  Copyright (c) 2026 agent
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#if !defined(HPX_RUNTIME_THREADS_POLICIES_IDLE_BACKOFF_HPP)
+#define HPX_RUNTIME_THREADS_POLICIES_IDLE_BACKOFF_HPP
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_THREAD_MANAGER_IDLE_BACKOFF)
+#include <hpx/runtime/config_entry.hpp>
+
+#include <boost/atomic.hpp>
+#include <boost/lexical_cast.hpp>
+
+#if defined(__linux__)
+#include <linux/futex.h>
+#include <sys/syscall.h>
+#include <time.h>
+#include <unistd.h>
+#else
+#include <hpx/compat/condition_variable.hpp>
+#include <hpx/compat/mutex.hpp>
+#include <mutex>
+#endif
+
+#if defined(HPX_MSVC)
+#include <intrin.h>
+#endif
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+
+///////////////////////////////////////////////////////////////////////////////
+// Adaptive idle backoff of the scheduler worker threads.
+//
+// A worker which doesn't find any work goes through three phases:
+//  - it spins for hpx.idle_backoff.spin_count iterations of the scheduling
+//    loop, the number of pause instructions executed per iteration grows
+//    exponentially,
+//  - it yields its OS thread for hpx.idle_backoff.yield_count iterations,
+//  - it parks, i.e. it blocks on a futex (a condition variable on non-Linux
+//    systems) until new work is made available to it or until
+//    hpx.idle_backoff.park_timeout microseconds have passed. Workers which
+//    host a background thread (parcel layer and AGAS progress) use the
+//    (shorter) hpx.idle_backoff.background_park_timeout instead.
+//
+// Parked workers are woken up by the scheduler whenever work is added to
+// their queues (see scheduler_base::do_some_work).
+namespace hpx { namespace threads { namespace policies { namespace detail
+{
+    ///////////////////////////////////////////////////////////////////////////
+    inline std::int64_t get_idle_backoff_spin_count()
+    {
+        static std::int64_t spin_count =
+            boost::lexical_cast<std::int64_t>(hpx::get_config_entry(
+                "hpx.idle_backoff.spin_count", "32"));
+        return spin_count;
+    }
+
+    inline std::int64_t get_idle_backoff_yield_count()
+    {
+        static std::int64_t yield_count =
+            boost::lexical_cast<std::int64_t>(hpx::get_config_entry(
+                "hpx.idle_backoff.yield_count", "16"));
+        return yield_count;
+    }
+
+    inline std::chrono::microseconds get_idle_backoff_park_timeout()
+    {
+        static std::chrono::microseconds park_timeout(
+            boost::lexical_cast<std::int64_t>(hpx::get_config_entry(
+                "hpx.idle_backoff.park_timeout", "10000")));
+        return park_timeout;
+    }
+
+    inline std::chrono::microseconds get_idle_backoff_background_park_timeout()
+    {
+        static std::chrono::microseconds park_timeout(
+            boost::lexical_cast<std::int64_t>(hpx::get_config_entry(
+                "hpx.idle_backoff.background_park_timeout", "1000")));
+        return park_timeout;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    inline void spin_pause()
+    {
+#if defined(HPX_MSVC)
+        _mm_pause();
+#elif defined(__x86_64__) || defined(__i386__)
+        __builtin_ia32_pause();
+#elif defined(__aarch64__) || defined(__arm__)
+        __asm__ __volatile__("yield" ::: "memory");
+#endif
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    // The parking state of a single worker thread. All functions except
+    // unpark() must be called by the owning worker only.
+    class worker_parking
+    {
+        enum { awake = 0, parked = 1 };
+        enum { cache_line_size = 64 };
+
+        HPX_NON_COPYABLE(worker_parking);
+
+    public:
+        worker_parking()
+          : state_(awake)
+          , idle_count_(0)
+          , parks_(0)
+          , unparks_(0)
+        {}
+
+        // Announce that this worker is about to park. The caller has to
+        // check for new work after this and either call cancel_park() or
+        // park().
+        void prepare_park()
+        {
+            state_.store(parked, boost::memory_order_seq_cst);
+        }
+
+        void cancel_park()
+        {
+            state_.store(awake, boost::memory_order_relaxed);
+        }
+
+        // Block until unpark() is called or the timeout expires, returns
+        // whether this worker was woken up explicitly.
+        bool park(std::chrono::microseconds timeout)
+        {
+            parks_.fetch_add(1, boost::memory_order_relaxed);
+
+#if defined(__linux__)
+            struct timespec ts;
+            ts.tv_sec = static_cast<time_t>(timeout.count() / 1000000);
+            ts.tv_nsec = static_cast<long>((timeout.count() % 1000000) * 1000);
+
+            // spurious wake-ups are fine, the scheduling loop will simply
+            // look for work once more
+            if (state_.load(boost::memory_order_acquire) == parked)
+            {
+                ::syscall(SYS_futex, get_futex_word(), FUTEX_WAIT_PRIVATE,
+                    std::uint32_t(parked), &ts, nullptr, 0);
+            }
+#else
+            {
+                std::unique_lock<compat::mutex> l(mtx_);
+                cond_.wait_for(l, timeout, [this]() -> bool
+                {
+                    return state_.load(boost::memory_order_acquire) != parked;
+                });
+            }
+#endif
+            return state_.exchange(awake, boost::memory_order_acquire) ==
+                awake;
+        }
+
+        // Wake up this worker if it is parked, may be called by any thread.
+        bool unpark()
+        {
+            if (state_.load(boost::memory_order_relaxed) != parked ||
+                state_.exchange(awake, boost::memory_order_release) != parked)
+            {
+                return false;
+            }
+
+            unparks_.fetch_add(1, boost::memory_order_relaxed);
+
+#if defined(__linux__)
+            ::syscall(SYS_futex, get_futex_word(), FUTEX_WAKE_PRIVATE, 1,
+                nullptr, nullptr, 0);
+#else
+            {
+                std::lock_guard<compat::mutex> l(mtx_);
+            }
+            cond_.notify_one();
+#endif
+            return true;
+        }
+
+        // number of consecutive idle iterations of the owning worker
+        std::int64_t& idle_count()
+        {
+            return idle_count_;
+        }
+
+        std::int64_t get_num_parks(bool reset)
+        {
+            return reset ? parks_.exchange(0, boost::memory_order_relaxed) :
+                parks_.load(boost::memory_order_relaxed);
+        }
+
+        std::int64_t get_num_unparks(bool reset)
+        {
+            return reset ? unparks_.exchange(0, boost::memory_order_relaxed) :
+                unparks_.load(boost::memory_order_relaxed);
+        }
+
+    private:
+#if defined(__linux__)
+        std::uint32_t* get_futex_word()
+        {
+            static_assert(sizeof(state_) == sizeof(std::uint32_t),
+                "futex word must be a plain 32 bit integer");
+            return reinterpret_cast<std::uint32_t*>(&state_);
+        }
+#endif
+
+        boost::atomic<std::uint32_t> state_;
+        std::int64_t idle_count_;
+
+        boost::atomic<std::int64_t> parks_;
+        boost::atomic<std::int64_t> unparks_;
+
+#if !defined(__linux__)
+        compat::mutex mtx_;
+        compat::condition_variable cond_;
+#endif
+
+        // avoid false sharing between workers
+        char pad_[cache_line_size];
+    };
+}}}}
+
+#endif
+#endif
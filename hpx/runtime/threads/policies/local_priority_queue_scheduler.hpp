@@ -17,6 +17,8 @@
 #include <hpx/runtime/threads/topology.hpp>
 #include <hpx/runtime/threads_fwd.hpp>
 #include <hpx/throw_exception.hpp>
+#include <hpx/util/assert.hpp>
+#include <hpx/util/get_and_reset_value.hpp>
 #include <hpx/util/logging.hpp>
 #include <hpx/util_fwd.hpp>
 
@@ -53,6 +55,12 @@ namespace hpx { namespace threads { namespace policies
     /// High priority threads are executed by the first N OS threads before any
     /// other work is executed. Low priority threads are executed by the last
     /// OS thread whenever no other work is available.
+    /// Idle OS threads steal work from the queues of other OS threads. The
+    /// victims are probed level by level (see \a steal_level): first the
+    /// threads running on the same core, then the ones sharing the last level
+    /// cache, then the ones in the same NUMA domain, and only then the ones
+    /// in remote NUMA domains. Each level is probed starting at a randomly
+    /// selected victim to spread the stealing pressure.
     template <typename Mutex = compat::mutex,
         typename PendingQueuing = lockfree_fifo,
         typename StagedQueuing = lockfree_fifo,
@@ -127,11 +135,9 @@ namespace hpx { namespace threads { namespace policies
             high_priority_queues_(init.num_high_priority_queues_),
             low_priority_queue_(init.max_queue_thread_count_),
             curr_queue_(0),
-            numa_sensitive_(init.numa_sensitive_)
+            numa_sensitive_(init.numa_sensitive_),
+            victim_threads_(init.num_queues_)
         {
-            victim_threads_.clear();
-            victim_threads_.resize(init.num_queues_);
-
             if (!deferred_initialization)
             {
 #if defined(HPX_MSVC)
@@ -412,6 +418,26 @@ namespace hpx { namespace threads { namespace policies
             }
             return num_stolen_threads;
         }
+
+        std::int64_t get_num_stolen_at_level(steal_level level,
+            std::size_t num_thread, bool reset)
+        {
+            HPX_ASSERT(level < steal_level_count);
+
+            if (num_thread == std::size_t(-1))
+            {
+                std::int64_t num_stolen_threads = 0;
+                for (victims_data& victims : victim_threads_)
+                {
+                    num_stolen_threads += util::get_and_reset_value(
+                        victims.stolen_[level], reset);
+                }
+                return num_stolen_threads;
+            }
+
+            return util::get_and_reset_value(
+                victim_threads_[num_thread].stolen_[level], reset);
+        }
 #endif
 
         ///////////////////////////////////////////////////////////////////////
@@ -539,30 +565,35 @@ namespace hpx { namespace threads { namespace policies
                     return false;
             }
 
-            for (std::size_t idx: victim_threads_[num_thread])
-            {
-                HPX_ASSERT(idx != num_thread);
-
-                if (idx < high_priority_queues &&
-                    num_thread < high_priority_queues)
+            bool stolen = steal_from_victims(num_thread,
+                [&](std::size_t idx) -> std::size_t
                 {
-                    thread_queue_type* q = high_priority_queues_[idx];
-                    if (q->get_next_thread(thrd, running))
+                    HPX_ASSERT(idx != num_thread);
+
+                    if (idx < high_priority_queues &&
+                        num_thread < high_priority_queues)
                     {
-                        q->increment_num_stolen_from_pending();
-                        this_high_priority_queue->
-                            increment_num_stolen_to_pending();
-                        return true;
+                        thread_queue_type* q = high_priority_queues_[idx];
+                        if (q->get_next_thread(thrd, running))
+                        {
+                            q->increment_num_stolen_from_pending();
+                            this_high_priority_queue->
+                                increment_num_stolen_to_pending();
+                            return 1;
+                        }
                     }
-                }
 
-                if (queues_[idx]->get_next_thread(thrd, running))
-                {
-                    queues_[idx]->increment_num_stolen_from_pending();
-                    this_queue->increment_num_stolen_to_pending();
-                    return true;
-                }
-            }
+                    if (queues_[idx]->get_next_thread(thrd, running))
+                    {
+                        queues_[idx]->increment_num_stolen_from_pending();
+                        this_queue->increment_num_stolen_to_pending();
+                        return 1;
+                    }
+                    return 0;
+                });
+
+            if (stolen)
+                return true;
 
             return low_priority_queue_.get_next_thread(thrd);
         }
@@ -923,37 +954,43 @@ namespace hpx { namespace threads { namespace policies
                 running, idle_loop_count, added) && result;
             if (0 != added) return result;
 
-            for (std::size_t idx: victim_threads_[num_thread])
-            {
-                HPX_ASSERT(idx != num_thread);
-
-                if (idx < high_priority_queues &&
-                    num_thread < high_priority_queues)
+            // the staged queues of the victims are stolen from in batches
+            // of half of their length (see thread_queue::add_new_always)
+            bool stolen = steal_from_victims(num_thread,
+                [&](std::size_t idx) -> std::size_t
                 {
-                    thread_queue_type* q =  high_priority_queues_[idx];
-                    result = this_high_priority_queue->
-                        wait_or_add_new(running, idle_loop_count,
-                            added, q)
-                      && result;
+                    HPX_ASSERT(idx != num_thread);
 
+                    if (idx < high_priority_queues &&
+                        num_thread < high_priority_queues)
+                    {
+                        thread_queue_type* q =  high_priority_queues_[idx];
+                        result = this_high_priority_queue->
+                            wait_or_add_new(running, idle_loop_count,
+                                added, q)
+                          && result;
+
+                        if (0 != added)
+                        {
+                            q->increment_num_stolen_from_staged(added);
+                            this_high_priority_queue->
+                                increment_num_stolen_to_staged(added);
+                            return added;
+                        }
+                    }
+
+                    result = this_queue->wait_or_add_new(running,
+                        idle_loop_count, added, queues_[idx]) && result;
                     if (0 != added)
                     {
-                        q->increment_num_stolen_from_staged(added);
-                        this_high_priority_queue->
-                            increment_num_stolen_to_staged(added);
-                        return result;
+                        queues_[idx]->increment_num_stolen_from_staged(added);
+                        this_queue->increment_num_stolen_to_staged(added);
                     }
-                }
+                    return added;
+                });
 
-                result = this_queue->wait_or_add_new(running,
-                    idle_loop_count, added, queues_[idx]) && result;
-                if (0 != added)
-                {
-                    queues_[idx]->increment_num_stolen_from_staged(added);
-                    this_queue->increment_num_stolen_to_staged(added);
-                    return result;
-                }
-            }
+            if (stolen)
+                return result;
 
 #ifdef HPX_HAVE_THREAD_MINIMAL_DEADLOCK_DETECTION
             // no new work is available, are we deadlocked?
@@ -1020,14 +1057,17 @@ namespace hpx { namespace threads { namespace policies
             queues_[num_thread]->on_start_thread(num_thread);
 
             std::size_t num_threads = queues_.size();
-            // get numa domain masks of all queues...
+            // get numa domain, cache, and core masks of all queues...
             std::vector<mask_type> numa_masks(num_threads);
+            std::vector<mask_type> cache_masks(num_threads);
             std::vector<mask_type> core_masks(num_threads);
             for (std::size_t i = 0; i != num_threads; ++i)
             {
                 std::size_t num_pu = get_pu_num(i);
                 numa_masks[i] =
                     topology_.get_numa_node_affinity_mask(num_pu, numa_sensitive_ != 0);
+                cache_masks[i] =
+                    topology_.get_cache_affinity_mask(num_pu, numa_sensitive_ != 0);
                 core_masks[i] =
                     topology_.get_core_affinity_mask(num_pu, numa_sensitive_ != 0);
             }
@@ -1036,11 +1076,17 @@ namespace hpx { namespace threads { namespace policies
             // steal from
             std::ptrdiff_t radius =
                 static_cast<std::ptrdiff_t>((num_threads / 2.0) + 0.5);
-            victim_threads_[num_thread].reserve(num_threads);
+
+            victims_data& victims = victim_threads_[num_thread];
+            victims.victims_.clear();
+            victims.victims_.reserve(num_threads);
+            victims.seed_ = (num_thread + 1) * 0x9e3779b97f4a7c15ULL;
+
             std::size_t num_pu = get_pu_num(num_thread);
             mask_cref_type pu_mask =
                 topology_.get_thread_affinity_mask(num_pu, numa_sensitive_ != 0);
             mask_cref_type numa_mask = numa_masks[num_thread];
+            mask_cref_type cache_mask = cache_masks[num_thread];
             mask_cref_type core_mask = core_masks[num_thread];
 
             // we allow the thread on the boundary of the NUMA domain to steal
@@ -1053,8 +1099,34 @@ namespace hpx { namespace threads { namespace policies
             else
                 first_mask = pu_mask;
 
-            auto iterate = [&](hpx::util::function_nonser<bool(std::size_t)> f)
+            // we steal from remote NUMA domains only if we are not strictly
+            // numa aware
+            bool steal_remote = numa_sensitive_ != 2 && any(first_mask & pu_mask);
+
+            auto get_steal_level = [&](std::size_t other_num_thread)
+                -> std::size_t
+            {
+                if (!any(numa_mask & numa_masks[other_num_thread]))
+                {
+                    return steal_remote ?
+                        std::size_t(steal_level_remote) :
+                        std::size_t(steal_level_count);
+                }
+                if (any(core_mask & core_masks[other_num_thread]))
+                    return steal_level_smt;
+                if (any(cache_mask & cache_masks[other_num_thread]))
+                    return steal_level_cache;
+                return steal_level_numa;
+            };
+
+            auto iterate = [&](std::size_t level)
             {
+                auto f = [&](std::size_t other_num_thread) -> bool
+                {
+                    return other_num_thread != num_thread &&
+                        get_steal_level(other_num_thread) == level;
+                };
+
                 // check our neighbors in a radial fashion (left and right
                 // alternating, increasing distance each iteration)
                 int i = 1;
@@ -1068,14 +1140,14 @@ namespace hpx { namespace threads { namespace policies
 
                     if (f(std::size_t(left)))
                     {
-                        victim_threads_[num_thread].push_back(
+                        victims.victims_.push_back(
                             static_cast<std::size_t>(left));
                     }
 
                     std::size_t right = (num_thread + i) % num_threads;
                     if (f(right))
                     {
-                        victim_threads_[num_thread].push_back(right);
+                        victims.victims_.push_back(right);
                     }
                 }
                 if ((num_threads % 2) == 0)
@@ -1083,39 +1155,18 @@ namespace hpx { namespace threads { namespace policies
                     std::size_t right = (num_thread + i) % num_threads;
                     if (f(right))
                     {
-                        victim_threads_[num_thread].push_back(right);
+                        victims.victims_.push_back(right);
                     }
                 }
-            };
-
-            // check for threads which share the same core...
-            iterate(
-                [&](std::size_t other_num_thread)
-                {
-                    return any(core_mask & core_masks[other_num_thread]);
-                }
-            );
 
-            // check for threads which share the same numa domain...
-            iterate(
-                [&](std::size_t other_num_thread)
-                {
-                    return
-                        !any(core_mask & core_masks[other_num_thread])
-                        && any(numa_mask & numa_masks[other_num_thread]);
-                }
-            );
+                victims.level_end_[level] = victims.victims_.size();
+            };
 
-            // check for the rest and if we are numa aware
-            if (numa_sensitive_ != 2 && any(first_mask & pu_mask))
-            {
-                iterate(
-                    [&](std::size_t other_num_thread)
-                    {
-                        return !any(numa_mask & numa_masks[other_num_thread]);
-                    }
-                );
-            }
+            // check for threads which share the same core, then for threads
+            // sharing the same last level cache, the same numa domain, and
+            // finally for the rest (if we are not numa aware)
+            for (std::size_t level = 0; level != steal_level_count; ++level)
+                iterate(level);
         }
 
         void on_stop_thread(std::size_t num_thread)
@@ -1143,6 +1194,76 @@ namespace hpx { namespace threads { namespace policies
             curr_queue_.store(0);
         }
 
+    protected:
+        // The victims of a single OS thread, sorted by steal level
+        struct victims_data
+        {
+            victims_data()
+              : seed_(1)
+            {
+                for (std::size_t level = 0; level != steal_level_count; ++level)
+                {
+                    level_end_[level] = 0;
+#ifdef HPX_HAVE_THREAD_STEALING_COUNTS
+                    stolen_[level].store(0, boost::memory_order_relaxed);
+#endif
+                }
+            }
+
+            // xorshift64*, this is accessed by the owning OS thread only
+            std::size_t next_random()
+            {
+                seed_ ^= seed_ >> 12;
+                seed_ ^= seed_ << 25;
+                seed_ ^= seed_ >> 27;
+                return static_cast<std::size_t>(
+                    (seed_ * 0x2545f4914f6cdd1dULL) >> 32);
+            }
+
+            std::vector<std::size_t> victims_;
+            std::size_t level_end_[steal_level_count];
+            std::uint64_t seed_;
+
+#ifdef HPX_HAVE_THREAD_STEALING_COUNTS
+            boost::atomic<std::int64_t> stolen_[steal_level_count];
+#endif
+        };
+
+        // Invoke f for the victims of the given OS thread until it reports
+        // having stolen something. Victims are probed level by level, each
+        // level starting at a random victim.
+        template <typename F>
+        bool steal_from_victims(std::size_t num_thread, F && f)
+        {
+            victims_data& victims = victim_threads_[num_thread];
+
+            std::size_t begin = 0;
+            for (std::size_t level = 0; level != steal_level_count; ++level)
+            {
+                std::size_t end = victims.level_end_[level];
+                std::size_t size = end - begin;
+                if (size != 0)
+                {
+                    std::size_t offset = victims.next_random() % size;
+                    for (std::size_t i = 0; i != size; ++i)
+                    {
+                        std::size_t stolen =
+                            f(victims.victims_[begin + (offset + i) % size]);
+                        if (stolen != 0)
+                        {
+#ifdef HPX_HAVE_THREAD_STEALING_COUNTS
+                            victims.stolen_[level].fetch_add(stolen,
+                                boost::memory_order_relaxed);
+#endif
+                            return true;
+                        }
+                    }
+                }
+                begin = end;
+            }
+            return false;
+        }
+
     protected:
         std::size_t max_queue_thread_count_;
         std::vector<thread_queue_type*> queues_;
@@ -1151,7 +1272,7 @@ namespace hpx { namespace threads { namespace policies
         boost::atomic<std::size_t> curr_queue_;
         std::size_t numa_sensitive_;
 
-        std::vector<std::vector<std::size_t> > victim_threads_;
+        std::vector<victims_data> victim_threads_;
     };
 }}}
 
@@ -10,7 +10,11 @@
 
 #include <hpx/config.hpp>
 
+#include <hpx/util/lockfree/chase_lev_deque.hpp>
 #include <hpx/util/lockfree/deque.hpp>
+#include <hpx/util/thread_specific_ptr.hpp>
+
+#include <boost/atomic.hpp>
 #include <boost/lockfree/queue.hpp>
 #include <boost/lockfree/stack.hpp>
 
@@ -55,6 +59,9 @@ struct basic_lockfree_queue_backend
         return queue_.empty();
     }
 
+    void on_start_thread() {}
+    void on_stop_thread() {}
+
   private:
     container_type queue_;
 };
@@ -120,6 +127,9 @@ struct lockfree_abp_fifo_backend
         return queue_.empty();
     }
 
+    void on_start_thread() {}
+    void on_stop_thread() {}
+
   private:
     container_type queue_;
 };
@@ -172,6 +182,9 @@ struct lockfree_abp_lifo_backend
         return queue_.empty();
     }
 
+    void on_start_thread() {}
+    void on_stop_thread() {}
+
   private:
     container_type queue_;
 };
@@ -187,6 +200,106 @@ struct lockfree_abp_lifo
 
 #endif // HPX_HAVE_ABP_SCHEDULER
 
+///////////////////////////////////////////////////////////////////////////////
+// LIFO for the owning worker thread + FIFO stealing at the opposite end, based
+// on the Chase-Lev work-stealing deque. The worker thread owning the queue
+// (the one which called on_start_thread()) pushes and pops its own work
+// without any atomic read-modify-write operations in the common case, only
+// thieves contend on the top end of the deque.
+//
+// Items pushed from any other thread (or pushed to the 'other end') are
+// placed into a separate lock-free FIFO which is drained by the owner once
+// its deque runs empty and which is visible to thieves as well.
+struct lockfree_chase_lev_lifo;
+
+namespace detail
+{
+    // Returns a value uniquely identifying the calling OS thread.
+    inline std::uintptr_t get_queue_owner_token()
+    {
+        static HPX_NATIVE_TLS char token = 0;
+        return reinterpret_cast<std::uintptr_t>(&token);
+    }
+}
+
+template <typename T>
+struct lockfree_chase_lev_lifo_backend
+{
+    typedef boost::lockfree::chase_lev_deque<T> container_type;
+    typedef T value_type;
+    typedef T& reference;
+    typedef T const& const_reference;
+    typedef std::uint64_t size_type;
+
+    lockfree_chase_lev_lifo_backend(
+        size_type initial_size = 0
+      , size_type num_thread = size_type(-1)
+        )
+      : owner_(0)
+      , queue_(std::size_t(initial_size))
+      , overflow_(std::size_t(initial_size))
+    {}
+
+    bool push(const_reference val, bool other_end = false)
+    {
+        if (!other_end && is_owner())
+            return queue_.push_bottom(val);
+        return overflow_.push(val);
+    }
+
+    bool pop(reference val, bool /*steal*/ = true)
+    {
+        if (is_owner())
+        {
+            if (queue_.pop_bottom(val))
+                return true;
+        }
+        else if (queue_.steal(val))
+        {
+            return true;
+        }
+        return overflow_.pop(val);
+    }
+
+    bool empty()
+    {
+        return queue_.empty() && overflow_.empty();
+    }
+
+    // The thread calling this becomes the owner of the deque
+    void on_start_thread()
+    {
+        owner_.store(detail::get_queue_owner_token(),
+            boost::memory_order_release);
+    }
+
+    void on_stop_thread()
+    {
+        if (is_owner())
+            owner_.store(0, boost::memory_order_release);
+    }
+
+  private:
+    bool is_owner() const
+    {
+        return owner_.load(boost::memory_order_relaxed) ==
+            detail::get_queue_owner_token();
+    }
+
+    boost::atomic<std::uintptr_t> owner_;
+    container_type queue_;
+    boost::lockfree::queue<T> overflow_;
+};
+
+struct lockfree_chase_lev_lifo
+{
+    template <typename T>
+    struct apply
+    {
+        typedef lockfree_chase_lev_lifo_backend<T> type;
+    };
+};
+
 }}}
 
 #endif // HPX_FB3518C8_4493_450E_A823_A9F8A3185B2D
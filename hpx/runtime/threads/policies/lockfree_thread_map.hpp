@@ -0,0 +1,285 @@
+//  Copyright (c) 2026 agent
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#if !defined(HPX_RUNTIME_THREADS_POLICIES_LOCKFREE_THREAD_MAP_HPP)
+#define HPX_RUNTIME_THREADS_POLICIES_LOCKFREE_THREAD_MAP_HPP
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_THREAD_LOCKFREE_RECYCLING)
+#include <hpx/compat/mutex.hpp>
+#include <hpx/runtime/threads/thread_data.hpp>
+#include <hpx/throw_exception.hpp>
+#include <hpx/util/assert.hpp>
+
+#include <boost/atomic.hpp>
+#include <boost/lockfree/detail/tagged_ptr.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+
+///////////////////////////////////////////////////////////////////////////////
+namespace hpx { namespace threads { namespace policies { namespace detail
+{
+    ///////////////////////////////////////////////////////////////////////////
+    // Intrusive lock-free (Treiber) stack of recycled thread_data objects.
+    // The link is stored in the thread_data object itself, thus pushing and
+    // popping never allocates. ABA problems are avoided by tagging the head
+    // pointer.
+    //
+    // Objects stored in this list must stay alive for as long as the list is
+    // being used (the thread_queue holds a reference to each of them).
+    class thread_recycling_list
+    {
+        typedef boost::lockfree::detail::tagged_ptr<thread_data> tagged_ptr;
+
+        HPX_NON_COPYABLE(thread_recycling_list);
+
+    public:
+        thread_recycling_list()
+          : head_(tagged_ptr(nullptr, 0))
+        {}
+
+        void push(thread_data* thrd)
+        {
+            tagged_ptr old_head = head_.load(boost::memory_order_relaxed);
+            while (true)
+            {
+                thrd->set_next_recycled(old_head.get_ptr());
+                tagged_ptr new_head(thrd, old_head.get_next_tag());
+                if (head_.compare_exchange_weak(old_head, new_head,
+                        boost::memory_order_release,
+                        boost::memory_order_relaxed))
+                {
+                    return;
+                }
+            }
+        }
+
+        thread_data* pop()
+        {
+            tagged_ptr old_head = head_.load(boost::memory_order_acquire);
+            while (old_head.get_ptr() != nullptr)
+            {
+                tagged_ptr new_head(old_head->get_next_recycled(),
+                    old_head.get_next_tag());
+                if (head_.compare_exchange_weak(old_head, new_head,
+                        boost::memory_order_acquire,
+                        boost::memory_order_acquire))
+                {
+                    return old_head.get_ptr();
+                }
+            }
+            return nullptr;
+        }
+
+        bool empty() const
+        {
+            return head_.load(boost::memory_order_relaxed).get_ptr() == nullptr;
+        }
+
+    private:
+        boost::atomic<tagged_ptr> head_;
+    };
+
+#if defined(HPX_HAVE_THREAD_ENUMERATION)
+    ///////////////////////////////////////////////////////////////////////////
+    // Allocation-free (in the steady state) registry of all threads managed
+    // by a thread_queue, replacing the std::unordered_set based thread map.
+    //
+    // The registry is a table of slots which is grown in chunks. Each slot
+    // either holds a pointer to a registered thread_data object or, if it is
+    // unused, the index of the next unused slot (the lowest bit is set in this
+    // case). Unused slots form a lock-free list whose (tagged) head is stored
+    // in a single 64 bit word. Registering and unregistering a thread are
+    // lock-free, only growing the table acquires a mutex.
+    //
+    // Iterating over the registry is safe as long as it is guaranteed that
+    // registered thread_data objects are not destroyed concurrently.
+    class thread_registry
+    {
+        typedef boost::atomic<std::uintptr_t> slot_type;
+
+        enum
+        {
+            chunk_size = 4096,
+            max_chunks = 1024
+        };
+
+        HPX_NON_COPYABLE(thread_registry);
+
+    public:
+        thread_registry()
+          : free_head_(0)
+          , num_chunks_(0)
+        {
+            for (std::size_t i = 0; i != max_chunks; ++i)
+                chunks_[i].store(nullptr, boost::memory_order_relaxed);
+        }
+
+        ~thread_registry()
+        {
+            std::size_t num_chunks =
+                num_chunks_.load(boost::memory_order_relaxed);
+            for (std::size_t i = 0; i != num_chunks; ++i)
+                delete [] chunks_[i].load(boost::memory_order_relaxed);
+        }
+
+        void insert(thread_data* thrd)
+        {
+            HPX_ASSERT((reinterpret_cast<std::uintptr_t>(thrd) & 1) == 0);
+
+            std::size_t idx = pop_free_slot();
+            thrd->set_registry_slot(idx);
+            get_slot(idx).store(reinterpret_cast<std::uintptr_t>(thrd),
+                boost::memory_order_release);
+        }
+
+        void erase(thread_data* thrd)
+        {
+            std::size_t idx = thrd->get_registry_slot();
+            HPX_ASSERT(get_slot(idx).load(boost::memory_order_relaxed) ==
+                reinterpret_cast<std::uintptr_t>(thrd));
+
+            thrd->set_registry_slot(std::size_t(-1));
+            push_free_slot(idx);
+        }
+
+        // Invoke the given function for all registered threads
+        template <typename F>
+        void for_each(F && f) const
+        {
+            std::size_t num_chunks =
+                num_chunks_.load(boost::memory_order_acquire);
+            for (std::size_t i = 0; i != num_chunks; ++i)
+            {
+                slot_type const* chunk =
+                    chunks_[i].load(boost::memory_order_acquire);
+                for (std::size_t j = 0; j != chunk_size; ++j)
+                {
+                    std::uintptr_t value =
+                        chunk[j].load(boost::memory_order_acquire);
+                    if (value != 0 && (value & 1) == 0)
+                        f(reinterpret_cast<thread_data*>(value));
+                }
+            }
+        }
+
+    private:
+        slot_type& get_slot(std::size_t idx) const
+        {
+            return chunks_[idx / chunk_size].load(
+                boost::memory_order_acquire)[idx % chunk_size];
+        }
+
+        // The head of the list of unused slots is stored as (tag << 32) |
+        // (index + 1), an index of zero marks the end of the list.
+        static std::uint64_t make_head(std::uint64_t head, std::size_t idx1)
+        {
+            return (((head >> 32) + 1) << 32) | std::uint32_t(idx1);
+        }
+
+        std::size_t pop_free_slot()
+        {
+            std::uint64_t head = free_head_.load(boost::memory_order_acquire);
+            while (true)
+            {
+                std::size_t idx1 = std::uint32_t(head);
+                if (idx1 == 0)
+                {
+                    grow();
+                    head = free_head_.load(boost::memory_order_acquire);
+                    continue;
+                }
+
+                // the slot might have been reused concurrently, in which case
+                // the tag of the head has changed and the CAS below will fail
+                std::uintptr_t next =
+                    get_slot(idx1 - 1).load(boost::memory_order_relaxed);
+                if (free_head_.compare_exchange_weak(head,
+                        make_head(head, std::size_t(next >> 1)),
+                        boost::memory_order_acquire,
+                        boost::memory_order_acquire))
+                {
+                    return idx1 - 1;
+                }
+            }
+        }
+
+        void push_free_slot(std::size_t idx)
+        {
+            slot_type& slot = get_slot(idx);
+            std::uint64_t head = free_head_.load(boost::memory_order_relaxed);
+            while (true)
+            {
+                slot.store((std::uintptr_t(std::uint32_t(head)) << 1) | 1,
+                    boost::memory_order_relaxed);
+                if (free_head_.compare_exchange_weak(head,
+                        make_head(head, idx + 1),
+                        boost::memory_order_release,
+                        boost::memory_order_relaxed))
+                {
+                    return;
+                }
+            }
+        }
+
+        void grow()
+        {
+            std::lock_guard<compat::mutex> l(grow_mtx_);
+
+            // somebody else might have added new slots in the meantime
+            if (std::uint32_t(free_head_.load(boost::memory_order_acquire)) != 0)
+                return;
+
+            std::size_t num_chunks =
+                num_chunks_.load(boost::memory_order_relaxed);
+            if (num_chunks == max_chunks)
+            {
+                HPX_THROW_EXCEPTION(hpx::out_of_memory,
+                    "thread_registry::grow",
+                    "Couldn't add new thread to the thread registry");
+            }
+
+            // link all new slots, the last one will be linked to the
+            // current head of the list of unused slots below
+            std::size_t base = num_chunks * chunk_size;
+            slot_type* chunk = new slot_type[chunk_size];
+            for (std::size_t j = 0; j != chunk_size - 1; ++j)
+            {
+                chunk[j].store(((base + j + 2) << 1) | 1,
+                    boost::memory_order_relaxed);
+            }
+
+            chunks_[num_chunks].store(chunk, boost::memory_order_release);
+            num_chunks_.store(num_chunks + 1, boost::memory_order_release);
+
+            std::uint64_t head = free_head_.load(boost::memory_order_relaxed);
+            while (true)
+            {
+                chunk[chunk_size - 1].store(
+                    (std::uintptr_t(std::uint32_t(head)) << 1) | 1,
+                    boost::memory_order_relaxed);
+                if (free_head_.compare_exchange_weak(head,
+                        make_head(head, base + 1),
+                        boost::memory_order_release,
+                        boost::memory_order_relaxed))
+                {
+                    return;
+                }
+            }
+        }
+
+        boost::atomic<std::uint64_t> free_head_;
+        boost::atomic<std::size_t> num_chunks_;
+        boost::atomic<slot_type*> chunks_[max_chunks];
+        compat::mutex grow_mtx_;
+    };
+#endif
+}}}}
+
+#endif
+#endif
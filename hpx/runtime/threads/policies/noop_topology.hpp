@@ -98,6 +98,18 @@ public:
         return empty_mask;
     }
 
+    mask_cref_type get_cache_affinity_mask(
+        std::size_t thread_num
+      , bool numa_sensitive
+      , error_code& ec = throws
+        ) const
+    {
+        if (&ec != &throws)
+            ec = make_success_code();
+
+        return empty_mask;
+    }
+
     mask_cref_type get_thread_affinity_mask(
         std::size_t thread_num
       , bool numa_sensitive = false
@@ -140,6 +152,30 @@ public:
         return empty_mask;
     }
 
+    void set_area_membind(
+        void const* addr
+      , std::size_t len
+      , mask_cref_type mask
+      , membind_policy policy
+      , bool migrate
+      , error_code& ec = throws
+        ) const
+    {
+        if (&ec != &throws)
+            ec = make_success_code();
+    }
+
+    mask_type get_area_memlocation(
+        void const* addr
+      , error_code& ec = throws
+        ) const
+    {
+        if (&ec != &throws)
+            ec = make_success_code();
+
+        return empty_mask;
+    }
+
     mask_type get_cpubind_mask(
         error_code& ec = throws
         ) const
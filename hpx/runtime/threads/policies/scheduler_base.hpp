@@ -9,20 +9,31 @@
 #include <hpx/config.hpp>
 #include <hpx/compat/condition_variable.hpp>
 #include <hpx/compat/mutex.hpp>
+#include <hpx/compat/thread.hpp>
 #include <hpx/runtime/agas/interface.hpp>
 #include <hpx/runtime/parcelset_fwd.hpp>
 #include <hpx/runtime/threads/policies/affinity_data.hpp>
+#include <hpx/runtime/threads/policies/idle_backoff.hpp>
 #include <hpx/runtime/threads/policies/scheduler_mode.hpp>
+#include <hpx/runtime/threads/policies/steal_level.hpp>
+#if defined(HPX_HAVE_THREAD_TIMER_WHEEL)
+#include <hpx/runtime/config_entry.hpp>
+#include <hpx/runtime/threads/policies/timer_wheel.hpp>
+#endif
 #include <hpx/runtime/threads/thread_init_data.hpp>
 #include <hpx/runtime/threads/topology.hpp>
 #include <hpx/state.hpp>
 #include <hpx/util/assert.hpp>
+#include <hpx/util/steady_clock.hpp>
 #include <hpx/util_fwd.hpp>
 #if defined(HPX_HAVE_SCHEDULER_LOCAL_STORAGE)
 #include <hpx/runtime/threads/coroutines/detail/tss.hpp>
 #endif
 
 #include <boost/atomic.hpp>
+#if defined(HPX_HAVE_THREAD_TIMER_WHEEL)
+#include <boost/lexical_cast.hpp>
+#endif
 
 #include <algorithm>
 #include <chrono>
@@ -60,6 +71,29 @@ namespace hpx { namespace threads { namespace policies
     }
 #endif
 
+#if defined(HPX_HAVE_THREAD_TIMER_WHEEL)
+    namespace detail
+    {
+        // the state change to apply to a thread once its timer has expired
+        struct thread_timer_data
+        {
+            thread_id_type thrd_;
+            thread_state_enum newstate_;
+            thread_state_ex_enum newstate_ex_;
+            thread_priority priority_;
+        };
+
+        typedef timer_wheel<thread_timer_data> thread_timer_wheel;
+
+        inline std::chrono::microseconds get_timer_wheel_resolution()
+        {
+            return std::chrono::microseconds(
+                boost::lexical_cast<std::int64_t>(hpx::get_config_entry(
+                    "hpx.timer_wheel.resolution", "100")));
+        }
+    }
+#endif
+
     ///////////////////////////////////////////////////////////////////////////
     /// The scheduler_base defines the interface to be implemented by all
     /// scheduler policies
@@ -76,7 +110,16 @@ namespace hpx { namespace threads { namespace policies
           , affinity_data_(num_threads)
           , mode_(mode)
 #if defined(HPX_HAVE_THREAD_MANAGER_IDLE_BACKOFF)
-          , wait_count_(0)
+          , parking_(num_threads)
+          , num_spinning_(0)
+          , num_parked_(0)
+          , next_unpark_(0)
+#endif
+#if defined(HPX_HAVE_THREAD_TIMER_WHEEL)
+          , timers_(detail::get_timer_wheel_resolution())
+#if defined(HPX_HAVE_THREAD_MANAGER_IDLE_BACKOFF)
+          , timer_watcher_(std::size_t(-1))
+#endif
 #endif
           , states_(num_threads)
           , description_(description)
@@ -114,18 +157,202 @@ namespace hpx { namespace threads { namespace policies
             return affinity_data_.init(data, topology);
         }
 
-        void idle_callback(std::size_t /*num_thread*/)
+        /// This function gets called by the scheduling loop whenever the
+        /// given worker didn't find any work. Depending on how long the worker
+        /// has been idle already it spins, yields its OS thread, or parks
+        /// until new work is made available to it (see idle_backoff.hpp).
+        void idle_backoff(std::size_t num_thread, bool may_park,
+            bool has_background_work)
+        {
+#if defined(HPX_HAVE_THREAD_MANAGER_IDLE_BACKOFF)
+            HPX_ASSERT(num_thread < parking_.size());
+            detail::worker_parking& p = parking_[num_thread];
+
+            std::int64_t idle_count = p.idle_count()++;
+            if (idle_count == 0)
+                ++num_spinning_;
+
+            std::int64_t const spin_count = detail::get_idle_backoff_spin_count();
+            if (idle_count < spin_count)
+            {
+                // exponential spinning, capped at 64 pause instructions
+                std::int64_t pauses = std::int64_t(1) <<
+                    (idle_count < 6 ? idle_count : 6);
+                for (std::int64_t i = 0; i != pauses; ++i)
+                    detail::spin_pause();
+                return;
+            }
+
+            if (!may_park ||
+                idle_count < spin_count + detail::get_idle_backoff_yield_count())
+            {
+                compat::this_thread::yield();
+                return;
+            }
+
+            // announce the intent to park and look for work once more, this
+            // pairs with the fence in do_some_work
+            --num_spinning_;
+            ++num_parked_;
+            p.prepare_park();
+
+            std::chrono::microseconds timeout = has_background_work ?
+                detail::get_idle_backoff_background_park_timeout() :
+                detail::get_idle_backoff_park_timeout();
+
+#if defined(HPX_HAVE_THREAD_TIMER_WHEEL)
+            // one of the parked workers wakes up in time for the next timed
+            // thread state change, this pairs with the fence in
+            // add_thread_timer
+            std::size_t watcher = std::size_t(-1);
+            bool const watch_timers = !timers_.empty() &&
+                timer_watcher_.compare_exchange_strong(watcher, num_thread);
+            if (watch_timers)
+            {
+                util::steady_clock::duration const due =
+                    timers_.next_expiry() - util::steady_clock::now();
+                if (due < timeout)
+                {
+                    timeout = std::chrono::duration_cast<
+                        std::chrono::microseconds>(due);
+                }
+            }
+#endif
+
+            bool woken = true;
+            if (timeout.count() <= 0 || this->get_queue_length() != 0)
+            {
+                p.cancel_park();
+            }
+            else
+            {
+                woken = p.park(timeout);
+            }
+
+#if defined(HPX_HAVE_THREAD_TIMER_WHEEL)
+            if (watch_timers)
+                timer_watcher_.store(std::size_t(-1));
+#endif
+
+            --num_parked_;
+            ++num_spinning_;
+
+            // spin again if there is new work, otherwise park again right
+            // away after the next unsuccessful attempt to find work
+            p.idle_count() = woken ? 1 : idle_count;
+#endif
+        }
+
+        /// This function gets called by the scheduling loop whenever the
+        /// given worker found work (after being idle).
+        void reset_idle_backoff(std::size_t num_thread)
+        {
+#if defined(HPX_HAVE_THREAD_MANAGER_IDLE_BACKOFF)
+            HPX_ASSERT(num_thread < parking_.size());
+            std::int64_t& idle_count = parking_[num_thread].idle_count();
+            if (idle_count != 0)
+            {
+                idle_count = 0;
+
+                // the last spinning worker going busy wakes up another one,
+                // if needed (for more work or for watching the timers)
+                if (--num_spinning_ == 0 &&
+                    num_parked_.load(boost::memory_order_relaxed) != 0 &&
+                    (this->get_queue_length() != 0 || has_unwatched_timers()))
+                {
+                    unpark_one(num_thread);
+                }
+            }
+#endif
+        }
+
+        /// Wake up all parked workers
+        void unpark_all()
+        {
+#if defined(HPX_HAVE_THREAD_MANAGER_IDLE_BACKOFF)
+            boost::atomic_thread_fence(boost::memory_order_seq_cst);
+            for (detail::worker_parking& p : parking_)
+                p.unpark();
+#endif
+        }
+
+        std::int64_t get_num_parks(std::size_t num_thread, bool reset)
         {
 #if defined(HPX_HAVE_THREAD_MANAGER_IDLE_BACKOFF)
-            // Put this thread to sleep for some time, additionally it gets
-            // woken up on new work.
-            std::chrono::milliseconds period(++wait_count_);
+            if (num_thread != std::size_t(-1))
+                return parking_[num_thread].get_num_parks(reset);
 
-            std::unique_lock<compat::mutex> l(mtx_);
-            cond_.wait_for(l, period);
+            std::int64_t result = 0;
+            for (detail::worker_parking& p : parking_)
+                result += p.get_num_parks(reset);
+            return result;
+#else
+            return 0;
 #endif
         }
 
+        std::int64_t get_num_unparks(std::size_t num_thread, bool reset)
+        {
+#if defined(HPX_HAVE_THREAD_MANAGER_IDLE_BACKOFF)
+            if (num_thread != std::size_t(-1))
+                return parking_[num_thread].get_num_unparks(reset);
+
+            std::int64_t result = 0;
+            for (detail::worker_parking& p : parking_)
+                result += p.get_num_unparks(reset);
+            return result;
+#else
+            return 0;
+#endif
+        }
+
+#if defined(HPX_HAVE_THREAD_TIMER_WHEEL)
+        /// Arm a timer which applies the given state change to a thread once
+        /// it has expired. Expired timers are fired by the scheduling loop.
+        detail::thread_timer_wheel::handle add_thread_timer(
+            util::steady_clock::time_point const& abs_time,
+            detail::thread_timer_data && data)
+        {
+            bool earliest = false;
+            detail::thread_timer_wheel::handle h =
+                timers_.arm(abs_time, std::move(data), earliest);
+
+#if defined(HPX_HAVE_THREAD_MANAGER_IDLE_BACKOFF)
+            // make sure a parked worker wakes up in time for the new timer,
+            // this pairs with prepare_park in idle_backoff
+            if (earliest)
+            {
+                boost::atomic_thread_fence(boost::memory_order_seq_cst);
+
+                std::size_t const watcher = timer_watcher_.load(
+                    boost::memory_order_relaxed);
+                if (watcher != std::size_t(-1))
+                {
+                    parking_[watcher].unpark();
+                }
+                else if (num_parked_.load(boost::memory_order_relaxed) != 0 &&
+                    num_spinning_.load(boost::memory_order_relaxed) == 0)
+                {
+                    unpark_one(std::size_t(-1));
+                }
+            }
+#endif
+            return h;
+        }
+
+        /// Cancel a timer armed by add_thread_timer, returns whether the
+        /// timer was canceled before it expired.
+        bool cancel_thread_timer(detail::thread_timer_wheel::handle const& h)
+        {
+            return timers_.cancel(h);
+        }
+
+        detail::thread_timer_wheel& get_thread_timers()
+        {
+            return timers_;
+        }
+#endif
+
         bool background_callback(std::size_t num_thread)
         {
             bool result = false;
@@ -143,12 +370,20 @@ namespace hpx { namespace threads { namespace policies
         void do_some_work(std::size_t num_thread)
         {
 #if defined(HPX_HAVE_THREAD_MANAGER_IDLE_BACKOFF)
-            wait_count_.store(0, boost::memory_order_release);
-
-            if (num_thread == std::size_t(-1))
-                cond_.notify_all();
-            else
-                cond_.notify_one();
+            // make the new work visible before looking for parked workers,
+            // this pairs with prepare_park in idle_backoff
+            boost::atomic_thread_fence(boost::memory_order_seq_cst);
+            if (num_parked_.load(boost::memory_order_relaxed) == 0)
+                return;
+
+            // wake up the worker owning the queue the work was added to
+            if (num_thread < parking_.size() && parking_[num_thread].unpark())
+                return;
+
+            // otherwise wake up some other worker (which will steal the
+            // work), but only if no worker is actively looking for work
+            if (num_spinning_.load(boost::memory_order_relaxed) == 0)
+                unpark_one(num_thread);
 #endif
         }
 
@@ -243,6 +478,14 @@ namespace hpx { namespace threads { namespace policies
             bool reset) = 0;
         virtual std::int64_t get_num_stolen_to_staged(std::size_t num_thread,
             bool reset) = 0;
+
+        // number of tasks stolen from victims at the given steal level, only
+        // schedulers with hierarchical victim selection maintain these
+        virtual std::int64_t get_num_stolen_at_level(steal_level,
+            std::size_t, bool)
+        {
+            return 0;
+        }
 #endif
 
         virtual std::int64_t get_queue_length(
@@ -307,10 +550,48 @@ namespace hpx { namespace threads { namespace policies
         boost::atomic<scheduler_mode> mode_;
 
 #if defined(HPX_HAVE_THREAD_MANAGER_IDLE_BACKOFF)
-        // support for suspension on idle queues
+        bool has_unwatched_timers() const
+        {
+#if defined(HPX_HAVE_THREAD_TIMER_WHEEL)
+            return !timers_.empty() &&
+                timer_watcher_.load(boost::memory_order_relaxed) ==
+                    std::size_t(-1);
+#else
+            return false;
+#endif
+        }
+
+        void unpark_one(std::size_t num_thread)
+        {
+            std::size_t const size = parking_.size();
+            std::size_t start = (num_thread < size) ? num_thread + 1 :
+                next_unpark_.fetch_add(1, boost::memory_order_relaxed);
+
+            for (std::size_t i = 0; i != size; ++i)
+            {
+                if (parking_[(start + i) % size].unpark())
+                    return;
+            }
+        }
+
+        // support for suspension of disabled workers
         compat::mutex mtx_;
         compat::condition_variable cond_;
-        boost::atomic<std::uint32_t> wait_count_;
+
+        // support for parking idle workers
+        std::vector<detail::worker_parking> parking_;
+        boost::atomic<std::int32_t> num_spinning_;
+        boost::atomic<std::int32_t> num_parked_;
+        boost::atomic<std::size_t> next_unpark_;
+#endif
+
+#if defined(HPX_HAVE_THREAD_TIMER_WHEEL)
+        // timed thread state changes
+        detail::thread_timer_wheel timers_;
+#if defined(HPX_HAVE_THREAD_MANAGER_IDLE_BACKOFF)
+        // the parked worker responsible for firing the next timer
+        boost::atomic<std::size_t> timer_watcher_;
+#endif
 #endif
 
         std::vector<boost::atomic<hpx::state> > states_;
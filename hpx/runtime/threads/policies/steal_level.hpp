@@ -0,0 +1,24 @@
+//  Copyright (c) 2026 agent
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#if !defined(HPX_RUNTIME_THREADS_POLICIES_STEAL_LEVEL_HPP)
+#define HPX_RUNTIME_THREADS_POLICIES_STEAL_LEVEL_HPP
+
+namespace hpx { namespace threads { namespace policies
+{
+    /// The levels of the memory hierarchy work stealing schedulers
+    /// distinguish when selecting their victims, ordered by increasing
+    /// distance from the stealing worker thread.
+    enum steal_level
+    {
+        steal_level_smt = 0,        ///< the victim runs on the same core
+        steal_level_cache = 1,      ///< the victim shares the last level cache
+        steal_level_numa = 2,       ///< the victim is in the same NUMA domain
+        steal_level_remote = 3,     ///< the victim is in a different NUMA domain
+        steal_level_count = 4
+    };
+}}}
+
+#endif
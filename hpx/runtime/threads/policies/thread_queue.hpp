@@ -12,6 +12,7 @@
 #include <hpx/error_code.hpp>
 #include <hpx/runtime/config_entry.hpp>
 #include <hpx/runtime/threads/policies/lockfree_queue_backends.hpp>
+#include <hpx/runtime/threads/policies/lockfree_thread_map.hpp>
 #include <hpx/runtime/threads/policies/queue_helpers.hpp>
 #include <hpx/runtime/threads/thread_data.hpp>
 #include <hpx/throw_exception.hpp>
@@ -146,11 +147,15 @@ namespace hpx { namespace threads { namespace policies
     //       , size_type num_thread = ...
     //         );
     //
-    //     bool push(const_reference val);
+    //     bool push(const_reference val, bool other_end = false);
     //
     //     bool pop(reference val, bool steal = true);
     //
     //     bool empty();
+    //
+    //     // invoked on the worker thread owning the queue
+    //     void on_start_thread();
+    //     void on_stop_thread();
     // };
     //
     // struct queue_policy
@@ -187,9 +192,24 @@ namespace hpx { namespace threads { namespace policies
         // number of terminated threads to collect before cleaning them up
         int const max_terminated_threads;
 
+#if defined(HPX_HAVE_THREAD_LOCKFREE_RECYCLING)
+        // this is the type of the registry holding all threads (except
+        // depleted ones), each registered thread is referenced once by the
+        // registry
+#if defined(HPX_HAVE_THREAD_ENUMERATION)
+        typedef detail::thread_registry thread_map_type;
+#endif
+
+        // this is the type of the lists holding the recycled threads
+        typedef detail::thread_recycling_list thread_heap_type;
+#else
         // this is the type of a map holding all threads (except depleted ones)
         typedef std::unordered_set<thread_id_type> thread_map_type;
 
+        // this is the type of the lists holding the recycled threads
+        typedef std::list<thread_id_type> thread_heap_type;
+#endif
+
 #ifdef HPX_HAVE_THREAD_QUEUE_WAITTIME
         typedef
             util::tuple<thread_init_data, thread_state_enum, std::uint64_t>
@@ -214,56 +234,163 @@ namespace hpx { namespace threads { namespace policies
             apply<thread_data*>::type terminated_items_type;
 
     protected:
-        template <typename Lock>
-        void create_thread_object(threads::thread_id_type& thrd,
-            threads::thread_init_data& data, thread_state_enum state, Lock& lk)
+        thread_heap_type& get_thread_heap(std::ptrdiff_t stacksize)
         {
-            HPX_ASSERT(lk.owns_lock());
-            HPX_ASSERT(data.stacksize != 0);
-
-            std::ptrdiff_t stacksize = data.stacksize;
-
-            std::list<thread_id_type>* heap = nullptr;
-
             if (stacksize == get_stack_size(thread_stacksize_small))
             {
-                heap = &thread_heap_small_;
+                return thread_heap_small_;
             }
             else if (stacksize == get_stack_size(thread_stacksize_medium))
             {
-                heap = &thread_heap_medium_;
+                return thread_heap_medium_;
             }
             else if (stacksize == get_stack_size(thread_stacksize_large))
             {
-                heap = &thread_heap_large_;
+                return thread_heap_large_;
             }
             else if (stacksize == get_stack_size(thread_stacksize_huge))
             {
-                heap = &thread_heap_huge_;
+                return thread_heap_huge_;
+            }
+            else if (stacksize == get_stack_size(thread_stacksize_nostack))
+            {
+                return thread_heap_nostack_;
             }
-            else {
-                switch(stacksize) {
-                case thread_stacksize_small:
-                    heap = &thread_heap_small_;
-                    break;
 
-                case thread_stacksize_medium:
-                    heap = &thread_heap_medium_;
-                    break;
+            switch(stacksize) {
+            case thread_stacksize_small:
+                return thread_heap_small_;
 
-                case thread_stacksize_large:
-                    heap = &thread_heap_large_;
-                    break;
+            case thread_stacksize_medium:
+                return thread_heap_medium_;
 
-                case thread_stacksize_huge:
-                    heap = &thread_heap_huge_;
-                    break;
+            case thread_stacksize_large:
+                return thread_heap_large_;
 
-                default:
-                    break;
+            case thread_stacksize_huge:
+                return thread_heap_huge_;
+
+            case thread_stacksize_nostack:
+                return thread_heap_nostack_;
+
+            default:
+                break;
+            }
+
+            HPX_ASSERT(false);
+            return thread_heap_small_;
+        }
+
+#if defined(HPX_HAVE_THREAD_LOCKFREE_RECYCLING)
+        // The returned thread object carries an additional reference which
+        // is owned by the thread map (see add_to_thread_map).
+        void create_thread_object(threads::thread_id_type& thrd,
+            threads::thread_init_data& data, thread_state_enum state)
+        {
+            HPX_ASSERT(data.stacksize != 0);
+
+            if (state == pending_do_not_schedule || state == pending_boost)
+            {
+                state = pending;
+            }
+
+            // Check for an unused thread object, the reference held by the
+            // recycling list is handed over to the thread map.
+            thread_data* p = get_thread_heap(data.stacksize).pop();
+            if (p != nullptr)
+            {
+                thrd = p;
+                thrd->rebind(data, state);
+                return;
+            }
+
+            // Allocate a new thread object.
+            thrd = threads::thread_data::create(data, memory_pool_, state);
+            intrusive_ptr_add_ref(thrd.get());
+
+#if !defined(HPX_HAVE_THREAD_ENUMERATION)
+            // remember all thread objects to be able to release them when
+            // the queue is destroyed, objects are removed from this list only
+            // after they have been retired
+            thread_data* head = allocated_threads_.load(
+                boost::memory_order_relaxed);
+            do {
+                thrd->set_next_allocated(head);
+            } while (!allocated_threads_.compare_exchange_weak(head,
+                thrd.get(), boost::memory_order_release,
+                boost::memory_order_relaxed));
+#endif
+        }
+
+        template <typename Lock>
+        void create_thread_object(threads::thread_id_type& thrd,
+            threads::thread_init_data& data, thread_state_enum state, Lock& lk)
+        {
+            HPX_ASSERT(lk.owns_lock());
+            create_thread_object(thrd, data, state);
+        }
+
+        static void release_thread_heap(thread_heap_type& heap)
+        {
+            while (thread_data* thrd = heap.pop())
+                intrusive_ptr_release(thrd);
+        }
+
+        // Release the thread objects which have been removed from the thread
+        // map without being recycled. The mutex has to be held by the
+        // caller, this guarantees that nobody iterates over the registry
+        // (or unlinks objects from the list of allocated thread objects)
+        // concurrently.
+        void release_retired_threads_locked()
+        {
+#if defined(HPX_HAVE_THREAD_ENUMERATION)
+            release_thread_heap(retired_threads_);
+#else
+            // new objects are only ever pushed to the front of the list,
+            // everything behind the head can be unlinked safely
+            thread_data* prev = nullptr;
+            thread_data* thrd = allocated_threads_.load(
+                boost::memory_order_acquire);
+            while (thrd != nullptr)
+            {
+                thread_data* next = thrd->get_next_allocated();
+
+                bool unlinked = false;
+                if (thrd->is_retired())
+                {
+                    if (prev != nullptr)
+                    {
+                        prev->set_next_allocated(next);
+                        unlinked = true;
+                    }
+                    else
+                    {
+                        // new objects might have been added in the meantime,
+                        // in which case this one is released next time
+                        thread_data* expected = thrd;
+                        unlinked = allocated_threads_.compare_exchange_strong(
+                            expected, next, boost::memory_order_relaxed);
+                    }
                 }
+
+                if (unlinked)
+                    intrusive_ptr_release(thrd);
+                else
+                    prev = thrd;
+
+                thrd = next;
             }
-            HPX_ASSERT(heap);
+#endif
+        }
+#else
+        template <typename Lock>
+        void create_thread_object(threads::thread_id_type& thrd,
+            threads::thread_init_data& data, thread_state_enum state, Lock& lk)
+        {
+            HPX_ASSERT(lk.owns_lock());
+            HPX_ASSERT(data.stacksize != 0);
+
+            thread_heap_type& heap = get_thread_heap(data.stacksize);
 
             if (state == pending_do_not_schedule || state == pending_boost)
             {
@@ -271,11 +398,11 @@ namespace hpx { namespace threads { namespace policies
             }
 
             // Check for an unused thread object.
-            if (!heap->empty())
+            if (!heap.empty())
             {
                 // Take ownership of the thread object and rebind it.
-                thrd = heap->front();
-                heap->pop_front();
+                thrd = heap.front();
+                heap.pop_front();
                 thrd->rebind(data, state);
             }
 
@@ -287,6 +414,100 @@ namespace hpx { namespace threads { namespace policies
                 thrd = threads::thread_data::create(data, memory_pool_, state);
             }
         }
+#endif
+
+        ///////////////////////////////////////////////////////////////////////
+        // add a new entry to the map of all threads
+        bool add_to_thread_map(thread_id_type const& thrd)
+        {
+#if defined(HPX_HAVE_THREAD_LOCKFREE_RECYCLING)
+#if defined(HPX_HAVE_THREAD_ENUMERATION)
+            thread_map_.insert(thrd.get());
+#endif
+#else
+            std::pair<thread_map_type::iterator, bool> p =
+                thread_map_.insert(thrd);
+
+            if (HPX_UNLIKELY(!p.second))
+                return false;
+#endif
+            ++thread_map_count_;
+            return true;
+        }
+
+        // remove a terminated thread from the map of all threads, optionally
+        // keeping the thread object for later reuse
+        void remove_from_thread_map(thread_data* thrd, bool recycle)
+        {
+#if defined(HPX_HAVE_THREAD_LOCKFREE_RECYCLING)
+#if defined(HPX_HAVE_THREAD_ENUMERATION)
+            thread_map_.erase(thrd);
+#endif
+            // The reference held by the thread map is handed over to the
+            // recycling list. Thread objects which are not recycled are
+            // released later on while holding the mutex (see
+            // release_retired_threads_locked), this allows to iterate over
+            // the registry without synchronizing with the removal of threads.
+            if (recycle)
+            {
+                get_thread_heap(thrd->get_stack_size()).push(thrd);
+            }
+            else
+            {
+#if defined(HPX_HAVE_THREAD_ENUMERATION)
+                retired_threads_.push(thrd);
+#else
+                thrd->set_retired();
+#endif
+            }
+#else
+            thread_map_type::iterator it = thread_map_.find(thrd);
+
+            // this thread has to be in this map
+            HPX_ASSERT(it != thread_map_.end());
+
+            if (recycle)
+                get_thread_heap(thrd->get_stack_size()).push_front(*it);
+
+            thread_map_.erase(it);
+#endif
+            --thread_map_count_;
+            HPX_ASSERT(thread_map_count_ >= 0);
+        }
+
+        bool is_in_thread_map(thread_data* thrd) const
+        {
+#if defined(HPX_HAVE_THREAD_LOCKFREE_RECYCLING)
+#if defined(HPX_HAVE_THREAD_ENUMERATION)
+            return thrd->get_registry_slot() != std::size_t(-1);
+#else
+            return true;
+#endif
+#else
+            return thread_map_.find(thrd) != thread_map_.end();
+#endif
+        }
+
+        // invoke the given function for all threads in the map of all
+        // threads, the mutex has to be held by the caller
+        //
+        // In lock-free mode the mutex does not protect against concurrent
+        // removal of threads. This is safe nevertheless as thread objects
+        // are released only while the mutex is held, the function may
+        // however see threads which are being terminated or reused
+        // concurrently.
+        template <typename F>
+        void for_each_thread_locked(F && f) const
+        {
+#if defined(HPX_HAVE_THREAD_LOCKFREE_RECYCLING)
+#if defined(HPX_HAVE_THREAD_ENUMERATION)
+            thread_map_.for_each(std::forward<F>(f));
+#endif
+#else
+            for (thread_id_type const& thrd : thread_map_)
+                f(thrd.get());
+#endif
+        }
 
         ///////////////////////////////////////////////////////////////////////
         // add new threads if there is some amount of work available
@@ -324,17 +545,13 @@ namespace hpx { namespace threads { namespace policies
                 delete task;
 
                 // add the new entry to the map of all threads
-                std::pair<thread_map_type::iterator, bool> p =
-                    thread_map_.insert(thrd);
-
-                if (HPX_UNLIKELY(!p.second)) {
+                if (HPX_UNLIKELY(!add_to_thread_map(thrd))) {
                     lk.unlock();
                     HPX_THROW_EXCEPTION(hpx::out_of_memory,
                         "threadmanager::add_new",
                         "Couldn't add new thread to the thread map");
                     return 0;
                 }
-                ++thread_map_count_;
 
                 // only insert the thread into the work-items queue if it is in
                 // pending state
@@ -346,7 +563,7 @@ namespace hpx { namespace threads { namespace policies
                 }
 
                 // this thread has to be in the map now
-                HPX_ASSERT(thread_map_.find(thrd.get()) != thread_map_.end());
+                HPX_ASSERT(is_in_thread_map(thrd.get()));
                 HPX_ASSERT(thrd->get_pool() == &memory_pool_);
             }
 
@@ -372,7 +589,8 @@ namespace hpx { namespace threads { namespace policies
             // if we are desperate (no work in the queues), add some even if the
             // map holds more than max_count
             if (HPX_LIKELY(max_count_)) {
-                std::size_t count = thread_map_.size();
+                std::size_t count = static_cast<std::size_t>(
+                    thread_map_count_.load(boost::memory_order_relaxed));
                 if (max_count_ >= count + min_add_new_count) { //-V104
                     HPX_ASSERT(max_count_ - count <
                         static_cast<std::size_t>(
@@ -393,55 +611,23 @@ namespace hpx { namespace threads { namespace policies
                 }
             }
 
-            std::size_t addednew = add_new(add_count, addfrom, lk, steal);
-            added += addednew;
-            return addednew != 0;
-        }
-
-        void recycle_thread(thread_id_type thrd)
-        {
-            std::ptrdiff_t stacksize = thrd->get_stack_size();
-
-            if (stacksize == get_stack_size(thread_stacksize_small))
-            {
-                thread_heap_small_.push_front(thrd);
-            }
-            else if (stacksize == get_stack_size(thread_stacksize_medium))
-            {
-                thread_heap_medium_.push_front(thrd);
-            }
-            else if (stacksize == get_stack_size(thread_stacksize_large))
+            // when stealing from another queue, take half of its staged
+            // tasks at once (but not more than max_add_new_count), this
+            // amortizes the cost of (possibly remote) steals
+            if (addfrom != this &&
+                (add_count == -1 || add_count < max_add_new_count))
             {
-                thread_heap_large_.push_front(thrd);
+                std::int64_t half = (addfrom->new_tasks_count_.load(
+                    boost::memory_order_relaxed) + 1) / 2;
+                if (half > max_add_new_count)
+                    half = max_add_new_count;
+                if (half != 0 && (add_count == -1 || half > add_count))
+                    add_count = half;
             }
-            else if (stacksize == get_stack_size(thread_stacksize_huge))
-            {
-                thread_heap_huge_.push_front(thrd);
-            }
-            else
-            {
-                switch(stacksize) {
-                case thread_stacksize_small:
-                    thread_heap_small_.push_front(thrd);
-                    break;
-
-                case thread_stacksize_medium:
-                    thread_heap_medium_.push_front(thrd);
-                    break;
-
-                case thread_stacksize_large:
-                    thread_heap_large_.push_front(thrd);
-                    break;
-
-                case thread_stacksize_huge:
-                    thread_heap_huge_.push_front(thrd);
-                    break;
 
-                default:
-                    HPX_ASSERT(false);
-                    break;
-                }
-            }
+            std::size_t addednew = add_new(add_count, addfrom, lk, steal);
+            added += addednew;
+            return addednew != 0;
         }
 
     public:
@@ -449,14 +635,15 @@ namespace hpx { namespace threads { namespace policies
         /// (state is terminated) are properly destroyed.
         ///
         /// This returns 'true' if there are no more terminated threads waiting
-        /// to be deleted.
+        /// to be deleted. If \a delete_all is true the mutex has to be held
+        /// by the caller.
         bool cleanup_terminated_locked_helper(bool delete_all = false)
         {
 #ifdef HPX_HAVE_THREAD_CREATION_AND_CLEANUP_RATES
             util::tick_counter tc(cleanup_terminated_time_);
 #endif
 
-            if (terminated_items_count_ == 0 && thread_map_.empty())
+            if (terminated_items_count_ == 0 && thread_map_count_ == 0)
                 return true;
 
             if (delete_all) {
@@ -465,17 +652,11 @@ namespace hpx { namespace threads { namespace policies
                 while (terminated_items_.pop(todelete))
                 {
                     --terminated_items_count_;
-
-                    // this thread has to be in this map
-                    HPX_ASSERT(thread_map_.find(todelete) != thread_map_.end());
-
-                    bool deleted = thread_map_.erase(todelete) != 0;
-                    HPX_ASSERT(deleted);
-                    if (deleted) {
-                        --thread_map_count_;
-                        HPX_ASSERT(thread_map_count_ >= 0);
-                    }
+                    remove_from_thread_map(todelete, false);
                 }
+#if defined(HPX_HAVE_THREAD_LOCKFREE_RECYCLING)
+                release_retired_threads_locked();
+#endif
             }
             else {
                 // delete only this many threads
@@ -488,18 +669,7 @@ namespace hpx { namespace threads { namespace policies
                 while (delete_count && terminated_items_.pop(todelete))
                 {
                     --terminated_items_count_;
-
-                    thread_map_type::iterator it = thread_map_.find(todelete);
-
-                    // this thread has to be in this map
-                    HPX_ASSERT(it != thread_map_.end());
-
-                    recycle_thread(*it);
-
-                    thread_map_.erase(it);
-                    --thread_map_count_;
-                    HPX_ASSERT(thread_map_count_ >= 0);
-
+                    remove_from_thread_map(todelete, true);
                     --delete_count;
                 }
             }
@@ -509,7 +679,7 @@ namespace hpx { namespace threads { namespace policies
         bool cleanup_terminated_locked(bool delete_all = false)
         {
             return cleanup_terminated_locked_helper(delete_all) &&
-                thread_map_.empty();
+                thread_map_count_ == 0;
         }
 
     public:
@@ -523,7 +693,9 @@ namespace hpx { namespace threads { namespace policies
                 bool thread_map_is_empty = false;
                 while (true)
                 {
+#if !defined(HPX_HAVE_THREAD_LOCKFREE_RECYCLING)
                     std::lock_guard<mutex_type> lk(mtx_);
+#endif
                     if (cleanup_terminated_locked_helper(false))
                     {
                         thread_map_is_empty =
@@ -534,7 +706,11 @@ namespace hpx { namespace threads { namespace policies
                 return thread_map_is_empty;
             }
 
+#if !defined(HPX_HAVE_THREAD_LOCKFREE_RECYCLING)
+            // recycling terminated threads doesn't require to hold the lock
+            // if the recycling lists and the thread map are lock-free
             std::lock_guard<mutex_type> lk(mtx_);
+#endif
             return cleanup_terminated_locked_helper(false) &&
                 (thread_map_count_ == 0) && (new_tasks_count_ == 0);
         }
@@ -577,6 +753,14 @@ namespace hpx { namespace threads { namespace policies
             thread_heap_medium_(),
             thread_heap_large_(),
             thread_heap_huge_(),
+            thread_heap_nostack_(),
+#if defined(HPX_HAVE_THREAD_LOCKFREE_RECYCLING)
+#if defined(HPX_HAVE_THREAD_ENUMERATION)
+            retired_threads_(),
+#else
+            allocated_threads_(nullptr),
+#endif
+#endif
 #ifdef HPX_HAVE_THREAD_CREATION_AND_CLEANUP_RATES
             add_new_time_(0),
             cleanup_terminated_time_(0),
@@ -592,6 +776,38 @@ namespace hpx { namespace threads { namespace policies
             add_new_logger_("thread_queue::add_new")
         {}
 
+#if defined(HPX_HAVE_THREAD_LOCKFREE_RECYCLING)
+        ~thread_queue()
+        {
+            // release the references held by the thread map and the
+            // recycling lists
+#if defined(HPX_HAVE_THREAD_ENUMERATION)
+            for_each_thread_locked(
+                [](thread_data* thrd)
+                {
+                    intrusive_ptr_release(thrd);
+                });
+
+            release_thread_heap(thread_heap_small_);
+            release_thread_heap(thread_heap_medium_);
+            release_thread_heap(thread_heap_large_);
+            release_thread_heap(thread_heap_huge_);
+            release_thread_heap(thread_heap_nostack_);
+            release_thread_heap(retired_threads_);
+#else
+            // each allocated thread object is either registered, recycled or
+            // retired, in all cases the queue holds exactly one reference
+            thread_data* thrd = allocated_threads_.load();
+            while (thrd != nullptr)
+            {
+                thread_data* next = thrd->get_next_allocated();
+                intrusive_ptr_release(thrd);
+                thrd = next;
+            }
+#endif
+        }
+#endif
+
         void set_max_count(std::size_t max_count = max_thread_count)
         {
             max_count_ = (0 == max_count) ? max_thread_count : max_count; //-V105
@@ -733,24 +949,25 @@ namespace hpx { namespace threads { namespace policies
                 // created, as it might have that the current HPX thread gets
                 // suspended.
                 {
+#if defined(HPX_HAVE_THREAD_LOCKFREE_RECYCLING)
+                    // the thread map and the recycling lists are lock-free
+                    create_thread_object(thrd, data, initial_state);
+#else
                     std::unique_lock<mutex_type> lk(mtx_);
 
                     create_thread_object(thrd, data, initial_state, lk);
+#endif
 
                     // add a new entry in the map for this thread
-                    std::pair<thread_map_type::iterator, bool> p =
-                        thread_map_.insert(thrd);
-
-                    if (HPX_UNLIKELY(!p.second)) {
+                    if (HPX_UNLIKELY(!add_to_thread_map(thrd))) {
                         HPX_THROWS_IF(ec, hpx::out_of_memory,
                             "threadmanager::register_thread",
                             "Couldn't add new thread to the map of threads");
                         return;
                     }
-                    ++thread_map_count_;
 
                     // this thread has to be in the map now
-                    HPX_ASSERT(thread_map_.find(thrd.get()) != thread_map_.end());
+                    HPX_ASSERT(is_in_thread_map(thrd.get()));
                     HPX_ASSERT(thrd->get_pool() == &memory_pool_);
 
                     // push the new thread in the pending queue thread
@@ -922,13 +1139,12 @@ namespace hpx { namespace threads { namespace policies
             std::lock_guard<mutex_type> lk(mtx_);
 
             std::int64_t num_threads = 0;
-            thread_map_type::const_iterator end = thread_map_.end();
-            for (thread_map_type::const_iterator it = thread_map_.begin();
-                 it != end; ++it)
-            {
-                if ((*it)->get_state().state() == state)
-                    ++num_threads;
-            }
+            for_each_thread_locked(
+                [&](thread_data* thrd)
+                {
+                    if (thrd->get_state().state() == state)
+                        ++num_threads;
+                });
             return num_threads;
         }
 
@@ -936,16 +1152,15 @@ namespace hpx { namespace threads { namespace policies
         void abort_all_suspended_threads()
         {
             std::lock_guard<mutex_type> lk(mtx_);
-            thread_map_type::iterator end =  thread_map_.end();
-            for (thread_map_type::iterator it = thread_map_.begin();
-                 it != end; ++it)
-            {
-                if ((*it)->get_state().state() == suspended)
+            for_each_thread_locked(
+                [this](thread_data* thrd)
                 {
-                    (*it)->set_state(pending, wait_abort);
-                    schedule_thread((*it).get());
-                }
-            }
+                    if (thrd->get_state().state() == suspended)
+                    {
+                        thrd->set_state(pending, wait_abort);
+                        schedule_thread(thrd);
+                    }
+                });
         }
 
         bool enumerate_threads(
@@ -965,29 +1180,27 @@ namespace hpx { namespace threads { namespace policies
                 return false;
             }
 
+#if defined(HPX_HAVE_THREAD_LOCKFREE_RECYCLING) && \
+    !defined(HPX_HAVE_THREAD_ENUMERATION)
+            HPX_THROW_EXCEPTION(not_implemented,
+                "thread_queue::iterate_threads",
+                "enumerating threads is not supported by this build, "
+                "rebuild with HPX_WITH_THREAD_ENUMERATION=ON");
+#else
             std::vector<thread_id_type> ids;
             ids.reserve(static_cast<std::size_t>(count));
 
-            if (state == unknown)
             {
                 std::lock_guard<mutex_type> lk(mtx_);
-                thread_map_type::const_iterator end =  thread_map_.end();
-                for (thread_map_type::const_iterator it = thread_map_.begin();
-                     it != end; ++it)
-                {
-                    ids.push_back(*it);
-                }
-            }
-            else
-            {
-                std::lock_guard<mutex_type> lk(mtx_);
-                thread_map_type::const_iterator end =  thread_map_.end();
-                for (thread_map_type::const_iterator it = thread_map_.begin();
-                     it != end; ++it)
-                {
-                    if ((*it)->get_state().state() == state)
-                        ids.push_back(*it);
-                }
+                for_each_thread_locked(
+                    [&](thread_data* thrd)
+                    {
+                        if (state == unknown ||
+                            thrd->get_state().state() == state)
+                        {
+                            ids.push_back(thrd);
+                        }
+                    });
             }
 
             // now invoke callback function for all matching threads
@@ -998,6 +1211,7 @@ namespace hpx { namespace threads { namespace policies
             }
 
             return true;
+#endif
         }
 
         /// This is a function which gets called periodically by the thread
@@ -1075,23 +1289,45 @@ namespace hpx { namespace threads { namespace policies
 #else
             if (minimal_deadlock_detection) {
                 std::lock_guard<mutex_type> lk(mtx_);
+#if defined(HPX_HAVE_THREAD_LOCKFREE_RECYCLING)
+                std::vector<thread_id_type> ids;
+                for_each_thread_locked(
+                    [&](thread_data* thrd)
+                    {
+                        ids.push_back(thrd);
+                    });
+                return detail::dump_suspended_threads(num_thread, ids
+                  , idle_loop_count, running);
+#else
                 return detail::dump_suspended_threads(num_thread, thread_map_
                   , idle_loop_count, running);
+#endif
             }
             return false;
 #endif
         }
 
         ///////////////////////////////////////////////////////////////////////
-        void on_start_thread(std::size_t num_thread) {}
-        void on_stop_thread(std::size_t num_thread) {}
+        void on_start_thread(std::size_t num_thread)
+        {
+            work_items_.on_start_thread();
+            new_tasks_.on_start_thread();
+        }
+        void on_stop_thread(std::size_t num_thread)
+        {
+            work_items_.on_stop_thread();
+            new_tasks_.on_stop_thread();
+        }
         void on_error(std::size_t num_thread, std::exception_ptr const& e) {}
 
     private:
         mutable mutex_type mtx_;                    ///< mutex protecting the members
 
+#if !defined(HPX_HAVE_THREAD_LOCKFREE_RECYCLING) || \
+    defined(HPX_HAVE_THREAD_ENUMERATION)
         thread_map_type thread_map_;
         ///< mapping of thread id's to HPX-threads
+#endif
         boost::atomic<std::int64_t> thread_map_count_;
         ///< overall count of work items
 
@@ -1127,10 +1363,21 @@ namespace hpx { namespace threads { namespace policies
         threads::thread_pool memory_pool_;          ///< OS thread local memory pools for
                                                     ///< HPX-threads
 
-        std::list<thread_id_type> thread_heap_small_;
-        std::list<thread_id_type> thread_heap_medium_;
-        std::list<thread_id_type> thread_heap_large_;
-        std::list<thread_id_type> thread_heap_huge_;
+        thread_heap_type thread_heap_small_;
+        thread_heap_type thread_heap_medium_;
+        thread_heap_type thread_heap_large_;
+        thread_heap_type thread_heap_huge_;
+        thread_heap_type thread_heap_nostack_;
+
+#if defined(HPX_HAVE_THREAD_LOCKFREE_RECYCLING)
+#if defined(HPX_HAVE_THREAD_ENUMERATION)
+        thread_heap_type retired_threads_;
+        ///< thread objects removed without being recycled
+#else
+        boost::atomic<thread_data*> allocated_threads_;
+        ///< all thread objects allocated by this queue
+#endif
+#endif
 
 #ifdef HPX_HAVE_THREAD_CREATION_AND_CLEANUP_RATES
         std::uint64_t add_new_time_;
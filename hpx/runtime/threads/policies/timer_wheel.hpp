@@ -0,0 +1,532 @@
+//  Copyright (c) 2026 agent
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#if !defined(HPX_RUNTIME_THREADS_POLICIES_TIMER_WHEEL_HPP)
+#define HPX_RUNTIME_THREADS_POLICIES_TIMER_WHEEL_HPP
+
+#include <hpx/config.hpp>
+#include <hpx/compat/mutex.hpp>
+#include <hpx/compat/thread.hpp>
+#include <hpx/util/assert.hpp>
+#include <hpx/util/steady_clock.hpp>
+
+#include <boost/atomic.hpp>
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <utility>
+
+///////////////////////////////////////////////////////////////////////////////
+// Hierarchical timer wheel used by the schedulers for timed thread state
+// changes (this_thread::sleep_for, timed waits, timed executors).
+//
+// Time is divided into ticks of a fixed resolution. The wheel consists of
+// num_levels levels of num_slots slots each, level L covering a range of
+// num_slots^(L+1) ticks. A timer is linked into the level which corresponds
+// to the most significant bit in which its expiry tick differs from the
+// current tick, into the slot selected by the expiry tick's digit at that
+// level. Whenever the current tick reaches the start of a slot on a higher
+// level, the timers of that slot are re-linked (cascaded) into the lower
+// levels; the timers in the slot of the lowest level which corresponds to the
+// current tick have expired. Arming and canceling a timer is O(1).
+//
+// The wheel doesn't rely on a periodic tick, it is advanced by calling
+// expire() (from the scheduling loop), which directly jumps from one
+// non-empty slot to the next. Timers never fire early, the expiry time is
+// rounded up to the next tick.
+namespace hpx { namespace threads { namespace policies { namespace detail
+{
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename Payload>
+    class timer_wheel
+    {
+        HPX_NON_COPYABLE(timer_wheel);
+
+        enum
+        {
+            slot_bits = 6,
+            num_slots = 1 << slot_bits,
+            num_levels = 6,
+            overflow_level = num_levels
+        };
+
+        enum entry_state
+        {
+            armed = 0,
+            expiring = 1,
+            expired = 2,
+            canceled = 3
+        };
+
+        typedef compat::mutex mutex_type;
+
+    public:
+        typedef util::steady_clock clock_type;
+        typedef clock_type::time_point time_point;
+        typedef clock_type::duration duration;
+
+        class entry
+        {
+            HPX_NON_COPYABLE(entry);
+
+            friend class timer_wheel;
+
+        public:
+            entry(Payload && payload, std::uint64_t expiry)
+              : payload_(std::move(payload))
+              , expiry_(expiry)
+              , prev_(nullptr)
+              , next_(nullptr)
+              , level_(0)
+              , slot_(0)
+              , state_(armed)
+            {}
+
+            Payload const& get_payload() const
+            {
+                return payload_;
+            }
+
+        private:
+            Payload payload_;
+            std::uint64_t expiry_;
+
+            // intrusive list of all timers in the same slot
+            entry* prev_;
+            entry* next_;
+            std::size_t level_;
+            std::size_t slot_;
+
+            boost::atomic<int> state_;
+
+            // keeps this entry alive as long as it is referenced by the wheel
+            std::shared_ptr<entry> self_;
+        };
+
+        typedef std::shared_ptr<entry> handle;
+
+        explicit timer_wheel(
+                duration resolution = std::chrono::microseconds(100),
+                time_point epoch = clock_type::now())
+          : resolution_(resolution.count() > 0 ? resolution : duration(1))
+          , epoch_(epoch)
+          , current_(0)
+          , size_(0)
+          , next_expiry_((std::numeric_limits<std::uint64_t>::max)())
+          , overflow_(nullptr)
+        {
+            for (std::size_t l = 0; l != num_levels; ++l)
+            {
+                occupied_[l] = 0;
+                for (std::size_t s = 0; s != num_slots; ++s)
+                    slots_[l][s] = nullptr;
+            }
+        }
+
+        ~timer_wheel()
+        {
+            clear();
+        }
+
+        /// Arm a new timer expiring at the given point in time. Timers which
+        /// have expired already will fire on the next call to expire(). The
+        /// parameter \a earliest is set to true if the new timer is due
+        /// before all other timers.
+        handle arm(time_point abs_time, Payload && payload, bool& earliest)
+        {
+            handle h = std::make_shared<entry>(
+                std::move(payload), to_tick(abs_time, true));
+
+            std::lock_guard<mutex_type> l(mtx_);
+
+            // nothing is linked, we are free to move the wheel forward
+            if (size_ == 0)
+            {
+                std::uint64_t now = to_tick(clock_type::now(), false);
+                if (now > current_)
+                    current_ = now;
+            }
+
+            // timers which are due already fire on the next tick
+            if (h->expiry_ <= current_)
+                h->expiry_ = current_ + 1;
+
+            h->self_ = h;
+            std::uint64_t const due = link(h.get());
+            ++size_;
+
+            std::uint64_t const next = next_expiry_.load(
+                boost::memory_order_relaxed);
+            earliest = due < next;
+            if (earliest)
+                next_expiry_.store(due, boost::memory_order_seq_cst);
+
+            return h;
+        }
+
+        handle arm(time_point abs_time, Payload && payload)
+        {
+            bool earliest = false;
+            return arm(abs_time, std::move(payload), earliest);
+        }
+
+        /// Cancel the given timer, returns whether the timer was still armed.
+        /// If the timer is being fired concurrently this waits for the
+        /// callback to return.
+        bool cancel(handle const& h)
+        {
+            if (!h)
+                return false;
+
+            {
+                std::lock_guard<mutex_type> l(mtx_);
+                if (h->state_.load(boost::memory_order_relaxed) == armed)
+                {
+                    unlink(h.get());
+                    h->state_.store(canceled, boost::memory_order_relaxed);
+                    h->self_.reset();
+
+                    if (--size_ == 0)
+                    {
+                        next_expiry_.store(
+                            (std::numeric_limits<std::uint64_t>::max)(),
+                            boost::memory_order_relaxed);
+                    }
+                    return true;
+                }
+            }
+
+            while (h->state_.load(boost::memory_order_acquire) == expiring)
+                compat::this_thread::yield();
+
+            return false;
+        }
+
+        /// Fire all timers which have expired at the given point in time by
+        /// invoking f with their payload. Only one thread at a time advances
+        /// the wheel, concurrent invocations return immediately. The function
+        /// f must not throw. Returns the number of fired timers.
+        template <typename F>
+        std::size_t expire(time_point now, F && f)
+        {
+            std::uint64_t next = next_expiry_.load(boost::memory_order_relaxed);
+            if (next == (std::numeric_limits<std::uint64_t>::max)())
+                return 0;
+
+            std::uint64_t const now_tick = to_tick(now, false);
+            if (now_tick < next)
+                return 0;
+
+            entry* fired = nullptr;
+            std::size_t count = 0;
+
+            {
+                std::unique_lock<mutex_type> l(mtx_, std::try_to_lock);
+                if (!l.owns_lock())
+                    return 0;
+
+                next = next_expiry_.load(boost::memory_order_relaxed);
+                while (next <= now_tick)
+                {
+                    count += advance(next, fired);
+                    next = find_next_expiry();
+                }
+
+                if (now_tick > current_)
+                    current_ = now_tick;
+
+                size_ -= count;
+                next_expiry_.store(next, boost::memory_order_relaxed);
+            }
+
+            while (fired != nullptr)
+            {
+                entry* e = fired;
+                fired = e->next_;
+
+                std::shared_ptr<entry> keep(std::move(e->self_));
+                f(e->payload_);
+                e->state_.store(expired, boost::memory_order_release);
+            }
+
+            return count;
+        }
+
+        template <typename F>
+        std::size_t expire(F && f)
+        {
+            if (next_expiry_.load(boost::memory_order_relaxed) ==
+                (std::numeric_limits<std::uint64_t>::max)())
+            {
+                return 0;
+            }
+            return expire(clock_type::now(), std::forward<F>(f));
+        }
+
+        /// Return the point in time at which the wheel has to be advanced
+        /// next, never later than the expiry of the earliest timer.
+        time_point next_expiry() const
+        {
+            std::uint64_t next = next_expiry_.load(boost::memory_order_acquire);
+            if (next == (std::numeric_limits<std::uint64_t>::max)())
+                return (time_point::max)();
+            return epoch_ + resolution_ * static_cast<duration::rep>(next);
+        }
+
+        bool empty() const
+        {
+            return next_expiry_.load(boost::memory_order_relaxed) ==
+                (std::numeric_limits<std::uint64_t>::max)();
+        }
+
+        std::size_t size() const
+        {
+            std::lock_guard<mutex_type> l(mtx_);
+            return size_;
+        }
+
+        /// Drop all armed timers without firing them.
+        void clear()
+        {
+            std::lock_guard<mutex_type> l(mtx_);
+            for (std::size_t level = 0; level != num_levels; ++level)
+            {
+                for (std::size_t slot = 0; slot != num_slots; ++slot)
+                    release(take(level, slot));
+            }
+            release(take(overflow_level, 0));
+
+            size_ = 0;
+            next_expiry_.store((std::numeric_limits<std::uint64_t>::max)(),
+                boost::memory_order_relaxed);
+        }
+
+    private:
+        std::uint64_t to_tick(time_point t, bool round_up) const
+        {
+            if (t <= epoch_)
+                return 0;
+            if (t == (time_point::max)())
+                return (std::numeric_limits<std::uint64_t>::max)() - 1;
+
+            duration::rep const d = (t - epoch_).count();
+            duration::rep const r = resolution_.count();
+            return std::uint64_t(round_up ? (d + r - 1) / r : d / r);
+        }
+
+        static std::size_t first_set_bit(std::uint64_t v)
+        {
+            HPX_ASSERT(v != 0);
+#if defined(__GNUC__)
+            return std::size_t(__builtin_ctzll(v));
+#else
+            std::size_t bit = 0;
+            while (!(v & 1))
+            {
+                v >>= 1;
+                ++bit;
+            }
+            return bit;
+#endif
+        }
+
+        // link the given entry into the slot corresponding to its expiry,
+        // entries expiring at the current tick end up in the slot which is
+        // about to be fired (while cascading), returns the tick at which the
+        // slot has to be fired or cascaded
+        std::uint64_t link(entry* e)
+        {
+            HPX_ASSERT(e->expiry_ >= current_);
+            std::uint64_t const diff = e->expiry_ ^ current_;
+
+            std::size_t level = 0;
+            while (level != num_levels &&
+                (diff >> ((level + 1) * slot_bits)) != 0)
+            {
+                ++level;
+            }
+
+            std::size_t const shift = level * slot_bits;
+
+            entry** head = &overflow_;
+            std::size_t slot = 0;
+            std::uint64_t due = ((current_ >> shift) + 1) << shift;
+            if (level != overflow_level)
+            {
+                slot = std::size_t(e->expiry_ >> shift) & (num_slots - 1);
+                head = &slots_[level][slot];
+                occupied_[level] |= std::uint64_t(1) << slot;
+                due = (e->expiry_ >> shift) << shift;
+            }
+
+            e->level_ = level;
+            e->slot_ = slot;
+            e->prev_ = nullptr;
+            e->next_ = *head;
+            if (*head != nullptr)
+                (*head)->prev_ = e;
+            *head = e;
+
+            return due;
+        }
+
+        void unlink(entry* e)
+        {
+            entry** head = (e->level_ == overflow_level) ?
+                &overflow_ : &slots_[e->level_][e->slot_];
+
+            if (e->prev_ != nullptr)
+                e->prev_->next_ = e->next_;
+            else
+                *head = e->next_;
+            if (e->next_ != nullptr)
+                e->next_->prev_ = e->prev_;
+
+            e->prev_ = e->next_ = nullptr;
+
+            if (*head == nullptr && e->level_ != overflow_level)
+                occupied_[e->level_] &= ~(std::uint64_t(1) << e->slot_);
+        }
+
+        // detach and return all entries of the given list
+        entry* take(std::size_t level, std::size_t slot)
+        {
+            entry* list = nullptr;
+            if (level == overflow_level)
+            {
+                list = overflow_;
+                overflow_ = nullptr;
+            }
+            else
+            {
+                list = slots_[level][slot];
+                slots_[level][slot] = nullptr;
+                occupied_[level] &= ~(std::uint64_t(1) << slot);
+            }
+            return list;
+        }
+
+        static void release(entry* list)
+        {
+            while (list != nullptr)
+            {
+                entry* e = list;
+                list = e->next_;
+
+                e->prev_ = e->next_ = nullptr;
+                e->state_.store(canceled, boost::memory_order_relaxed);
+                e->self_.reset();
+            }
+        }
+
+        void relink(entry* list)
+        {
+            while (list != nullptr)
+            {
+                entry* e = list;
+                list = e->next_;
+                link(e);
+            }
+        }
+
+        // move the wheel to the given tick, there are no timers due and no
+        // slots to cascade in between, expired entries are prepended to
+        // 'fired'
+        std::size_t advance(std::uint64_t tick, entry*& fired)
+        {
+            HPX_ASSERT(tick > current_);
+            current_ = tick;
+
+            // cascade higher levels first, as their entries might end up in
+            // the slots of the lower levels which have to be cascaded now
+            std::uint64_t const top_mask =
+                (std::uint64_t(1) << (num_levels * slot_bits)) - 1;
+            if ((tick & top_mask) == 0)
+                relink(take(overflow_level, 0));
+
+            for (std::size_t level = num_levels - 1; level != 0; --level)
+            {
+                std::uint64_t const mask =
+                    (std::uint64_t(1) << (level * slot_bits)) - 1;
+                if ((tick & mask) == 0)
+                {
+                    std::size_t const slot =
+                        std::size_t(tick >> (level * slot_bits)) &
+                            (num_slots - 1);
+                    relink(take(level, slot));
+                }
+            }
+
+            std::size_t count = 0;
+            entry* list = take(0, std::size_t(tick) & (num_slots - 1));
+            while (list != nullptr)
+            {
+                entry* e = list;
+                list = e->next_;
+
+                HPX_ASSERT(e->expiry_ == tick);
+                e->state_.store(expiring, boost::memory_order_relaxed);
+                e->prev_ = nullptr;
+                e->next_ = fired;
+                fired = e;
+                ++count;
+            }
+            return count;
+        }
+
+        // find the next tick at which a timer expires or at which a slot has
+        // to be cascaded into the lower levels
+        std::uint64_t find_next_expiry() const
+        {
+            for (std::size_t level = 0; level != num_levels; ++level)
+            {
+                std::size_t const shift = level * slot_bits;
+                std::size_t const digit =
+                    std::size_t(current_ >> shift) & (num_slots - 1);
+
+                // all linked slots are behind the current digit
+                std::uint64_t const behind = (digit == num_slots - 1) ?
+                    0 : ~((std::uint64_t(2) << digit) - 1);
+                HPX_ASSERT((occupied_[level] & ~behind) == 0);
+
+                std::uint64_t const candidates = occupied_[level] & behind;
+                if (candidates != 0)
+                {
+                    std::size_t const block_shift = shift + slot_bits;
+                    return ((current_ >> block_shift) << block_shift) |
+                        (std::uint64_t(first_set_bit(candidates)) << shift);
+                }
+            }
+
+            if (overflow_ != nullptr)
+            {
+                std::size_t const shift = num_levels * slot_bits;
+                return ((current_ >> shift) + 1) << shift;
+            }
+
+            return (std::numeric_limits<std::uint64_t>::max)();
+        }
+
+    private:
+        mutable mutex_type mtx_;
+
+        duration const resolution_;
+        time_point const epoch_;
+
+        std::uint64_t current_;         // all timers up to here have fired
+        std::size_t size_;
+        boost::atomic<std::uint64_t> next_expiry_;
+
+        entry* slots_[num_levels][num_slots];
+        std::uint64_t occupied_[num_levels];
+        entry* overflow_;
+    };
+}}}}
+
+#endif
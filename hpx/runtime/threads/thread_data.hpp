@@ -503,11 +503,67 @@ namespace hpx { namespace threads
             return stacksize_;
         }
 
+        /// Stackless threads are run to completion on the stack of the
+        /// scheduler, they can't be suspended.
+        bool is_stackless() const
+        {
+            return stacksize_ == thread_stacksize_nostack;
+        }
+
         pool_type* get_pool()
         {
             return pool_;
         }
 
+#if defined(HPX_HAVE_THREAD_LOCKFREE_RECYCLING)
+        // intrusive hooks used by the lock-free recycling lists and the
+        // thread registry (or, without thread enumeration, the list of all
+        // allocated thread objects) maintained by the thread queues
+        thread_data* get_next_recycled() const
+        {
+            return next_recycled_.load(boost::memory_order_relaxed);
+        }
+
+        void set_next_recycled(thread_data* next)
+        {
+            next_recycled_.store(next, boost::memory_order_relaxed);
+        }
+
+#if defined(HPX_HAVE_THREAD_ENUMERATION)
+        std::size_t get_registry_slot() const
+        {
+            return registry_slot_;
+        }
+
+        void set_registry_slot(std::size_t slot)
+        {
+            registry_slot_ = slot;
+        }
+#else
+        thread_data* get_next_allocated() const
+        {
+            return next_allocated_;
+        }
+
+        void set_next_allocated(thread_data* next)
+        {
+            next_allocated_ = next;
+        }
+
+        // thread objects removed from a thread queue without being recycled
+        // are released later on by the queue
+        bool is_retired() const
+        {
+            return retired_;
+        }
+
+        void set_retired()
+        {
+            retired_ = true;
+        }
+#endif
+#endif
+
         /// \brief Execute the thread function
         ///
         /// \returns        This function returns the thread state the thread
@@ -517,6 +573,8 @@ namespace hpx { namespace threads
         coroutine_type::result_type operator()()
         {
             HPX_ASSERT(this == coroutine_.get_thread_id());
+            if (is_stackless())
+                return coroutine_.invoke_stackless(set_state_ex(wait_signaled));
             return coroutine_(set_state_ex(wait_signaled));
         }
 
@@ -604,9 +662,20 @@ namespace hpx { namespace threads
             scheduler_base_(init_data.scheduler_base),
             count_(0),
             stacksize_(init_data.stacksize),
-            coroutine_(std::move(init_data.func),
-                this_(), init_data.stacksize),
+            // no stack is allocated for stackless threads
+            coroutine_(std::move(init_data.func), this_(),
+                init_data.stacksize == thread_stacksize_nostack ?
+                    coroutines::detail::no_stack_size : init_data.stacksize),
             pool_(pool)
+#if defined(HPX_HAVE_THREAD_LOCKFREE_RECYCLING)
+          , next_recycled_(nullptr)
+#if defined(HPX_HAVE_THREAD_ENUMERATION)
+          , registry_slot_(std::size_t(-1))
+#else
+          , next_allocated_(nullptr)
+          , retired_(false)
+#endif
+#endif
         {
             LTM_(debug) << "thread::thread(" << this << "), description("
                         << get_description() << ")";
@@ -734,6 +803,16 @@ namespace hpx { namespace threads
 
         coroutine_type coroutine_;
         pool_type* pool_;
+
+#if defined(HPX_HAVE_THREAD_LOCKFREE_RECYCLING)
+        boost::atomic<thread_data*> next_recycled_;
+#if defined(HPX_HAVE_THREAD_ENUMERATION)
+        std::size_t registry_slot_;
+#else
+        thread_data* next_allocated_;
+        bool retired_;
+#endif
+#endif
     };
 
     typedef thread_data::pool_type thread_pool;
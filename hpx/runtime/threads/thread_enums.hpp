@@ -133,6 +133,9 @@ namespace hpx { namespace threads
         thread_stacksize_huge = 4,          ///< use very large stack size
 
         thread_stacksize_current = 5,      ///< use size of current thread's stack
+        thread_stacksize_nostack = 6,      ///< run the thread on the stack of
+                                           ///< the scheduler (the thread can't
+                                           ///< be suspended)
 
         thread_stacksize_default = thread_stacksize_small,  ///< use default stack size
         thread_stacksize_minimal = thread_stacksize_small,  ///< use minimally stack size
@@ -90,7 +90,11 @@ namespace hpx { namespace threads
     ///                   if this is pre-initialized to \a hpx#throws
     ///                   the function will throw on error instead.
     ///
-    /// \returns
+    /// \returns          The id of the helper thread managing the timer.
+    ///                   Setting its state to \a pending with \a wait_abort
+    ///                   cancels the timer. If \a HPX_HAVE_THREAD_TIMER_WHEEL
+    ///                   is defined the timer is managed by the scheduler
+    ///                   and this function returns \a invalid_thread_id.
     ///
     /// \note             As long as \a ec is not pre-initialized to
     ///                   \a hpx#throws this function doesn't
@@ -31,6 +31,16 @@
 
 namespace hpx { namespace threads
 {
+    /// The policies which can be used to bind a memory area to the NUMA
+    /// domains of a set of processing units, see topology::set_area_membind.
+    enum membind_policy
+    {
+        membind_default = 0,    ///< use the default policy of the system
+        membind_firsttouch = 1, ///< place pages where they are first touched
+        membind_bind = 2,       ///< allocate pages on the given domains only
+        membind_interleave = 3  ///< interleave pages across the given domains
+    };
+
     struct topology
     {
         virtual ~topology() {}
@@ -104,6 +114,17 @@ namespace hpx { namespace threads
         virtual mask_cref_type get_core_affinity_mask(std::size_t num_thread,
             bool numa_sensitive, error_code& ec = throws) const = 0;
 
+        /// \brief Return a bit mask where each set bit corresponds to a
+        ///        processing unit sharing the last level cache with the
+        ///        given thread. If the cache hierarchy is unknown this is
+        ///        the same as the core affinity mask.
+        ///
+        /// \param ec         [in,out] this represents the error status on exit,
+        ///                   if this is pre-initialized to \a hpx#throws
+        ///                   the function will throw on error instead.
+        virtual mask_cref_type get_cache_affinity_mask(std::size_t num_thread,
+            bool numa_sensitive, error_code& ec = throws) const = 0;
+
         /// \brief Return a bit mask where each set bit corresponds to a
         ///        processing unit available to the given thread.
         ///
@@ -149,6 +170,30 @@ namespace hpx { namespace threads
         virtual mask_type get_thread_affinity_mask_from_lva(
             naming::address_type, error_code& ec = throws) const = 0;
 
+        /// \brief Bind the memory area [addr, addr + len) to the NUMA domains
+        ///        co-located with the processing units in the given mask.
+        ///
+        /// \param migrate    [in] move the pages of the area which have been
+        ///                   touched already such that they follow the new
+        ///                   binding (this corresponds to move_pages on Linux)
+        /// \param ec         [in,out] this represents the error status on exit,
+        ///                   if this is pre-initialized to \a hpx#throws
+        ///                   the function will throw on error instead.
+        virtual void set_area_membind(void const* addr, std::size_t len,
+            mask_cref_type mask, membind_policy policy, bool migrate,
+            error_code& ec = throws) const = 0;
+
+        /// \brief Return a bit mask where each set bit corresponds to a
+        ///        processing unit co-located with the memory the page holding
+        ///        the given address is physically located on. Returns an
+        ///        empty mask if the page has not been touched yet.
+        ///
+        /// \param ec         [in,out] this represents the error status on exit,
+        ///                   if this is pre-initialized to \a hpx#throws
+        ///                   the function will throw on error instead.
+        virtual mask_type get_area_memlocation(void const* addr,
+            error_code& ec = throws) const = 0;
+
         /// \brief Prints the \param m to os in a human readable form
         virtual void print_affinity_mask(std::ostream& os,
             std::size_t num_thread, mask_type const& m) const = 0;
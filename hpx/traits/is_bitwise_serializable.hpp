@@ -12,9 +12,13 @@
 
 namespace hpx { namespace traits
 {
+    // Enumerations are serialized as their underlying integral values,
+    // which allows for aggregates holding enumerations (pairs, tuples, etc.)
+    // to be stored as a single block of memory as well.
     template <typename T>
     struct is_bitwise_serializable
-      : std::is_arithmetic<T>
+      : std::integral_constant<bool,
+            std::is_arithmetic<T>::value || std::is_enum<T>::value>
     {};
 }}
 
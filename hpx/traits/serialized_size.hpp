@@ -0,0 +1,66 @@
+//  Copyright (c) 2026 agent
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef HPX_TRAITS_SERIALIZED_SIZE_HPP
+#define HPX_TRAITS_SERIALIZED_SIZE_HPP
+
+#include <hpx/config.hpp>
+#include <hpx/traits/is_bitwise_serializable.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+namespace hpx { namespace traits
+{
+    namespace detail
+    {
+        template <typename T, typename Enable = void>
+        struct serialized_size_impl
+          : std::integral_constant<std::size_t, 0>
+        {};
+
+        // integral values and enumerations are promoted to 64 bit integers
+        template <typename T>
+        struct serialized_size_impl<T,
+            typename std::enable_if<
+                std::is_integral<T>::value || std::is_enum<T>::value
+            >::type>
+          : std::integral_constant<std::size_t, sizeof(std::int64_t)>
+        {};
+
+        template <>
+        struct serialized_size_impl<char>
+          : std::integral_constant<std::size_t, sizeof(char)>
+        {};
+
+        template <>
+        struct serialized_size_impl<bool>
+          : std::integral_constant<std::size_t, sizeof(bool)>
+        {};
+
+        // all other bitwise serializable types are stored as a single block
+        // of memory
+        template <typename T>
+        struct serialized_size_impl<T,
+            typename std::enable_if<
+                !std::is_integral<T>::value && !std::is_enum<T>::value &&
+                is_bitwise_serializable<T>::value
+            >::type>
+          : std::integral_constant<std::size_t, sizeof(T)>
+        {};
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    // The number of bytes an object of the given type occupies in an archive
+    // which has the array optimizations enabled. This is zero for all types
+    // whose serialized size is not known at compile time.
+    template <typename T, typename Enable = void>
+    struct serialized_size
+      : detail::serialized_size_impl<typename std::remove_const<T>::type>
+    {};
+}}
+
+#endif
@@ -1,4 +1,5 @@
 //  Copyright (c)      2013 Thomas Heller
+//  Copyright (c)      2026 agent
 //
 //  Distributed under the Boost Software License, Version 1.0. (See accompanying
 //  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
@@ -6,66 +7,136 @@
 #if !defined(HPX_UTIL_BUFFER_POOL_HPP)
 #define HPX_UTIL_BUFFER_POOL_HPP
 
-#include <list>
+#include <hpx/config.hpp>
+#include <hpx/lcos/local/spinlock.hpp>
+
+#include <boost/atomic.hpp>
+
+#include <cstddef>
+#include <cstdint>
 #include <map>
 #include <memory>
+#include <mutex>
 #include <utility>
 #include <vector>
 
 namespace hpx { namespace util {
 
-    // This class holds shared_ptr of vector<T, Allocator> with a power of two
+    // This class holds vector<T, Allocator> instances sorted into size classes
+    // (powers of two) for later reuse. All buffers stored in a size class have
+    // a capacity of at least the size of that class. The overall capacity
+    // retained by the pool is limited, buffers which would exceed this limit
+    // are released instead of being stored.
     template <typename T, typename Allocator = std::allocator<T> >
     struct buffer_pool
     {
         typedef std::vector<T, Allocator> buffer_type;
         typedef std::shared_ptr<buffer_type> shared_buffer_type;
         typedef typename buffer_type::size_type size_type;
-        typedef std::map<size_type, std::list<shared_buffer_type> > buffer_map_type;
+        typedef std::map<size_type, std::vector<buffer_type> > buffer_map_type;
 
-        shared_buffer_type get_buffer(size_type size)
+    private:
+        typedef lcos::local::spinlock mutex_type;
+
+    public:
+        explicit buffer_pool(
+                std::size_t max_retained_bytes = std::size_t(-1),
+                Allocator const& alloc = Allocator())
+          : max_retained_bytes_(max_retained_bytes)
+          , retained_bytes_(0)
+          , hits_(0)
+          , misses_(0)
+          , alloc_(alloc)
+        {}
+
+        // Return an empty buffer with a capacity of at least the given size
+        buffer_type get(size_type size)
         {
             size_type capacity = next_power_of_two(size);
-            typename buffer_map_type::iterator it = buffers_.find(capacity);
-            shared_buffer_type res;
-            if(it == buffers_.end() || it->second.empty())
-            {
-                res.reset(new buffer_type());
-                res->reserve(capacity);
-            }
-            else
             {
-                res = it->second.front();
-                it->second.pop_front();
+                std::lock_guard<mutex_type> l(mtx_);
+                typename buffer_map_type::iterator it = buffers_.find(capacity);
+                if (it != buffers_.end() && !it->second.empty())
+                {
+                    buffer_type res(std::move(it->second.back()));
+                    it->second.pop_back();
+                    retained_bytes_ -= res.capacity() * sizeof(T);
+                    ++hits_;
+                    return res;
+                }
             }
+
+            ++misses_;
+
+            buffer_type res(alloc_);
+            res.reserve(capacity);
             return res;
         }
 
-        void reclaim_buffer(shared_buffer_type buffer)
+        // Store the given buffer for later reuse
+        void reclaim(buffer_type && buffer)
         {
-            size_type capacity = next_power_of_two(buffer->capacity());
-            buffer->clear();
-            if(capacity != buffer->capacity())
-            {
-                buffer->reserve(capacity);
-            }
+            size_type capacity = buffer.capacity();
+            if (capacity == 0)
+                return;
 
-            typename buffer_map_type::iterator it = buffers_.find(capacity);
-            if(it == buffers_.end())
-            {
-                it = buffers_.insert(it, std::make_pair(capacity,
-                    std::list<shared_buffer_type>()));
-            }
-            it->second.push_back(buffer);
+            std::size_t bytes = capacity * sizeof(T);
+            buffer.clear();
+
+            std::lock_guard<mutex_type> l(mtx_);
+            if (retained_bytes_ + bytes > max_retained_bytes_)
+                return;     // the buffer is released
+
+            buffers_[prev_power_of_two(capacity)].push_back(std::move(buffer));
+            retained_bytes_ += bytes;
+        }
+
+        shared_buffer_type get_buffer(size_type size)
+        {
+            return std::make_shared<buffer_type>(get(size));
+        }
+
+        void reclaim_buffer(shared_buffer_type buffer)
+        {
+            reclaim(std::move(*buffer));
         }
 
         void clear()
         {
+            std::lock_guard<mutex_type> l(mtx_);
             buffers_.clear();
+            retained_bytes_ = 0;
+        }
+
+        // statistics
+        std::int64_t hits(bool reset)
+        {
+            return static_cast<std::int64_t>(
+                reset ? hits_.exchange(0) : hits_.load());
+        }
+
+        std::int64_t misses(bool reset)
+        {
+            return static_cast<std::int64_t>(
+                reset ? misses_.exchange(0) : misses_.load());
+        }
+
+        std::int64_t retained_bytes() const
+        {
+            std::lock_guard<mutex_type> l(mtx_);
+            return static_cast<std::int64_t>(retained_bytes_);
         }
 
     private:
+        mutable mutex_type mtx_;
         buffer_map_type buffers_;
+        std::size_t max_retained_bytes_;
+        std::size_t retained_bytes_;
+
+        boost::atomic<std::size_t> hits_;
+        boost::atomic<std::size_t> misses_;
+
+        Allocator alloc_;
 
         static size_type next_power_of_two(size_type size)
         {
@@ -86,6 +157,12 @@ namespace hpx { namespace util {
             size++;
             return size;
         }
+
+        static size_type prev_power_of_two(size_type size)
+        {
+            size_type next = next_power_of_two(size);
+            return next == size ? size : next >> 1;
+        }
     };
 }}
 
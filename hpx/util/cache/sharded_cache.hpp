@@ -0,0 +1,818 @@
+//  Copyright (c) 2026 agent
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef HPX_UTIL_CACHE_SHARDED_CACHE_HPP
+#define HPX_UTIL_CACHE_SHARDED_CACHE_HPP
+
+#include <hpx/config.hpp>
+#include <hpx/lcos/local/spinlock.hpp>
+#include <hpx/util/assert.hpp>
+#include <hpx/util/cache/statistics/no_statistics.hpp>
+
+#include <boost/atomic.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+namespace hpx { namespace util { namespace cache
+{
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief The default for the \a KeyBlocks parameter of a
+    ///        \a sharded_cache, every key is mapped to a single block.
+    template <typename Key>
+    struct single_key_block
+    {
+        std::pair<std::uint64_t, std::uint64_t> operator()(Key const& key) const
+        {
+            std::uint64_t block = std::hash<Key>()(key);
+            return std::make_pair(block, block);
+        }
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \class sharded_cache sharded_cache.hpp hpx/util/cache/sharded_cache.hpp
+    ///
+    /// \brief The \a sharded_cache implements a local (non-distributed) cache
+    ///        which may be accessed concurrently by any number of threads.
+    ///
+    /// The entries are distributed over a number of independent shards. Each
+    /// shard holds its entries in a sorted array which is protected by a
+    /// sequence lock: lookups do not write to any shared memory (except for
+    /// setting the reference bit of an entry, if it is not set already) and
+    /// never block while no concurrent modification of the same shard is in
+    /// progress. Modifications of a shard are serialized by a spinlock.
+    ///
+    /// As lookups copy an entry before validating that it was not modified
+    /// concurrently, \a Key and \a Entry have to be types which can be
+    /// copied safely while being modified (such as trivially copyable
+    /// types).
+    ///
+    /// Eviction uses the CLOCK algorithm, which approximates LRU without
+    /// having to reorder entries on lookup.
+    ///
+    /// Keys may represent ranges (such as the keys of the AGAS GVA cache), in
+    /// which case a key compares equivalent to all keys it overlaps with.
+    /// Such keys are stored in all shards covered by their range of blocks
+    /// as returned by \a KeyBlocks; \a size returns the overall number of
+    /// stored entries, including those copies.
+    ///
+    /// \tparam Key           The type of the keys to use to identify the
+    ///                       entries stored in the cache
+    /// \tparam Entry         The type of the items to be held in the cache.
+    /// \tparam KeyBlocks     A function object returning the (inclusive)
+    ///                       range of blocks covered by a key. Consecutive
+    ///                       blocks have to be represented by consecutive
+    ///                       numbers. Lookups use the shard of the first
+    ///                       block of the given key.
+    template <
+        typename Key, typename Entry,
+        typename KeyBlocks = single_key_block<Key>
+    >
+    class sharded_cache
+    {
+    public:
+        typedef Key key_type;
+        typedef Entry entry_type;
+        typedef std::pair<key_type, entry_type> entry_pair;
+        typedef std::size_t size_type;
+
+    private:
+        typedef hpx::lcos::local::spinlock mutex_type;
+
+        enum { cache_line_size = 64 };
+        enum { max_num_shards = 64 };
+        enum { max_read_retries = 16 };
+        enum { num_methods = statistics::method_erase_entry + 1 };
+
+        ///////////////////////////////////////////////////////////////////////
+        struct shard_statistics
+        {
+            shard_statistics()
+              : hits_(0), misses_(0), insertions_(0), evictions_(0)
+            {
+                for (std::size_t i = 0; i != num_methods; ++i)
+                {
+                    count_[i].store(0, boost::memory_order_relaxed);
+                    time_[i].store(0, boost::memory_order_relaxed);
+                }
+            }
+
+            boost::atomic<std::int64_t> hits_;
+            boost::atomic<std::int64_t> misses_;
+            boost::atomic<std::int64_t> insertions_;
+            boost::atomic<std::int64_t> evictions_;
+
+            boost::atomic<std::int64_t> count_[num_methods];
+            boost::atomic<std::int64_t> time_[num_methods];
+        };
+
+        // Helper class to update timings and counts on function exit
+        struct update_on_exit
+        {
+            update_on_exit(shard_statistics* stat, statistics::method m)
+              : stat_(stat), method_(m), started_at_(stat ? now() : 0)
+            {}
+
+            ~update_on_exit()
+            {
+                if (stat_ != nullptr)
+                {
+                    stat_->count_[method_].fetch_add(1,
+                        boost::memory_order_relaxed);
+                    stat_->time_[method_].fetch_add(now() - started_at_,
+                        boost::memory_order_relaxed);
+                }
+            }
+
+            static std::int64_t now()
+            {
+                std::chrono::nanoseconds ns =
+                    std::chrono::steady_clock::now().time_since_epoch();
+                return static_cast<std::int64_t>(ns.count());
+            }
+
+            shard_statistics* stat_;
+            statistics::method method_;
+            std::int64_t started_at_;
+        };
+
+        ///////////////////////////////////////////////////////////////////////
+        // The entries of a shard, storages are never deallocated before the
+        // cache is destroyed as concurrent readers might still access them.
+        struct storage
+        {
+            explicit storage(size_type capacity)
+              : capacity_(capacity)
+              , entries_(new entry_pair[capacity])
+              , referenced_(new boost::atomic<bool>[capacity])
+            {
+                for (size_type i = 0; i != capacity; ++i)
+                    referenced_[i].store(false, boost::memory_order_relaxed);
+            }
+
+            size_type const capacity_;
+            std::unique_ptr<entry_pair[]> entries_;
+            std::unique_ptr<boost::atomic<bool>[]> referenced_;
+        };
+
+        struct shard
+        {
+            shard()
+              : version_(0)
+              , storage_(nullptr)
+              , size_(0)
+              , hand_(0)
+            {
+                storages_.emplace_back(new storage(0));
+                storage_.store(storages_.back().get(),
+                    boost::memory_order_relaxed);
+            }
+
+            mutex_type mtx_;
+            boost::atomic<std::uint64_t> version_;  // odd while being modified
+            boost::atomic<storage*> storage_;
+            boost::atomic<size_type> size_;
+            size_type hand_;
+
+            std::vector<std::unique_ptr<storage> > storages_;
+            shard_statistics statistics_;
+
+            // avoid false sharing between shards
+            char pad_[cache_line_size];
+        };
+
+        // Serializes writers and marks the shard as being modified
+        struct write_guard
+        {
+            explicit write_guard(shard& s)
+              : shard_(s), lock_(s.mtx_)
+            {
+                shard_.version_.store(
+                    shard_.version_.load(boost::memory_order_relaxed) + 1,
+                    boost::memory_order_relaxed);
+                boost::atomic_thread_fence(boost::memory_order_release);
+            }
+
+            ~write_guard()
+            {
+                shard_.version_.store(
+                    shard_.version_.load(boost::memory_order_relaxed) + 1,
+                    boost::memory_order_release);
+            }
+
+            shard& shard_;
+            std::lock_guard<mutex_type> lock_;
+        };
+
+    public:
+        ///////////////////////////////////////////////////////////////////////
+        /// \brief Gives access to the accumulated statistics of all shards,
+        ///        provides the same interface as
+        ///        \a statistics#local_full_statistics.
+        class statistics_type
+        {
+        public:
+            explicit statistics_type(sharded_cache& cache)
+              : cache_(cache)
+            {}
+
+            std::size_t hits(bool reset = false)
+            {
+                return cache_.accumulate(&shard_statistics::hits_, reset);
+            }
+            std::size_t misses(bool reset = false)
+            {
+                return cache_.accumulate(&shard_statistics::misses_, reset);
+            }
+            std::size_t insertions(bool reset = false)
+            {
+                return cache_.accumulate(
+                    &shard_statistics::insertions_, reset);
+            }
+            std::size_t evictions(bool reset = false)
+            {
+                return cache_.accumulate(&shard_statistics::evictions_, reset);
+            }
+
+            std::int64_t get_get_entry_count(bool reset)
+            {
+                return cache_.accumulate(&shard_statistics::count_,
+                    statistics::method_get_entry, reset);
+            }
+            std::int64_t get_insert_entry_count(bool reset)
+            {
+                return cache_.accumulate(&shard_statistics::count_,
+                    statistics::method_insert_entry, reset);
+            }
+            std::int64_t get_update_entry_count(bool reset)
+            {
+                return cache_.accumulate(&shard_statistics::count_,
+                    statistics::method_update_entry, reset);
+            }
+            std::int64_t get_erase_entry_count(bool reset)
+            {
+                return cache_.accumulate(&shard_statistics::count_,
+                    statistics::method_erase_entry, reset);
+            }
+
+            std::int64_t get_get_entry_time(bool reset)
+            {
+                return cache_.accumulate(&shard_statistics::time_,
+                    statistics::method_get_entry, reset);
+            }
+            std::int64_t get_insert_entry_time(bool reset)
+            {
+                return cache_.accumulate(&shard_statistics::time_,
+                    statistics::method_insert_entry, reset);
+            }
+            std::int64_t get_update_entry_time(bool reset)
+            {
+                return cache_.accumulate(&shard_statistics::time_,
+                    statistics::method_update_entry, reset);
+            }
+            std::int64_t get_erase_entry_time(bool reset)
+            {
+                return cache_.accumulate(&shard_statistics::time_,
+                    statistics::method_erase_entry, reset);
+            }
+
+        private:
+            sharded_cache& cache_;
+        };
+
+        ///////////////////////////////////////////////////////////////////////
+        /// \brief Construct an instance of a sharded_cache.
+        ///
+        /// \param max_size   [in] The maximal number of entries this cache is
+        ///                   allowed to hold, the capacity is evenly divided
+        ///                   between the shards.
+        /// \param num_shards [in] The number of shards to use, this will be
+        ///                   rounded up to the next power of two (at most 64).
+        ///
+        sharded_cache(size_type max_size = 0, std::size_t num_shards = 32)
+          : max_size_(0), shard_bits_(0)
+        {
+            num_shards = (std::min)(num_shards, std::size_t(max_num_shards));
+            while ((std::size_t(1) << shard_bits_) < num_shards)
+                ++shard_bits_;
+
+            shards_.reset(new shard[std::size_t(1) << shard_bits_]);
+            reserve(max_size);
+        }
+
+        sharded_cache(sharded_cache const&) = delete;
+        sharded_cache& operator=(sharded_cache const&) = delete;
+
+        ///////////////////////////////////////////////////////////////////////
+        /// \brief Return current number of entries stored in all shards.
+        size_type size() const
+        {
+            size_type result = 0;
+            for (std::size_t i = 0; i != num_shards(); ++i)
+                result += shards_[i].size_.load(boost::memory_order_relaxed);
+            return result;
+        }
+
+        /// \brief Return the number of shards used by this cache
+        std::size_t num_shards() const
+        {
+            return std::size_t(1) << shard_bits_;
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        /// \brief Access the maximum size the cache is allowed to grow to.
+        size_type capacity() const
+        {
+            return max_size_;
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        /// \brief Change the maximum size this cache can grow to
+        ///
+        /// \param max_size    [in] The new maximum size this cache will be
+        ///             allowed to grow to.
+        ///
+        void reserve(size_type max_size)
+        {
+            max_size_ = max_size;
+
+            size_type capacity = (max_size + num_shards() - 1) / num_shards();
+            for (std::size_t i = 0; i != num_shards(); ++i)
+            {
+                shard& s = shards_[i];
+                write_guard l(s);
+
+                storage* st = s.storage_.load(boost::memory_order_relaxed);
+                if (st->capacity_ == capacity)
+                    continue;
+
+                size_type size = s.size_.load(boost::memory_order_relaxed);
+                while (size > capacity)
+                {
+                    evict(s, st, size);
+                    --size;
+                }
+
+                std::unique_ptr<storage> new_st(new storage(capacity));
+                for (size_type j = 0; j != size; ++j)
+                {
+                    new_st->entries_[j] = st->entries_[j];
+                    new_st->referenced_[j].store(
+                        st->referenced_[j].load(boost::memory_order_relaxed),
+                        boost::memory_order_relaxed);
+                }
+
+                s.storages_.push_back(std::move(new_st));
+                s.storage_.store(s.storages_.back().get(),
+                    boost::memory_order_release);
+                s.hand_ = 0;
+            }
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        /// \brief Check whether the cache currently holds an entry identified
+        ///        by the given key
+        bool holds_key(key_type const& key)
+        {
+            key_type realkey;
+            entry_type entry;
+            return lookup(shards_[primary_shard(key)], key, realkey, entry,
+                false);
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        /// \brief Get a specific entry identified by the given key.
+        ///
+        /// \param key     [in] The key for the entry which should be retrieved
+        ///               from the cache.
+        /// \param realkey [out] The key of the entry as stored in the cache.
+        /// \param entry  [out] If the entry indexed by the key is found in the
+        ///               cache this value on successful return will be a copy
+        ///               of the corresponding entry.
+        ///
+        /// \returns      This function returns \a true if the cache holds the
+        ///               referenced entry, otherwise it returns \a false.
+        bool get_entry(key_type const& key, key_type& realkey,
+            entry_type& entry)
+        {
+            shard& s = shards_[primary_shard(key)];
+            update_on_exit update(&s.statistics_, statistics::method_get_entry);
+
+            if (!lookup(s, key, realkey, entry, true))
+            {
+                s.statistics_.misses_.fetch_add(1, boost::memory_order_relaxed);
+                return false;
+            }
+
+            s.statistics_.hits_.fetch_add(1, boost::memory_order_relaxed);
+            return true;
+        }
+
+        bool get_entry(key_type const& key, entry_type& entry)
+        {
+            key_type tmp;
+            return get_entry(key, tmp, entry);
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        /// \brief Insert a new entry into this cache
+        ///
+        /// \returns      This function returns \a false if an entry for the
+        ///               given key is already held by the cache.
+        bool insert(key_type const& key, entry_type const& entry)
+        {
+            return update_if(key, entry,
+                [](key_type const&, key_type const&) { return true; });
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        /// \brief Update an existing element in this cache or add it if it is
+        ///        not held by the cache yet.
+        void update(key_type const& key, entry_type const& entry)
+        {
+            update_if(key, entry,
+                [](key_type const&, key_type const&) { return false; });
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        /// \brief Update an existing element in this cache or add it if it is
+        ///        not held by the cache yet.
+        ///
+        /// \param key    [in] The key for the value which should be updated in
+        ///               the cache.
+        /// \param entry  [in] The value which should be used as a replacement
+        ///               for the existing value in the cache.
+        /// \param f      [in] A callable taking two arguments, \a k and the
+        ///               key found in the cache (in that order). If \a f
+        ///               returns true, then the update will not succeed.
+        ///
+        /// \returns      This function returns \a true if the entry has been
+        ///               successfully updated or added, otherwise it returns
+        ///               \a false.
+        template <typename F>
+        bool update_if(key_type const& key, entry_type const& entry, F && f)
+        {
+            bool result = true;
+            std::size_t primary = primary_shard(key);
+            std::uint64_t shards = covered_shards(key);
+
+            for (std::size_t i = 0; i != num_shards(); ++i)
+            {
+                if (shards & (std::uint64_t(1) << i))
+                {
+                    if (!update_if(shards_[i], key, entry, f, i == primary))
+                        result = false;
+                }
+            }
+            return result;
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        /// \brief Remove stored entries from the cache for which the supplied
+        ///        function object returns true.
+        ///
+        /// \returns      This function returns the number of removed entries.
+        template <typename Func>
+        size_type erase(Func const& ep)
+        {
+            update_on_exit update(&shards_[0].statistics_,
+                statistics::method_erase_entry);
+
+            size_type erased = 0;
+            for (std::size_t i = 0; i != num_shards(); ++i)
+            {
+                shard& s = shards_[i];
+                write_guard l(s);
+
+                storage* st = s.storage_.load(boost::memory_order_relaxed);
+                size_type size = s.size_.load(boost::memory_order_relaxed);
+                for (size_type j = 0; j != size; /**/)
+                {
+                    if (ep(st->entries_[j]))
+                    {
+                        erase_at(s, st, size, j);
+                        --size;
+                        ++erased;
+                        s.statistics_.evictions_.fetch_add(1,
+                            boost::memory_order_relaxed);
+                    }
+                    else
+                    {
+                        ++j;
+                    }
+                }
+            }
+            return erased;
+        }
+
+        /// \brief Remove all stored entries from the cache
+        size_type erase()
+        {
+            return clear();
+        }
+
+        /// \brief Clear the cache
+        ///
+        /// Unconditionally removes all stored entries from the cache.
+        size_type clear()
+        {
+            size_type erased = 0;
+            for (std::size_t i = 0; i != num_shards(); ++i)
+            {
+                shard& s = shards_[i];
+                write_guard l(s);
+
+                erased += s.size_.load(boost::memory_order_relaxed);
+                s.size_.store(0, boost::memory_order_relaxed);
+                s.hand_ = 0;
+            }
+            return erased;
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        /// \brief Allow to access the accumulated statistics of all shards
+        statistics_type get_statistics()
+        {
+            return statistics_type(*this);
+        }
+
+    private:
+        ///////////////////////////////////////////////////////////////////////
+        std::size_t shard_of_block(std::uint64_t block) const
+        {
+            if (shard_bits_ == 0)
+                return 0;
+
+            // Fibonacci hashing spreads consecutive blocks over all shards
+            return static_cast<std::size_t>(
+                (block * 0x9e3779b97f4a7c15ull) >> (64 - shard_bits_));
+        }
+
+        std::size_t primary_shard(key_type const& key) const
+        {
+            return shard_of_block(KeyBlocks()(key).first);
+        }
+
+        // returns the set of shards covered by the given key as a bit mask
+        std::uint64_t covered_shards(key_type const& key) const
+        {
+            std::pair<std::uint64_t, std::uint64_t> blocks = KeyBlocks()(key);
+
+            if (blocks.second < blocks.first ||
+                blocks.second - blocks.first >= num_shards() - 1)
+            {
+                return (num_shards() == max_num_shards) ? ~std::uint64_t(0) :
+                    (std::uint64_t(1) << num_shards()) - 1;
+            }
+
+            std::uint64_t result = 0;
+            for (std::uint64_t b = blocks.first; /**/; ++b)
+            {
+                result |= std::uint64_t(1) << shard_of_block(b);
+                if (b == blocks.second)
+                    break;
+            }
+            return result;
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        static entry_pair* find(entry_pair* first, entry_pair* last,
+            key_type const& key)
+        {
+            entry_pair* it = std::lower_bound(first, last, key,
+                [](entry_pair const& lhs, key_type const& rhs)
+                {
+                    return lhs.first < rhs;
+                });
+
+            if (it != last && !(key < it->first))
+                return it;
+
+            return nullptr;
+        }
+
+        bool lookup(shard& s, key_type const& key, key_type& realkey,
+            entry_type& entry, bool touch)
+        {
+            // optimistic read, retried if the shard was modified concurrently
+            for (std::size_t i = 0; i != max_read_retries; ++i)
+            {
+                std::uint64_t version =
+                    s.version_.load(boost::memory_order_acquire);
+                if (version & 1)
+                    continue;
+
+                storage* st = s.storage_.load(boost::memory_order_acquire);
+                size_type size = (std::min)(
+                    s.size_.load(boost::memory_order_relaxed), st->capacity_);
+
+                entry_pair* first = st->entries_.get();
+                entry_pair* it = find(first, first + size, key);
+                if (it != nullptr)
+                {
+                    realkey = it->first;
+                    entry = it->second;
+                }
+
+                boost::atomic_thread_fence(boost::memory_order_acquire);
+                if (s.version_.load(boost::memory_order_relaxed) != version)
+                    continue;
+
+                if (it != nullptr && touch)
+                    mark_referenced(st->referenced_[it - first]);
+
+                return it != nullptr;
+            }
+
+            // fall back to reading under the lock
+            std::lock_guard<mutex_type> l(s.mtx_);
+
+            storage* st = s.storage_.load(boost::memory_order_relaxed);
+            entry_pair* first = st->entries_.get();
+            entry_pair* it = find(first,
+                first + s.size_.load(boost::memory_order_relaxed), key);
+            if (it == nullptr)
+                return false;
+
+            realkey = it->first;
+            entry = it->second;
+            if (touch)
+                mark_referenced(st->referenced_[it - first]);
+
+            return true;
+        }
+
+        static void mark_referenced(boost::atomic<bool>& referenced)
+        {
+            // avoid writing to the shared cache line if possible
+            if (!referenced.load(boost::memory_order_relaxed))
+                referenced.store(true, boost::memory_order_relaxed);
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        template <typename F>
+        bool update_if(shard& s, key_type const& key, entry_type const& entry,
+            F& f, bool primary)
+        {
+            // only the primary shard of a key collects statistics
+            shard_statistics* stat = primary ? &s.statistics_ : nullptr;
+            update_on_exit update(stat, statistics::method_update_entry);
+
+            write_guard l(s);
+
+            storage* st = s.storage_.load(boost::memory_order_relaxed);
+            size_type size = s.size_.load(boost::memory_order_relaxed);
+
+            entry_pair* first = st->entries_.get();
+            entry_pair* it = find(first, first + size, key);
+            if (it == nullptr)
+            {
+                // got miss
+                if (primary)
+                {
+                    s.statistics_.misses_.fetch_add(1,
+                        boost::memory_order_relaxed);
+                }
+
+                update_on_exit update_insert(
+                    stat, statistics::method_insert_entry);
+                insert_nonexist(s, st, size, key, entry, primary);
+                return true;
+            }
+
+            if (f(key, it->first))
+                return false;
+
+            // got hit!
+            it->second = entry;
+            mark_referenced(st->referenced_[it - first]);
+
+            if (primary)
+                s.statistics_.hits_.fetch_add(1, boost::memory_order_relaxed);
+
+            return true;
+        }
+
+        void insert_nonexist(shard& s, storage* st, size_type size,
+            key_type const& key, entry_type const& entry, bool primary)
+        {
+            if (primary)
+            {
+                s.statistics_.insertions_.fetch_add(1,
+                    boost::memory_order_relaxed);
+            }
+
+            if (st->capacity_ == 0)
+            {
+                // the new entry is evicted right away
+                s.statistics_.evictions_.fetch_add(1,
+                    boost::memory_order_relaxed);
+                return;
+            }
+
+            // Do we need to evict a cache entry?
+            if (size == st->capacity_)
+            {
+                evict(s, st, size);
+                --size;
+            }
+
+            entry_pair* first = st->entries_.get();
+            size_type pos = std::lower_bound(first, first + size, key,
+                [](entry_pair const& lhs, key_type const& rhs)
+                {
+                    return lhs.first < rhs;
+                }) - first;
+
+            std::move_backward(first + pos, first + size, first + size + 1);
+            for (size_type i = size; i != pos; --i)
+            {
+                st->referenced_[i].store(
+                    st->referenced_[i - 1].load(boost::memory_order_relaxed),
+                    boost::memory_order_relaxed);
+            }
+
+            first[pos] = entry_pair(key, entry);
+            st->referenced_[pos].store(true, boost::memory_order_relaxed);
+            s.size_.store(size + 1, boost::memory_order_relaxed);
+        }
+
+        // evict one entry using the CLOCK algorithm, the shard must be locked
+        void evict(shard& s, storage* st, size_type size)
+        {
+            HPX_ASSERT(size != 0);
+
+            size_type hand = s.hand_ % size;
+            while (st->referenced_[hand].load(boost::memory_order_relaxed))
+            {
+                st->referenced_[hand].store(false, boost::memory_order_relaxed);
+                hand = (hand + 1) % size;
+            }
+
+            erase_at(s, st, size, hand);
+            s.hand_ = hand;
+
+            s.statistics_.evictions_.fetch_add(1, boost::memory_order_relaxed);
+        }
+
+        void erase_at(shard& s, storage* st, size_type size, size_type pos)
+        {
+            entry_pair* first = st->entries_.get();
+            std::move(first + pos + 1, first + size, first + pos);
+            for (size_type i = pos + 1; i != size; ++i)
+            {
+                st->referenced_[i - 1].store(
+                    st->referenced_[i].load(boost::memory_order_relaxed),
+                    boost::memory_order_relaxed);
+            }
+            s.size_.store(size - 1, boost::memory_order_relaxed);
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        std::size_t accumulate(boost::atomic<std::int64_t> shard_statistics::*p,
+            bool reset)
+        {
+            std::int64_t result = 0;
+            for (std::size_t i = 0; i != num_shards(); ++i)
+            {
+                boost::atomic<std::int64_t>& value = shards_[i].statistics_.*p;
+                result += reset ?
+                    value.exchange(0, boost::memory_order_relaxed) :
+                    value.load(boost::memory_order_relaxed);
+            }
+            return static_cast<std::size_t>(result);
+        }
+
+        std::int64_t accumulate(
+            boost::atomic<std::int64_t> (shard_statistics::*p)[num_methods],
+            statistics::method m, bool reset)
+        {
+            std::int64_t result = 0;
+            for (std::size_t i = 0; i != num_shards(); ++i)
+            {
+                boost::atomic<std::int64_t>& value =
+                    (shards_[i].statistics_.*p)[m];
+                result += reset ?
+                    value.exchange(0, boost::memory_order_relaxed) :
+                    value.load(boost::memory_order_relaxed);
+            }
+            return result;
+        }
+
+        size_type max_size_;
+        std::size_t shard_bits_;
+        std::unique_ptr<shard[]> shards_;
+    };
+}}}
+
+#endif
@@ -0,0 +1,220 @@
+////////////////////////////////////////////////////////////////////////////////
+//  Algorithms from "Dynamic Circular Work-Stealing Deque"
+//  by D. Chase and Y. Lev
+//  Link: http://dl.acm.org/citation.cfm?id=1073974
+//
+//  Memory orderings follow "Correct and Efficient Work-Stealing for Weak
+//  Memory Models" by N. M. Le, A. Pop, A. Cohen and F. Zappa Nardelli
+//  Link: http://dl.acm.org/citation.cfm?id=2442524
+//
+//  Copyright (c) 2026 agent
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+//  Disclaimer: Not a Boost library.
+//
+//  Only one thread (the owner) may call push_bottom() and pop_bottom(), any
+//  number of threads may concurrently call steal(). The owner does not execute
+//  any read-modify-write operations, except when racing with thieves for the
+//  last element in the deque.
+////////////////////////////////////////////////////////////////////////////////
+
+#if !defined(HPX_UTIL_LOCKFREE_CHASE_LEV_DEQUE_HPP)
+#define HPX_UTIL_LOCKFREE_CHASE_LEV_DEQUE_HPP
+
+#include <hpx/config.hpp>
+#include <hpx/util/assert.hpp>
+
+#include <boost/atomic.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+namespace boost { namespace lockfree
+{
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename T>
+    class chase_lev_deque
+    {
+        static_assert(std::is_trivially_copyable<T>::value,
+            "chase_lev_deque<T> requires T to be trivially copyable");
+
+        // The circular array holding the elements. Arrays are only ever
+        // replaced by the owner (when growing); old arrays are kept alive
+        // until the deque is destroyed as thieves might still read from them.
+        struct array
+        {
+            explicit array(std::size_t log_size, array* previous = nullptr)
+              : log_size_(log_size)
+              , mask_((std::int64_t(1) << log_size) - 1)
+              , buffer_(new boost::atomic<T>[std::size_t(1) << log_size])
+              , previous_(previous)
+            {}
+
+            ~array()
+            {
+                delete [] buffer_;
+            }
+
+            std::int64_t size() const
+            {
+                return mask_ + 1;
+            }
+
+            T get(std::int64_t i) const
+            {
+                return buffer_[i & mask_].load(boost::memory_order_relaxed);
+            }
+
+            void put(std::int64_t i, T x)
+            {
+                buffer_[i & mask_].store(x, boost::memory_order_relaxed);
+            }
+
+            array* grow(std::int64_t bottom, std::int64_t top)
+            {
+                array* a = new array(log_size_ + 1, this);
+                for (std::int64_t i = top; i != bottom; ++i)
+                    a->put(i, get(i));
+                return a;
+            }
+
+            std::size_t const log_size_;
+            std::int64_t const mask_;
+            boost::atomic<T>* buffer_;
+            array* previous_;
+        };
+
+        enum { cache_line_size = 64 };
+
+        static std::size_t initial_log_size(std::size_t initial_size)
+        {
+            std::size_t log_size = 4;       // never start with less than 16
+            while ((std::size_t(1) << log_size) < initial_size)
+                ++log_size;
+            return log_size;
+        }
+
+        HPX_NON_COPYABLE(chase_lev_deque);
+
+    public:
+        typedef T value_type;
+
+        explicit chase_lev_deque(std::size_t initial_size = 0)
+          : top_(0)
+          , bottom_(0)
+          , array_(new array(initial_log_size(initial_size)))
+        {}
+
+        ~chase_lev_deque()
+        {
+            array* a = array_.load(boost::memory_order_relaxed);
+            while (a != nullptr)
+            {
+                array* previous = a->previous_;
+                delete a;
+                a = previous;
+            }
+        }
+
+        // Owner only: add an item at the bottom end of the deque.
+        bool push_bottom(T const& x)
+        {
+            std::int64_t b = bottom_.load(boost::memory_order_relaxed);
+            std::int64_t t = top_.load(boost::memory_order_acquire);
+            array* a = array_.load(boost::memory_order_relaxed);
+
+            if (b - t > a->size() - 1)
+            {
+                a = a->grow(b, t);
+                array_.store(a, boost::memory_order_release);
+            }
+
+            a->put(b, x);
+            boost::atomic_thread_fence(boost::memory_order_release);
+            bottom_.store(b + 1, boost::memory_order_relaxed);
+            return true;
+        }
+
+        // Owner only: remove the item most recently pushed by the owner.
+        bool pop_bottom(T& x)
+        {
+            std::int64_t b = bottom_.load(boost::memory_order_relaxed) - 1;
+            array* a = array_.load(boost::memory_order_relaxed);
+            bottom_.store(b, boost::memory_order_relaxed);
+            boost::atomic_thread_fence(boost::memory_order_seq_cst);
+            std::int64_t t = top_.load(boost::memory_order_relaxed);
+
+            if (t > b)
+            {
+                // the deque was empty
+                bottom_.store(b + 1, boost::memory_order_relaxed);
+                return false;
+            }
+
+            x = a->get(b);
+            if (t == b)
+            {
+                // this is the last item, race against thieves
+                bool result = top_.compare_exchange_strong(t, t + 1,
+                    boost::memory_order_seq_cst, boost::memory_order_relaxed);
+                bottom_.store(b + 1, boost::memory_order_relaxed);
+                return result;
+            }
+            return true;
+        }
+
+        // Any thread: remove the oldest item from the top end of the deque.
+        // Returns false if the deque is empty. Losing a race against another
+        // thief or the owner is retried as long as items are available.
+        bool steal(T& x)
+        {
+            while (true)
+            {
+                std::int64_t t = top_.load(boost::memory_order_acquire);
+                boost::atomic_thread_fence(boost::memory_order_seq_cst);
+                std::int64_t b = bottom_.load(boost::memory_order_acquire);
+
+                if (t >= b)
+                    return false;
+
+                array* a = array_.load(boost::memory_order_acquire);
+                x = a->get(t);
+                if (top_.compare_exchange_strong(t, t + 1,
+                        boost::memory_order_seq_cst,
+                        boost::memory_order_relaxed))
+                {
+                    return true;
+                }
+            }
+        }
+
+        bool empty() const
+        {
+            std::int64_t b = bottom_.load(boost::memory_order_relaxed);
+            std::int64_t t = top_.load(boost::memory_order_relaxed);
+            return b <= t;
+        }
+
+        std::int64_t size() const
+        {
+            std::int64_t b = bottom_.load(boost::memory_order_relaxed);
+            std::int64_t t = top_.load(boost::memory_order_relaxed);
+            return b > t ? b - t : 0;
+        }
+
+    private:
+        // top_ is written by thieves, bottom_ and array_ by the owner only;
+        // keep them on separate cache lines to avoid false sharing
+        boost::atomic<std::int64_t> top_;
+        char pad0_[cache_line_size - sizeof(boost::atomic<std::int64_t>)];
+        boost::atomic<std::int64_t> bottom_;
+        boost::atomic<array*> array_;
+        char pad1_[cache_line_size - sizeof(boost::atomic<std::int64_t>) -
+            sizeof(boost::atomic<array*>)];
+    };
+}}
+
+#endif
@@ -9,6 +9,8 @@
 
 #include <hpx/config.hpp>
 #include <hpx/lcos/local/spinlock.hpp>
+#include <hpx/runtime/get_os_thread_count.hpp>
+#include <hpx/runtime/get_worker_thread_num.hpp>
 #include <hpx/runtime/threads/thread_data_fwd.hpp>
 #include <hpx/state.hpp>
 #include <hpx/throw_exception.hpp>
@@ -19,6 +21,7 @@
 #include <hpx/util/one_size_heap_list_base.hpp>
 #include <hpx/util/unlock_guard.hpp>
 
+#include <boost/atomic.hpp>
 #include <boost/format.hpp>
 
 #include <cstddef>
@@ -27,9 +30,27 @@
 #include <mutex>
 #include <string>
 
+// Freed objects are handed back to their heap in batches unless the heaps
+// have to see each individual pointer for debugging purposes.
+#if !(defined(HPX_DEBUG_WRAPPER_HEAP) && HPX_DEBUG_WRAPPER_HEAP != 0)
+#define HPX_ONE_SIZE_HEAP_LIST_BATCHED_FREE
+#endif
+
 ///////////////////////////////////////////////////////////////////////////////
 namespace hpx { namespace util
 {
+    // Each worker thread caches a magazine of slots claimed from one of the
+    // heaps in one go and serves single object allocations from it without
+    // acquiring any lock. The cache entries are accessed by the HPX threads
+    // running on the corresponding worker thread only, which is safe as long
+    // as no suspension point is hit while an entry is being used.
+    //
+    // The caches are not flushed when a worker thread goes idle. Each worker
+    // thread retains at most magazine_size - 1 unused slots and
+    // free_batch_size - 1 freed objects. A heap holding any of those is
+    // released only once the worker thread has used up its magazine, or has
+    // handed back its batch of freed objects (which happens when the batch
+    // is full or when an object of a different heap is freed).
     template <typename Heap, typename Mutex = lcos::local::spinlock>
     class one_size_heap_list : public one_size_heap_list_base
     {
@@ -53,8 +74,39 @@ namespace hpx { namespace util
 
         typedef std::unique_lock<mutex_type> unique_lock_type;
 
+        enum
+        {
+            magazine_size = 64,     // number of slots claimed at once
+            free_batch_size = 64    // number of objects freed at once
+        };
+
+    private:
+        typedef typename list_type::value_type heap_pointer;
+
+        struct thread_cache
+        {
+            enum { cache_line_size = 64 };
+
+            thread_cache()
+              : next_(nullptr), end_(nullptr), free_count_(0)
+            {}
+
+            // the magazine [next_, end_) claimed from alloc_heap_
+            heap_pointer alloc_heap_;
+            value_type* next_;
+            value_type* end_;
+
+            // objects freed but not returned to free_heap_ yet
+            heap_pointer free_heap_;
+            std::size_t free_count_;
+
+            char pad_[cache_line_size];
+        };
+
+    public:
         explicit one_size_heap_list(char const* class_name = "")
-            : class_name_(class_name)
+            : caches_(nullptr), num_caches_(0)
+            , class_name_(class_name)
 #if defined(HPX_DEBUG)
             , alloc_count_(0L)
             , free_count_(0L)
@@ -66,7 +118,8 @@ namespace hpx { namespace util
         }
 
         explicit one_size_heap_list(std::string const& class_name)
-            : class_name_(class_name)
+            : caches_(nullptr), num_caches_(0)
+            , class_name_(class_name)
 #if defined(HPX_DEBUG)
             , alloc_count_(0L)
             , free_count_(0L)
@@ -79,6 +132,12 @@ namespace hpx { namespace util
 
         ~one_size_heap_list() noexcept
         {
+            // Slots still held by the thread caches (see above for their
+            // bounds) are not handed back to their heaps as this could
+            // release the heaps while AGAS is not available anymore. The
+            // heaps are destroyed right after anyways.
+            delete [] caches_.load();
+
 #if defined(HPX_DEBUG)
             LOSH_(info)
                 << (boost::format(
@@ -103,6 +162,78 @@ namespace hpx { namespace util
 
         // operations
         void* alloc(std::size_t count = 1)
+        {
+            if (count == 1)
+            {
+                thread_cache* cache = get_thread_cache();
+                if (cache != nullptr)
+                {
+                    if (cache->next_ != cache->end_)
+                        return cache->next_++;
+                    return alloc_magazine();
+                }
+            }
+            return alloc_locked(count);
+        }
+
+    private:
+        // Claim a new magazine from the heaps and return its first slot.
+        void* alloc_magazine()
+        {
+            value_type* p = nullptr;
+            std::size_t count = 0;
+            heap_pointer heap;
+
+            {
+                unique_lock_type guard(mtx_);
+                for (iterator it = heap_list_.begin(); it != heap_list_.end();
+                     ++it)
+                {
+                    heap = *it;
+                    {
+                        util::unlock_guard<unique_lock_type> ul(guard);
+                        count = heap->alloc_some(&p, magazine_size);
+                    }
+                    if (count != 0)
+                        break;
+                }
+#if defined(HPX_DEBUG)
+                alloc_count_ += count;
+                if (alloc_count_ - free_count_ > max_alloc_count_)
+                    max_alloc_count_ = alloc_count_- free_count_;
+#endif
+            }
+
+            // all heaps are exhausted, create a new one
+            if (count == 0)
+                return alloc_locked(1);
+
+            // acquiring the lock may have suspended this thread, look up the
+            // cache of the worker thread we're running on now
+            thread_cache* cache = get_thread_cache();
+            if (count > 1)
+            {
+                if (cache != nullptr && cache->next_ == cache->end_)
+                {
+                    cache->alloc_heap_ = std::move(heap);
+                    cache->next_ = p + 1;
+                    cache->end_ = p + count;
+                }
+                else
+                {
+                    // the cache was refilled concurrently, give the slots back
+                    heap->free(p + 1, count - 1);
+#if defined(HPX_DEBUG)
+                    unique_lock_type guard(mtx_);
+                    free_count_ += count - 1;
+#endif
+                }
+            }
+            return p;
+        }
+
+        // Allocate from the heaps while holding the lock.
+        void* alloc_locked(std::size_t count)
         {
             unique_lock_type guard(mtx_);
 
@@ -205,9 +336,36 @@ namespace hpx { namespace util
             guard.unlock();
 
             // Try again, we just got a new heap, so we should be good.
-            return alloc(count);
+            return alloc_locked(count);
+        }
+
+        // Return the cache of the current worker thread, if any.
+        thread_cache* get_thread_cache()
+        {
+            std::size_t num_thread = hpx::get_worker_thread_num();
+            if (num_thread == std::size_t(-1))
+                return nullptr;
+
+            thread_cache* caches = caches_.load(boost::memory_order_acquire);
+            if (HPX_UNLIKELY(caches == nullptr))
+            {
+                unique_lock_type guard(mtx_);
+                caches = caches_.load(boost::memory_order_relaxed);
+                if (caches == nullptr)
+                {
+                    num_caches_ = hpx::get_os_thread_count();
+                    caches = new thread_cache[num_caches_];
+                    caches_.store(caches, boost::memory_order_release);
+                }
+            }
+
+            if (num_thread >= num_caches_)
+                return nullptr;
+            return &caches[num_thread];
         }
 
+    public:
+
         heap_type* alloc_heap()
         {
             return new heap_type(class_name_.c_str(), 0, heap_step);
@@ -257,11 +415,23 @@ namespace hpx { namespace util
 
         void free(void* p, std::size_t count = 1)
         {
-            unique_lock_type ul(mtx_);
-
             if (nullptr == p || !threads::threadmanager_is(state_running))
                 return;
 
+#if defined(HPX_ONE_SIZE_HEAP_LIST_BATCHED_FREE)
+            // objects freed from outside of HPX threads are rescheduled below
+            if (nullptr != threads::get_self_ptr() && free_batched(p, count))
+            {
+#if defined(HPX_DEBUG)
+                std::lock_guard<mutex_type> l(mtx_);
+                free_count_ += count;
+#endif
+                return;
+            }
+#endif
+
+            unique_lock_type ul(mtx_);
+
             // if this is called from outside a HPX thread we need to
             // re-schedule the request
             if (reschedule(p, count))
@@ -296,6 +466,74 @@ namespace hpx { namespace util
                     % p % name()));
         }
 
+    private:
+#if defined(HPX_ONE_SIZE_HEAP_LIST_BATCHED_FREE)
+        // Objects allocated from the same heap as the objects freed last by
+        // the current worker thread are handed back to that heap in batches.
+        bool free_batched(void* p, std::size_t count)
+        {
+            thread_cache* cache = get_thread_cache();
+            if (cache == nullptr)
+                return false;
+
+            if (cache->free_count_ != 0 && cache->free_heap_->did_alloc(p))
+            {
+                cache->free_count_ += count;
+                if (cache->free_count_ >= free_batch_size)
+                    flush_free_batch(*cache);
+                return true;
+            }
+
+            // the object belongs to a different heap, start a new batch
+            if (cache->free_count_ != 0)
+                flush_free_batch(*cache);
+
+            heap_pointer heap;
+            {
+                unique_lock_type ul(mtx_);
+                for (iterator it = heap_list_.begin(); it != heap_list_.end();
+                     ++it)
+                {
+                    if ((*it)->did_alloc(p))
+                    {
+                        heap = *it;
+                        break;
+                    }
+                }
+            }
+
+            // let the caller report objects not allocated by this list
+            if (!heap)
+                return false;
+
+            // acquiring the lock may have suspended this thread
+            cache = get_thread_cache();
+            if (cache != nullptr && cache->free_count_ == 0)
+            {
+                cache->free_heap_ = std::move(heap);
+                cache->free_count_ = count;
+            }
+            else
+            {
+                heap->free(p, count);
+            }
+            return true;
+        }
+
+        // The heaps don't need to know which objects are freed, only how
+        // many. The cache entry is reset before the heap is accessed as this
+        // might suspend the current thread.
+        static void flush_free_batch(thread_cache& cache)
+        {
+            heap_pointer heap = std::move(cache.free_heap_);
+            std::size_t count = cache.free_count_;
+            cache.free_count_ = 0;
+
+            heap->free(nullptr, count);
+        }
+#endif
+
+    public:
         bool did_alloc(void* p) const
         {
             unique_lock_type ul(mtx_);
@@ -327,6 +565,9 @@ namespace hpx { namespace util
         list_type heap_list_;
 
     private:
+        boost::atomic<thread_cache*> caches_;
+        std::size_t num_caches_;
+
         std::string const class_name_;
 
     public:
@@ -139,6 +139,9 @@ namespace hpx { namespace util
 #if defined(__linux) || defined(linux) || defined(__linux__) || defined(__FreeBSD__)
         bool init_use_stack_guard_pages() const;
 #endif
+#if defined(HPX_HAVE_THREAD_STACK_POOL)
+        void init_stack_pool() const;
+#endif
 
         void pre_initialize_ini();
         void post_initialize_ini(std::string& hpx_ini_file,
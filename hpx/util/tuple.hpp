@@ -1036,6 +1036,15 @@ namespace hpx { namespace traits
             >...
         >
     {};
+
+    // a tuple is stored exactly like its implementation, which allows for
+    // containers of tuples to be copied as a single block of memory
+    template <typename T, typename ...Ts>
+    struct is_bitwise_serializable< ::hpx::util::tuple<T, Ts...> >
+      : is_bitwise_serializable<
+            decltype(std::declval< ::hpx::util::tuple<T, Ts...> >()._impl)
+        >
+    {};
 }}
 
 namespace hpx { namespace serialization
@@ -14,6 +14,7 @@
 #include <hpx/util/get_and_reset_value.hpp>
 #include <hpx/util/assert.hpp>
 #include <hpx/util/bind.hpp>
+#include <hpx/util/static.hpp>
 
 #include <hpx/plugins/message_handler_factory.hpp>
 #include <hpx/plugins/parcel/coalescing_message_handler.hpp>
@@ -22,9 +23,12 @@
 #include <boost/lexical_cast.hpp>
 #include <boost/accumulators/accumulators.hpp>
 
+#include <algorithm>
 #include <chrono>
 #include <cstddef>
 #include <cstdint>
+#include <map>
+#include <memory>
 #include <mutex>
 #include <string>
 #include <utility>
@@ -41,6 +45,12 @@ namespace hpx { namespace traits
     //      num_messages = 50
     //      interval = 100
     //
+    // If 'adaptive' is set, num_messages is the upper limit for the number
+    // of coalesced parcels, the actual number is adjusted to the observed
+    // parcel rate such that no parcel is delayed by more than
+    // 'target_latency' microseconds. If 'per_destination' is set, the parcels
+    // of all actions sent to the same locality are coalesced together.
+    //
     template <>
     struct plugin_config_data<hpx::plugins::parcel::coalescing_message_handler>
     {
@@ -48,7 +58,10 @@ namespace hpx { namespace traits
         {
             return "num_messages = 50\n"
                    "interval = 100\n"
-                   "allow_background_flush = 1";
+                   "allow_background_flush = 1\n"
+                   "adaptive = 0\n"
+                   "target_latency = 100\n"
+                   "per_destination = 0";
         }
     };
 }}
@@ -84,6 +97,52 @@ namespace hpx { namespace plugins { namespace parcel
                 "1");
             return !value.empty() && value[0] != '0';
         }
+
+        bool get_adaptive()
+        {
+            std::string value = hpx::get_config_entry(
+                "hpx.plugins.coalescing_message_handler.adaptive", "0");
+            return !value.empty() && value[0] != '0';
+        }
+
+        std::size_t get_target_latency(std::size_t target_latency)
+        {
+            return boost::lexical_cast<std::size_t>(hpx::get_config_entry(
+                "hpx.plugins.coalescing_message_handler.target_latency",
+                target_latency));
+        }
+
+        bool get_per_destination()
+        {
+            std::string value = hpx::get_config_entry(
+                "hpx.plugins.coalescing_message_handler.per_destination", "0");
+            return !value.empty() && value[0] != '0';
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        // The handlers shared by all actions sent to the same destination.
+        // The registry holds weak references only, the handlers are kept
+        // alive by the per-action handlers referring to them.
+        struct destination_handlers
+        {
+            typedef lcos::local::spinlock mutex_type;
+            typedef std::map<
+                    parcelset::locality,
+                    std::weak_ptr<coalescing_message_handler>
+                > map_type;
+
+            mutex_type mtx_;
+            map_type handlers_;
+        };
+
+        struct destination_handlers_tag {};
+
+        destination_handlers& get_destination_handlers()
+        {
+            util::static_<destination_handlers, destination_handlers_tag>
+                handlers;
+            return handlers.get();
+        }
     }
 
     void coalescing_message_handler::update_num_messages()
@@ -99,6 +158,84 @@ namespace hpx { namespace plugins { namespace parcel
         interval_ = detail::get_interval(interval_);
     }
 
+    void coalescing_message_handler::update_target_latency()
+    {
+        std::lock_guard<mutex_type> l(mtx_);
+        target_latency_ = detail::get_target_latency(target_latency_);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    void coalescing_message_handler::adapt_parameters(
+        std::int64_t time_since_last_parcel)
+    {
+        // the weight of 1/8 lets the average follow changes of the parcel
+        // rate within a few dozen parcels
+        average_time_between_parcels_ +=
+            (double(time_since_last_parcel) - average_time_between_parcels_)
+                / 8.0;
+
+        // number of parcels expected to arrive within the latency budget
+        double expected = (double(target_latency_) * 1000.0) /
+            (std::max)(average_time_between_parcels_, 1.0);
+
+        if (expected < 2.0)
+        {
+            adaptive_num_coalesced_parcels_ = 1;
+        }
+        else
+        {
+            adaptive_num_coalesced_parcels_ = (std::min)(
+                std::size_t(expected), num_coalesced_parcels_);
+        }
+    }
+
+    std::shared_ptr<coalescing_message_handler>
+    coalescing_message_handler::get_destination_handler(
+        parcelset::locality const& dest, parcelset::parcelport* pp,
+        std::size_t num, std::size_t interval)
+    {
+        detail::destination_handlers& handlers =
+            detail::get_destination_handlers();
+
+        {
+            std::lock_guard<detail::destination_handlers::mutex_type> l(
+                handlers.mtx_);
+
+            auto it = handlers.handlers_.find(dest);
+            if (it != handlers.handlers_.end())
+            {
+                std::shared_ptr<coalescing_message_handler> h =
+                    (*it).second.lock();
+                if (h)
+                    return h;
+            }
+        }
+
+        // create the new handler without holding the lock, this registers
+        // its performance counters
+        std::string name("destination(" +
+            boost::lexical_cast<std::string>(dest) + ")");
+
+        std::shared_ptr<coalescing_message_handler> h =
+            std::make_shared<coalescing_message_handler>(
+                name.c_str(), pp, num, interval);
+        h->per_destination_ = false;
+
+        std::lock_guard<detail::destination_handlers::mutex_type> l(
+            handlers.mtx_);
+
+        std::weak_ptr<coalescing_message_handler>& entry =
+            handlers.handlers_[dest];
+
+        // some other thread might have created the handler in the meantime
+        std::shared_ptr<coalescing_message_handler> existing = entry.lock();
+        if (existing)
+            return existing;
+
+        entry = h;
+        return h;
+    }
+
     coalescing_message_handler::coalescing_message_handler(
             char const* action_name, parcelset::parcelport* pp, std::size_t num,
             std::size_t interval)
@@ -122,7 +259,12 @@ namespace hpx { namespace plugins { namespace parcel
         last_parcel_time_(started_at_),
         histogram_min_boundary_(-1),
         histogram_max_boundary_(-1),
-        histogram_num_buckets_(-1)
+        histogram_num_buckets_(-1),
+        adaptive_(detail::get_adaptive()),
+        target_latency_(detail::get_target_latency(interval_)),
+        average_time_between_parcels_(double(target_latency_) * 1000.0),
+        adaptive_num_coalesced_parcels_(1),
+        per_destination_(detail::get_per_destination())
     {
         // register performance counter functions
         using util::placeholders::_1;
@@ -146,6 +288,10 @@ namespace hpx { namespace plugins { namespace parcel
         set_config_entry_callback(
             "hpx.plugins.coalescing_message_handler.interval",
             util::bind(&coalescing_message_handler::update_interval, this));
+        set_config_entry_callback(
+            "hpx.plugins.coalescing_message_handler.target_latency",
+            util::bind(&coalescing_message_handler::update_target_latency,
+                this));
     }
 
     void coalescing_message_handler::put_parcel(
@@ -164,13 +310,46 @@ namespace hpx { namespace plugins { namespace parcel
         if (time_between_parcels_)
             (*time_between_parcels_)(time_since_last_parcel);
 
+        // hand the parcel to the handler responsible for its destination
+        if (per_destination_ && !stopped_)
+        {
+            std::shared_ptr<coalescing_message_handler> h =
+                destination_handler_;
+            if (!h)
+            {
+                std::size_t num = num_coalesced_parcels_;
+                std::size_t interval = interval_;
+
+                l.unlock();
+                h = get_destination_handler(dest, pp_, num, interval);
+
+                l.lock();
+                if (!destination_handler_)
+                    destination_handler_ = h;
+            }
+            l.unlock();
+
+            h->put_parcel(dest, std::move(p), std::move(f));
+            return;
+        }
+
+        std::size_t num_coalesced_parcels = num_coalesced_parcels_;
         std::chrono::microseconds interval(interval_);
 
+        if (adaptive_)
+        {
+            adapt_parameters(time_since_last_parcel);
+            num_coalesced_parcels = adaptive_num_coalesced_parcels_;
+            interval = std::chrono::microseconds(target_latency_);
+        }
+
         // just send parcel if the coalescing was stopped or the buffer is
-        // empty and time since last parcel is larger than coalescing interval.
+        // empty and time since last parcel is larger than coalescing interval
+        // (or the parcel rate is too low for coalescing to pay off).
         if (stopped_ ||
             (buffer_.empty() &&
-                std::chrono::nanoseconds(time_since_last_parcel) > interval
+                (std::chrono::nanoseconds(time_since_last_parcel) > interval ||
+                    num_coalesced_parcels <= 1)
            ))
         {
             ++num_messages_;
@@ -184,6 +363,13 @@ namespace hpx { namespace plugins { namespace parcel
         detail::message_buffer::message_buffer_append_state s =
             buffer_.append(dest, std::move(p), std::move(f));
 
+        // the adaptive batch size may be smaller than the buffer capacity
+        if (s != detail::message_buffer::buffer_now_full &&
+            buffer_.size() >= num_coalesced_parcels)
+        {
+            s = detail::message_buffer::buffer_now_full;
+        }
+
         switch(s) {
         case detail::message_buffer::first_message:
             // start deadline timer to flush buffer
@@ -232,7 +418,18 @@ namespace hpx { namespace plugins { namespace parcel
         bool stop_buffering)
     {
         std::unique_lock<mutex_type> l(mtx_);
-        return flush_locked(l, mode, stop_buffering, true);
+        std::shared_ptr<coalescing_message_handler> h = destination_handler_;
+
+        bool result = flush_locked(l, mode, stop_buffering, true);
+        if (l.owns_lock())
+            l.unlock();
+
+        // flush the shared handler as well, if any, it keeps buffering the
+        // parcels of all other actions sent to the same destination
+        if (h)
+            result = h->flush(mode, false) || result;
+
+        return result;
     }
 
     void coalescing_message_handler::flush_terminate()
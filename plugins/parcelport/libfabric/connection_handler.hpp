@@ -34,6 +34,7 @@ namespace libfabric
         typedef HPX_PARCELPORT_LIBFABRIC_HAVE_BOOTSTRAPPING send_early_parcel;
         typedef std::true_type                              do_background_work;
         typedef std::true_type                              send_immediate_parcels;
+        typedef std::false_type                             send_multiple_messages;
 
         static const char * type()
         {
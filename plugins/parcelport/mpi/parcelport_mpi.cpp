@@ -63,6 +63,7 @@ namespace hpx { namespace parcelset
         typedef std::true_type  send_early_parcel;
         typedef std::true_type  do_background_work;
         typedef std::false_type send_immediate_parcels;
+        typedef std::false_type send_multiple_messages;
 
         static const char * type()
         {
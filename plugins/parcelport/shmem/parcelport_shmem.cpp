@@ -0,0 +1,240 @@
+//  Copyright (c) 2026 agent
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_NETWORKING)
+#include <hpx/traits/plugin_config_data.hpp>
+
+#include <hpx/plugins/parcelport_factory.hpp>
+#include <hpx/util/command_line_handling.hpp>
+
+// parcelport
+#include <hpx/runtime.hpp>
+#include <hpx/runtime/parcelset/locality.hpp>
+#include <hpx/runtime/parcelset/parcelport_impl.hpp>
+
+#include <hpx/plugins/parcelport/shmem/locality.hpp>
+#include <hpx/plugins/parcelport/shmem/sender.hpp>
+#include <hpx/plugins/parcelport/shmem/receiver.hpp>
+
+#include <hpx/util/detail/pp/stringize.hpp>
+#include <hpx/util/runtime_configuration.hpp>
+#include <hpx/util/safe_lexical_cast.hpp>
+
+#include <boost/asio/ip/host_name.hpp>
+#include <boost/atomic.hpp>
+
+#include <unistd.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <type_traits>
+
+#include <hpx/config/warnings_prefix.hpp>
+
+namespace hpx { namespace parcelset
+{
+    namespace policies { namespace shmem
+    {
+        class HPX_EXPORT parcelport;
+    }}
+
+    template <>
+    struct connection_handler_traits<policies::shmem::parcelport>
+    {
+        typedef policies::shmem::sender_connection connection_type;
+        typedef std::false_type send_early_parcel;
+        typedef std::true_type  do_background_work;
+        typedef std::false_type send_immediate_parcels;
+        typedef std::false_type send_multiple_messages;
+
+        static const char * type()
+        {
+            return "shmem";
+        }
+
+        static const char * pool_name()
+        {
+            return "parcel-pool-shmem";
+        }
+
+        static const char * pool_name_postfix()
+        {
+            return "-shmem";
+        }
+    };
+
+    namespace policies { namespace shmem
+    {
+        void add_connection(sender * s, std::shared_ptr<sender_connection> const &ptr)
+        {
+            s->add(ptr);
+        }
+
+        // This parcelport is used for all localities running on the same node
+        // only. It never bootstraps the application, messages to remote
+        // localities are sent using any of the other enabled parcelports
+        // instead.
+        class HPX_EXPORT parcelport
+          : public parcelport_impl<parcelport>
+        {
+            typedef parcelport_impl<parcelport> base_type;
+
+            static parcelset::locality here()
+            {
+                return
+                    parcelset::locality(
+                        locality(
+                            boost::asio::ip::host_name(),
+                            static_cast<std::int32_t>(::getpid())
+                        )
+                    );
+            }
+
+            static std::size_t get_size(util::runtime_configuration const& ini,
+                char const* name, std::size_t default_size)
+            {
+                return hpx::util::get_entry_as<std::size_t>(ini,
+                    std::string("hpx.parcel.shmem.") + name, default_size);
+            }
+
+        public:
+            parcelport(util::runtime_configuration const& ini,
+                util::function_nonser<void(std::size_t, char const*)> const& on_start,
+                util::function_nonser<void()> const& on_stop)
+              : base_type(ini, here(), on_start, on_stop)
+              , stopped_(false)
+              , sender_(
+                    static_cast<std::int32_t>(::getpid()),
+                    (std::max)(get_size(ini, "ring_size",
+                        HPX_PARCEL_SHMEM_RING_SIZE), std::size_t(4096)),
+                    get_size(ini, "heap_size", HPX_PARCEL_SHMEM_HEAP_SIZE),
+                    get_size(ini, "zero_copy_threshold",
+                        HPX_PARCEL_SHMEM_ZERO_COPY_THRESHOLD))
+              , receiver_(*this, static_cast<std::int32_t>(::getpid()))
+            {}
+
+            /// Start the handling of connections.
+            bool do_run()
+            {
+                receiver_.run();
+                return true;
+            }
+
+            /// Stop the handling of connectons.
+            void do_stop()
+            {
+                while(do_background_work(0))
+                {
+                    if(threads::get_self_ptr())
+                        hpx::this_thread::suspend(hpx::threads::pending,
+                            "shmem::parcelport::do_stop");
+                }
+                stopped_ = true;
+            }
+
+            /// Only localities on the same node which have their shared
+            /// memory parcelport enabled can be reached.
+            bool can_connect(parcelset::locality const& dest,
+                bool use_alternative_parcelport)
+            {
+                if (!use_alternative_parcelport)
+                    return false;
+
+                locality const& l = dest.get<locality>();
+                return l.host() == here_.get<locality>().host() &&
+                    sender_.can_connect(l.pid());
+            }
+
+            /// Return the name of this locality
+            std::string get_locality_name() const
+            {
+                return here_.get<locality>().host();
+            }
+
+            std::shared_ptr<sender_connection> create_connection(
+                parcelset::locality const& l, error_code& ec)
+            {
+                return sender_.create_connection(l.get<locality>(), this, ec);
+            }
+
+            parcelset::locality agas_locality(
+                util::runtime_configuration const & ini) const
+            {
+                return parcelset::locality(locality());
+            }
+
+            parcelset::locality create_locality() const
+            {
+                return parcelset::locality(locality());
+            }
+
+            bool background_work(std::size_t num_thread)
+            {
+                if (stopped_)
+                    return false;
+
+                bool has_work = false;
+                has_work = sender_.background_work();
+                has_work = receiver_.background_work(num_thread) || has_work;
+                return has_work;
+            }
+
+        private:
+            boost::atomic<bool> stopped_;
+
+            sender sender_;
+            receiver<parcelport> receiver_;
+        };
+    }}
+}}
+
+#include <hpx/config/warnings_suffix.hpp>
+
+namespace hpx { namespace traits
+{
+    // Inject additional configuration data into the factory registry for this
+    // type. This information ends up in the system wide configuration database
+    // under the plugin specific section:
+    //
+    //      [hpx.parcel.shmem]
+    //      ...
+    //      priority = 1000
+    //
+    template <>
+    struct plugin_config_data<hpx::parcelset::policies::shmem::parcelport>
+    {
+        static char const* priority()
+        {
+            return "1000";
+        }
+
+        static void init(int *argc, char ***argv, util::command_line_handling &cfg)
+        {
+        }
+
+        static char const* call()
+        {
+            return
+                "ring_size = ${HPX_PARCEL_SHMEM_RING_SIZE:"
+                    HPX_PP_STRINGIZE(HPX_PARCEL_SHMEM_RING_SIZE) "}\n"
+                "heap_size = ${HPX_PARCEL_SHMEM_HEAP_SIZE:"
+                    HPX_PP_STRINGIZE(HPX_PARCEL_SHMEM_HEAP_SIZE) "}\n"
+                "zero_copy_threshold = ${HPX_PARCEL_SHMEM_ZERO_COPY_THRESHOLD:"
+                    HPX_PP_STRINGIZE(HPX_PARCEL_SHMEM_ZERO_COPY_THRESHOLD) "}\n"
+                ;
+        }
+    };
+}}
+
+HPX_REGISTER_PARCELPORT(
+    hpx::parcelset::policies::shmem::parcelport,
+    shmem);
+
+#endif
@@ -20,6 +20,7 @@
 #include <hpx/util/asio_util.hpp>
 #include <hpx/util/bind.hpp>
 #include <hpx/util/runtime_configuration.hpp>
+#include <hpx/util/safe_lexical_cast.hpp>
 
 #include <boost/io/ios_state.hpp>
 #include <boost/asio/ip/tcp.hpp>
@@ -64,6 +65,9 @@ namespace hpx { namespace parcelset { namespace policies { namespace tcp
             util::function_nonser<void()> const& on_stop_thread)
       : base_type(ini, parcelport_address(ini), on_start_thread, on_stop_thread)
       , acceptor_(nullptr)
+      , pipeline_window_(hpx::util::get_entry_as<std::size_t>(
+            ini, "hpx.parcel.tcp.pipeline_window",
+            std::size_t(HPX_PARCEL_TCP_PIPELINE_WINDOW)))
     {
         if (here_.type() != std::string("tcp")) {
             HPX_THROW_EXCEPTION(network_error, "tcp::parcelport::parcelport",
@@ -152,7 +156,7 @@ namespace hpx { namespace parcelset { namespace policies { namespace tcp
 
         // The parcel gets serialized inside the connection constructor, no
         // need to keep the original parcel alive after this call returned.
-        std::shared_ptr<sender> sender_connection(new sender(io_service, l, this));
+        std::shared_ptr<sender> sender_connection(new sender(io_service, l, this, pipeline_window_));
 
         // Connect to the target locality, retry if needed
         boost::system::error_code error = boost::asio::error::try_again;
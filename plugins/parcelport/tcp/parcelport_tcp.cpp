@@ -11,6 +11,7 @@
 #include <hpx/plugins/parcelport/tcp/connection_handler.hpp>
 #include <hpx/plugins/parcelport/tcp/sender.hpp>
 #include <hpx/plugins/parcelport_factory.hpp>
+#include <hpx/util/detail/pp/stringize.hpp>
 
 namespace hpx { namespace traits
 {
@@ -35,7 +36,8 @@ namespace hpx { namespace traits
         }
         static char const* call()
         {
-            return "";
+            return "pipeline_window = ${HPX_PARCEL_TCP_PIPELINE_WINDOW:"
+                HPX_PP_STRINGIZE(HPX_PARCEL_TCP_PIPELINE_WINDOW) "}\n";
         }
     };
 }}
@@ -32,6 +32,7 @@ namespace verbs
         typedef HPX_PARCELPORT_VERBS_HAVE_BOOTSTRAPPING send_early_parcel;
         typedef std::true_type                          do_background_work;
         typedef std::true_type                          send_immediate_parcels;
+        typedef std::false_type                         send_multiple_messages;
 
         static const char * type()
         {
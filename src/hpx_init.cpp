@@ -891,7 +891,8 @@ namespace hpx
         ///////////////////////////////////////////////////////////////////////
         // local scheduler with priority queue (one queue for each OS threads
         // plus one separate queue for high priority HPX-threads)
-        template <typename Queuing>
+        template <typename Queuing,
+            typename StagedQueuing = hpx::threads::policies::lockfree_fifo>
         int run_priority_local(startup_function_type startup,
             shutdown_function_type shutdown,
             util::command_line_handling& cfg, bool blocking)
@@ -909,7 +910,7 @@ namespace hpx
 
             // scheduling policy
             typedef hpx::threads::policies::local_priority_queue_scheduler<
-                    compat::mutex, Queuing
+                    compat::mutex, Queuing, StagedQueuing
                 > local_queue_policy;
 
             typename local_queue_policy::init_parameter_type init(
@@ -1189,6 +1190,17 @@ namespace hpx
                             hpx::threads::policies::lockfree_lifo
                         >(std::move(startup), std::move(shutdown), cfg, blocking);
                 }
+                else if (0 == std::string("local-priority-chase-lev").find(
+                    cfg.queuing_))
+                {
+                    // local scheduler with priority queue, where the pending
+                    // and staged queues are Chase-Lev work-stealing deques
+                    cfg.queuing_ = "local-priority-chase-lev";
+                    result = run_priority_local<
+                            hpx::threads::policies::lockfree_chase_lev_lifo,
+                            hpx::threads::policies::lockfree_chase_lev_lifo
+                        >(std::move(startup), std::move(shutdown), cfg, blocking);
+                }
                 else if (0 == std::string("static-priority").find(cfg.queuing_))
                 {
                     cfg.queuing_ = "static-priority";
@@ -9,9 +9,17 @@
 #include <hpx/util/detail/yield_k.hpp>
 #include <hpx/lcos/local/futures_factory.hpp>
 #include <hpx/lcos/detail/future_data.hpp>
+#include <hpx/runtime/config_entry.hpp>
 #include <hpx/runtime/threads/thread.hpp>
+#include <hpx/runtime/threads/thread_helpers.hpp>
 #include <hpx/runtime/launch_policy.hpp>
+#include <hpx/util/detail/pp/expand.hpp>
+#include <hpx/util/detail/pp/stringize.hpp>
 
+#include <boost/lexical_cast.hpp>
+
+#include <cstddef>
+#include <string>
 #include <utility>
 
 namespace hpx { namespace lcos { namespace detail
@@ -48,4 +56,58 @@ namespace hpx { namespace lcos { namespace detail
             return true;
         }
     }
+
+    ///////////////////////////////////////////////////////////////////////////
+    std::size_t get_max_continuation_inline_depth()
+    {
+        static std::size_t max_depth =
+            boost::lexical_cast<std::size_t>(hpx::get_config_entry(
+                "hpx.continuations.max_inline_depth",
+                HPX_PP_STRINGIZE(HPX_PP_EXPAND(
+                    HPX_CONTINUATION_MAX_RECURSION_DEPTH))));
+        return max_depth;
+    }
+
+    bool can_inline_continuation()
+    {
+        if (nullptr == hpx::threads::get_self_ptr())
+            return false;
+
+        if (threads::get_continuation_recursion_count() >
+                get_max_continuation_inline_depth())
+        {
+            return false;
+        }
+
+#if defined(HPX_HAVE_THREADS_GET_STACK_POINTER)
+        return this_thread::has_sufficient_stack_space();
+#else
+        return true;
+#endif
+    }
+
+    namespace
+    {
+        launch parse_continuation_policy(std::string const& policy)
+        {
+            if (policy == "sync")
+                return launch::sync;
+            if (policy == "sync_if_cheap")
+                return launch::sync_if_cheap;
+            if (policy == "async")
+                return launch::async;
+            if (policy == "fork")
+                return launch::fork;
+
+            // use the built-in defaults
+            return launch::all;
+        }
+    }
+
+    launch get_default_continuation_policy()
+    {
+        static launch policy = parse_continuation_policy(
+            hpx::get_config_entry("hpx.continuations.policy", "default"));
+        return policy;
+    }
 }}}
@@ -0,0 +1,276 @@
+//  Copyright (c) 2026 agent
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+#include <hpx/compat/mutex.hpp>
+#include <hpx/lcos/detail/shared_state_pool.hpp>
+#include <hpx/util/assert.hpp>
+#include <hpx/util/thread_specific_ptr.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <new>
+
+namespace hpx { namespace lcos { namespace detail
+{
+    namespace
+    {
+        ///////////////////////////////////////////////////////////////////////
+        enum
+        {
+            chunk_alignment = 64,
+            num_size_classes = max_pooled_shared_state_size / chunk_alignment,
+            slab_size = 64 * 1024,
+            thread_cache_size = 256
+        };
+
+        // free chunks are linked through their first word
+        struct free_chunk
+        {
+            free_chunk* next_;
+        };
+
+        inline std::size_t get_size_class(std::size_t size)
+        {
+            return (size - 1) / chunk_alignment;
+        }
+
+        inline std::size_t get_chunk_size(std::size_t idx)
+        {
+            return (idx + 1) * chunk_alignment;
+        }
+
+        // global free list of all chunks of the same size, and the part of
+        // the current slab no chunks have been handed out from yet
+        struct size_class
+        {
+            size_class()
+              : free_(nullptr), count_(0)
+              , slab_next_(nullptr), slab_end_(nullptr)
+            {}
+
+            compat::mutex mtx_;
+            free_chunk* free_;
+            std::size_t count_;
+
+            char* slab_next_;
+            char* slab_end_;
+        };
+
+        // per OS-thread cache of free chunks
+        struct thread_cache
+        {
+            struct entry
+            {
+                free_chunk* free_;
+                std::size_t count_;
+            };
+
+            thread_cache()
+            {
+                for (entry& e : entries_)
+                {
+                    e.free_ = nullptr;
+                    e.count_ = 0;
+                }
+            }
+
+            entry entries_[num_size_classes];
+        };
+
+        struct thread_cache_tag {};
+
+        ///////////////////////////////////////////////////////////////////////
+        class shared_state_pool
+        {
+        public:
+            void* allocate(std::size_t idx)
+            {
+                thread_cache::entry& e = get_thread_cache().entries_[idx];
+                if (e.free_ == nullptr)
+                    refill(idx, e);
+
+                HPX_ASSERT(e.free_ != nullptr);
+
+                free_chunk* chunk = e.free_;
+                e.free_ = chunk->next_;
+                --e.count_;
+
+                return chunk;
+            }
+
+            void deallocate(void* p, std::size_t idx)
+            {
+                thread_cache::entry& e = get_thread_cache().entries_[idx];
+
+                free_chunk* chunk = static_cast<free_chunk*>(p);
+                chunk->next_ = e.free_;
+                e.free_ = chunk;
+
+                if (++e.count_ > thread_cache_size)
+                    spill(idx, e, e.count_ - thread_cache_size / 2);
+            }
+
+            // move all chunks cached by the calling thread to the global free
+            // lists and delete its cache, the chunks themselves may still be
+            // in use by other threads
+            void release_thread_cache()
+            {
+                thread_cache* c = cache_.get();
+                if (c == nullptr)
+                    return;
+
+                for (std::size_t idx = 0; idx != num_size_classes; ++idx)
+                {
+                    thread_cache::entry& e = c->entries_[idx];
+                    spill(idx, e, e.count_);
+                }
+                cache_.reset();
+            }
+
+        private:
+            thread_cache& get_thread_cache()
+            {
+                thread_cache* c = cache_.get();
+                if (c == nullptr)
+                {
+                    c = new thread_cache;
+                    cache_.reset(c);
+                }
+                return *c;
+            }
+
+            // move chunks from the global free list (or the current slab) to
+            // the cache of the calling thread
+            void refill(std::size_t idx, thread_cache::entry& e)
+            {
+                std::size_t const chunk_size = get_chunk_size(idx);
+
+                size_class& sc = classes_[idx];
+                std::lock_guard<compat::mutex> l(sc.mtx_);
+
+                std::size_t count = thread_cache_size / 2;
+                while (sc.free_ != nullptr && count-- != 0)
+                {
+                    free_chunk* chunk = sc.free_;
+                    sc.free_ = chunk->next_;
+                    --sc.count_;
+
+                    chunk->next_ = e.free_;
+                    e.free_ = chunk;
+                    ++e.count_;
+                }
+
+                if (e.free_ != nullptr)
+                    return;
+
+                // hand out chunks from the current slab
+                if (std::size_t(sc.slab_end_ - sc.slab_next_) < chunk_size)
+                    allocate_slab(sc, chunk_size);
+
+                std::size_t available =
+                    std::size_t(sc.slab_end_ - sc.slab_next_) / chunk_size;
+                if (count > available)
+                    count = available;
+
+                for (std::size_t i = count; i != 0; --i)
+                {
+                    free_chunk* chunk = reinterpret_cast<free_chunk*>(
+                        sc.slab_next_ + (i - 1) * chunk_size);
+                    chunk->next_ = e.free_;
+                    e.free_ = chunk;
+                }
+                e.count_ += count;
+                sc.slab_next_ += count * chunk_size;
+            }
+
+            // move the given number of chunks from the cache of the calling
+            // thread to the global free list
+            void spill(std::size_t idx, thread_cache::entry& e,
+                std::size_t count)
+            {
+                if (count == 0)
+                    return;
+
+                free_chunk* first = e.free_;
+                free_chunk* last = first;
+                for (std::size_t i = 1; i != count; ++i)
+                    last = last->next_;
+
+                e.free_ = last->next_;
+                e.count_ -= count;
+
+                size_class& sc = classes_[idx];
+
+                std::lock_guard<compat::mutex> l(sc.mtx_);
+                last->next_ = sc.free_;
+                sc.free_ = first;
+                sc.count_ += count;
+            }
+
+            // allocate a new slab for the given size class, sc.mtx_ must be
+            // held, the slabs are never released
+            static void allocate_slab(size_class& sc, std::size_t chunk_size)
+            {
+                char* slab = static_cast<char*>(
+                    ::operator new(slab_size + chunk_alignment));
+
+                // align the chunks to the cache line size to avoid false
+                // sharing between shared states used by different threads
+                std::uintptr_t base =
+                    (reinterpret_cast<std::uintptr_t>(slab) +
+                        chunk_alignment - 1) & ~std::uintptr_t(chunk_alignment - 1);
+
+                // the remainder of the previous slab (if any) is smaller than
+                // a single chunk and is left unused
+                sc.slab_next_ = reinterpret_cast<char*>(base);
+                sc.slab_end_ =
+                    sc.slab_next_ + (slab_size / chunk_size) * chunk_size;
+            }
+
+            size_class classes_[num_size_classes];
+
+            hpx::util::thread_specific_ptr<thread_cache, thread_cache_tag>
+                cache_;
+        };
+
+        // The pool is never destroyed, as shared states might be released
+        // during the destruction of global objects.
+        shared_state_pool& get_shared_state_pool()
+        {
+            static shared_state_pool* pool = new shared_state_pool;
+            return *pool;
+        }
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    void* allocate_shared_state(std::size_t size)
+    {
+        if (size == 0 || size > max_pooled_shared_state_size)
+            return ::operator new(size);
+
+        return get_shared_state_pool().allocate(get_size_class(size));
+    }
+
+    void release_shared_state_cache()
+    {
+        get_shared_state_pool().release_thread_cache();
+    }
+
+    void deallocate_shared_state(void* p, std::size_t size)
+    {
+        if (p == nullptr)
+            return;
+
+        if (size == 0 || size > max_pooled_shared_state_size)
+        {
+            ::operator delete(p);
+            return;
+        }
+
+        get_shared_state_pool().deallocate(p, get_size_class(size));
+    }
+}}}
@@ -1186,7 +1186,15 @@ namespace hpx { namespace threads
     std::ptrdiff_t get_stack_size(threads::thread_stacksize stacksize)
     {
         if (stacksize == threads::thread_stacksize_current)
-            return threads::get_self_stacksize();
+        {
+            // threads created from a stackless thread don't inherit its
+            // 'size', they are given the default stack instead
+            std::ptrdiff_t size = threads::get_self_stacksize();
+            if (size == threads::thread_stacksize_nostack)
+                stacksize = threads::thread_stacksize_default;
+            else
+                return size;
+        }
 
         return get_runtime().get_config().get_stack_size(stacksize);
     }
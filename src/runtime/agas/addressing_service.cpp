@@ -42,6 +42,7 @@
 #include <hpx/performance_counters/counter_creators.hpp>
 #include <hpx/performance_counters/manage_counter_type.hpp>
 #include <hpx/lcos/wait_all.hpp>
+#include <hpx/lcos/when_all.hpp>
 #include <hpx/lcos/broadcast.hpp>
 
 #include <boost/format.hpp>
@@ -124,6 +125,36 @@ struct addressing_service::gva_cache_key
     }
 }; // }}}
 
+#if defined(HPX_HAVE_AGAS_SHARDED_GVA_CACHE)
+// Ids are distributed over the shards of the GVA cache in blocks of 256
+// consecutive ids, entries describing a range of ids are stored in all shards
+// covered by that range.
+struct addressing_service::gva_cache_key_blocks
+{ // {{{ gva_cache_key_blocks implementation
+    enum { block_bits = 8 };
+
+    std::pair<std::uint64_t, std::uint64_t> operator()(
+        gva_cache_key const& key
+        ) const
+    {
+        naming::gid_type const id = key.get_gid();
+        std::uint64_t const count = key.get_count();
+
+        // all ranges of ids with the same MSB map to consecutive blocks
+        std::uint64_t const base = id.get_msb() * 0xff51afd7ed558ccdull;
+        std::uint64_t const first = id.get_lsb() >> block_bits;
+
+        // a range wrapping around the LSB is reported as an inverted range
+        // of blocks (i.e. it covers all shards)
+        std::uint64_t const last = (id.get_lsb() + (count - 1)) >> block_bits;
+        if (last < first)
+            return std::make_pair(base + first, base + first - 1);
+
+        return std::make_pair(base + first, base + last);
+    }
+}; // }}}
+#endif
+
 addressing_service::addressing_service(
     parcelset::parcelhandler& ph
   , util::runtime_configuration const& ini_
@@ -805,6 +836,121 @@ hpx::future<bool> addressing_service::bind_range_async(
         ));
 }
 
+// Combine the results of bulk requests sent to several localities, the
+// indices refer to the position of each of the results in the overall result.
+template <typename T>
+static std::vector<T> scatter_results(
+    future<std::vector<future<std::vector<T> > > > f
+  , std::vector<std::vector<std::size_t> > const& indices
+  , std::vector<T> results
+    )
+{
+    std::vector<future<std::vector<T> > > lazy_results = f.get();
+    HPX_ASSERT(lazy_results.size() == indices.size());
+
+    for (std::size_t i = 0; i != lazy_results.size(); ++i)
+    {
+        // rethrow possible errors
+        std::vector<T> r = lazy_results[i].get();
+        HPX_ASSERT(r.size() == indices[i].size());
+
+        for (std::size_t j = 0; j != r.size(); ++j)
+            results[indices[i][j]] = std::move(r[j]);
+    }
+
+    return results;
+}
+
+std::vector<bool> addressing_service::bind_many_postproc(
+    future<std::vector<bool> > f
+  , std::vector<primary_namespace::bind_gid_request_type> const& requests
+    )
+{
+    using hpx::util::get;
+
+    std::vector<bool> results = f.get();
+
+    for (primary_namespace::bind_gid_request_type const& req : requests)
+    {
+        gva const& g = get<0>(req);
+        naming::gid_type const& lower_id = get<1>(req);
+
+        if (range_caching_)
+        {
+            // Put the range into the cache.
+            update_cache_entry(lower_id, g);
+        }
+        else
+        {
+            // Only put the first GID in the range into the cache
+            gva const first_g = g.resolve(lower_id, lower_id);
+            update_cache_entry(lower_id, first_g);
+        }
+    }
+
+    return results;
+}
+
+hpx::future<std::vector<bool> > addressing_service::bind_range_many(
+    std::vector<bind_range_request_type> const& requests
+    )
+{
+    using hpx::util::get;
+
+    // collect all requests for each locality
+    typedef std::map<
+            naming::gid_type,
+            std::pair<
+                std::vector<primary_namespace::bind_gid_request_type>,
+                std::vector<std::size_t>
+            >
+        > requests_type;
+    requests_type requests_map;
+
+    for (std::size_t i = 0; i != requests.size(); ++i)
+    {
+        bind_range_request_type const& req = requests[i];
+        naming::address const& baseaddr = get<2>(req);
+
+        // Create a global virtual address from the legacy calling convention
+        // parameters.
+        gva const g(baseaddr.locality_, baseaddr.type_, get<1>(req),
+            baseaddr.address_, get<3>(req));
+
+        naming::gid_type id(
+            naming::detail::get_stripped_gid_except_dont_cache(get<0>(req)));
+
+        auto& data =
+            requests_map[primary_namespace::get_service_instance(id)];
+        data.first.push_back(hpx::util::make_tuple(g, id, get<4>(req)));
+        data.second.push_back(i);
+    }
+
+    // send requests to all localities
+    std::vector<hpx::future<std::vector<bool> > > lazy_results;
+    std::vector<std::vector<std::size_t> > indices;
+    lazy_results.reserve(requests_map.size());
+    indices.reserve(requests_map.size());
+
+    using util::placeholders::_1;
+    for (auto& data : requests_map)
+    {
+        future<std::vector<bool> > f =
+            primary_ns_.bind_gids_async(data.second.first);
+
+        lazy_results.push_back(f.then(util::bind(
+                util::one_shot(&addressing_service::bind_many_postproc),
+                this, _1, std::move(data.second.first)
+            )));
+        indices.push_back(std::move(data.second.second));
+    }
+
+    return hpx::when_all(lazy_results).then(util::bind(
+            util::one_shot(&scatter_results<bool>),
+            _1, std::move(indices), std::vector<bool>(requests.size(), false)
+        ));
+}
+
 hpx::future<naming::address> addressing_service::unbind_range_async(
     naming::gid_type const& lower_id
   , std::uint64_t count
@@ -1219,7 +1365,7 @@ naming::address addressing_service::resolve_full_postproc(
     {
         HPX_THROW_EXCEPTION(bad_parameter,
             "addressing_service::resolve_full_postproc",
-            "could no resolve global id");
+            "could not resolve global id");
         return addr;
     }
 
@@ -1274,6 +1420,144 @@ hpx::future<naming::address> addressing_service::resolve_full_async(
         ));
 }
 
+///////////////////////////////////////////////////////////////////////////////
+std::vector<naming::address> addressing_service::resolve_full_many_postproc(
+    future<std::vector<primary_namespace::resolved_type> > f
+  , std::vector<naming::gid_type> const& ids
+    )
+{
+    using hpx::util::get;
+
+    std::vector<primary_namespace::resolved_type> reps = f.get();
+    HPX_ASSERT(reps.size() == ids.size());
+
+    std::vector<naming::address> addrs;
+    addrs.reserve(ids.size());
+
+    for (std::size_t i = 0; i != ids.size(); ++i)
+    {
+        auto const& rep = reps[i];
+        if (get<0>(rep) == naming::invalid_gid ||
+            get<2>(rep) == naming::invalid_gid)
+        {
+            HPX_THROW_EXCEPTION(bad_parameter,
+                "addressing_service::resolve_full_many_postproc",
+                "could not resolve global id");
+            return addrs;
+        }
+
+        // Resolve the gva to the real resolved address (which is just a gva
+        // with as fully resolved LVA and and offset of zero).
+        naming::gid_type const& id = ids[i];
+        naming::gid_type const& base_gid = get<0>(rep);
+        gva const& base_gva = get<1>(rep);
+
+        gva const g = base_gva.resolve(id, base_gid);
+
+        addrs.push_back(naming::address(g.prefix, g.type, g.lva()));
+
+        if (naming::detail::store_in_cache(id))
+        {
+            if (range_caching_)
+            {
+                // Put the range into the cache.
+                update_cache_entry(base_gid, base_gva);
+            }
+            else
+            {
+                // Put the fully resolved gva into the cache.
+                update_cache_entry(id, g);
+            }
+        }
+    }
+
+    return addrs;
+}
+
+hpx::future<std::vector<naming::address> > addressing_service::resolve_async(
+    std::vector<naming::gid_type> const& gids
+    )
+{
+    std::vector<naming::address> addrs(gids.size());
+
+    // collect all ids which are not cached for each locality
+    typedef std::map<
+            naming::gid_type,
+            std::pair<std::vector<naming::gid_type>, std::vector<std::size_t> >
+        > requests_type;
+    requests_type requests;
+
+    for (std::size_t i = 0; i != gids.size(); ++i)
+    {
+        naming::gid_type const& gid = gids[i];
+        if (!gid)
+        {
+            return hpx::make_exceptional_future<std::vector<naming::address> >(
+                HPX_GET_EXCEPTION(bad_parameter,
+                    "addressing_service::resolve_async",
+                    "invalid reference id"));
+        }
+
+        // Try the cache.
+        if (caching_)
+        {
+            error_code ec;
+            if (resolve_cached(gid, addrs[i], ec))
+                continue;
+
+            if (ec)
+            {
+                return hpx::make_exceptional_future<
+                        std::vector<naming::address>
+                    >(hpx::detail::access_exception(ec));
+            }
+        }
+
+        auto& data = requests[primary_namespace::get_service_instance(gid)];
+        data.first.push_back(gid);
+        data.second.push_back(i);
+    }
+
+    if (requests.empty())
+        return hpx::make_ready_future(std::move(addrs));
+
+    // now ask the AGAS service instances, one request per locality
+    std::vector<hpx::future<std::vector<naming::address> > > lazy_results;
+    std::vector<std::vector<std::size_t> > indices;
+    lazy_results.reserve(requests.size());
+    indices.reserve(requests.size());
+
+    using util::placeholders::_1;
+    for (auto& data : requests)
+    {
+        future<std::vector<primary_namespace::resolved_type> > f =
+            primary_ns_.resolve_full(data.second.first);
+
+        lazy_results.push_back(f.then(util::bind(
+                util::one_shot(&addressing_service::resolve_full_many_postproc),
+                this, _1, std::move(data.second.first)
+            )));
+        indices.push_back(std::move(data.second.second));
+    }
+
+    return hpx::when_all(lazy_results).then(util::bind(
+            util::one_shot(&scatter_results<naming::address>),
+            _1, std::move(indices), std::move(addrs)
+        ));
+}
+
+hpx::future<std::vector<naming::address> > addressing_service::resolve_async(
+    std::vector<naming::id_type> const& ids
+    )
+{
+    std::vector<naming::gid_type> gids;
+    gids.reserve(ids.size());
+    for (naming::id_type const& id : ids)
+        gids.push_back(id.get_gid());
+
+    return resolve_async(gids);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 bool addressing_service::resolve_full_local(
     naming::gid_type const* gids
@@ -1606,6 +1890,230 @@ void addressing_service::decref(
     }
 } // }}}
 
+///////////////////////////////////////////////////////////////////////////////
+std::vector<std::int64_t> addressing_service::incref_many_postproc(
+    future<std::vector<std::int64_t> > f
+  , std::vector<std::int64_t> const& compensated_credits
+    )
+{
+    std::vector<std::int64_t> credits = f.get();
+    HPX_ASSERT(credits.size() == compensated_credits.size());
+
+    for (std::size_t i = 0; i != credits.size(); ++i)
+        credits[i] += compensated_credits[i];
+
+    return credits;
+}
+
+lcos::future<std::vector<std::int64_t> > addressing_service::incref_many(
+    std::vector<std::pair<naming::gid_type, std::int64_t> > const& requests
+    )
+{ // {{{ incref_many implementation
+    if (HPX_UNLIKELY(nullptr == threads::get_self_ptr()))
+    {
+        // reschedule this call as an HPX thread
+        lcos::future<std::vector<std::int64_t> > (
+                addressing_service::*incref_many_ptr)(
+            std::vector<std::pair<naming::gid_type, std::int64_t> > const&
+        ) = &addressing_service::incref_many;
+
+        return async(incref_many_ptr, this, requests);
+    }
+
+    for (auto const& req : requests)
+    {
+        if (HPX_UNLIKELY(0 >= req.second))
+        {
+            HPX_THROW_EXCEPTION(bad_parameter
+              , "addressing_service::incref_many"
+              , boost::str(boost::format("invalid credit count of %1%")
+                    % req.second));
+            return lcos::future<std::vector<std::int64_t> >();
+        }
+    }
+
+    // The pending decrefs are matched with the given increfs exactly as in
+    // incref_async, the remaining increfs are collected for each locality.
+    typedef std::map<
+            naming::gid_type,
+            std::pair<
+                std::vector<primary_namespace::credit_request_type>,
+                std::vector<std::size_t>
+            >
+        > requests_type;
+    requests_type increfs;
+
+    std::vector<std::int64_t> pending_decrefs(requests.size(), 0);
+
+    {
+        std::lock_guard<mutex_type> l(refcnt_requests_mtx_);
+
+        typedef refcnt_requests_type::iterator iterator;
+
+        for (std::size_t i = 0; i != requests.size(); ++i)
+        {
+            naming::gid_type raw(
+                naming::detail::get_stripped_gid(requests[i].first));
+            std::int64_t credit = requests[i].second;
+
+            iterator matches = refcnt_requests_->find(raw);
+            if (matches != refcnt_requests_->end())
+            {
+                pending_decrefs[i] = matches->second;
+                matches->second += credit;
+
+                if (matches->second == 0)
+                {
+                    refcnt_requests_->erase(matches);
+                    continue;
+                }
+                else if (matches->second < 0)
+                {
+                    continue;
+                }
+
+                credit = matches->second;
+                refcnt_requests_->erase(matches);
+            }
+
+            auto& data =
+                increfs[primary_namespace::get_service_instance(raw)];
+            data.first.push_back(hpx::util::make_tuple(credit, raw, raw));
+            data.second.push_back(i);
+        }
+    }
+
+    // send requests to all localities
+    std::vector<lcos::future<std::vector<std::int64_t> > > lazy_results;
+    std::vector<std::vector<std::size_t> > indices;
+    lazy_results.reserve(increfs.size());
+    indices.reserve(increfs.size());
+
+    using util::placeholders::_1;
+    for (auto& data : increfs)
+    {
+        std::vector<std::int64_t> compensated_credits;
+        compensated_credits.reserve(data.second.second.size());
+        for (std::size_t i : data.second.second)
+            compensated_credits.push_back(pending_decrefs[i]);
+
+        lcos::future<std::vector<std::int64_t> > f =
+            primary_ns_.increment_credits(std::move(data.second.first));
+
+        // pass the amount of compensated decrefs to the callback
+        lazy_results.push_back(f.then(util::bind(
+                util::one_shot(&addressing_service::incref_many_postproc),
+                this, _1, std::move(compensated_credits)
+            )));
+        indices.push_back(std::move(data.second.second));
+    }
+
+    if (lazy_results.empty())
+    {
+        // no need to talk to AGAS, acknowledge the increfs immediately
+        return hpx::make_ready_future(std::move(pending_decrefs));
+    }
+
+    return hpx::when_all(lazy_results).then(util::bind(
+            util::one_shot(&scatter_results<std::int64_t>),
+            _1, std::move(indices), std::move(pending_decrefs)
+        ));
+} // }}}
+
+void addressing_service::decref_many(
+    std::vector<std::pair<naming::gid_type, std::int64_t> > const& requests
+  , error_code& ec
+    )
+{ // {{{ decref_many implementation
+    if (HPX_UNLIKELY(nullptr == threads::get_self_ptr()))
+    {
+        // reschedule this call as an HPX thread
+        void (addressing_service::*decref_many_ptr)(
+            std::vector<std::pair<naming::gid_type, std::int64_t> > const&
+          , error_code&
+        ) = &addressing_service::decref_many;
+
+        threads::register_thread_nullary(
+            util::deferred_call(decref_many_ptr, this, requests,
+                std::ref(throws)),
+            "addressing_service::decref_many", threads::pending, true,
+            threads::thread_priority_normal, std::size_t(-1),
+            threads::thread_stacksize_default, ec);
+
+        return;
+    }
+
+    for (auto const& req : requests)
+    {
+        if (HPX_UNLIKELY(req.second <= 0))
+        {
+            HPX_THROWS_IF(ec, bad_parameter
+              , "addressing_service::decref_many"
+              , boost::str(boost::format("invalid credit count of %1%")
+                    % req.second));
+            return;
+        }
+    }
+
+    if (requests.empty())
+    {
+        if (&ec != &throws)
+            ec = make_success_code();
+        return;
+    }
+
+    try {
+        std::unique_lock<mutex_type> l(refcnt_requests_mtx_);
+
+        // Match the decref requests with entries in the incref table
+        typedef refcnt_requests_type::iterator iterator;
+        typedef refcnt_requests_type::value_type mapping;
+
+        for (auto const& req : requests)
+        {
+            naming::gid_type raw(naming::detail::get_stripped_gid(req.first));
+
+            iterator matches = refcnt_requests_->find(raw);
+            if (matches != refcnt_requests_->end())
+            {
+                matches->second -= req.second;
+            }
+            else
+            {
+                std::pair<iterator, bool> p =
+                    refcnt_requests_->insert(mapping(raw, -req.second));
+
+                if (HPX_UNLIKELY(!p.second))
+                {
+                    l.unlock();
+
+                    HPX_THROWS_IF(ec, bad_parameter
+                      , "addressing_service::decref_many"
+                      , boost::str(boost::format("couldn't insert decref "
+                            "request for %1% (%2%)") % raw % req.second));
+                    return;
+                }
+            }
+        }
+
+        // all requests but the last one are accounted for here, the last
+        // one is accounted for by send_refcnt_requests
+        refcnt_requests_count_ += requests.size() - 1;
+        if (enable_refcnt_caching_ &&
+            refcnt_requests_count_ >= max_refcnt_requests_)
+        {
+            send_refcnt_requests_non_blocking(l, ec);
+        }
+        else
+        {
+            send_refcnt_requests(l, ec);
+        }
+    }
+    catch (hpx::exception const& e) {
+        HPX_RETHROWS_IF(ec, e, "addressing_service::decref_many");
+    }
+} // }}}
+
 ///////////////////////////////////////////////////////////////////////////////
 bool addressing_service::register_name(
     std::string const& name
@@ -1856,7 +2364,7 @@ void addressing_service::update_cache_entry(
         const gva_cache_key key(gid, count);
 
         {
-            std::unique_lock<mutex_type> lock(gva_cache_mtx_);
+            std::unique_lock<gva_cache_mutex_type> lock(gva_cache_mtx_);
             if (!gva_cache_->update_if(key, g, check_for_collisions))
             {
                 if (LAGAS_ENABLED(warning))
@@ -1909,7 +2417,7 @@ bool addressing_service::get_cache_entry(
     gva_cache_key k(gid);
     gva_cache_key idbase_key;
 
-    std::unique_lock<mutex_type> lock(gva_cache_mtx_);
+    std::unique_lock<gva_cache_mutex_type> lock(gva_cache_mtx_);
     if(gva_cache_->get_entry(k, idbase_key, gva))
     {
         const std::uint64_t id_msb =
@@ -1946,7 +2454,7 @@ void addressing_service::clear_cache(
     try {
         LAGAS_(warning) << "addressing_service::clear_cache, clearing cache";
 
-        std::lock_guard<mutex_type> lock(gva_cache_mtx_);
+        std::lock_guard<gva_cache_mutex_type> lock(gva_cache_mtx_);
 
         gva_cache_->clear();
 
@@ -1993,7 +2501,7 @@ void addressing_service::remove_cache_entry(
     try {
         LAGAS_(warning) << "addressing_service::remove_cache_entry";
 
-        std::lock_guard<mutex_type> lock(gva_cache_mtx_);
+        std::lock_guard<gva_cache_mutex_type> lock(gva_cache_mtx_);
 
         gva_cache_->erase(
             [&gid](std::pair<gva_cache_key, gva> const& p)
@@ -2144,80 +2652,80 @@ namespace detail
 // Helper functions to access the current cache statistics
 std::uint64_t addressing_service::get_cache_entries(bool reset)
 {
-    std::lock_guard<mutex_type> lock(gva_cache_mtx_);
+    std::lock_guard<gva_cache_mutex_type> lock(gva_cache_mtx_);
     return gva_cache_->size();
 }
 
 std::uint64_t addressing_service::get_cache_hits(bool reset)
 {
-    std::lock_guard<mutex_type> lock(gva_cache_mtx_);
+    std::lock_guard<gva_cache_mutex_type> lock(gva_cache_mtx_);
     return gva_cache_->get_statistics().hits(reset);
 }
 
 std::uint64_t addressing_service::get_cache_misses(bool reset)
 {
-    std::lock_guard<mutex_type> lock(gva_cache_mtx_);
+    std::lock_guard<gva_cache_mutex_type> lock(gva_cache_mtx_);
     return gva_cache_->get_statistics().misses(reset);
 }
 
 std::uint64_t addressing_service::get_cache_evictions(bool reset)
 {
-    std::lock_guard<mutex_type> lock(gva_cache_mtx_);
+    std::lock_guard<gva_cache_mutex_type> lock(gva_cache_mtx_);
     return gva_cache_->get_statistics().evictions(reset);
 }
 
 std::uint64_t addressing_service::get_cache_insertions(bool reset)
 {
-    std::lock_guard<mutex_type> lock(gva_cache_mtx_);
+    std::lock_guard<gva_cache_mutex_type> lock(gva_cache_mtx_);
     return gva_cache_->get_statistics().insertions(reset);
 }
 
 ///////////////////////////////////////////////////////////////////////////////
 std::uint64_t addressing_service::get_cache_get_entry_count(bool reset)
 {
-    std::lock_guard<mutex_type> lock(gva_cache_mtx_);
+    std::lock_guard<gva_cache_mutex_type> lock(gva_cache_mtx_);
     return gva_cache_->get_statistics().get_get_entry_count(reset);
 }
 
 std::uint64_t addressing_service::get_cache_insertion_entry_count(bool reset)
 {
-    std::lock_guard<mutex_type> lock(gva_cache_mtx_);
+    std::lock_guard<gva_cache_mutex_type> lock(gva_cache_mtx_);
     return gva_cache_->get_statistics().get_insert_entry_count(reset);
 }
 
 std::uint64_t addressing_service::get_cache_update_entry_count(bool reset)
 {
-    std::lock_guard<mutex_type> lock(gva_cache_mtx_);
+    std::lock_guard<gva_cache_mutex_type> lock(gva_cache_mtx_);
     return gva_cache_->get_statistics().get_update_entry_count(reset);
 }
 
 std::uint64_t addressing_service::get_cache_erase_entry_count(bool reset)
 {
-    std::lock_guard<mutex_type> lock(gva_cache_mtx_);
+    std::lock_guard<gva_cache_mutex_type> lock(gva_cache_mtx_);
     return gva_cache_->get_statistics().get_erase_entry_count(reset);
 }
 
 std::uint64_t addressing_service::get_cache_get_entry_time(bool reset)
 {
-    std::lock_guard<mutex_type> lock(gva_cache_mtx_);
+    std::lock_guard<gva_cache_mutex_type> lock(gva_cache_mtx_);
     return gva_cache_->get_statistics().get_get_entry_time(reset);
 }
 
 std::uint64_t addressing_service::get_cache_insertion_entry_time(bool reset)
 {
-    std::lock_guard<mutex_type> lock(gva_cache_mtx_);
+    std::lock_guard<gva_cache_mutex_type> lock(gva_cache_mtx_);
     return gva_cache_->get_statistics().get_insert_entry_time(reset);
 }
 
 std::uint64_t addressing_service::get_cache_update_entry_time(bool reset)
 {
-    std::lock_guard<mutex_type> lock(gva_cache_mtx_);
+    std::lock_guard<gva_cache_mutex_type> lock(gva_cache_mtx_);
     return gva_cache_->get_statistics().get_update_entry_time(reset);
 }
 
 std::uint64_t addressing_service::get_cache_erase_entry_time(bool reset)
 {
-    std::lock_guard<mutex_type> lock(gva_cache_mtx_);
+    std::lock_guard<gva_cache_mutex_type> lock(gva_cache_mtx_);
     return gva_cache_->get_statistics().get_erase_entry_time(reset);
 }
 
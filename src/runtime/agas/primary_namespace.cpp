@@ -43,6 +43,11 @@ HPX_REGISTER_ACTION_ID(
     primary_namespace_bind_gid_action,
     hpx::actions::primary_namespace_bind_gid_action_id)
 
+HPX_REGISTER_ACTION_ID(
+    primary_namespace::bind_gids_action,
+    primary_namespace_bind_gids_action,
+    hpx::actions::primary_namespace_bind_gids_action_id)
+
 HPX_REGISTER_ACTION_ID(
     primary_namespace::begin_migration_action,
     primary_namespace_begin_migration_action,
@@ -63,11 +68,21 @@ HPX_REGISTER_ACTION_ID(
     primary_namespace_increment_credit_action,
     hpx::actions::primary_namespace_increment_credit_action_id)
 
+HPX_REGISTER_ACTION_ID(
+    primary_namespace::increment_credits_action,
+    primary_namespace_increment_credits_action,
+    hpx::actions::primary_namespace_increment_credits_action_id)
+
 HPX_REGISTER_ACTION_ID(
     primary_namespace::resolve_gid_action,
     primary_namespace_resolve_gid_action,
     hpx::actions::primary_namespace_resolve_gid_action_id)
 
+HPX_REGISTER_ACTION_ID(
+    primary_namespace::resolve_gids_action,
+    primary_namespace_resolve_gids_action,
+    hpx::actions::primary_namespace_resolve_gids_action_id)
+
 HPX_REGISTER_ACTION_ID(
     primary_namespace::colocate_action,
     primary_namespace_colocate_action,
@@ -96,6 +111,10 @@ HPX_REGISTER_BASE_LCO_WITH_VALUE_ID(
     gva_tuple_type, gva_tuple,
     hpx::actions::base_lco_with_value_gva_tuple_get,
     hpx::actions::base_lco_with_value_gva_tuple_set)
+HPX_REGISTER_BASE_LCO_WITH_VALUE_ID(
+    std::vector<gva_tuple_type>, vector_gva_tuple,
+    hpx::actions::base_lco_with_value_vector_gva_tuple_get,
+    hpx::actions::base_lco_with_value_vector_gva_tuple_set)
 HPX_REGISTER_BASE_LCO_WITH_VALUE_ID(
     std_pair_address_id_type, std_pair_address_id_type,
     hpx::actions::base_lco_with_value_std_pair_address_id_type_get,
@@ -311,6 +330,58 @@ namespace hpx { namespace agas {
         return hpx::async(action, std::move(dest), credits, lower, upper);
     }
 
+    future<std::vector<bool> > primary_namespace::bind_gids_async(
+        std::vector<bind_gid_request_type> requests)
+    {
+        if (requests.empty())
+            return hpx::make_ready_future(std::vector<bool>());
+
+        naming::id_type dest = naming::id_type(
+            get_service_instance(hpx::util::get<1>(requests.front())),
+            naming::id_type::unmanaged);
+        if (naming::get_locality_from_gid(dest.get_gid()) == hpx::get_locality())
+        {
+            return hpx::make_ready_future(
+                server_->bind_gids(std::move(requests)));
+        }
+        server::primary_namespace::bind_gids_action action;
+        return hpx::async(action, std::move(dest), std::move(requests));
+    }
+
+    future<std::vector<primary_namespace::resolved_type> >
+    primary_namespace::resolve_full(std::vector<naming::gid_type> ids)
+    {
+        if (ids.empty())
+            return hpx::make_ready_future(std::vector<resolved_type>());
+
+        naming::id_type dest = naming::id_type(
+            get_service_instance(ids.front()), naming::id_type::unmanaged);
+        if (naming::get_locality_from_gid(dest.get_gid()) == hpx::get_locality())
+        {
+            return hpx::make_ready_future(server_->resolve_gids(std::move(ids)));
+        }
+        server::primary_namespace::resolve_gids_action action;
+        return hpx::async(action, std::move(dest), std::move(ids));
+    }
+
+    future<std::vector<std::int64_t> > primary_namespace::increment_credits(
+        std::vector<credit_request_type> requests)
+    {
+        if (requests.empty())
+            return hpx::make_ready_future(std::vector<std::int64_t>());
+
+        naming::id_type dest = naming::id_type(
+            get_service_instance(hpx::util::get<1>(requests.front())),
+            naming::id_type::unmanaged);
+        if (naming::get_locality_from_gid(dest.get_gid()) == hpx::get_locality())
+        {
+            return hpx::make_ready_future(
+                server_->increment_credits(std::move(requests)));
+        }
+        server::primary_namespace::increment_credits_action action;
+        return hpx::async(action, std::move(dest), std::move(requests));
+    }
+
     std::pair<naming::gid_type, naming::gid_type>
     primary_namespace::allocate(std::uint64_t count)
     {
@@ -221,6 +221,49 @@ serialization::binary_filter* primary_namespace::get_serialization_filter(
     return routed_p.get_serialization_filter();
 }
 
+///////////////////////////////////////////////////////////////////////////////
+// Ids are assigned to the shards in blocks of consecutive ids, Fibonacci
+// hashing spreads consecutive blocks over all shards.
+std::size_t primary_namespace::get_shard(naming::gid_type const& id)
+{
+    std::uint64_t const block = id.get_msb() * 0xff51afd7ed558ccdull +
+        (id.get_lsb() >> shard_block_bits);
+    return static_cast<std::size_t>(
+        (block * 0x9e3779b97f4a7c15ull) >> (64 - 6)) % num_shards;
+}
+
+// A GVA range is wide if it spans more than one block of ids
+bool primary_namespace::is_wide_range(
+    naming::gid_type const& id
+  , std::uint64_t count
+    )
+{
+    if (count <= 1)
+        return false;
+
+    naming::gid_type const upper(id + (count - 1));
+    return upper.get_msb() != id.get_msb() ||
+        (upper.get_lsb() >> shard_block_bits) !=
+            (id.get_lsb() >> shard_block_bits);
+}
+
+// Return the entry of the given table which covers the given id.
+primary_namespace::gva_table_type::iterator primary_namespace::find_range(
+    gva_table_type& gvas
+  , naming::gid_type const& id
+    )
+{
+    gva_table_type::iterator it = gvas.upper_bound(id);
+    if (it == gvas.begin())
+        return gvas.end();
+
+    --it;
+    if (it->first == id || (it->first + it->second.first.count) > id)
+        return it;
+
+    return gvas.end();
+}
+
 // start migration of the given object
 std::pair<naming::id_type, naming::address>
 primary_namespace::begin_migration(naming::gid_type id)
@@ -231,13 +274,9 @@ primary_namespace::begin_migration(naming::gid_type id)
     counter_data_.increment_begin_migration_count();
     using hpx::util::get;
 
-    std::unique_lock<mutex_type> l(mutex_);
-
-    resolved_type r = resolve_gid_locked(l, id, hpx::throws);
+    resolved_type r = resolve_gid_impl(id, hpx::throws);
     if (get<0>(r) == naming::invalid_gid)
     {
-        l.unlock();
-
         LAGAS_(info) << (boost::format(
             "primary_namespace::begin_migration, gid(%1%), response(no_success)")
             % id);
@@ -245,18 +284,25 @@ primary_namespace::begin_migration(naming::gid_type id)
         return std::make_pair(naming::invalid_id, naming::address());
     }
 
-    migration_table_type::iterator it = migrating_objects_.find(id);
-    if (it == migrating_objects_.end())
     {
-        std::pair<migration_table_type::iterator, bool> p =
-            migrating_objects_.emplace(std::piecewise_construct,
-                std::forward_as_tuple(id), std::forward_as_tuple());
-        HPX_ASSERT(p.second);
-        it = p.first;
-    }
+        std::lock_guard<mutex_type> l(migration_mtx_);
 
-    // flag this id as being migrated
-    hpx::util::get<0>(it->second) = true; //-V601
+        migration_table_type::iterator it = migrating_objects_.find(id);
+        if (it == migrating_objects_.end())
+        {
+            std::pair<migration_table_type::iterator, bool> p =
+                migrating_objects_.emplace(std::piecewise_construct,
+                    std::forward_as_tuple(id), std::forward_as_tuple());
+            HPX_ASSERT(p.second);
+            it = p.first;
+
+            migrating_objects_count_.store(migrating_objects_.size(),
+                boost::memory_order_release);
+        }
+
+        // flag this id as being migrated
+        hpx::util::get<0>(it->second) = true; //-V601
+    }
 
     gva const& g(hpx::util::get<1>(r));
     naming::address addr(g.prefix, g.type, g.lva());
@@ -272,7 +318,7 @@ bool primary_namespace::end_migration(naming::gid_type id)
     );
     counter_data_.increment_end_migration_count();
 
-    std::unique_lock<mutex_type> l(mutex_);
+    std::unique_lock<mutex_type> l(migration_mtx_);
 
     using hpx::util::get;
 
@@ -289,10 +335,30 @@ bool primary_namespace::end_migration(naming::gid_type id)
     // flag this id as not being migrated anymore
     get<0>(it->second) = false;
 
+    // the entry is removed by the last waiting thread, if any
+    if (get<1>(it->second) == 0)
+    {
+        migrating_objects_.erase(it);
+        migrating_objects_count_.store(migrating_objects_.size(),
+            boost::memory_order_release);
+    }
+
     return true;
 }
 
 // wait if given object is currently being migrated
+void primary_namespace::wait_for_migration(
+    naming::gid_type id
+  , error_code& ec)
+{
+    // avoid acquiring the lock if no object is being migrated
+    if (migrating_objects_count_.load(boost::memory_order_acquire) == 0)
+        return;
+
+    std::unique_lock<mutex_type> l(migration_mtx_);
+    wait_for_migration_locked(l, id, ec);
+}
+
 void primary_namespace::wait_for_migration_locked(
     std::unique_lock<mutex_type>& l
   , naming::gid_type id
@@ -310,7 +376,11 @@ void primary_namespace::wait_for_migration_locked(
         get<2>(it->second).wait(l, ec);
 
         if (--get<1>(it->second) == 0 && !get<0>(it->second))
+        {
             migrating_objects_.erase(it);
+            migrating_objects_count_.store(migrating_objects_.size(),
+                boost::memory_order_release);
+        }
     }
 }
 
@@ -328,11 +398,53 @@ bool primary_namespace::bind_gid(
 
     naming::detail::strip_internal_bits_from_gid(id);
 
-    std::unique_lock<mutex_type> l(mutex_);
+    bool const wide = is_wide_range(id, g.count);
+
+    gva_shard& shard = gva_shards_[get_shard(id)];
+    std::unique_lock<mutex_type> l(shard.mutex_);
+
+    // The new id might be covered by a wide range (or vice versa), in which
+    // case the table of wide ranges has to be locked as well.
+    std::unique_lock<mutex_type> wl(wide_gvas_mtx_, std::defer_lock);
+    if (wide || wide_gvas_count_.load(boost::memory_order_acquire) != 0)
+        wl.lock();
+
+    auto unlock_all = [&]()
+    {
+        if (wl.owns_lock())
+            wl.unlock();
+        l.unlock();
+    };
+
+    gva_table_type& gvas = wide ? wide_gvas_ : shard.gvas_;
+
+    // Check that no range of the other kind covers the new id.
+    gva_table_type* other = wide ? &shard.gvas_ :
+        (wl.owns_lock() ? &wide_gvas_ : nullptr);
+    if (other != nullptr)
+    {
+        gva_table_type::iterator it = find_range(*other, id);
+        if (HPX_UNLIKELY(it != other->end()))
+        {
+            unlock_all();
+
+            // REVIEW: Is this the right error code to use?
+            if (it->first == id)
+            {
+                HPX_THROW_EXCEPTION(bad_parameter
+                  , "primary_namespace::bind_gid"
+                  , "cannot change block size of existing binding");
+            }
+
+            HPX_THROW_EXCEPTION(bad_parameter
+              , "primary_namespace::bind_gid"
+              , "the new GID is contained in an existing range");
+        }
+    }
 
-    gva_table_type::iterator it = gvas_.lower_bound(id)
-                           , begin = gvas_.begin()
-                           , end = gvas_.end();
+    gva_table_type::iterator it = gvas.lower_bound(id)
+                           , begin = gvas.begin()
+                           , end = gvas.end();
 
     if (it != end)
     {
@@ -348,7 +460,7 @@ bool primary_namespace::bind_gid(
             if (HPX_UNLIKELY(gaddr.count != g.count))
             {
                 // REVIEW: Is this the right error code to use?
-                l.unlock();
+                unlock_all();
 
                 HPX_THROW_EXCEPTION(bad_parameter
                   , "primary_namespace::bind_gid"
@@ -357,7 +469,7 @@ bool primary_namespace::bind_gid(
 
             if (HPX_UNLIKELY(components::component_invalid == g.type))
             {
-                l.unlock();
+                unlock_all();
 
                 HPX_THROW_EXCEPTION(bad_parameter
                   , "primary_namespace::bind_gid"
@@ -369,7 +481,7 @@ bool primary_namespace::bind_gid(
 
             if (HPX_UNLIKELY(!locality))
             {
-                l.unlock();
+                unlock_all();
 
                 HPX_THROW_EXCEPTION(bad_parameter
                   , "primary_namespace::bind_gid"
@@ -386,7 +498,7 @@ bool primary_namespace::bind_gid(
             gaddr.offset = g.offset;
             loc = locality;
 
-            l.unlock();
+            unlock_all();
 
             LAGAS_(info) << (boost::format(
                 "primary_namespace::bind_gid, gid(%1%), gva(%2%), "
@@ -406,7 +518,7 @@ bool primary_namespace::bind_gid(
             if (HPX_UNLIKELY((it->first + it->second.first.count) > id))
             {
                 // REVIEW: Is this the right error code to use?
-                l.unlock();
+                unlock_all();
 
                 HPX_THROW_EXCEPTION(bad_parameter
                   , "primary_namespace::bind_gid"
@@ -415,7 +527,7 @@ bool primary_namespace::bind_gid(
         }
     }
 
-    else if (HPX_LIKELY(!gvas_.empty()))
+    else if (HPX_LIKELY(!gvas.empty()))
     {
         --it;
 
@@ -423,7 +535,7 @@ bool primary_namespace::bind_gid(
         if ((it->first + it->second.first.count) > id)
         {
             // REVIEW: Is this the right error code to use?
-            l.unlock();
+            unlock_all();
 
             HPX_THROW_EXCEPTION(bad_parameter
               , "primary_namespace::bind_gid"
@@ -435,7 +547,7 @@ bool primary_namespace::bind_gid(
 
     if (HPX_UNLIKELY(id.get_msb() != upper_bound.get_msb()))
     {
-        l.unlock();
+        unlock_all();
 
         HPX_THROW_EXCEPTION(internal_server_error
           , "primary_namespace::bind_gid"
@@ -444,7 +556,7 @@ bool primary_namespace::bind_gid(
 
     if (HPX_UNLIKELY(components::component_invalid == g.type))
     {
-        l.unlock();
+        unlock_all();
 
         HPX_THROW_EXCEPTION(bad_parameter
           , "primary_namespace::bind_gid"
@@ -455,10 +567,10 @@ bool primary_namespace::bind_gid(
     }
 
     // Insert a GID -> GVA entry into the GVA table.
-    if (HPX_UNLIKELY(!util::insert_checked(gvas_.insert(
+    if (HPX_UNLIKELY(!util::insert_checked(gvas.insert(
             std::make_pair(id, std::make_pair(g, locality))))))
     {
-        l.unlock();
+        unlock_all();
 
         HPX_THROW_EXCEPTION(lock_error
           , "primary_namespace::bind_gid"
@@ -468,7 +580,33 @@ bool primary_namespace::bind_gid(
                 % id % g % locality));
     }
 
-    l.unlock();
+    if (wide)
+    {
+        // this store is ordered with the load below, either a concurrent
+        // bind of a narrow range sees the new wide range or the wide range
+        // has been bound after the narrow one
+        wide_gvas_count_.store(wide_gvas_.size(),
+            boost::memory_order_seq_cst);
+    }
+    else if (!wl.owns_lock() &&
+        wide_gvas_count_.load(boost::memory_order_seq_cst) != 0)
+    {
+        // A wide range covering the new id might have been bound since the
+        // table of wide ranges was found empty above, re-check under the
+        // wide lock.
+        wl.lock();
+        if (HPX_UNLIKELY(find_range(wide_gvas_, id) != wide_gvas_.end()))
+        {
+            gvas.erase(id);
+            unlock_all();
+
+            HPX_THROW_EXCEPTION(bad_parameter
+              , "primary_namespace::bind_gid"
+              , "the new GID is contained in an existing range");
+        }
+    }
+
+    unlock_all();
 
     LAGAS_(info) << (boost::format(
         "primary_namespace::bind_gid, gid(%1%), gva(%2%), locality(%3%)")
@@ -485,17 +623,11 @@ primary_namespace::resolved_type primary_namespace::resolve_gid(naming::gid_type
     counter_data_.increment_resolve_gid_count();
     using hpx::util::get;
 
-    resolved_type r;
-
-    {
-        std::unique_lock<mutex_type> l(mutex_);
-
-        // wait for any migration to be completed
-        wait_for_migration_locked(l, id, hpx::throws);
+    // wait for any migration to be completed
+    wait_for_migration(id, hpx::throws);
 
-        // now, resolve the id
-        r = resolve_gid_locked(l, id, hpx::throws);
-    }
+    // now, resolve the id
+    resolved_type r = resolve_gid_impl(id, hpx::throws);
 
     if (get<0>(r) == naming::invalid_gid)
     {
@@ -532,16 +664,35 @@ naming::address primary_namespace::unbind_gid(
 
     naming::detail::strip_internal_bits_from_gid(id);
 
-    std::unique_lock<mutex_type> l(mutex_);
+    gva_shard& shard = gva_shards_[get_shard(id)];
+    std::unique_lock<mutex_type> l(shard.mutex_);
 
-    gva_table_type::iterator it = gvas_.find(id)
-                           , end = gvas_.end();
+    std::unique_lock<mutex_type> wl(wide_gvas_mtx_, std::defer_lock);
+    if (wide_gvas_count_.load(boost::memory_order_acquire) != 0)
+        wl.lock();
 
-    if (it != end)
+    auto unlock_all = [&]()
+    {
+        if (wl.owns_lock())
+            wl.unlock();
+        l.unlock();
+    };
+
+    // the binding is stored in the table of wide ranges if the range spans
+    // more than one block of ids
+    gva_table_type* gvas = &shard.gvas_;
+    gva_table_type::iterator it = gvas->find(id);
+    if (it == gvas->end() && wl.owns_lock())
+    {
+        gvas = &wide_gvas_;
+        it = gvas->find(id);
+    }
+
+    if (it != gvas->end())
     {
         if (HPX_UNLIKELY(it->second.first.count != count))
         {
-            l.unlock();
+            unlock_all();
 
             HPX_THROW_EXCEPTION(bad_parameter
               , "primary_namespace::unbind_gid"
@@ -550,9 +701,14 @@ naming::address primary_namespace::unbind_gid(
 
         gva_table_data_type data = it->second;
 
-        gvas_.erase(it);
+        gvas->erase(it);
+        if (gvas == &wide_gvas_)
+        {
+            wide_gvas_count_.store(wide_gvas_.size(),
+                boost::memory_order_release);
+        }
 
-        l.unlock();
+        unlock_all();
         LAGAS_(info) << (boost::format(
             "primary_namespace::unbind_gid, gid(%1%), count(%2%), gva(%3%), "
             "locality_id(%4%)")
@@ -562,7 +718,7 @@ naming::address primary_namespace::unbind_gid(
         return naming::address(g.prefix, g.type, g.lva());
     }
 
-    l.unlock();
+    unlock_all();
 
     LAGAS_(info) << (boost::format(
         "primary_namespace::unbind_gid, gid(%1%), count(%2%), "
@@ -652,6 +808,58 @@ std::vector<std::int64_t> primary_namespace::decrement_credit(
     return res_credits;
 }
 
+///////////////////////////////////////////////////////////////////////////////
+// The bulk operations handle each of the requests separately, they merely
+// avoid a round trip per request.
+std::vector<bool> primary_namespace::bind_gids(
+    std::vector<
+        hpx::util::tuple<gva, naming::gid_type, naming::gid_type>
+    > requests
+    )
+{
+    std::vector<bool> results;
+    results.reserve(requests.size());
+
+    for (auto const& req : requests)
+    {
+        results.push_back(bind_gid(hpx::util::get<0>(req),
+            hpx::util::get<1>(req), hpx::util::get<2>(req)));
+    }
+
+    return results;
+}
+
+std::vector<primary_namespace::resolved_type> primary_namespace::resolve_gids(
+    std::vector<naming::gid_type> ids
+    )
+{
+    std::vector<resolved_type> results;
+    results.reserve(ids.size());
+
+    for (naming::gid_type const& id : ids)
+        results.push_back(resolve_gid(id));
+
+    return results;
+}
+
+std::vector<std::int64_t> primary_namespace::increment_credits(
+    std::vector<
+        hpx::util::tuple<std::int64_t, naming::gid_type, naming::gid_type>
+    > requests
+    )
+{
+    std::vector<std::int64_t> res_credits;
+    res_credits.reserve(requests.size());
+
+    for (auto const& req : requests)
+    {
+        res_credits.push_back(increment_credit(hpx::util::get<0>(req),
+            hpx::util::get<1>(req), hpx::util::get<2>(req)));
+    }
+
+    return res_credits;
+}
+
 std::pair<naming::gid_type, naming::gid_type> primary_namespace::allocate(
     std::uint64_t count
     )
@@ -717,37 +925,41 @@ std::pair<naming::gid_type, naming::gid_type> primary_namespace::allocate(
 
 #if defined(HPX_HAVE_AGAS_DUMP_REFCNT_ENTRIES)
     void primary_namespace::dump_refcnt_matches(
-        refcnt_table_type::iterator lower_it
-      , refcnt_table_type::iterator upper_it
-      , naming::gid_type const& lower
+        naming::gid_type const& lower
       , naming::gid_type const& upper
-      , std::unique_lock<mutex_type>& l
       , const char* func_name
         )
     { // dump_refcnt_matches implementation
-        HPX_ASSERT(l.owns_lock());
-
-        if (lower_it == refcnts_.end() && upper_it == refcnts_.end())
-            // We got nothing, bail - our caller is probably about to throw.
-            return;
-
         std::stringstream ss;
         ss << (boost::format(
               "%1%, dumping server-side refcnt table matches, lower(%2%), "
               "upper(%3%):")
               % func_name % lower % upper);
 
-        for (/**/; lower_it != upper_it; ++lower_it)
+        naming::gid_type const last = (lower != upper) ? upper : lower + 1;
+
+        bool found = false;
+        for (naming::gid_type raw = lower; raw != last; ++raw)
         {
+            refcnt_shard& shard = refcnt_shards_[get_shard(raw)];
+            std::lock_guard<mutex_type> l(shard.mutex_);
+
+            refcnt_table_type::iterator it = shard.refcnts_.find(raw);
+            if (it == shard.refcnts_.end())
+                continue;
+
             // The [server] tag is in there to make it easier to filter
             // through the logs.
             ss << (boost::format(
                    "\n  [server] lower(%1%), credits(%2%)")
-                   % lower_it->first
-                   % lower_it->second);
+                   % it->first
+                   % it->second);
+            found = true;
         }
 
-        LAGAS_(debug) << ss.str();
+        // We got nothing, bail - our caller is probably about to throw.
+        if (found)
+            LAGAS_(debug) << ss.str();
     } // dump_refcnt_matches implementation
 #endif
 
@@ -759,28 +971,11 @@ void primary_namespace::increment(
   , error_code& ec
     )
 { // {{{ increment implementation
-    std::unique_lock<mutex_type> l(mutex_);
-
 #if defined(HPX_HAVE_AGAS_DUMP_REFCNT_ENTRIES)
     if (LAGAS_ENABLED(debug))
     {
-        typedef refcnt_table_type::iterator iterator;
-
-        // Find the mappings that we're about to touch.
-        refcnt_table_type::iterator lower_it = refcnts_.find(lower);
-        refcnt_table_type::iterator upper_it;
-        if (lower != upper)
-        {
-            upper_it = refcnts_.find(upper);
-        }
-        else
-        {
-            upper_it = lower_it;
-            ++upper_it;
-        }
-
-        dump_refcnt_matches(lower_it, upper_it, lower, upper, l,
-            "primary_namespace::increment");
+        // Dump the mappings that we're about to touch.
+        dump_refcnt_matches(lower, upper, "primary_namespace::increment");
     }
 #endif
 
@@ -796,14 +991,18 @@ void primary_namespace::increment(
 
     for (naming::gid_type raw = lower; raw != upper; ++raw)
     {
-        refcnt_table_type::iterator it = refcnts_.find(raw);
-        if (it == refcnts_.end())
+        refcnt_shard& shard = refcnt_shards_[get_shard(raw)];
+        std::unique_lock<mutex_type> l(shard.mutex_);
+
+        refcnt_table_type::iterator it = shard.refcnts_.find(raw);
+        if (it == shard.refcnts_.end())
         {
             std::int64_t count =
                 std::int64_t(HPX_GLOBALCREDIT_INITIAL) + credits;
 
             std::pair<refcnt_table_type::iterator, bool> p =
-                refcnts_.insert(refcnt_table_type::value_type(raw, count));
+                shard.refcnts_.insert(
+                    refcnt_table_type::value_type(raw, count));
             if (!p.second)
             {
                 l.unlock();
@@ -835,39 +1034,27 @@ void primary_namespace::increment(
 
 ///////////////////////////////////////////////////////////////////////////////
 void primary_namespace::resolve_free_list(
-    std::unique_lock<mutex_type>& l
-  , std::list<refcnt_table_type::iterator> const& free_list
+    std::list<naming::gid_type> const& free_list
   , std::list<free_entry>& free_entry_list
   , naming::gid_type const& lower
   , naming::gid_type const& upper
   , error_code& ec
     )
 {
-    HPX_ASSERT_OWNS_LOCK(l);
-
     using hpx::util::get;
 
-    typedef refcnt_table_type::iterator iterator;
-
-    for (iterator const& it : free_list)
+    for (naming::gid_type const& gid : free_list)
     {
-        typedef refcnt_table_type::key_type key_type;
-
-        // The mapping's key space.
-        key_type gid = it->first;
-
         // wait for any migration to be completed
-        wait_for_migration_locked(l, gid, ec);
+        wait_for_migration(gid, ec);
 
         // Resolve the query GID.
-        resolved_type r = resolve_gid_locked(l, gid, ec);
+        resolved_type r = resolve_gid_impl(gid, ec);
         if (ec) return;
 
         naming::gid_type& raw = get<0>(r);
         if (raw == naming::invalid_gid)
         {
-            l.unlock();
-
             HPX_THROWS_IF(ec, internal_server_error
                 , "primary_namespace::resolve_free_list"
                 , boost::str(boost::format(
@@ -883,8 +1070,6 @@ void primary_namespace::resolve_free_list(
         // REVIEW: Should we do more to make sure the GVA is valid?
         if (HPX_UNLIKELY(components::component_invalid == g.type))
         {
-            l.unlock();
-
             HPX_THROWS_IF(ec, internal_server_error
                 , "primary_namespace::resolve_free_list"
                 , boost::str(boost::format(
@@ -895,8 +1080,6 @@ void primary_namespace::resolve_free_list(
         }
         else if (HPX_UNLIKELY(0 == g.count))
         {
-            l.unlock();
-
             HPX_THROWS_IF(ec, internal_server_error
                 , "primary_namespace::resolve_free_list"
                 , boost::str(boost::format(
@@ -917,9 +1100,6 @@ void primary_namespace::resolve_free_list(
         // Add the information needed to destroy these components to the
         // free list.
         free_entry_list.push_back(free_entry(resolved, gid, get<2>(r)));
-
-        // remove this entry from the refcnt table
-        refcnts_.erase(it);
     }
 }
 
@@ -939,109 +1119,101 @@ void primary_namespace::decrement_sweep(
 
     free_entry_list.clear();
 
-    {
-        std::unique_lock<mutex_type> l(mutex_);
-
 #if defined(HPX_HAVE_AGAS_DUMP_REFCNT_ENTRIES)
-        if (LAGAS_ENABLED(debug))
-        {
-            typedef refcnt_table_type::iterator iterator;
-
-            // Find the mappings that we just added or modified.
-            refcnt_table_type::iterator lower_it = refcnts_.find(lower);
-            refcnt_table_type::iterator upper_it;
-            if (lower != upper)
-            {
-                upper_it = refcnts_.find(upper);
-            }
-            else
-            {
-                upper_it = lower_it;
-                ++upper_it;
-            }
-
-            dump_refcnt_matches(lower_it, upper_it, lower, upper, l,
-                "primary_namespace::decrement_sweep");
-        }
+    if (LAGAS_ENABLED(debug))
+    {
+        // Dump the mappings that we're about to modify.
+        dump_refcnt_matches(lower, upper,
+            "primary_namespace::decrement_sweep");
+    }
 #endif
 
-        ///////////////////////////////////////////////////////////////////////
-        // Apply the decrement across the entire key space (e.g. [lower, upper]).
-
-        // The third parameter we pass here is the default data to use in case
-        // the key is not mapped. We don't insert GIDs into the refcnt table
-        // when we allocate/bind them, so if a GID is not in the refcnt table,
-        // we know that it's global reference count is the initial global
-        // reference count.
+    ///////////////////////////////////////////////////////////////////////////
+    // Apply the decrement across the entire key space (e.g. [lower, upper]).
+
+    // The third parameter we pass here is the default data to use in case
+    // the key is not mapped. We don't insert GIDs into the refcnt table
+    // when we allocate/bind them, so if a GID is not in the refcnt table,
+    // we know that it's global reference count is the initial global
+    // reference count.
+
+    // Entries whose reference count drops to zero are removed from the
+    // refcnt table right away, their GVAs are resolved below without holding
+    // any lock.
+    std::list<naming::gid_type> free_list;
+    for (naming::gid_type raw = lower; raw != upper; ++raw)
+    {
+        refcnt_shard& shard = refcnt_shards_[get_shard(raw)];
+        std::unique_lock<mutex_type> l(shard.mutex_);
 
-        std::list<refcnt_table_type::iterator> free_list;
-        for (naming::gid_type raw = lower; raw != upper; ++raw)
+        refcnt_table_type::iterator it = shard.refcnts_.find(raw);
+        if (it == shard.refcnts_.end())
         {
-            refcnt_table_type::iterator it = refcnts_.find(raw);
-            if (it == refcnts_.end())
+            if (credits > std::int64_t(HPX_GLOBALCREDIT_INITIAL))
             {
-                if (credits > std::int64_t(HPX_GLOBALCREDIT_INITIAL))
-                {
-                    l.unlock();
-
-                    HPX_THROWS_IF(ec, invalid_data
-                      , "primary_namespace::decrement_sweep"
-                      , boost::str(boost::format(
-                            "negative entry in reference count table, raw(%1%), "
-                            "refcount(%2%)")
-                            % raw
-                            % (std::int64_t(HPX_GLOBALCREDIT_INITIAL) - credits)));
-                    return;
-                }
-
-                std::int64_t count =
-                    std::int64_t(HPX_GLOBALCREDIT_INITIAL) - credits;
-
-                std::pair<refcnt_table_type::iterator, bool> p =
-                    refcnts_.insert(refcnt_table_type::value_type(raw, count));
-                if (!p.second)
-                {
-                    l.unlock();
-
-                    HPX_THROWS_IF(ec, invalid_data
-                      , "primary_namespace::decrement_sweep"
-                      , boost::str(boost::format(
-                            "couldn't create entry in reference count table, "
-                            "raw(%1%), ref-count(%3%)")
-                            % raw % count));
-                    return;
-                }
+                l.unlock();
 
-                it = p.first;
-            }
-            else
-            {
-                it->second -= credits;
+                HPX_THROWS_IF(ec, invalid_data
+                  , "primary_namespace::decrement_sweep"
+                  , boost::str(boost::format(
+                        "negative entry in reference count table, raw(%1%), "
+                        "refcount(%2%)")
+                        % raw
+                        % (std::int64_t(HPX_GLOBALCREDIT_INITIAL) - credits)));
+                return;
             }
 
-            // Sanity check.
-            if (it->second < 0)
+            std::int64_t count =
+                std::int64_t(HPX_GLOBALCREDIT_INITIAL) - credits;
+
+            std::pair<refcnt_table_type::iterator, bool> p =
+                shard.refcnts_.insert(
+                    refcnt_table_type::value_type(raw, count));
+            if (!p.second)
             {
                 l.unlock();
 
                 HPX_THROWS_IF(ec, invalid_data
                   , "primary_namespace::decrement_sweep"
                   , boost::str(boost::format(
-                        "negative entry in reference count table, raw(%1%), "
-                        "refcount(%2%)")
-                        % raw % it->second));
+                        "couldn't create entry in reference count table, "
+                        "raw(%1%), ref-count(%3%)")
+                        % raw % count));
                 return;
             }
 
-            // this objects needs to be deleted
-            if (it->second == 0)
-                free_list.push_back(it);
+            it = p.first;
+        }
+        else
+        {
+            it->second -= credits;
+        }
+
+        // Sanity check.
+        if (it->second < 0)
+        {
+            std::int64_t count = it->second;
+            l.unlock();
+
+            HPX_THROWS_IF(ec, invalid_data
+              , "primary_namespace::decrement_sweep"
+              , boost::str(boost::format(
+                    "negative entry in reference count table, raw(%1%), "
+                    "refcount(%2%)")
+                    % raw % count));
+            return;
         }
 
-        // Resolve the objects which have to be deleted.
-        resolve_free_list(l, free_list, free_entry_list, lower, upper, ec);
+        // this objects needs to be deleted
+        if (it->second == 0)
+        {
+            shard.refcnts_.erase(it);
+            free_list.push_back(raw);
+        }
+    }
 
-    } // Unlock the mutex.
+    // Resolve the objects which have to be deleted.
+    resolve_free_list(free_list, free_entry_list, lower, upper, ec);
 
     if (&ec != &throws)
         ec = make_success_code();
@@ -1108,21 +1280,49 @@ void primary_namespace::free_components_sync(
         ec = make_success_code();
 } // }}}
 
+primary_namespace::resolved_type primary_namespace::resolve_gid_impl(
+    naming::gid_type const& gid
+  , error_code& ec
+    )
+{ // {{{ resolve_gid_impl implementation
+    // parameters
+    naming::gid_type id = gid;
+    naming::detail::strip_internal_bits_from_gid(id);
+
+    {
+        gva_shard& shard = gva_shards_[get_shard(id)];
+        std::unique_lock<mutex_type> l(shard.mutex_);
+
+        resolved_type r = resolve_gid_locked(l, shard.gvas_, id, ec);
+        if (ec || hpx::util::get<0>(r) != naming::invalid_gid)
+            return r;
+    }
+
+    // fall back to the table of ranges spanning more than one block
+    if (wide_gvas_count_.load(boost::memory_order_acquire) != 0)
+    {
+        std::unique_lock<mutex_type> l(wide_gvas_mtx_);
+        return resolve_gid_locked(l, wide_gvas_, id, ec);
+    }
+
+    if (&ec != &throws)
+        ec = make_success_code();
+
+    return resolved_type(naming::invalid_gid, gva(), naming::invalid_gid);
+} // }}}
+
 primary_namespace::resolved_type primary_namespace::resolve_gid_locked(
     std::unique_lock<mutex_type>& l
-  , naming::gid_type const& gid
+  , gva_table_type& gvas
+  , naming::gid_type const& id
   , error_code& ec
     )
 { // {{{ resolve_gid_locked implementation
     HPX_ASSERT_OWNS_LOCK(l);
 
-    // parameters
-    naming::gid_type id = gid;
-    naming::detail::strip_internal_bits_from_gid(id);
-
-    gva_table_type::const_iterator it = gvas_.lower_bound(id)
-                                 , begin = gvas_.begin()
-                                 , end = gvas_.end();
+    gva_table_type::const_iterator it = gvas.lower_bound(id)
+                                 , begin = gvas.begin()
+                                 , end = gvas.end();
 
     if (it != end)
     {
@@ -1165,7 +1365,7 @@ primary_namespace::resolved_type primary_namespace::resolve_gid_locked(
         }
     }
 
-    else if (HPX_LIKELY(!gvas_.empty()))
+    else if (HPX_LIKELY(!gvas.empty()))
     {
         --it;
 
@@ -16,7 +16,11 @@ namespace hpx
         detail::async_policy{threads::thread_priority_default};
     const detail::fork_policy launch::fork =
         detail::fork_policy{threads::thread_priority_default};
+    const detail::nostack_policy launch::nostack =
+        detail::nostack_policy{threads::thread_priority_default};
     const detail::sync_policy launch::sync = detail::sync_policy{};
+    const detail::sync_if_cheap_policy launch::sync_if_cheap =
+        detail::sync_if_cheap_policy{threads::thread_priority_default};
     const detail::deferred_policy launch::deferred = detail::deferred_policy{};
     const detail::apply_policy launch::apply = detail::apply_policy{};
 
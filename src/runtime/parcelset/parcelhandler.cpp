@@ -978,6 +978,16 @@ namespace hpx { namespace parcelset
         return pp ? pp->get_connection_cache_statistics(stat_type, reset) : 0;
     }
 
+    // buffer pool statistics
+    std::int64_t parcelhandler::get_buffer_pool_statistics(
+        std::string const& pp_type,
+        parcelport::buffer_pool_statistics_type stat_type, bool reset) const
+    {
+        error_code ec(lightweight);
+        parcelport* pp = find_parcelport(pp_type, ec);
+        return pp ? pp->get_buffer_pool_statistics(stat_type, reset) : 0;
+    }
+
 #if defined(HPX_HAVE_PARCELPORT_ACTION_COUNTERS)
     // same as above, just separated data for each action
     // number of parcels sent
@@ -1045,6 +1055,7 @@ namespace hpx { namespace parcelset
         {
             register_counter_types(pp.second->type());
             register_connection_cache_counter_types(pp.second->type());
+            register_buffer_pool_counter_types(pp.second->type());
         }
 
         using util::placeholders::_1;
@@ -1524,6 +1535,74 @@ namespace hpx { namespace parcelset
 #endif
     }
 
+    // register connection specific performance counters related to the pool
+    // of recycled message buffers
+    void parcelhandler::register_buffer_pool_counter_types(
+        std::string const& pp_type)
+    {
+        using hpx::util::placeholders::_1;
+        using hpx::util::placeholders::_2;
+
+#if defined(HPX_HAVE_NETWORKING)
+        util::function_nonser<std::int64_t(bool)> pool_hits(
+            util::bind(&parcelhandler::get_buffer_pool_statistics,
+                this, pp_type, parcelport::buffer_pool_hits, _1));
+        util::function_nonser<std::int64_t(bool)> pool_misses(
+            util::bind(&parcelhandler::get_buffer_pool_statistics,
+                this, pp_type, parcelport::buffer_pool_misses, _1));
+        util::function_nonser<std::int64_t(bool)> pool_retained_bytes(
+            util::bind(&parcelhandler::get_buffer_pool_statistics,
+                this, pp_type, parcelport::buffer_pool_retained_bytes, _1));
+
+        performance_counters::generic_counter_type_data const
+            buffer_pool_types[] =
+        {
+            { boost::str(boost::format(
+                  "/parcelport/count/%s/buffer-pool-hits") % pp_type),
+              performance_counters::counter_raw,
+              boost::str(boost::format(
+                  "returns the number of message buffers which were taken "
+                  "from the buffer pool for the %s connection type on the "
+                  "referenced locality") % pp_type),
+              HPX_PERFORMANCE_COUNTER_V1,
+              util::bind(&performance_counters::locality_raw_counter_creator,
+                  _1, std::move(pool_hits), _2),
+              &performance_counters::locality_counter_discoverer,
+              ""
+            },
+            { boost::str(boost::format(
+                  "/parcelport/count/%s/buffer-pool-misses") % pp_type),
+              performance_counters::counter_raw,
+              boost::str(boost::format(
+                  "returns the number of message buffers which had to be "
+                  "newly allocated as the buffer pool for the %s connection "
+                  "type on the referenced locality had no matching buffer")
+                  % pp_type),
+              HPX_PERFORMANCE_COUNTER_V1,
+              util::bind(&performance_counters::locality_raw_counter_creator,
+                  _1, std::move(pool_misses), _2),
+              &performance_counters::locality_counter_discoverer,
+              ""
+            },
+            { boost::str(boost::format(
+                  "/parcelport/count/%s/buffer-pool-retained-bytes") % pp_type),
+              performance_counters::counter_raw,
+              boost::str(boost::format(
+                  "returns the number of bytes currently held by the buffer "
+                  "pool for the %s connection type on the referenced "
+                  "locality") % pp_type),
+              HPX_PERFORMANCE_COUNTER_V1,
+              util::bind(&performance_counters::locality_raw_counter_creator,
+                  _1, std::move(pool_retained_bytes), _2),
+              &performance_counters::locality_counter_discoverer,
+              "bytes"
+            }
+        };
+        performance_counters::install_counter_types(buffer_pool_types,
+            sizeof(buffer_pool_types)/sizeof(buffer_pool_types[0]));
+#endif
+    }
+
     std::vector<plugins::parcelport_factory_base *> &
     parcelhandler::get_parcelport_factories()
     {
@@ -1578,6 +1657,11 @@ namespace hpx { namespace parcelset
                 HPX_PP_STRINGIZE(HPX_PARCEL_MAX_MESSAGE_SIZE) "}",
             "max_outbound_message_size = ${HPX_PARCEL_MAX_OUTBOUND_MESSAGE_SIZE:"
                 HPX_PP_STRINGIZE(HPX_PARCEL_MAX_OUTBOUND_MESSAGE_SIZE) "}",
+            "buffer_pool_size = ${HPX_PARCEL_BUFFER_POOL_SIZE:"
+                HPX_PP_STRINGIZE(HPX_PARCEL_BUFFER_POOL_SIZE) "}",
+            "parallel_encoding_segment_size = "
+                "${HPX_PARCEL_PARALLEL_ENCODING_SEGMENT_SIZE:"
+                HPX_PP_STRINGIZE(HPX_PARCEL_PARALLEL_ENCODING_SEGMENT_SIZE) "}",
 #ifdef BOOST_BIG_ENDIAN
             "endian_out = ${HPX_PARCEL_ENDIAN_OUT:big}",
 #else
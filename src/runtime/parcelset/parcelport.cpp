@@ -11,6 +11,7 @@
 #include <hpx/runtime/applier/applier.hpp>
 #include <hpx/runtime/parcelset/parcelport.hpp>
 #include <hpx/runtime/threads/thread.hpp>
+#include <hpx/util/detail/pp/stringize.hpp>
 #include <hpx/util/io_service_pool.hpp>
 #include <hpx/util/runtime_configuration.hpp>
 #include <hpx/util/safe_lexical_cast.hpp>
@@ -36,6 +37,12 @@ namespace hpx { namespace parcelset
         here_(here),
         max_inbound_message_size_(ini.get_max_inbound_message_size()),
         max_outbound_message_size_(ini.get_max_outbound_message_size()),
+        parallel_encoding_segment_size_(hpx::util::get_entry_as<std::size_t>(
+            ini, "hpx.parcel." + type + ".parallel_encoding_segment_size",
+            HPX_PP_STRINGIZE(HPX_PARCEL_PARALLEL_ENCODING_SEGMENT_SIZE))),
+        buffer_pool_(hpx::util::get_entry_as<std::size_t>(ini,
+            "hpx.parcel." + type + ".buffer_pool_size",
+            HPX_PP_STRINGIZE(HPX_PARCEL_BUFFER_POOL_SIZE))),
         allow_array_optimizations_(true),
         allow_zero_copy_optimizations_(true),
         enable_security_(false),
@@ -190,6 +197,30 @@ namespace hpx { namespace parcelset
         return parcels_received_.total_buffer_allocate_time(reset);
     }
 
+    std::int64_t parcelport::get_buffer_pool_statistics(
+        buffer_pool_statistics_type t, bool reset)
+    {
+        switch (t)
+        {
+        case buffer_pool_hits:
+            return buffer_pool_.hits(reset);
+
+        case buffer_pool_misses:
+            return buffer_pool_.misses(reset);
+
+        case buffer_pool_retained_bytes:
+            return buffer_pool_.retained_bytes();
+
+        default:
+            break;
+        }
+
+        HPX_THROW_EXCEPTION(bad_parameter,
+            "parcelport::get_buffer_pool_statistics",
+            "invalid buffer pool statistics type");
+        return 0;
+    }
+
     std::int64_t parcelport::get_pending_parcels_count(bool /*reset*/)
     {
         std::lock_guard<lcos::local::spinlock> l(mtx_);
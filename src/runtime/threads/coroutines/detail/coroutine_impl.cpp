@@ -133,6 +133,48 @@ namespace hpx { namespace threads { namespace coroutines { namespace detail
         HPX_ASSERT(this->m_state == super_type::ctx_running);
     }
 
+    coroutine_impl::result_type coroutine_impl::invoke_stackless(arg_type arg)
+    {
+        HPX_ASSERT(is_stackless());
+        HPX_ASSERT(is_ready());
+
+#if defined(HPX_HAVE_THREAD_PHASE_INFORMATION)
+        ++this->m_phase;
+#endif
+        this->m_state = super_type::ctx_running;
+
+        result_type result(terminated, nullptr);
+        try
+        {
+            coroutine_self* old_self = coroutine_self::get_self();
+            coroutine_self self(this, old_self);
+            reset_self_on_exit on_exit(&self, old_self);
+
+            result = m_fun(arg);
+        }
+        catch (...)
+        {
+            this->m_state = super_type::ctx_exited;
+            this->m_exit_status = super_type::ctx_exited_abnormally;
+            this->reset();
+            throw;
+        }
+
+        // if this thread returned 'terminated' we need to reset the functor
+        // and the bound arguments
+        if (result.first == terminated)
+        {
+            this->m_state = super_type::ctx_exited;
+            this->m_exit_status = super_type::ctx_exited_return;
+            this->reset();
+        }
+        else
+        {
+            this->m_state = super_type::ctx_ready;
+        }
+        return result;
+    }
+
     ///////////////////////////////////////////////////////////////////////////
     // the memory for the threads is managed by a lockfree caching_freelist
     struct coroutine_heap
@@ -219,6 +261,11 @@ namespace hpx { namespace threads { namespace coroutines { namespace detail
     coroutine_impl* coroutine_impl::allocate(
         thread_id_repr_type id, std::ptrdiff_t stacksize)
     {
+        // coroutines without a stack are recycled together with their
+        // thread object only
+        if (stacksize == no_stack_size)
+            return nullptr;
+
         // start looking at the matching heap
         std::size_t const heap_num = std::size_t(id) / 32; //-V112
         std::size_t const heap_count = get_heap_count(stacksize);
@@ -237,6 +284,12 @@ namespace hpx { namespace threads { namespace coroutines { namespace detail
 
     void coroutine_impl::deallocate(coroutine_impl* p)
     {
+        if (p->is_stackless())
+        {
+            delete p;
+            return;
+        }
+
         std::size_t const heap_num = std::size_t(p->get_thread_id()) / 32; //-V112
         std::ptrdiff_t const stacksize = p->get_stacksize();
 
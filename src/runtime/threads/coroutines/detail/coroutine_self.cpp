@@ -5,11 +5,17 @@
 //  http://www.boost.org/LICENSE_1_0.txt)
 
 #include <hpx/config.hpp>
+#include <hpx/runtime/get_worker_thread_num.hpp>
 #include <hpx/runtime/threads/coroutines/detail/coroutine_self.hpp>
+#include <hpx/runtime/threads/policies/scheduler_base.hpp>
+#include <hpx/runtime/threads/thread_data.hpp>
+#include <hpx/runtime/threads/thread_enums.hpp>
+#include <hpx/throw_exception.hpp>
 #include <hpx/util/assert.hpp>
 #include <hpx/util/thread_specific_ptr.hpp>
 
 #include <cstddef>
+#include <sstream>
 
 namespace hpx { namespace threads { namespace coroutines { namespace detail
 {
@@ -38,4 +44,30 @@ namespace hpx { namespace threads { namespace coroutines { namespace detail
     {
         self_.reset(nullptr);
     }
+
+    coroutine_self::arg_type coroutine_self::yield_stackless(result_type arg)
+    {
+        if (arg.first != threads::pending &&
+            arg.first != threads::pending_boost)
+        {
+            std::ostringstream strm;
+            strm << "stackless thread(" << get_thread_id()
+                 << ") can't be suspended (requested state: "
+                 << get_thread_state_name(arg.first) << ")";
+            HPX_THROW_EXCEPTION(invalid_status,
+                "coroutine_self::yield_stackless", strm.str());
+        }
+
+        // There is no way to switch to the requested thread directly, as we
+        // have to run to completion first. Make sure it runs as soon as
+        // possible instead.
+        thread_data* next = arg.second.get();
+        if (next != nullptr)
+        {
+            next->get_scheduler_base()->schedule_thread(next,
+                hpx::get_worker_thread_num(), threads::thread_priority_boost);
+        }
+
+        return threads::wait_signaled;
+    }
 }}}}
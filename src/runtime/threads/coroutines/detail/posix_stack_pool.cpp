@@ -0,0 +1,463 @@
+//  Copyright (c) 2026 agent
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_THREAD_STACK_POOL)
+#include <hpx/compat/mutex.hpp>
+#include <hpx/runtime/threads/coroutines/detail/posix_stack_pool.hpp>
+#include <hpx/runtime/threads/coroutines/detail/posix_utility.hpp>
+#include <hpx/util/assert.hpp>
+
+#include <boost/atomic.hpp>
+
+#include <pthread.h>
+#if defined(__linux__)
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+#include <algorithm>
+#include <cerrno>
+#include <cstddef>
+#include <mutex>
+#include <stdexcept>
+
+namespace hpx { namespace threads { namespace coroutines { namespace detail {
+namespace posix
+{
+    ///////////////////////////////////////////////////////////////////////////
+    // these global variables are set once by the runtime configuration
+    // startup code
+    HPX_EXPORT bool use_stack_pool = true;
+    HPX_EXPORT bool use_stack_pool_huge_pages = false;
+    HPX_EXPORT std::size_t stack_pool_slab_size = 32 * 1024 * 1024;
+    HPX_EXPORT std::size_t stack_pool_cache_size = 64;
+
+#if defined(HPX_HAVE_THREAD_STACK_MMAP) && defined(_POSIX_MAPPED_FILES) \
+ && _POSIX_MAPPED_FILES > 0
+    namespace
+    {
+        ///////////////////////////////////////////////////////////////////////
+        // Free stacks are linked through the topmost word of the stack. The
+        // topmost page of a stack is never released to the OS, thus the link
+        // stays valid even for trimmed stacks.
+        struct free_stack
+        {
+            free_stack* next_;
+        };
+
+        inline free_stack* get_link(void* stack, std::size_t size)
+        {
+            return reinterpret_cast<free_stack*>(
+                static_cast<char*>(stack) + size) - 1;
+        }
+
+        inline void* get_stack(free_stack* link, std::size_t size)
+        {
+            return reinterpret_cast<char*>(link + 1) - size;
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        enum { max_size_classes = 8, max_numa_domains = 8 };
+
+        // the NUMA domain the calling thread currently runs on
+        inline std::size_t get_numa_domain()
+        {
+#if defined(__linux__) && defined(SYS_getcpu)
+            unsigned cpu = 0;
+            unsigned node = 0;
+            if (::syscall(SYS_getcpu, &cpu, &node, nullptr) == 0)
+                return node % max_numa_domains;
+#endif
+            return 0;
+        }
+
+        // free list for stacks of the same size released by threads running
+        // on the same NUMA domain
+        struct free_list
+        {
+            free_list()
+              : free_(nullptr), count_(0)
+            {}
+
+            compat::mutex mtx_;
+            free_stack* free_;
+            std::size_t count_;
+        };
+
+        struct size_class
+        {
+            size_class()
+              : size_(0)
+            {}
+
+            boost::atomic<std::size_t> size_;
+            free_list free_lists_[max_numa_domains];
+        };
+
+        // per OS-thread cache of free stacks, and the part of the slab of
+        // the thread no stacks have been carved from yet
+        struct thread_cache
+        {
+            struct entry
+            {
+                free_stack* free_;
+                std::size_t count_;
+
+                char* slab_next_;
+                char* slab_end_;
+            };
+
+            thread_cache()
+            {
+                for (entry& e : entries_)
+                {
+                    e.free_ = nullptr;
+                    e.count_ = 0;
+                    e.slab_next_ = nullptr;
+                    e.slab_end_ = nullptr;
+                }
+            }
+
+            entry entries_[max_size_classes];
+        };
+
+        void release_thread_cache(void* cache);
+
+        ///////////////////////////////////////////////////////////////////////
+        class stack_pool
+        {
+        public:
+            stack_pool()
+              : num_classes_(0)
+            {
+                // the caches of exiting threads are handed back to the pool
+                if (::pthread_key_create(&cache_key_, &release_thread_cache))
+                {
+                    throw std::runtime_error(
+                        "pthread_key_create() failed to create the key for "
+                        "the thread stack pool");
+                }
+            }
+
+            void* allocate(std::size_t size)
+            {
+                std::size_t idx = get_size_class(size);
+                if (idx == std::size_t(-1))
+                    return nullptr;
+
+                thread_cache::entry& e = get_thread_cache().entries_[idx];
+                if (e.free_ == nullptr)
+                    refill(idx, e, size);
+
+                HPX_ASSERT(e.free_ != nullptr);
+
+                free_stack* link = e.free_;
+                e.free_ = link->next_;
+                --e.count_;
+
+                return get_stack(link, size);
+            }
+
+            bool deallocate(void* stack, std::size_t size)
+            {
+                std::size_t idx = find_size_class(size);
+                if (idx == std::size_t(-1))
+                    return false;
+
+                thread_cache::entry& e = get_thread_cache().entries_[idx];
+
+                free_stack* link = get_link(stack, size);
+                link->next_ = e.free_;
+                e.free_ = link;
+
+                if (++e.count_ > stack_pool_cache_size)
+                    spill(idx, e, size, e.count_ - stack_pool_cache_size / 2);
+
+                return true;
+            }
+
+            std::size_t trim()
+            {
+                thread_cache* c = static_cast<thread_cache*>(
+                    ::pthread_getspecific(cache_key_));
+                if (c == nullptr)
+                    return 0;
+                return trim(*c);
+            }
+
+            // called on exit of a thread which has used the pool
+            void release(thread_cache* c)
+            {
+                trim(*c);
+                delete c;
+            }
+
+        private:
+            std::size_t trim(thread_cache& c)
+            {
+                std::size_t trimmed = 0;
+
+                std::size_t num_classes =
+                    num_classes_.load(boost::memory_order_acquire);
+                for (std::size_t idx = 0; idx != num_classes; ++idx)
+                {
+                    thread_cache::entry& e = c.entries_[idx];
+                    trimmed += e.count_;
+                    spill(idx, e,
+                        classes_[idx].size_.load(boost::memory_order_relaxed),
+                        e.count_);
+                }
+                return trimmed;
+            }
+
+            // The caches are kept in thread specific data with a destructor,
+            // the cached stacks are returned to the free lists when
+            // the thread exits.
+            thread_cache& get_thread_cache()
+            {
+                thread_cache* c = static_cast<thread_cache*>(
+                    ::pthread_getspecific(cache_key_));
+                if (c == nullptr)
+                {
+                    c = new thread_cache;
+                    ::pthread_setspecific(cache_key_, c);
+                }
+                return *c;
+            }
+
+            std::size_t find_size_class(std::size_t size) const
+            {
+                std::size_t num_classes =
+                    num_classes_.load(boost::memory_order_acquire);
+                for (std::size_t idx = 0; idx != num_classes; ++idx)
+                {
+                    if (classes_[idx].size_.load(
+                            boost::memory_order_relaxed) == size)
+                    {
+                        return idx;
+                    }
+                }
+                return std::size_t(-1);
+            }
+
+            std::size_t get_size_class(std::size_t size)
+            {
+                std::size_t idx = find_size_class(size);
+                if (idx != std::size_t(-1))
+                    return idx;
+
+                std::lock_guard<compat::mutex> l(mtx_);
+
+                idx = find_size_class(size);
+                if (idx != std::size_t(-1))
+                    return idx;
+
+                // fall back to non-pooled stacks if there are too many
+                // different stack sizes
+                std::size_t num_classes =
+                    num_classes_.load(boost::memory_order_relaxed);
+                if (num_classes == max_size_classes)
+                    return std::size_t(-1);
+
+                classes_[num_classes].size_.store(size,
+                    boost::memory_order_relaxed);
+                num_classes_.store(num_classes + 1,
+                    boost::memory_order_release);
+
+                return num_classes;
+            }
+
+            // move stacks from the free list of the current NUMA domain (or
+            // the slab of the calling thread) to the cache of the calling
+            // thread
+            void refill(std::size_t idx, thread_cache::entry& e,
+                std::size_t size)
+            {
+                std::size_t count = (stack_pool_cache_size + 1) / 2;
+                if (count == 0)
+                    count = 1;
+
+                free_list& fl = classes_[idx].free_lists_[get_numa_domain()];
+                {
+                    std::lock_guard<compat::mutex> l(fl.mtx_);
+
+                    for (/**/; fl.free_ != nullptr && count != 0; --count)
+                    {
+                        free_stack* link = fl.free_;
+                        fl.free_ = link->next_;
+                        --fl.count_;
+
+                        link->next_ = e.free_;
+                        e.free_ = link;
+                        ++e.count_;
+                    }
+                }
+
+                if (e.free_ == nullptr)
+                    carve(e, count, size);
+            }
+
+            // move the given number of stacks from the cache of the calling
+            // thread to the free list of the current NUMA domain
+            void spill(std::size_t idx, thread_cache::entry& e,
+                std::size_t size, std::size_t count)
+            {
+                if (count == 0)
+                    return;
+
+                // release the memory of the stacks while not holding the lock
+                free_stack* first = e.free_;
+                free_stack* last = first;
+                reset_stack(get_stack(last, size), size);
+                for (std::size_t i = 1; i != count; ++i)
+                {
+                    last = last->next_;
+                    reset_stack(get_stack(last, size), size);
+                }
+
+                e.free_ = last->next_;
+                e.count_ -= count;
+
+                free_list& fl = classes_[idx].free_lists_[get_numa_domain()];
+
+                std::lock_guard<compat::mutex> l(fl.mtx_);
+                last->next_ = fl.free_;
+                fl.free_ = first;
+                fl.count_ += count;
+            }
+
+            // map a new slab for the calling thread, this replaces the
+            // current slab of the thread (if any)
+            static void map_slab(thread_cache::entry& e, std::size_t stride)
+            {
+                std::size_t count = stack_pool_slab_size / stride;
+                if (count == 0)
+                    count = 1;
+
+                void* slab = ::mmap(nullptr, count * stride,
+                    PROT_EXEC | PROT_READ | PROT_WRITE,
+#if defined(__APPLE__)
+                    MAP_PRIVATE | MAP_ANON | MAP_NORESERVE,
+#else
+                    MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE,
+#endif
+                    -1, 0);
+
+                if (slab == MAP_FAILED)
+                {
+                    if (ENOMEM == errno)
+                    {
+                        throw std::runtime_error("mmap() failed to allocate "
+                            "thread stack pool slab due to insufficient "
+                            "resources, decrease hpx.stacks.pool_slab_size "
+                            "or add -Ihpx.stacks.use_pool=0 to the command "
+                            "line");
+                    }
+                    throw std::runtime_error(
+                        "mmap() failed to allocate thread stack pool slab");
+                }
+
+#if defined(MADV_HUGEPAGE)
+                // Huge pages will be split by the kernel wherever a guard
+                // page is protected.
+                if (use_stack_pool_huge_pages)
+                    ::madvise(slab, count * stride, MADV_HUGEPAGE);
+#endif
+
+                // the remainder of the previous slab (if any) is smaller than
+                // a single stack and is left unused
+                e.slab_next_ = static_cast<char*>(slab);
+                e.slab_end_ = e.slab_next_ + count * stride;
+            }
+
+            // Carve (at most) the given number of stacks from the slab of the
+            // calling thread and add them to its cache. Slabs are owned by a
+            // single thread, thus no synchronization is required. All pages
+            // of the new stacks are faulted in by writing to them, which
+            // places them on the NUMA domain of the calling thread.
+            static void carve(thread_cache::entry& e, std::size_t count,
+                std::size_t size)
+            {
+                std::size_t guard_size = 0;
+#if defined(HPX_HAVE_THREAD_GUARD_PAGE)
+                if (use_guard_pages)
+                    guard_size = EXEC_PAGESIZE;
+#endif
+                std::size_t const stride = size + guard_size;
+
+                if (std::size_t(e.slab_end_ - e.slab_next_) < stride)
+                    map_slab(e, stride);
+
+                count = (std::min)(count,
+                    std::size_t(e.slab_end_ - e.slab_next_) / stride);
+
+                for (std::size_t i = 0; i != count; ++i)
+                {
+                    char* stack = e.slab_next_ + guard_size;
+                    e.slab_next_ += stride;
+
+                    if (guard_size != 0)
+                        ::mprotect(stack - guard_size, guard_size, PROT_NONE);
+
+                    volatile char* pages = stack;
+                    for (std::size_t offset = 0; offset < size;
+                         offset += EXEC_PAGESIZE)
+                    {
+                        pages[offset] = '\0';
+                    }
+                    watermark_stack(stack, size);
+
+                    free_stack* link = get_link(stack, size);
+                    link->next_ = e.free_;
+                    e.free_ = link;
+                }
+                e.count_ += count;
+            }
+
+            boost::atomic<std::size_t> num_classes_;
+            size_class classes_[max_size_classes];
+            compat::mutex mtx_;
+
+            ::pthread_key_t cache_key_;
+        };
+
+        // The pool is never destroyed, as stacks might be returned to it
+        // during the destruction of global objects.
+        stack_pool& get_stack_pool()
+        {
+            static stack_pool* pool = new stack_pool;
+            return *pool;
+        }
+
+        void release_thread_cache(void* cache)
+        {
+            get_stack_pool().release(static_cast<thread_cache*>(cache));
+        }
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    void* pool_alloc_stack(std::size_t size)
+    {
+        return get_stack_pool().allocate(size);
+    }
+
+    bool pool_free_stack(void* stack, std::size_t size)
+    {
+        return get_stack_pool().deallocate(stack, size);
+    }
+
+    std::size_t trim_stack_pool()
+    {
+        if (!use_stack_pool)
+            return 0;
+        return get_stack_pool().trim();
+    }
+#endif
+}
+}}}}
+
+#endif
@@ -497,6 +497,7 @@ namespace hpx { namespace threads { namespace detail
 
             // make sure we're not waiting
             sched_.Scheduler::do_some_work(std::size_t(-1));
+            sched_.Scheduler::unpark_all();
 
             if (blocking) {
                 for (std::size_t i = 0; i != threads_.size(); ++i)
@@ -507,6 +508,7 @@ namespace hpx { namespace threads { namespace detail
                         << " notify_all";
 
                     sched_.Scheduler::do_some_work(std::size_t(-1));
+                    sched_.Scheduler::unpark_all();
 
                     LTM_(info) //-V128
                         << "thread_pool::stop: " << pool_name_
@@ -517,6 +519,12 @@ namespace hpx { namespace threads { namespace detail
                     threads_[i].join();
                 }
                 threads_.clear();
+
+#if defined(HPX_HAVE_THREAD_TIMER_WHEEL)
+                // no scheduling loop is left to fire the remaining timers,
+                // release the threads referenced by those
+                sched_.get_thread_timers().clear();
+#endif
             }
         }
     }
@@ -630,12 +638,9 @@ namespace hpx { namespace threads { namespace detail
                         idle_loop_counts_[num_thread], busy_loop_counts_[num_thread],
                         tasks_active_[num_thread]);
 
-                    detail::scheduling_callbacks callbacks(
-                        util::bind( //-V107
-                            &policies::scheduler_base::idle_callback,
-                            &sched_, num_thread
-                        ),
-                        detail::scheduling_callbacks::callback_type());
+                    // idling is handled by the scheduler's idle backoff
+                    detail::scheduling_callbacks callbacks{
+                        detail::scheduling_callbacks::callback_type()};
 
                     if (mode_ & policies::do_background_work)
                     {
@@ -1407,6 +1412,29 @@ namespace hpx { namespace threads { namespace detail
     {
         return sched_.Scheduler::get_num_stolen_to_staged(num, reset);
     }
+
+    template <typename Scheduler>
+    std::int64_t thread_pool<Scheduler>::get_num_stolen_at_level(
+        policies::steal_level level, std::size_t num, bool reset)
+    {
+        return sched_.Scheduler::get_num_stolen_at_level(level, num, reset);
+    }
+#endif
+
+#if defined(HPX_HAVE_THREAD_MANAGER_IDLE_BACKOFF)
+    template <typename Scheduler>
+    std::int64_t thread_pool<Scheduler>::
+        get_num_parks(std::size_t num, bool reset)
+    {
+        return sched_.Scheduler::get_num_parks(num, reset);
+    }
+
+    template <typename Scheduler>
+    std::int64_t thread_pool<Scheduler>::
+        get_num_unparks(std::size_t num, bool reset)
+    {
+        return sched_.Scheduler::get_num_unparks(num, reset);
+    }
 #endif
 
     template <typename Scheduler>
@@ -1461,6 +1489,11 @@ template class HPX_EXPORT hpx::threads::detail::thread_pool<
     hpx::threads::policies::local_priority_queue_scheduler<
         hpx::compat::mutex, hpx::threads::policies::lockfree_lifo
     > >;
+template class HPX_EXPORT hpx::threads::detail::thread_pool<
+    hpx::threads::policies::local_priority_queue_scheduler<
+        hpx::compat::mutex, hpx::threads::policies::lockfree_chase_lev_lifo,
+        hpx::threads::policies::lockfree_chase_lev_lifo
+    > >;
 
 #if defined(HPX_HAVE_ABP_SCHEDULER)
 template class HPX_EXPORT hpx::threads::detail::thread_pool<
@@ -156,6 +156,7 @@ namespace hpx { namespace threads
         socket_affinity_masks_.reserve(num_of_pus_);
         numa_node_affinity_masks_.reserve(num_of_pus_);
         core_affinity_masks_.reserve(num_of_pus_);
+        cache_affinity_masks_.reserve(num_of_pus_);
         thread_affinity_masks_.reserve(num_of_pus_);
 
         for (std::size_t i = 0; i < num_of_pus_; ++i)
@@ -173,6 +174,11 @@ namespace hpx { namespace threads
             core_affinity_masks_.push_back(init_core_affinity_mask(i));
         }
 
+        for (std::size_t i = 0; i < num_of_pus_; ++i)
+        {
+            cache_affinity_masks_.push_back(init_cache_affinity_mask(i));
+        }
+
         for (std::size_t i = 0; i < num_of_pus_; ++i)
         {
             thread_affinity_masks_.push_back(init_thread_affinity_mask(i));
@@ -205,6 +211,7 @@ namespace hpx { namespace threads
         detail::write_to_log_mask("socket_affinity_mask", socket_affinity_masks_);
         detail::write_to_log_mask("numa_node_affinity_mask", numa_node_affinity_masks_);
         detail::write_to_log_mask("core_affinity_mask", core_affinity_masks_);
+        detail::write_to_log_mask("cache_affinity_mask", cache_affinity_masks_);
         detail::write_to_log_mask("thread_affinity_mask", thread_affinity_masks_);
     }
 
@@ -329,6 +336,30 @@ namespace hpx { namespace threads
         return empty_mask;
     }
 
+    mask_cref_type hwloc_topology_info::get_cache_affinity_mask(
+        std::size_t num_thread
+      , bool numa_sensitive
+      , error_code& ec
+        ) const
+    {
+        std::size_t num_pu = num_thread % num_of_pus_;
+
+        if (num_pu < cache_affinity_masks_.size())
+        {
+            if (&ec != &throws)
+                ec = make_success_code();
+
+            return cache_affinity_masks_[num_pu];
+        }
+
+        HPX_THROWS_IF(ec, bad_parameter
+          , "hpx::threads::hwloc_topology_info::get_cache_affinity_mask"
+          , boost::str(boost::format(
+                "thread number %1% is out of range")
+                % num_thread));
+        return empty_mask;
+    }
+
     mask_cref_type hwloc_topology_info::get_thread_affinity_mask(
         std::size_t num_thread
       , bool numa_sensitive
@@ -471,6 +502,152 @@ namespace hpx { namespace threads
         return empty_mask;
     } // }}}
 
+    ///////////////////////////////////////////////////////////////////////////
+    hwloc_bitmap_t hwloc_topology_info::mask_to_cpuset(
+        mask_cref_type mask
+        ) const
+    { // {{{
+        hwloc_cpuset_t cpuset = hwloc_bitmap_alloc();
+
+        int const pu_depth =
+            hwloc_get_type_or_below_depth(topo, HWLOC_OBJ_PU);
+        for (std::size_t i = 0; i != mask_size(mask); ++i)
+        {
+            if (test(mask, i))
+            {
+                hwloc_obj_t const pu_obj =
+                    hwloc_get_obj_by_depth(topo, pu_depth, unsigned(i));
+                if (pu_obj != nullptr)
+                {
+                    hwloc_bitmap_set(cpuset,
+                        static_cast<unsigned int>(pu_obj->os_index));
+                }
+            }
+        }
+
+        return cpuset;
+    } // }}}
+
+    mask_type hwloc_topology_info::cpuset_to_mask(
+        hwloc_const_bitmap_t cpuset
+        ) const
+    { // {{{
+        mask_type mask = mask_type();
+        resize(mask, get_number_of_pus());
+
+        int const pu_depth =
+            hwloc_get_type_or_below_depth(topo, HWLOC_OBJ_PU);
+        for (unsigned int i = 0; std::size_t(i) != num_of_pus_; ++i)
+        {
+            hwloc_obj_t const pu_obj =
+                hwloc_get_obj_by_depth(topo, pu_depth, i);
+            unsigned idx = static_cast<unsigned>(pu_obj->os_index);
+            if (hwloc_bitmap_isset(cpuset, idx) != 0)
+                set(mask, detail::get_index(pu_obj));
+        }
+
+        return mask;
+    } // }}}
+
+    ///////////////////////////////////////////////////////////////////////////
+    void hwloc_topology_info::set_area_membind(
+        void const* addr
+      , std::size_t len
+      , mask_cref_type mask
+      , membind_policy policy
+      , bool migrate
+      , error_code& ec
+        ) const
+    { // {{{
+        hwloc_membind_policy_t hwloc_policy = HWLOC_MEMBIND_DEFAULT;
+        switch (policy)
+        {
+        case membind_firsttouch:
+            hwloc_policy = HWLOC_MEMBIND_FIRSTTOUCH;
+            break;
+
+        case membind_bind:
+            hwloc_policy = HWLOC_MEMBIND_BIND;
+            break;
+
+        case membind_interleave:
+            hwloc_policy = HWLOC_MEMBIND_INTERLEAVE;
+            break;
+
+        case membind_default:
+        default:
+            break;
+        }
+
+        int flags = 0;
+        if (migrate)
+            flags |= HWLOC_MEMBIND_MIGRATE;
+
+        hwloc_cpuset_t cpuset = mask_to_cpuset(mask);
+
+        int ret = 0;
+        {
+            std::unique_lock<hpx::util::spinlock> lk(topo_mtx);
+            ret = hwloc_set_area_membind(topo, addr, len, cpuset,
+                hwloc_policy, flags);
+        }
+
+        hwloc_bitmap_free(cpuset);
+
+        if (-1 == ret)
+        {
+            HPX_THROWS_IF(ec, kernel_error
+              , "hpx::threads::hwloc_topology_info::set_area_membind"
+              , boost::str(boost::format(
+                    "failed to bind memory area at %1% (%2% bytes), "
+                    "policy %3%")
+                    % addr % len % int(policy)));
+            return;
+        }
+
+        if (&ec != &throws)
+            ec = make_success_code();
+    } // }}}
+
+    mask_type hwloc_topology_info::get_area_memlocation(
+        void const* addr
+      , error_code& ec
+        ) const
+    { // {{{
+        if (&ec != &throws)
+            ec = make_success_code();
+
+#if HWLOC_API_VERSION >= 0x00010b03
+        hwloc_cpuset_t cpuset = hwloc_bitmap_alloc();
+
+        int ret = 0;
+        {
+            std::unique_lock<hpx::util::spinlock> lk(topo_mtx);
+            ret = hwloc_get_area_memlocation(topo, addr, 1, cpuset, 0);
+        }
+
+        if (-1 == ret)
+        {
+            hwloc_bitmap_free(cpuset);
+            HPX_THROWS_IF(ec, kernel_error
+              , "hpx::threads::hwloc_topology_info::get_area_memlocation"
+              , boost::str(boost::format(
+                    "failed to retrieve the location of address %1%")
+                    % addr));
+            return empty_mask;
+        }
+
+        mask_type mask = cpuset_to_mask(cpuset);
+        hwloc_bitmap_free(cpuset);
+        return mask;
+#else
+        // older versions of hwloc can only report the binding policy of the
+        // area, not where its pages actually reside
+        return get_thread_affinity_mask_from_lva(
+            reinterpret_cast<naming::address_type>(addr), ec);
+#endif
+    } // }}}
+
     std::size_t hwloc_topology_info::init_node_number(
         std::size_t num_thread, hwloc_obj_type_t type
         )
@@ -923,6 +1100,46 @@ namespace hpx { namespace threads
         return default_mask;
     } // }}}
 
+    mask_type hwloc_topology_info::init_cache_affinity_mask(
+        std::size_t num_thread
+        ) const
+    { // {{{
+        std::size_t num_pu = (num_thread + pu_offset) % num_of_pus_;
+
+        hwloc_obj_t cache_obj = nullptr;
+
+        {
+            std::unique_lock<hpx::util::spinlock> lk(topo_mtx);
+            hwloc_obj_t obj = hwloc_get_obj_by_type(topo, HWLOC_OBJ_PU,
+                static_cast<unsigned>(num_pu));
+
+            // find the outermost (last level) cache above the given PU
+            while (obj)
+            {
+#if HWLOC_API_VERSION >= 0x00020000
+                if (hwloc_obj_type_is_cache(obj->type))
+#else
+                if (hwloc_compare_types(HWLOC_OBJ_CACHE, obj->type) == 0)
+#endif
+                {
+                    cache_obj = obj;
+                }
+                obj = obj->parent;
+            }
+        }
+
+        if (cache_obj)
+        {
+            mask_type cache_affinity_mask = mask_type();
+            resize(cache_affinity_mask, get_number_of_pus());
+
+            extract_node_mask(cache_obj, cache_affinity_mask);
+            return cache_affinity_mask;
+        }
+
+        return core_affinity_masks_[num_thread];
+    } // }}}
+
     mask_type hwloc_topology_info::init_thread_affinity_mask(
         std::size_t num_thread
         ) const
@@ -520,6 +520,23 @@ namespace hpx { namespace this_thread
 #ifdef HPX_HAVE_THREAD_BACKTRACE_ON_SUSPENSION
             detail::reset_backtrace bt(id, ec);
 #endif
+#if defined(HPX_HAVE_THREAD_TIMER_WHEEL)
+            threads::policies::scheduler_base* scheduler =
+                id->get_scheduler_base();
+            threads::policies::detail::thread_timer_wheel::handle timer =
+                threads::detail::add_thread_timer(*scheduler, abs_time, id,
+                    threads::pending, threads::wait_timeout,
+                    threads::thread_priority_boost, ec);
+            if (ec) return threads::wait_unknown;
+
+            // suspend the HPX-thread
+            statex = self.yield(
+                threads::thread_result_type(threads::suspended, nextid));
+
+            // the timer is still armed if we were woken up by somebody else
+            if (statex != threads::wait_timeout)
+                scheduler->cancel_thread_timer(timer);
+#else
             threads::thread_id_type timer_id = threads::set_thread_state(id,
                 abs_time, threads::pending, threads::wait_timeout,
                 threads::thread_priority_boost, ec);
@@ -536,6 +553,7 @@ namespace hpx { namespace this_thread
                     threads::pending, threads::wait_abort,
                     threads::thread_priority_boost, ec1);
             }
+#endif
         }
 
         // handle interruption, if needed
@@ -147,6 +147,8 @@ namespace hpx { namespace threads
             size = thread_stacksize_large;
         else if (rtcfg.get_stack_size(thread_stacksize_huge) == size)
             size = thread_stacksize_huge;
+        else if (size == thread_stacksize_nostack)
+            return "nostack";
 
         if (size < thread_stacksize_small || size > thread_stacksize_huge)
             return "custom";
@@ -169,7 +171,7 @@ namespace hpx { namespace threads
         pool_(scheduler, notifier, "main_thread_scheduling_pool",
             policies::scheduler_mode(
                 policies::do_background_work | policies::reduce_thread_priority |
-                policies::delay_exit)),
+                policies::delay_exit | policies::enable_idle_backoff)),
         notifier_(notifier)
     {}
 
@@ -966,7 +968,65 @@ namespace hpx { namespace threads
               util::bind(&spt::get_num_stolen_to_staged, &pool_,
                   static_cast<std::size_t>(paths.instanceindex_), _1),
               "worker-thread", shepherd_count
-            }
+            },
+            // /threads{locality#%d/total}/count/stolen-smt
+            // /threads{locality#%d/worker-thread%d}/count/stolen-smt
+            { "count/stolen-smt",
+              util::bind(&spt::get_num_stolen_at_level, &pool_,
+                  policies::steal_level_smt, std::size_t(-1), _1),
+              util::bind(&spt::get_num_stolen_at_level, &pool_,
+                  policies::steal_level_smt,
+                  static_cast<std::size_t>(paths.instanceindex_), _1),
+              "worker-thread", shepherd_count
+            },
+            // /threads{locality#%d/total}/count/stolen-cache
+            // /threads{locality#%d/worker-thread%d}/count/stolen-cache
+            { "count/stolen-cache",
+              util::bind(&spt::get_num_stolen_at_level, &pool_,
+                  policies::steal_level_cache, std::size_t(-1), _1),
+              util::bind(&spt::get_num_stolen_at_level, &pool_,
+                  policies::steal_level_cache,
+                  static_cast<std::size_t>(paths.instanceindex_), _1),
+              "worker-thread", shepherd_count
+            },
+            // /threads{locality#%d/total}/count/stolen-numa
+            // /threads{locality#%d/worker-thread%d}/count/stolen-numa
+            { "count/stolen-numa",
+              util::bind(&spt::get_num_stolen_at_level, &pool_,
+                  policies::steal_level_numa, std::size_t(-1), _1),
+              util::bind(&spt::get_num_stolen_at_level, &pool_,
+                  policies::steal_level_numa,
+                  static_cast<std::size_t>(paths.instanceindex_), _1),
+              "worker-thread", shepherd_count
+            },
+            // /threads{locality#%d/total}/count/stolen-remote
+            // /threads{locality#%d/worker-thread%d}/count/stolen-remote
+            { "count/stolen-remote",
+              util::bind(&spt::get_num_stolen_at_level, &pool_,
+                  policies::steal_level_remote, std::size_t(-1), _1),
+              util::bind(&spt::get_num_stolen_at_level, &pool_,
+                  policies::steal_level_remote,
+                  static_cast<std::size_t>(paths.instanceindex_), _1),
+              "worker-thread", shepherd_count
+            },
+#endif
+#if defined(HPX_HAVE_THREAD_MANAGER_IDLE_BACKOFF)
+            // /threads{locality#%d/total}/count/parks
+            // /threads{locality#%d/worker-thread%d}/count/parks
+            { "count/parks",
+              util::bind(&spt::get_num_parks, &pool_, std::size_t(-1), _1),
+              util::bind(&spt::get_num_parks, &pool_,
+                  static_cast<std::size_t>(paths.instanceindex_), _1),
+              "worker-thread", shepherd_count
+            },
+            // /threads{locality#%d/total}/count/unparks
+            // /threads{locality#%d/worker-thread%d}/count/unparks
+            { "count/unparks",
+              util::bind(&spt::get_num_unparks, &pool_, std::size_t(-1), _1),
+              util::bind(&spt::get_num_unparks, &pool_,
+                  static_cast<std::size_t>(paths.instanceindex_), _1),
+              "worker-thread", shepherd_count
+            },
 #endif
         };
         std::size_t const data_size = sizeof(data)/sizeof(data[0]);
@@ -1220,6 +1280,54 @@ namespace hpx { namespace threads
               &performance_counters::locality_thread_counter_discoverer,
               ""
             },
+            { "/threads/count/stolen-smt", performance_counters::counter_raw,
+              "returns the overall number of HPX-threads and task descriptions "
+              "stolen from neighboring schedulers running on the same core for the "
+              "referenced locality", HPX_PERFORMANCE_COUNTER_V1,
+              counts_creator,
+              &performance_counters::locality_thread_counter_discoverer,
+              ""
+            },
+            { "/threads/count/stolen-cache", performance_counters::counter_raw,
+              "returns the overall number of HPX-threads and task descriptions "
+              "stolen from neighboring schedulers sharing the same last level cache for the "
+              "referenced locality", HPX_PERFORMANCE_COUNTER_V1,
+              counts_creator,
+              &performance_counters::locality_thread_counter_discoverer,
+              ""
+            },
+            { "/threads/count/stolen-numa", performance_counters::counter_raw,
+              "returns the overall number of HPX-threads and task descriptions "
+              "stolen from neighboring schedulers in the same NUMA domain for the "
+              "referenced locality", HPX_PERFORMANCE_COUNTER_V1,
+              counts_creator,
+              &performance_counters::locality_thread_counter_discoverer,
+              ""
+            },
+            { "/threads/count/stolen-remote", performance_counters::counter_raw,
+              "returns the overall number of HPX-threads and task descriptions "
+              "stolen from neighboring schedulers in remote NUMA domains for the "
+              "referenced locality", HPX_PERFORMANCE_COUNTER_V1,
+              counts_creator,
+              &performance_counters::locality_thread_counter_discoverer,
+              ""
+            },
+#endif
+#if defined(HPX_HAVE_THREAD_MANAGER_IDLE_BACKOFF)
+            { "/threads/count/parks", performance_counters::counter_raw,
+              "returns the overall number of times the worker threads were parked "
+              "because they did not find any work for the referenced locality",
+              HPX_PERFORMANCE_COUNTER_V1, counts_creator,
+              &performance_counters::locality_thread_counter_discoverer,
+              ""
+            },
+            { "/threads/count/unparks", performance_counters::counter_raw,
+              "returns the overall number of times parked worker threads were "
+              "woken up because new work became available for the referenced "
+              "locality", HPX_PERFORMANCE_COUNTER_V1, counts_creator,
+              &performance_counters::locality_thread_counter_discoverer,
+              ""
+            },
 #endif
             // scheduler utilization
             { "/scheduler/utilization/instantaneous", performance_counters::counter_raw,
@@ -1428,6 +1536,11 @@ template class HPX_EXPORT hpx::threads::threadmanager_impl<
     hpx::threads::policies::local_priority_queue_scheduler<
         hpx::compat::mutex, hpx::threads::policies::lockfree_lifo
     > >;
+template class HPX_EXPORT hpx::threads::threadmanager_impl<
+    hpx::threads::policies::local_priority_queue_scheduler<
+        hpx::compat::mutex, hpx::threads::policies::lockfree_chase_lev_lifo,
+        hpx::threads::policies::lockfree_chase_lev_lifo
+    > >;
 
 #if defined(HPX_HAVE_ABP_SCHEDULER)
 template class HPX_EXPORT hpx::threads::threadmanager_impl<
@@ -10,6 +10,9 @@
 #include <hpx/compat/thread.hpp>
 #include <hpx/exception.hpp>
 #include <hpx/lcos/barrier.hpp>
+#if defined(HPX_HAVE_SHARED_STATE_POOL)
+#include <hpx/lcos/detail/shared_state_pool.hpp>
+#endif
 #include <hpx/lcos/latch.hpp>
 #include <hpx/runtime/agas/big_boot_barrier.hpp>
 #include <hpx/runtime/components/console_error_sink.hpp>
@@ -724,6 +727,11 @@ namespace hpx {
         // initialize coroutines context switcher
         hpx::threads::coroutines::thread_shutdown();
 
+#if defined(HPX_HAVE_SHARED_STATE_POOL)
+        // hand back the shared states cached by this thread
+        lcos::detail::release_shared_state_cache();
+#endif
+
         // reset applier TSS
         applier_.deinit_tss();
 
@@ -869,6 +877,11 @@ template class HPX_EXPORT hpx::runtime_impl<
     hpx::threads::policies::local_priority_queue_scheduler<
         hpx::compat::mutex, hpx::threads::policies::lockfree_lifo
     > >;
+template class HPX_EXPORT hpx::runtime_impl<
+    hpx::threads::policies::local_priority_queue_scheduler<
+        hpx::compat::mutex, hpx::threads::policies::lockfree_chase_lev_lifo,
+        hpx::threads::policies::lockfree_chase_lev_lifo
+    > >;
 
 #if defined(HPX_HAVE_ABP_SCHEDULER)
 template class HPX_EXPORT hpx::runtime_impl<
@@ -9,6 +9,7 @@
 #include <hpx/config/defaults.hpp>
 // TODO: move parcel ports into plugins
 #include <hpx/runtime/parcelset/parcelhandler.hpp>
+#include <hpx/runtime/threads/coroutines/detail/posix_stack_pool.hpp>
 #include <hpx/util/detail/pp/expand.hpp>
 #include <hpx/util/detail/pp/stringize.hpp>
 #include <hpx/util/filesystem_compatibility.hpp>
@@ -222,6 +223,12 @@ namespace hpx { namespace util
 #if defined(__linux) || defined(linux) || defined(__linux__) || defined(__FreeBSD__)
             "use_guard_pages = ${HPX_USE_GUARD_PAGES:1}",
 #endif
+#if defined(HPX_HAVE_THREAD_STACK_POOL)
+            "use_pool = ${HPX_USE_STACK_POOL:1}",
+            "pool_use_huge_pages = ${HPX_STACK_POOL_USE_HUGE_PAGES:0}",
+            "pool_slab_size = ${HPX_STACK_POOL_SLAB_SIZE:0x2000000}",
+            "pool_cache_size = ${HPX_STACK_POOL_CACHE_SIZE:64}",
+#endif
 
             "[hpx.threadpools]",
             "io_pool_size = ${HPX_NUM_IO_POOL_SIZE:"
@@ -242,6 +249,26 @@ namespace hpx { namespace util
             "max_terminated_threads = ${HPX_THREAD_QUEUE_MAX_TERMINATED_THREADS:"
               HPX_PP_STRINGIZE(HPX_PP_EXPAND(HPX_SCHEDULER_MAX_TERMINATED_THREADS)) "}",
 
+#if defined(HPX_HAVE_THREAD_MANAGER_IDLE_BACKOFF)
+            "[hpx.idle_backoff]",
+            "spin_count = ${HPX_IDLE_BACKOFF_SPIN_COUNT:32}",
+            "yield_count = ${HPX_IDLE_BACKOFF_YIELD_COUNT:16}",
+            "park_timeout = ${HPX_IDLE_BACKOFF_PARK_TIMEOUT:10000}",
+            "background_park_timeout = "
+                "${HPX_IDLE_BACKOFF_BACKGROUND_PARK_TIMEOUT:1000}",
+#endif
+
+#if defined(HPX_HAVE_THREAD_TIMER_WHEEL)
+            "[hpx.timer_wheel]",
+            "resolution = ${HPX_TIMER_WHEEL_RESOLUTION:100}",
+#endif
+
+            "[hpx.continuations]",
+            "policy = ${HPX_CONTINUATIONS_POLICY:default}",
+            "max_inline_depth = ${HPX_CONTINUATIONS_MAX_INLINE_DEPTH:"
+                HPX_PP_STRINGIZE(HPX_PP_EXPAND(
+                    HPX_CONTINUATION_MAX_RECURSION_DEPTH)) "}",
+
             "[hpx.commandline]",
             // enable aliasing
             "aliasing = ${HPX_COMMANDLINE_ALIASING:1}",
@@ -496,6 +523,9 @@ namespace hpx { namespace util
         threads::coroutines::detail::posix::use_guard_pages =
             init_use_stack_guard_pages();
 #endif
+#if defined(HPX_HAVE_THREAD_STACK_POOL)
+        init_stack_pool();
+#endif
 #ifdef HPX_HAVE_VERIFY_LOCKS
         if (enable_lock_detection())
             util::enable_lock_detection();
@@ -557,6 +587,9 @@ namespace hpx { namespace util
         threads::coroutines::detail::posix::use_guard_pages =
             init_use_stack_guard_pages();
 #endif
+#if defined(HPX_HAVE_THREAD_STACK_POOL)
+        init_stack_pool();
+#endif
 #ifdef HPX_HAVE_VERIFY_LOCKS
         if (enable_lock_detection())
             util::enable_lock_detection();
@@ -934,6 +967,28 @@ namespace hpx { namespace util
     }
 #endif
 
+#if defined(HPX_HAVE_THREAD_STACK_POOL)
+    void runtime_configuration::init_stack_pool() const
+    {
+        namespace posix = threads::coroutines::detail::posix;
+        if (has_section("hpx")) {
+            util::section const* sec = get_section("hpx.stacks");
+            if (nullptr != sec) {
+                posix::use_stack_pool = hpx::util::get_entry_as<int>(
+                    *sec, "use_pool", "1") != 0;
+                posix::use_stack_pool_huge_pages =
+                    hpx::util::get_entry_as<int>(
+                        *sec, "pool_use_huge_pages", "0") != 0;
+                posix::stack_pool_slab_size = std::size_t(init_stack_size(
+                    "pool_slab_size", "0x2000000", 0x2000000));
+                posix::stack_pool_cache_size =
+                    hpx::util::get_entry_as<std::size_t>(
+                        *sec, "pool_cache_size", "64");
+            }
+        }
+    }
+#endif
+
     std::ptrdiff_t runtime_configuration::init_small_stack_size() const
     {
         return init_stack_size("small_size",
@@ -1025,6 +1080,10 @@ namespace hpx { namespace util
         case threads::thread_stacksize_huge:
             return huge_stacksize;
 
+        // stackless threads are identified by this special stack size
+        case threads::thread_stacksize_nostack:
+            return std::ptrdiff_t(threads::thread_stacksize_nostack);
+
         default:
         case threads::thread_stacksize_small:
             break;
@@ -24,6 +24,7 @@
 #include <algorithm>
 #include <cstddef>
 #include <cstdint>
+#include <iomanip>
 #include <iostream>
 #include <map>
 #include <string>
@@ -215,6 +216,122 @@ void test_update(gva_cache_type& cache, hpx::naming::gid_type first_key)
     calculate_histogram("update", timings);
 }
 
+///////////////////////////////////////////////////////////////////////////////
+// Compare the single and the bulk AGAS operations (bind, resolve, incref,
+// decref), the timings are reported per entry
+void print_timing(std::string const& prefix, std::uint64_t elapsed,
+    std::size_t num_entries)
+{
+    std::cout << prefix << ": " << std::setprecision(3) << std::setw(6)
+              << double(elapsed) / num_entries << " [ns/entry]" << std::endl;
+}
+
+std::vector<hpx::naming::gid_type> get_next_ids(std::size_t num_entries)
+{
+    std::vector<hpx::naming::gid_type> ids;
+    ids.reserve(num_entries);
+    for (std::size_t i = 0; i != num_entries; ++i)
+        ids.push_back(hpx::detail::get_next_id());
+    return ids;
+}
+
+void test_agas_single(std::size_t num_entries)
+{
+    hpx::agas::addressing_service& agas = hpx::naming::get_agas_client();
+    hpx::naming::gid_type locality = hpx::get_locality();
+
+    std::vector<hpx::naming::gid_type> ids = get_next_ids(num_entries);
+
+    std::uint64_t t = hpx::util::high_resolution_clock::now();
+    for (std::size_t i = 0; i != num_entries; ++i)
+    {
+        hpx::naming::address addr(locality,
+            hpx::components::component_memory, std::uint64_t(i + 1));
+        agas.bind_range_async(ids[i], 1, addr, 0, locality).get();
+    }
+    print_timing("   bind (single)",
+        hpx::util::high_resolution_clock::now() - t, num_entries);
+
+    t = hpx::util::high_resolution_clock::now();
+    for (std::size_t i = 0; i != num_entries; ++i)
+    {
+        agas.resolve_async(ids[i]).get();
+    }
+    print_timing("resolve (single)",
+        hpx::util::high_resolution_clock::now() - t, num_entries);
+
+    t = hpx::util::high_resolution_clock::now();
+    for (std::size_t i = 0; i != num_entries; ++i)
+    {
+        hpx::naming::id_type keep_alive(ids[i],
+            hpx::naming::id_type::unmanaged);
+        agas.incref_async(ids[i], 1, keep_alive).get();
+    }
+    print_timing(" incref (single)",
+        hpx::util::high_resolution_clock::now() - t, num_entries);
+
+    t = hpx::util::high_resolution_clock::now();
+    for (std::size_t i = 0; i != num_entries; ++i)
+    {
+        agas.decref(ids[i], 1);
+    }
+    agas.garbage_collect();
+    print_timing(" decref (single)",
+        hpx::util::high_resolution_clock::now() - t, num_entries);
+
+    for (std::size_t i = 0; i != num_entries; ++i)
+        agas.unbind_range_local(ids[i], 1);
+}
+
+void test_agas_bulk(std::size_t num_entries)
+{
+    hpx::agas::addressing_service& agas = hpx::naming::get_agas_client();
+    hpx::naming::gid_type locality = hpx::get_locality();
+
+    std::vector<hpx::naming::gid_type> ids = get_next_ids(num_entries);
+
+    std::vector<hpx::agas::addressing_service::bind_range_request_type>
+        bind_requests;
+    std::vector<std::pair<hpx::naming::gid_type, std::int64_t> >
+        credit_requests;
+    bind_requests.reserve(num_entries);
+    credit_requests.reserve(num_entries);
+
+    for (std::size_t i = 0; i != num_entries; ++i)
+    {
+        hpx::naming::address addr(locality,
+            hpx::components::component_memory, std::uint64_t(i + 1));
+        bind_requests.push_back(
+            hpx::util::make_tuple(ids[i], std::uint64_t(1), addr,
+                std::uint64_t(0), locality));
+        credit_requests.push_back(std::make_pair(ids[i], std::int64_t(1)));
+    }
+
+    std::uint64_t t = hpx::util::high_resolution_clock::now();
+    agas.bind_range_many(bind_requests).get();
+    print_timing("   bind (bulk)  ",
+        hpx::util::high_resolution_clock::now() - t, num_entries);
+
+    t = hpx::util::high_resolution_clock::now();
+    agas.resolve_async(ids).get();
+    print_timing("resolve (bulk)  ",
+        hpx::util::high_resolution_clock::now() - t, num_entries);
+
+    t = hpx::util::high_resolution_clock::now();
+    agas.incref_many(credit_requests).get();
+    print_timing(" incref (bulk)  ",
+        hpx::util::high_resolution_clock::now() - t, num_entries);
+
+    t = hpx::util::high_resolution_clock::now();
+    agas.decref_many(credit_requests);
+    agas.garbage_collect();
+    print_timing(" decref (bulk)  ",
+        hpx::util::high_resolution_clock::now() - t, num_entries);
+
+    for (std::size_t i = 0; i != num_entries; ++i)
+        agas.unbind_range_local(ids[i], 1);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 int hpx_main(boost::program_options::variables_map& vm)
 {
@@ -235,6 +352,9 @@ int hpx_main(boost::program_options::variables_map& vm)
     test_get(cache, first_key);
     test_update(cache, first_key);
 
+    test_agas_single(num_entries);
+    test_agas_bulk(num_entries);
+
     return hpx::finalize();
 }
 
@@ -6,6 +6,8 @@
 // TODO: Update
 
 #include <hpx/hpx_init.hpp>
+#include <hpx/lcos/local/promise.hpp>
+#include <hpx/lcos/wait_all.hpp>
 #include <hpx/lcos/wait_each.hpp>
 #include <hpx/runtime/actions/plain_action.hpp>
 #include <hpx/runtime/actions/continuation.hpp>
@@ -121,6 +123,71 @@ void measure_function_futures(std::uint64_t count, bool csv)
               << flush;
 }
 
+void measure_function_futures_continuations(std::uint64_t count, bool csv)
+{
+    std::vector<future<void> > futures;
+
+    futures.reserve(count);
+
+    // start the clock
+    high_resolution_timer walltime;
+
+    // attach a single continuation to each future, this is the common case
+    // for then() and dataflow()
+    for (std::uint64_t i = 0; i < count; ++i)
+        futures.push_back(async(&null_function).then(scratcher()));
+
+    hpx::wait_all(futures);
+
+    // stop the clock
+    const double duration = walltime.elapsed();
+
+    if (csv)
+        cout << ( boost::format("%1%,%2%\n")
+                % count
+                % duration)
+              << flush;
+    else
+        cout << ( boost::format("invoked %1% futures (continuations) in %2% "
+                    "seconds\n")
+                % count
+                % duration)
+              << flush;
+}
+
+void measure_ready_futures_continuations(std::uint64_t count, bool csv)
+{
+    std::uint64_t num_ready = 0;
+
+    // start the clock
+    high_resolution_timer walltime;
+
+    for (std::uint64_t i = 0; i < count; ++i)
+    {
+        hpx::lcos::local::promise<double> p;
+        future<void> f = p.get_future().then(scratcher());
+        p.set_value(null_function());
+        if (f.is_ready())
+            ++num_ready;
+    }
+
+    // stop the clock
+    const double duration = walltime.elapsed();
+
+    if (csv)
+        cout << ( boost::format("%1%,%2%\n")
+                % count
+                % duration)
+              << flush;
+    else
+        cout << ( boost::format("invoked %1% futures (promises, %2% "
+                    "continuations run inline) in %3% seconds\n")
+                % count
+                % num_ready
+                % duration)
+              << flush;
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 int hpx_main(
     variables_map& vm
@@ -136,6 +203,8 @@ int hpx_main(
 
         measure_action_futures(count, vm.count("csv") != 0);
         measure_function_futures(count, vm.count("csv") != 0);
+        measure_function_futures_continuations(count, vm.count("csv") != 0);
+        measure_ready_futures_continuations(count, vm.count("csv") != 0);
     }
 
     finalize();
@@ -8,6 +8,7 @@
 #include <hpx/include/iostreams.hpp>
 #include <hpx/include/serialization.hpp>
 #include <hpx/util/high_resolution_timer.hpp>
+#include <hpx/util/tuple.hpp>
 
 #include <hpx/runtime/serialization/detail/preprocess.hpp>
 
@@ -31,6 +32,21 @@ int test_function(hpx::serialization::serialize_buffer<double> const& b)
 }
 HPX_PLAIN_ACTION(test_function, test_action)
 
+// All members of a sample are trivially serializable, a vector of those is
+// stored as a single block of memory unless array optimizations are disabled
+// (-Ihpx.parcel.array_optimization=0).
+enum class sample_kind : std::int32_t { first, second, third };
+
+typedef hpx::util::tuple<std::int64_t, sample_kind, std::int32_t, double>
+    sample;
+
+// This function will never be called
+int test_samples_function(std::vector<sample> const& s)
+{
+    return 42;
+}
+HPX_PLAIN_ACTION(test_samples_function, test_samples_action)
+
 std::size_t get_archive_size(hpx::parcelset::parcel const& p,
     std::uint32_t flags,
     std::vector<hpx::serialization::serialization_chunk>* chunks)
@@ -43,9 +59,32 @@ std::size_t get_archive_size(hpx::parcelset::parcel const& p,
     return gather_size.size();
 }
 
+///////////////////////////////////////////////////////////////////////////////
+template <typename Action, typename Arg>
+hpx::parcelset::parcel create_parcel(hpx::naming::id_type const& here,
+    hpx::naming::address const& addr, bool continuation, Arg const& arg)
+{
+    hpx::naming::gid_type dest = here.get_gid();
+    hpx::naming::address a(addr);
+    if (continuation) {
+        return hpx::parcelset::parcel(
+            hpx::parcelset::detail::create_parcel::call(
+                std::true_type(),
+                std::move(dest), std::move(a),
+                hpx::actions::typed_continuation<int>(here),
+                Action(), hpx::threads::thread_priority_normal, arg
+                ));
+    }
+
+    return hpx::parcelset::parcel(hpx::parcelset::detail::create_parcel::call(
+        std::false_type(),
+        std::move(dest), std::move(a),
+        Action(), hpx::threads::thread_priority_normal, arg));
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 double benchmark_serialization(std::size_t data_size, std::size_t iterations,
-    bool continuation, bool zerocopy)
+    bool continuation, bool zerocopy, bool samples)
 {
     hpx::naming::id_type const here = hpx::find_here();
     hpx::naming::address addr(hpx::get_locality(),
@@ -90,27 +129,29 @@ double benchmark_serialization(std::size_t data_size, std::size_t iterations,
 
     // create argument for action
     std::vector<double> data;
-    data.resize(data_size);
-
-    hpx::serialization::serialize_buffer<double> buffer(data.data(), data.size(),
-        hpx::serialization::serialize_buffer<double>::reference);
+    std::vector<sample> sample_data;
 
     // create a parcel with/without continuation
     hpx::parcelset::parcel outp;
-    hpx::naming::gid_type dest = here.get_gid();
-    if (continuation) {
-        outp = hpx::parcelset::parcel(hpx::parcelset::detail::create_parcel::call(
-            std::true_type(),
-            std::move(dest), std::move(addr),
-            hpx::actions::typed_continuation<int>(here),
-            test_action(), hpx::threads::thread_priority_normal, buffer
-            ));
+    if (samples) {
+        sample_data.reserve(data_size);
+        for (std::size_t i = 0; i != data_size; ++i)
+        {
+            sample_data.push_back(sample(std::int64_t(i),
+                static_cast<sample_kind>(i % 3), std::int32_t(i), i / 3.0));
+        }
+
+        outp = create_parcel<test_samples_action>(
+            here, addr, continuation, sample_data);
     }
     else {
-        outp = hpx::parcelset::parcel(hpx::parcelset::detail::create_parcel::call(
-            std::false_type(),
-            std::move(dest), std::move(addr),
-            test_action(), hpx::threads::thread_priority_normal, buffer));
+        data.resize(data_size);
+
+        hpx::serialization::serialize_buffer<double> buffer(
+            data.data(), data.size(),
+            hpx::serialization::serialize_buffer<double>::reference);
+
+        outp = create_parcel<test_action>(here, addr, continuation, buffer);
     }
 
     outp.set_source_id(here);
@@ -164,13 +205,14 @@ int hpx_main(boost::program_options::variables_map& vm)
     bool print_header = vm.count("no-header") == 0;
     bool continuation = vm.count("continuation") != 0;
     bool zerocopy = vm.count("zerocopy") != 0;
+    bool samples = vm.count("samples") != 0;
 
     std::vector<hpx::future<double> > timings;
     for (std::size_t i = 0; i != concurrency; ++i)
     {
         timings.push_back(hpx::async(
             &benchmark_serialization, data_size, iterations,
-            continuation, zerocopy));
+            continuation, zerocopy, samples));
     }
 
     double overall_time = 0;
@@ -211,6 +253,10 @@ int main(int argc, char* argv[])
         ( "zerocopy"
         , "use zero copy serialization of bitwise copyable arguments")
 
+        ( "samples"
+        , "send a vector of data_size fixed layout samples instead of a "
+          "buffer of doubles")
+
         ( "no-header"
         , "do not print out the csv header row")
         ;
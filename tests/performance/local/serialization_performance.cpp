@@ -7,6 +7,7 @@
 #include <hpx/runtime/serialization/serialize.hpp>
 #include <hpx/runtime/serialization/string.hpp>
 #include <hpx/runtime/serialization/vector.hpp>
+#include <hpx/util/tuple.hpp>
 #include <hpx/version.hpp>
 
 #include <chrono>
@@ -171,6 +172,27 @@ namespace hpx_test
         hpx::serialization::input_archive archiver(data);
         archiver >> record;
     }
+
+    // All members of a sample are trivially serializable, a vector of those
+    // is stored as a single block of memory unless array optimizations are
+    // disabled (in which case each member is stored separately).
+    enum class Kind : std::int32_t { first, second, third };
+
+    typedef hpx::util::tuple<std::int64_t, Kind, std::int32_t, double> Sample;
+    typedef std::vector<Sample> Samples;
+
+    void to_string(const Samples &samples, std::string& data,
+        std::uint32_t flags)
+    {
+        hpx::serialization::output_archive archiver(data, flags);
+        archiver << samples;
+    }
+
+    void from_string(Samples &samples, std::string const& data)
+    {
+        hpx::serialization::input_archive archiver(data);
+        archiver >> samples;
+    }
 }
 
 void hpx_serialization_test(std::size_t iterations)
@@ -217,6 +239,47 @@ void hpx_serialization_test(std::size_t iterations)
               << std::endl << std::endl;
 }
 
+void hpx_fixed_layout_test(std::size_t iterations, std::uint32_t flags,
+    char const* name)
+{
+    using namespace hpx_test;
+
+    Samples s1, s2;
+    for (std::int64_t kInteger : kIntegers)
+    {
+        s1.push_back(Sample(kInteger, static_cast<Kind>(kInteger % 3),
+            static_cast<std::int32_t>(kInteger), kInteger / 3.0));
+    }
+
+    std::string serialized;
+    to_string(s1, serialized, flags);
+    from_string(s2, serialized);
+
+    if (s1 != s2)
+    {
+        throw std::logic_error("hpx's case: deserialization failed");
+    }
+
+    std::cout << "hpx (" << name << "): size    = " << serialized.size()
+              << " bytes" << std::endl;
+
+    auto start = std::chrono::high_resolution_clock::now();
+
+    for (size_t i = 0; i < iterations; ++i)
+    {
+        serialized.clear();
+        to_string(s1, serialized, flags);
+        from_string(s2, serialized);
+    }
+
+    auto finish = std::chrono::high_resolution_clock::now();
+    auto duration = std::chrono::duration_cast<std::chrono::milliseconds>(
+        finish - start).count();
+
+    std::cout << "hpx (" << name << "): time    = " << duration
+              << " milliseconds" << std::endl << std::endl;
+}
+
 int main(int argc, char **argv)
 {
     if (argc < 2)
@@ -239,5 +302,10 @@ int main(int argc, char **argv)
     }
 
     hpx_serialization_test(iterations);
+
+    // compare member-wise serialization with the bitwise fast path
+    hpx_fixed_layout_test(iterations,
+        hpx::serialization::disable_array_optimization, "member-wise");
+    hpx_fixed_layout_test(iterations, 0, "bitwise");
 }
 
@@ -0,0 +1,216 @@
+///////////////////////////////////////////////////////////////////////////////
+//  Copyright (c) 2026 agent
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+///////////////////////////////////////////////////////////////////////////////
+
+#include <hpx/hpx_init.hpp>
+#include <hpx/hpx.hpp>
+#include <hpx/include/parallel_sort.hpp>
+#include <hpx/parallel/algorithms/sort_by_key.hpp>
+#include <hpx/util/high_resolution_clock.hpp>
+#include <hpx/util/lightweight_test.hpp>
+
+#include <boost/format.hpp>
+#include <boost/program_options.hpp>
+#include <boost/random.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <iostream>
+#include <numeric>
+#include <string>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+struct random_fill
+{
+    random_fill()
+      : gen(std::rand())
+    {}
+
+    template <typename T>
+    void operator()(T& t)
+    {
+        t = T(boost::random::uniform_real_distribution<double>(
+            -1e9, 1e9)(gen));
+    }
+
+    boost::random::mt19937 gen;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename T, typename Compare>
+double run_sort_benchmark_std(int test_count, std::vector<T> const& org,
+    Compare comp)
+{
+    std::uint64_t time = 0;
+
+    for (int i = 0; i < test_count; ++i)
+    {
+        std::vector<T> v = org;
+
+        std::uint64_t elapsed = hpx::util::high_resolution_clock::now();
+        std::sort(std::begin(v), std::end(v), comp);
+        time += hpx::util::high_resolution_clock::now() - elapsed;
+    }
+
+    return (time * 1e-9) / test_count;
+}
+
+template <typename ExPolicy, typename T, typename Compare>
+double run_sort_benchmark_hpx(int test_count, ExPolicy policy,
+    std::vector<T> const& org, Compare comp)
+{
+    std::uint64_t time = 0;
+
+    for (int i = 0; i < test_count; ++i)
+    {
+        std::vector<T> v = org;
+
+        std::uint64_t elapsed = hpx::util::high_resolution_clock::now();
+        hpx::parallel::sort(policy, std::begin(v), std::end(v), comp);
+        time += hpx::util::high_resolution_clock::now() - elapsed;
+    }
+
+    return (time * 1e-9) / test_count;
+}
+
+template <typename ExPolicy, typename T>
+double run_sort_by_key_benchmark_hpx(int test_count, ExPolicy policy,
+    std::vector<T> const& org)
+{
+    std::uint64_t time = 0;
+
+    for (int i = 0; i < test_count; ++i)
+    {
+        std::vector<T> keys = org;
+        std::vector<std::size_t> values(keys.size());
+        std::iota(std::begin(values), std::end(values), std::size_t(0));
+
+        std::uint64_t elapsed = hpx::util::high_resolution_clock::now();
+        hpx::parallel::sort_by_key(policy, std::begin(keys), std::end(keys),
+            std::begin(values));
+        time += hpx::util::high_resolution_clock::now() - elapsed;
+    }
+
+    return (time * 1e-9) / test_count;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename T>
+void run_benchmark(std::size_t vector_size, int test_count, char const* name)
+{
+    std::cout << "* Preparing Benchmark (" << name << ")..." << std::endl;
+
+    std::vector<T> v(vector_size);
+    std::for_each(std::begin(v), std::end(v), random_fill());
+
+    using namespace hpx::parallel;
+
+    std::cout << "* Running Benchmark..." << std::endl;
+    double time_std =
+        run_sort_benchmark_std(test_count, v, std::less<T>());
+    double time_seq =
+        run_sort_benchmark_hpx(test_count, execution::seq, v, std::less<T>());
+    double time_par =
+        run_sort_benchmark_hpx(test_count, execution::par, v, std::less<T>());
+
+    // std::greater disables the radix sort, this measures the comparison
+    // based sort (sample sort for large inputs)
+    double time_std_greater =
+        run_sort_benchmark_std(test_count, v, std::greater<T>());
+    double time_seq_greater =
+        run_sort_benchmark_hpx(test_count, execution::seq, v,
+            std::greater<T>());
+    double time_par_greater =
+        run_sort_benchmark_hpx(test_count, execution::par, v,
+            std::greater<T>());
+
+    double time_seq_by_key =
+        run_sort_by_key_benchmark_hpx(test_count, execution::seq, v);
+    double time_par_by_key =
+        run_sort_by_key_benchmark_hpx(test_count, execution::par, v);
+
+    std::cout << "\n-------------- Benchmark Result --------------" << std::endl;
+    auto fmt = "%1% (%2%, %3%) : %4%(sec)";
+    std::cout << (boost::format(fmt) % "sort" % name % "std" % time_std)
+        << std::endl;
+    std::cout << (boost::format(fmt) % "sort" % name % "seq" % time_seq)
+        << std::endl;
+    std::cout << (boost::format(fmt) % "sort" % name % "par" % time_par)
+        << std::endl;
+    std::cout << (boost::format(fmt) % "sort/greater" % name % "std" %
+        time_std_greater) << std::endl;
+    std::cout << (boost::format(fmt) % "sort/greater" % name % "seq" %
+        time_seq_greater) << std::endl;
+    std::cout << (boost::format(fmt) % "sort/greater" % name % "par" %
+        time_par_greater) << std::endl;
+    std::cout << (boost::format(fmt) % "sort_by_key" % name % "seq" %
+        time_seq_by_key) << std::endl;
+    std::cout << (boost::format(fmt) % "sort_by_key" % name % "par" %
+        time_par_by_key) << std::endl;
+    std::cout << "----------------------------------------------\n" << std::endl;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main(boost::program_options::variables_map& vm)
+{
+    unsigned int seed = (unsigned int)std::time(nullptr);
+    if (vm.count("seed"))
+        seed = vm["seed"].as<unsigned int>();
+
+    std::srand(seed);
+
+    // pull values from cmd
+    std::size_t vector_size = vm["vector_size"].as<std::size_t>();
+    int test_count = vm["test_count"].as<int>();
+
+    std::size_t const os_threads = hpx::get_os_thread_count();
+
+    std::cout << "-------------- Benchmark Config --------------" << std::endl;
+    std::cout << "seed         : " << seed << std::endl;
+    std::cout << "vector_size  : " << vector_size << std::endl;
+    std::cout << "test_count   : " << test_count << std::endl;
+    std::cout << "os threads   : " << os_threads << std::endl;
+    std::cout << "----------------------------------------------\n" << std::endl;
+
+    run_benchmark<std::int32_t>(vector_size, test_count, "int32");
+    run_benchmark<std::int64_t>(vector_size, test_count, "int64");
+    run_benchmark<float>(vector_size, test_count, "float");
+    run_benchmark<double>(vector_size, test_count, "double");
+
+    return hpx::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    using namespace boost::program_options;
+    options_description desc_commandline(
+        "usage: " HPX_APPLICATION_STRING " [options]");
+
+    desc_commandline.add_options()
+        ("vector_size",
+            boost::program_options::value<std::size_t>()->default_value(10000000),
+            "size of vector (default: 10000000)")
+        ("test_count",
+            boost::program_options::value<int>()->default_value(10),
+            "number of tests to be averaged (default: 10)")
+        ("seed,s", boost::program_options::value<unsigned int>(),
+            "the random number generator seed to use for this run")
+        ;
+
+    // initialize program
+    std::vector<std::string> const cfg = {
+        "hpx.os_threads=all"
+    };
+
+    // Initialize and run HPX
+    HPX_TEST_EQ_MSG(hpx::init(desc_commandline, argc, argv, cfg), 0,
+        "HPX main exited with non-zero status");
+
+    return hpx::util::report_errors();
+}
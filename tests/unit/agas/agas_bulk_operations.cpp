@@ -0,0 +1,271 @@
+//  Copyright (c) 2026 agent
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// Verify the results of the bulk AGAS operations (bind_range_many,
+// resolve_async for a vector of gids, incref_many and decref_many), both with
+// a cold and with a warm local address cache.
+
+#include <hpx/hpx.hpp>
+#include <hpx/hpx_init.hpp>
+#include <hpx/include/iostreams.hpp>
+#include <hpx/util/lightweight_test.hpp>
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <tests/unit/agas/components/simple_refcnt_checker.hpp>
+#include <tests/unit/agas/components/managed_refcnt_checker.hpp>
+
+using boost::program_options::variables_map;
+using boost::program_options::options_description;
+using boost::program_options::value;
+
+using hpx::init;
+using hpx::finalize;
+using hpx::find_here;
+
+using std::chrono::milliseconds;
+
+using hpx::naming::id_type;
+using hpx::naming::gid_type;
+using hpx::naming::address;
+
+using hpx::agas::addressing_service;
+using hpx::agas::garbage_collect;
+
+using hpx::test::simple_refcnt_monitor;
+using hpx::test::managed_refcnt_monitor;
+
+using hpx::util::report_errors;
+
+using hpx::cout;
+using hpx::flush;
+
+typedef std::vector<std::pair<gid_type, std::int64_t> > credit_requests_type;
+
+///////////////////////////////////////////////////////////////////////////////
+address make_address(std::size_t i)
+{
+    return address(hpx::get_locality(), hpx::components::component_memory,
+        std::uint64_t(i + 1));
+}
+
+void check_resolved(std::vector<gid_type> const& ids,
+    std::vector<address> const& addrs)
+{
+    HPX_TEST_EQ(addrs.size(), ids.size());
+    for (std::size_t i = 0; i != addrs.size(); ++i)
+    {
+        HPX_TEST_EQ(addrs[i], make_address(i));
+    }
+}
+
+void test_bind_resolve_many(std::size_t num_entries)
+{
+    addressing_service& agas = hpx::naming::get_agas_client();
+    gid_type locality = hpx::get_locality();
+
+    std::vector<gid_type> ids;
+    std::vector<addressing_service::bind_range_request_type> requests;
+    ids.reserve(num_entries);
+    requests.reserve(num_entries);
+
+    for (std::size_t i = 0; i != num_entries; ++i)
+    {
+        ids.push_back(hpx::detail::get_next_id());
+        requests.push_back(hpx::util::make_tuple(ids.back(),
+            std::uint64_t(1), make_address(i), std::uint64_t(0), locality));
+    }
+
+    std::vector<bool> bound = agas.bind_range_many(requests).get();
+    HPX_TEST_EQ(bound.size(), num_entries);
+    for (std::size_t i = 0; i != bound.size(); ++i)
+    {
+        HPX_TEST(bound[i]);
+    }
+
+    // bind_range_many has populated the cache
+    check_resolved(ids, agas.resolve_async(ids).get());
+
+    // all entries have to be resolved by AGAS
+    agas.clear_cache();
+    check_resolved(ids, agas.resolve_async(ids).get());
+
+    // the previous bulk resolve has populated the cache again
+    check_resolved(ids, agas.resolve_async(ids).get());
+
+    // only every other entry is cached, the results have to be scattered
+    // back into the right slots
+    agas.clear_cache();
+    for (std::size_t i = 0; i < num_entries; i += 2)
+    {
+        HPX_TEST_EQ(agas.resolve_async(ids[i]).get(), make_address(i));
+    }
+    check_resolved(ids, agas.resolve_async(ids).get());
+
+    for (std::size_t i = 0; i != num_entries; ++i)
+        agas.unbind_range_local(ids[i], 1);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <
+    typename Client
+>
+void test_incref_decref_many(
+    std::uint64_t delay
+  , std::size_t num_objects
+  , bool cold_cache
+    )
+{
+    addressing_service& agas = hpx::naming::get_agas_client();
+
+    std::vector<Client> monitors;
+    monitors.reserve(num_objects);
+    for (std::size_t i = 0; i != num_objects; ++i)
+        monitors.push_back(Client(find_here()));
+
+    credit_requests_type increfs;
+    credit_requests_type decrefs;
+    increfs.reserve(num_objects);
+    decrefs.reserve(num_objects);
+
+    {
+        std::vector<id_type> ids;
+        ids.reserve(num_objects);
+        for (Client& monitor : monitors)
+        {
+            ids.push_back(monitor.detach().get());
+            increfs.push_back(
+                std::make_pair(ids.back().get_gid(), std::int64_t(2)));
+            decrefs.push_back(
+                std::make_pair(ids.back().get_gid(), std::int64_t(1)));
+        }
+
+        // Flush the pending decrefs, no incref below is compensated.
+        garbage_collect();
+
+        if (cold_cache)
+            agas.clear_cache();
+
+        // The ids keep the objects alive until the increfs are acknowledged.
+        std::vector<std::int64_t> credits = agas.incref_many(increfs).get();
+        HPX_TEST_EQ(credits.size(), num_objects);
+        for (std::size_t i = 0; i != credits.size(); ++i)
+        {
+            HPX_TEST_EQ(credits[i], std::int64_t(0));
+        }
+    }
+
+    // Flush pending reference counting operations.
+    garbage_collect();
+    garbage_collect();
+
+    // Each object still holds the two credits added by incref_many.
+    for (Client& monitor : monitors)
+    {
+        HPX_TEST_EQ(false, monitor.is_ready(milliseconds(delay)));
+    }
+
+    if (cold_cache)
+        agas.clear_cache();
+
+    agas.decref_many(decrefs);
+    garbage_collect();
+    garbage_collect();
+
+    // One credit is left for each object.
+    for (Client& monitor : monitors)
+    {
+        HPX_TEST_EQ(false, monitor.is_ready(milliseconds(delay)));
+    }
+
+    if (cold_cache)
+        agas.clear_cache();
+
+    agas.decref_many(decrefs);
+    garbage_collect();
+    garbage_collect();
+
+    // All credits are gone, the objects should be out of scope now.
+    for (Client& monitor : monitors)
+    {
+        HPX_TEST_EQ(true, monitor.is_ready(milliseconds(delay)));
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <
+    typename Client
+>
+void hpx_test_main(
+    variables_map& vm
+    )
+{
+    std::uint64_t const delay = vm["delay"].as<std::uint64_t>();
+    std::size_t const objects = vm["objects"].as<std::size_t>();
+
+    test_incref_decref_many<Client>(delay, objects, false);
+    test_incref_decref_many<Client>(delay, objects, true);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main(
+    variables_map& vm
+    )
+{
+    {
+        test_bind_resolve_many(vm["entries"].as<std::size_t>());
+
+        cout << std::string(80, '#') << "\n"
+             << "simple component test\n"
+             << std::string(80, '#') << "\n" << flush;
+
+        hpx_test_main<simple_refcnt_monitor>(vm);
+
+        cout << std::string(80, '#') << "\n"
+             << "managed component test\n"
+             << std::string(80, '#') << "\n" << flush;
+
+        hpx_test_main<managed_refcnt_monitor>(vm);
+    }
+
+    finalize();
+    return report_errors();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int main(
+    int argc
+  , char* argv[]
+    )
+{
+    // Configure application-specific options.
+    options_description cmdline("usage: " HPX_APPLICATION_STRING " [options]");
+
+    cmdline.add_options()
+        ( "delay"
+        , value<std::uint64_t>()->default_value(500)
+        , "number of milliseconds to wait for object destruction")
+        ( "entries"
+        , value<std::size_t>()->default_value(100)
+        , "number of address ranges to bind and resolve")
+        ( "objects"
+        , value<std::size_t>()->default_value(8)
+        , "number of objects to increment and decrement the credits of")
+        ;
+
+    // We need to explicitly enable the test components used by this test.
+    std::vector<std::string> const cfg = {
+        "hpx.components.simple_refcnt_checker.enabled! = 1",
+        "hpx.components.managed_refcnt_checker.enabled! = 1"
+    };
+
+    // Initialize and run HPX.
+    return init(cmdline, argc, argv, cfg);
+}
@@ -0,0 +1,123 @@
+//  Copyright (c) 2026 agent
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// Create and destroy many managed components concurrently to exercise the
+// per-worker-thread caches of the component heaps, including the batched
+// handing back of freed objects to their heaps.
+
+#include <hpx/hpx_main.hpp>
+#include <hpx/include/components.hpp>
+#include <hpx/include/actions.hpp>
+#include <hpx/include/lcos.hpp>
+#include <hpx/util/lightweight_test.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+struct test_server : hpx::components::managed_component_base<test_server>
+{
+    test_server() : value_(0) {}
+    explicit test_server(std::size_t value) : value_(value) {}
+
+    std::size_t call() const { return value_; }
+
+    HPX_DEFINE_COMPONENT_ACTION(test_server, call);
+
+    std::size_t value_;
+};
+
+typedef hpx::components::managed_component<test_server> server_type;
+HPX_REGISTER_COMPONENT(server_type, test_server);
+
+typedef test_server::call_action call_action;
+HPX_REGISTER_ACTION(call_action);
+
+// instances of a second component type are allocated from different heaps
+struct other_server : hpx::components::managed_component_base<other_server>
+{
+    other_server() {}
+};
+
+typedef hpx::components::managed_component<other_server> other_server_type;
+HPX_REGISTER_COMPONENT(other_server_type, other_server);
+
+///////////////////////////////////////////////////////////////////////////////
+std::vector<hpx::id_type> create_instances(std::size_t first,
+    std::size_t count)
+{
+    std::vector<hpx::id_type> ids;
+    ids.reserve(count);
+    for (std::size_t i = 0; i != count; ++i)
+        ids.push_back(hpx::local_new<test_server>(first + i).get());
+    return ids;
+}
+
+void test_concurrent_create_destroy(std::size_t tasks, std::size_t count)
+{
+    std::vector<hpx::future<std::vector<hpx::id_type> > > futures;
+    futures.reserve(tasks);
+    for (std::size_t i = 0; i != tasks; ++i)
+        futures.push_back(hpx::async(&create_instances, i * count, count));
+
+    std::vector<hpx::id_type> ids;
+    ids.reserve(tasks * count);
+    for (auto && f : futures)
+    {
+        std::vector<hpx::id_type> part = f.get();
+        ids.insert(ids.end(), part.begin(), part.end());
+    }
+
+    // all instances are alive and have distinct global ids
+    for (std::size_t i = 0; i != ids.size(); i += 97)
+        HPX_TEST_EQ(hpx::async<call_action>(ids[i]).get(), i);
+
+    std::vector<hpx::naming::gid_type> gids;
+    gids.reserve(ids.size());
+    for (hpx::id_type const& id : ids)
+        gids.push_back(id.get_gid());
+
+    std::sort(gids.begin(), gids.end());
+    HPX_TEST(std::adjacent_find(gids.begin(), gids.end()) == gids.end());
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Releasing instances of both types alternately makes every free hand back
+// the pending batch of freed objects of the other heap.
+void test_interleaved_destroy(std::size_t count)
+{
+    std::vector<hpx::id_type> ids;
+    ids.reserve(2 * count);
+    for (std::size_t i = 0; i != count; ++i)
+    {
+        ids.push_back(hpx::local_new<test_server>(i).get());
+        ids.push_back(hpx::local_new<other_server>().get());
+    }
+
+    for (std::size_t i = 0; i != ids.size(); i += 2)
+        HPX_TEST_EQ(hpx::async<call_action>(ids[i]).get(), i / 2);
+
+    while (!ids.empty())
+        ids.pop_back();
+
+    // the heaps are still usable afterwards
+    HPX_TEST_EQ(hpx::async<call_action>(
+        hpx::local_new<test_server>(std::size_t(42)).get()).get(),
+        std::size_t(42));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int main()
+{
+    // destroying the instances of one round returns their slots from many
+    // worker threads while the next round allocates new ones
+    for (std::size_t round = 0; round != 3; ++round)
+        test_concurrent_create_destroy(16, 1000);
+
+    test_interleaved_destroy(1000);
+
+    return hpx::util::report_errors();
+}
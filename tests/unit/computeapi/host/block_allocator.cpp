@@ -54,6 +54,79 @@ void test_bulk_allocator(std::size_t count)
     test_block_deallocation(alloc, p, count);
 }
 
+///////////////////////////////////////////////////////////////////////////////
+// Return whether the topology is able to report on which NUMA domain the
+// pages of a memory area are located.
+bool can_report_memlocation()
+{
+    auto const& topo = hpx::threads::get_topology();
+
+    std::size_t const page_size =
+        hpx::compute::host::detail::get_placement_page_size();
+
+    char* p = reinterpret_cast<char*>(topo.allocate(page_size));
+    *p = 0;
+
+    hpx::error_code ec(hpx::lightweight);
+    hpx::threads::mask_type location = topo.get_area_memlocation(p, ec);
+
+    topo.deallocate(p, page_size);
+
+    return !ec && hpx::threads::any(location);
+}
+
+template <typename T, typename Placement>
+void test_placement(std::size_t count, bool local)
+{
+    typedef hpx::compute::host::block_allocator<
+            T, hpx::parallel::execution::local_priority_queue_attached_executor,
+            Placement
+        > allocator_type;
+
+    allocator_type alloc(hpx::compute::host::numa_domains());
+
+    T* p = alloc.allocate(count);
+    alloc.bulk_construct(p, count);
+
+    // the pages holding the elements can't be on remote domains more often
+    // than there are pages
+    std::size_t const page_size =
+        hpx::compute::host::detail::get_placement_page_size();
+    std::size_t pages = (count * sizeof(T) + page_size - 1) / page_size + 1;
+    HPX_TEST(alloc.remote_pages(p, count) <= pages);
+
+    // all pages have to be local to the target processing them if the
+    // placement follows the chunk-to-domain mapping of the executor
+    if (local)
+    {
+        HPX_TEST_EQ(alloc.remote_pages(p, count), std::size_t(0));
+    }
+
+    alloc.migrate(p, count);
+    if (local)
+    {
+        HPX_TEST_EQ(alloc.remote_pages(p, count), std::size_t(0));
+    }
+
+    alloc.bulk_destroy(p, count);
+    alloc.deallocate(p, count);
+}
+
+template <typename T>
+void test_placement_policies(std::size_t count)
+{
+    using namespace hpx::compute::host;
+
+    // the location of the pages can only be verified if the topology is
+    // able to report it
+    bool const local = can_report_memlocation();
+
+    test_placement<T, first_touch_placement>(count, local);
+    test_placement<T, bind_placement>(count, local);
+    test_placement<T, migrate_placement>(count, local);
+    test_placement<T, interleaved_placement>(count, false);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 boost::atomic<std::size_t> construction_count(0);
 boost::atomic<std::size_t> destruction_count(0);
@@ -92,6 +165,12 @@ int hpx_main(boost::program_options::variables_map& vm)
         HPX_TEST_EQ(destruction_count.load(), count);
     }
 
+    {
+        std::size_t count = std::rand() % (1 << 24) + 1;
+        test_placement_policies<int>(count);
+        test_placement_policies<double>(count);
+    }
+
     return hpx::finalize();
 }
 
@@ -0,0 +1,63 @@
+//  Copyright (c) 2026 agent
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/hpx_main.hpp>
+#include <hpx/include/async.hpp>
+#include <hpx/include/lcos.hpp>
+#include <hpx/include/threads.hpp>
+#include <hpx/util/lightweight_test.hpp>
+
+#include <memory>
+
+#include "test_allocator.hpp"
+
+///////////////////////////////////////////////////////////////////////////////
+int increment(int i)
+{
+    return i + 1;
+}
+
+void wait_for_deallocation()
+{
+    // the thread running the task might still hold on to the shared state
+    while (test_alloc_base::count.load() != 0)
+        hpx::this_thread::yield();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int main()
+{
+    HPX_TEST_EQ(test_alloc_base::count, 0);
+    {
+        hpx::future<int> f = hpx::async(
+            std::allocator_arg, test_allocator<int>(), &increment, 41);
+        HPX_TEST_EQ(test_alloc_base::count, 1);
+        HPX_TEST_EQ(f.get(), 42);
+    }
+    wait_for_deallocation();
+    HPX_TEST_EQ(test_alloc_base::count, 0);
+    {
+        bool called = false;
+        hpx::future<void> f = hpx::async(
+            std::allocator_arg, test_allocator<void>(),
+            [&called]() { called = true; });
+        HPX_TEST_EQ(test_alloc_base::count, 1);
+        f.get();
+        HPX_TEST(called);
+    }
+    wait_for_deallocation();
+    HPX_TEST_EQ(test_alloc_base::count, 0);
+    {
+        hpx::lcos::local::packaged_task<int(int)> pt(
+            std::allocator_arg, test_allocator<int>(), &increment);
+        HPX_TEST_EQ(test_alloc_base::count, 1);
+        hpx::future<int> f = pt.get_future();
+        pt(41);
+        HPX_TEST_EQ(f.get(), 42);
+    }
+    HPX_TEST_EQ(test_alloc_base::count, 0);
+
+    return hpx::util::report_errors();
+}
@@ -0,0 +1,117 @@
+//  Copyright (c) 2026 agent
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// Continuations attached to a shared state have to be invoked exactly once,
+// the ones attached before the state became ready in the order they were
+// attached, also if the value is set while they are being attached.
+
+#include <hpx/hpx_init.hpp>
+#include <hpx/include/lcos.hpp>
+#include <hpx/include/threads.hpp>
+#include <hpx/util/lightweight_test.hpp>
+
+#include <boost/atomic.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#define NUM_CONTINUATIONS 10
+#define NUM_ROUNDS 1000
+
+///////////////////////////////////////////////////////////////////////////////
+void test_order()
+{
+    hpx::lcos::local::promise<int> p;
+    hpx::shared_future<int> f = p.get_future();
+
+    std::vector<int> order;
+    std::vector<hpx::future<void> > continuations;
+    for (int i = 0; i != NUM_CONTINUATIONS; ++i)
+    {
+        continuations.push_back(f.then(hpx::launch::sync,
+            [&order, i](hpx::shared_future<int> &&)
+            {
+                order.push_back(i);
+            }));
+    }
+
+    p.set_value(42);
+    hpx::wait_all(continuations);
+
+    HPX_TEST_EQ(order.size(), std::size_t(NUM_CONTINUATIONS));
+    for (std::size_t i = 0; i != order.size(); ++i)
+    {
+        HPX_TEST_EQ(order[i], int(i));
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// set the value while the continuations are being attached
+void test_concurrent()
+{
+    for (std::size_t round = 0; round != NUM_ROUNDS; ++round)
+    {
+        hpx::lcos::local::promise<int> p;
+        hpx::shared_future<int> f = p.get_future();
+
+        boost::atomic<int> count(0);
+        hpx::lcos::local::spinlock mtx;
+        std::vector<int> order;
+
+        hpx::future<void> setter = hpx::async(
+            [&p]()
+            {
+                p.set_value(42);
+            });
+
+        std::vector<hpx::future<void> > continuations;
+        for (int i = 0; i != NUM_CONTINUATIONS; ++i)
+        {
+            continuations.push_back(f.then(hpx::launch::sync,
+                [&count, &mtx, &order, i](hpx::shared_future<int> &&)
+                {
+                    ++count;
+                    std::lock_guard<hpx::lcos::local::spinlock> l(mtx);
+                    order.push_back(i);
+                }));
+        }
+
+        setter.get();
+        hpx::wait_all(continuations);
+
+        HPX_TEST_EQ(count.load(), NUM_CONTINUATIONS);
+        HPX_TEST_EQ(order.size(), std::size_t(NUM_CONTINUATIONS));
+
+        // every continuation has been invoked exactly once
+        std::sort(order.begin(), order.end());
+        for (std::size_t i = 0; i != order.size(); ++i)
+        {
+            HPX_TEST_EQ(order[i], int(i));
+        }
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main()
+{
+    test_order();
+    test_concurrent();
+
+    return hpx::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    // By default this test should run on all available cores
+    std::vector<std::string> const cfg = {
+        "hpx.os_threads=all"
+    };
+
+    HPX_TEST_EQ(hpx::init(argc, argv, cfg), 0);
+    return hpx::util::report_errors();
+}
@@ -9,9 +9,11 @@
 #include <hpx/include/threads.hpp>
 #include <hpx/include/threadmanager.hpp>
 #include <hpx/include/lcos.hpp>
+#include <hpx/lcos/detail/future_data.hpp>
 #include <hpx/util/lightweight_test.hpp>
 
 #include <chrono>
+#include <cstddef>
 #include <memory>
 #include <string>
 #include <utility>
@@ -137,6 +139,51 @@ void test_complex_then_chain_two()
     HPX_TEST(f2.get()==4);
 }
 
+///////////////////////////////////////////////////////////////////////////////
+bool is_same_thread(hpx::threads::thread_id_type const& id)
+{
+    return hpx::threads::get_self_id() == id;
+}
+
+void test_sync_if_cheap_then()
+{
+    hpx::threads::thread_id_type id = hpx::threads::get_self_id();
+
+    // continuations attached to a ready future run inline
+    hpx::lcos::future<bool> f1 = hpx::make_ready_future(1).then(
+        hpx::launch::sync_if_cheap,
+        [id](hpx::lcos::future<int>) { return is_same_thread(id); });
+    HPX_TEST(f1.get());
+
+    hpx::lcos::future<bool> f2 = hpx::dataflow(
+        hpx::launch::sync_if_cheap,
+        [id](hpx::lcos::future<int>) { return is_same_thread(id); },
+        hpx::make_ready_future(1));
+    HPX_TEST(f2.get());
+
+    hpx::lcos::future<bool> f3 = hpx::async(
+        hpx::launch::sync_if_cheap, &is_same_thread, id);
+    HPX_TEST(f3.get());
+}
+
+void test_sync_if_cheap_then_chain()
+{
+    // long chains of continuations are eventually moved to new threads
+    std::size_t const num_continuations =
+        10 * hpx::lcos::detail::get_max_continuation_inline_depth();
+
+    hpx::lcos::local::promise<int> p;
+    hpx::lcos::future<int> f = p.get_future();
+    for (std::size_t i = 0; i != num_continuations; ++i)
+    {
+        f = f.then(hpx::launch::sync_if_cheap,
+            [](hpx::lcos::future<int> f) { return f.get() + 1; });
+    }
+
+    p.set_value(0);
+    HPX_TEST_EQ(std::size_t(f.get()), num_continuations);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 using boost::program_options::variables_map;
 using boost::program_options::options_description;
@@ -152,6 +199,8 @@ int hpx_main(variables_map&)
         test_complex_then();
         test_complex_then_chain_one();
         test_complex_then_chain_two();
+        test_sync_if_cheap_then();
+        test_sync_if_cheap_then_chain();
     }
 
     hpx::finalize();
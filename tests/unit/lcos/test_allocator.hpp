@@ -11,6 +11,8 @@
 #include <hpx/include/lcos.hpp>
 #include <hpx/util/lightweight_test.hpp>
 
+#include <boost/atomic.hpp>
+
 #include <cstddef>
 #include <cstdint>
 #include <memory>
@@ -19,11 +21,12 @@
 
 struct test_alloc_base
 {
-    static int count;
+    // shared states may be released on any thread
+    static boost::atomic<int> count;
     static int throw_after;
 };
 
-int test_alloc_base::count = 0;
+boost::atomic<int> test_alloc_base::count(0);
 int test_alloc_base::throw_after = INT_MAX;
 
 template <typename T>
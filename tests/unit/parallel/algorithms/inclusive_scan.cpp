@@ -188,6 +188,16 @@ void inclusive_scan_bad_alloc_test()
 #endif
 }
 
+///////////////////////////////////////////////////////////////////////////////
+void inclusive_scan_noncommutative_test()
+{
+    using namespace hpx::parallel;
+
+    test_inclusive_scan_noncommutative(execution::seq);
+    test_inclusive_scan_noncommutative(execution::par);
+    test_inclusive_scan_noncommutative(execution::par_unseq);
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 void inclusive_scan_validate()
 {
@@ -224,6 +234,7 @@ int hpx_main(boost::program_options::variables_map& vm)
         inclusive_scan_exception_test();
         inclusive_scan_bad_alloc_test();
 
+        inclusive_scan_noncommutative_test();
         inclusive_scan_validate();
 #ifndef HPX_DEBUG
         inclusive_scan_benchmark();
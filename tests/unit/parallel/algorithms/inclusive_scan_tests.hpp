@@ -14,7 +14,10 @@
 
 #include <boost/iterator/counting_iterator.hpp>
 
+#include <algorithm>
 #include <cstddef>
+#include <cstdint>
+#include <cstdlib>
 #include <iostream>
 #include <iterator>
 #include <utility>
@@ -431,6 +434,49 @@ void test_inclusive_scan_bad_alloc_async(ExPolicy p, IteratorTag)
     HPX_TEST(returned_from_algorithm);
 }
 
+///////////////////////////////////////////////////////////////////////////////
+// The composition of affine functions x -> a*x + b is associative but not
+// commutative, the partition results have to be combined in order.
+typedef std::pair<std::uint64_t, std::uint64_t> affine_function;
+
+struct compose_affine_functions
+{
+    affine_function operator()(affine_function const& f,
+        affine_function const& g) const
+    {
+        return affine_function(g.first * f.first, g.first * f.second + g.second);
+    }
+};
+
+template <typename ExPolicy>
+void test_inclusive_scan_noncommutative(ExPolicy policy)
+{
+    static_assert(
+        hpx::parallel::execution::is_execution_policy<ExPolicy>::value,
+        "hpx::parallel::execution::is_execution_policy<ExPolicy>::value");
+
+    // large enough to create many partitions
+    std::vector<affine_function> c(1000007);
+    std::generate(std::begin(c), std::end(c),
+        []()
+        {
+            return affine_function(std::rand() % 7, std::rand() % 11);
+        });
+    std::vector<affine_function> d(c.size());
+
+    affine_function const init(1, 0);
+    hpx::parallel::inclusive_scan(policy, std::begin(c), std::end(c),
+        std::begin(d), compose_affine_functions(), init);
+
+    std::vector<affine_function> e(c.size());
+    hpx::parallel::v1::detail::sequential_inclusive_scan(
+        std::begin(c), std::end(c), std::begin(e), init,
+        compose_affine_functions());
+
+    HPX_TEST(std::equal(std::begin(d), std::end(d), std::begin(e)));
+}
+
+///////////////////////////////////////////////////////////////////////////////
 #define FILL_VALUE 10
 #define ARRAY_SIZE 10000
 
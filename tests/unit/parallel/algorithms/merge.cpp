@@ -0,0 +1,352 @@
+//  Copyright (c) 2026 agent
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/hpx_init.hpp>
+#include <hpx/hpx.hpp>
+#include <hpx/include/parallel_merge.hpp>
+#include <hpx/util/lightweight_test.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <iostream>
+#include <iterator>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "test_utils.hpp"
+
+// the size is chosen such that the parallel merge steps are exercised
+std::size_t const test_size = 300007;
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename ExPolicy, typename IteratorTag>
+void test_merge1(ExPolicy policy, IteratorTag)
+{
+    static_assert(
+        hpx::parallel::execution::is_execution_policy<ExPolicy>::value,
+        "hpx::parallel::execution::is_execution_policy<ExPolicy>::value");
+
+    typedef std::vector<std::size_t>::iterator base_iterator;
+    typedef test::test_iterator<base_iterator, IteratorTag> iterator;
+
+    std::vector<std::size_t> c1 = test::random_fill(test_size);
+    std::vector<std::size_t> c2 = test::random_fill(test_size / 3);
+
+    std::sort(std::begin(c1), std::end(c1));
+    std::sort(std::begin(c2), std::end(c2));
+
+    std::vector<std::size_t> c3(c1.size() + c2.size()), c4(c3.size());
+
+    auto result = hpx::parallel::merge(policy,
+        iterator(std::begin(c1)), iterator(std::end(c1)),
+        std::begin(c2), std::end(c2), std::begin(c3));
+    HPX_TEST(result == std::end(c3));
+
+    std::merge(std::begin(c1), std::end(c1),
+        std::begin(c2), std::end(c2), std::begin(c4));
+
+    // verify values
+    HPX_TEST(std::equal(std::begin(c3), std::end(c3), std::begin(c4)));
+}
+
+template <typename ExPolicy, typename IteratorTag>
+void test_merge1_async(ExPolicy p, IteratorTag)
+{
+    typedef std::vector<std::size_t>::iterator base_iterator;
+    typedef test::test_iterator<base_iterator, IteratorTag> iterator;
+
+    std::vector<std::size_t> c1 = test::random_fill(test_size);
+    std::vector<std::size_t> c2 = test::random_fill(test_size / 3);
+
+    std::sort(std::begin(c1), std::end(c1), std::greater<std::size_t>());
+    std::sort(std::begin(c2), std::end(c2), std::greater<std::size_t>());
+
+    std::vector<std::size_t> c3(c1.size() + c2.size()), c4(c3.size());
+
+    auto f = hpx::parallel::merge(p,
+        iterator(std::begin(c1)), iterator(std::end(c1)),
+        std::begin(c2), std::end(c2), std::begin(c3),
+        std::greater<std::size_t>());
+    HPX_TEST(f.get() == std::end(c3));
+
+    std::merge(std::begin(c1), std::end(c1),
+        std::begin(c2), std::end(c2), std::begin(c4),
+        std::greater<std::size_t>());
+
+    // verify values
+    HPX_TEST(std::equal(std::begin(c3), std::end(c3), std::begin(c4)));
+}
+
+template <typename IteratorTag>
+void test_merge1()
+{
+    using namespace hpx::parallel;
+
+    test_merge1(execution::seq, IteratorTag());
+    test_merge1(execution::par, IteratorTag());
+    test_merge1(execution::par_unseq, IteratorTag());
+
+    test_merge1_async(execution::seq(execution::task), IteratorTag());
+    test_merge1_async(execution::par(execution::task), IteratorTag());
+
+#if defined(HPX_HAVE_GENERIC_EXECUTION_POLICY)
+    test_merge1(execution_policy(execution::seq), IteratorTag());
+    test_merge1(execution_policy(execution::par), IteratorTag());
+    test_merge1(execution_policy(execution::par_unseq), IteratorTag());
+#endif
+}
+
+void merge_test1()
+{
+    test_merge1<std::random_access_iterator_tag>();
+    test_merge1<std::forward_iterator_tag>();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// equivalent elements from the first range have to precede the ones from
+// the second range
+template <typename ExPolicy>
+void test_merge2(ExPolicy policy)
+{
+    std::vector<std::size_t> c1 = test::random_fill(test_size);
+    std::vector<std::size_t> c2 = test::random_fill(test_size);
+
+    // mark the elements of the second range by the lowest bit
+    for (std::size_t& v : c1)
+        v = (v % 1000) << 1;
+    for (std::size_t& v : c2)
+        v = ((v % 1000) << 1) | 1;
+
+    auto comp = [](std::size_t l, std::size_t r) { return (l >> 1) < (r >> 1); };
+
+    std::sort(std::begin(c1), std::end(c1), comp);
+    std::sort(std::begin(c2), std::end(c2), comp);
+
+    std::vector<std::size_t> c3(c1.size() + c2.size()), c4(c3.size());
+
+    hpx::parallel::merge(policy, std::begin(c1), std::end(c1),
+        std::begin(c2), std::end(c2), std::begin(c3), comp);
+
+    std::merge(std::begin(c1), std::end(c1),
+        std::begin(c2), std::end(c2), std::begin(c4), comp);
+
+    // verify values
+    HPX_TEST(std::equal(std::begin(c3), std::end(c3), std::begin(c4)));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename ExPolicy>
+void test_inplace_merge(ExPolicy policy)
+{
+    static_assert(
+        hpx::parallel::execution::is_execution_policy<ExPolicy>::value,
+        "hpx::parallel::execution::is_execution_policy<ExPolicy>::value");
+
+    std::vector<std::size_t> c = test::random_fill(test_size);
+    std::size_t middle = std::rand() % c.size(); //-V104
+
+    std::sort(std::begin(c), std::begin(c) + middle);
+    std::sort(std::begin(c) + middle, std::end(c));
+
+    std::vector<std::size_t> d = c;
+
+    auto result = hpx::parallel::inplace_merge(policy,
+        std::begin(c), std::begin(c) + middle, std::end(c));
+    HPX_TEST(result == std::end(c));
+
+    std::inplace_merge(std::begin(d), std::begin(d) + middle, std::end(d));
+
+    // verify values
+    HPX_TEST(std::equal(std::begin(c), std::end(c), std::begin(d)));
+}
+
+template <typename ExPolicy>
+void test_inplace_merge_async(ExPolicy p)
+{
+    std::vector<std::size_t> c = test::random_fill(test_size);
+    std::size_t middle = std::rand() % c.size(); //-V104
+
+    std::sort(std::begin(c), std::begin(c) + middle);
+    std::sort(std::begin(c) + middle, std::end(c));
+
+    std::vector<std::size_t> d = c;
+
+    auto f = hpx::parallel::inplace_merge(p,
+        std::begin(c), std::begin(c) + middle, std::end(c));
+    HPX_TEST(f.get() == std::end(c));
+
+    std::inplace_merge(std::begin(d), std::begin(d) + middle, std::end(d));
+
+    // verify values
+    HPX_TEST(std::equal(std::begin(c), std::end(c), std::begin(d)));
+}
+
+// sequences not fitting into an auxiliary buffer are merged in place
+template <typename ExPolicy>
+void test_rotate_merge(ExPolicy policy)
+{
+    std::vector<std::size_t> c = test::random_fill(test_size);
+    std::size_t middle = std::rand() % c.size(); //-V104
+
+    std::sort(std::begin(c), std::begin(c) + middle);
+    std::sort(std::begin(c) + middle, std::end(c));
+
+    std::vector<std::size_t> d = c;
+
+    hpx::parallel::v1::detail::parallel_rotate_merge(policy,
+        std::begin(c), std::begin(c) + middle, std::end(c),
+        std::less<std::size_t>()).get();
+
+    std::inplace_merge(std::begin(d), std::begin(d) + middle, std::end(d));
+
+    // verify values
+    HPX_TEST(std::equal(std::begin(c), std::end(c), std::begin(d)));
+}
+
+void merge_test2()
+{
+    using namespace hpx::parallel;
+
+    test_merge2(execution::seq);
+    test_merge2(execution::par);
+    test_merge2(execution::par_unseq);
+
+    test_inplace_merge(execution::seq);
+    test_inplace_merge(execution::par);
+    test_inplace_merge(execution::par_unseq);
+
+    test_inplace_merge_async(execution::seq(execution::task));
+    test_inplace_merge_async(execution::par(execution::task));
+
+    test_rotate_merge(execution::par);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename ExPolicy>
+void test_merge_exception(ExPolicy policy)
+{
+    std::vector<std::size_t> c1 = test::random_fill(test_size);
+    std::vector<std::size_t> c2 = test::random_fill(test_size);
+
+    std::sort(std::begin(c1), std::end(c1));
+    std::sort(std::begin(c2), std::end(c2));
+
+    std::vector<std::size_t> c3(c1.size() + c2.size());
+
+    bool caught_exception = false;
+    try {
+        hpx::parallel::merge(policy, std::begin(c1), std::end(c1),
+            std::begin(c2), std::end(c2), std::begin(c3),
+            [](std::size_t, std::size_t) -> bool
+            {
+                throw std::runtime_error("test");
+                return true;
+            });
+
+        HPX_TEST(false);
+    }
+    catch(hpx::exception_list const&) {
+        caught_exception = true;
+    }
+    catch(...) {
+        HPX_TEST(false);
+    }
+
+    HPX_TEST(caught_exception);
+}
+
+template <typename ExPolicy>
+void test_merge_bad_alloc_async(ExPolicy p)
+{
+    std::vector<std::size_t> c1 = test::random_fill(test_size);
+    std::vector<std::size_t> c2 = test::random_fill(test_size);
+
+    std::sort(std::begin(c1), std::end(c1));
+    std::sort(std::begin(c2), std::end(c2));
+
+    std::vector<std::size_t> c3(c1.size() + c2.size());
+
+    bool caught_bad_alloc = false;
+    bool returned_from_algorithm = false;
+    try {
+        auto f = hpx::parallel::merge(p, std::begin(c1), std::end(c1),
+            std::begin(c2), std::end(c2), std::begin(c3),
+            [](std::size_t, std::size_t) -> bool
+            {
+                throw std::bad_alloc();
+                return true;
+            });
+
+        returned_from_algorithm = true;
+        f.get();
+
+        HPX_TEST(false);
+    }
+    catch(std::bad_alloc const&) {
+        caught_bad_alloc = true;
+    }
+    catch(...) {
+        HPX_TEST(false);
+    }
+
+    HPX_TEST(caught_bad_alloc);
+    HPX_TEST(returned_from_algorithm);
+}
+
+void merge_exception_test()
+{
+    using namespace hpx::parallel;
+
+    // If the execution policy object is of type vector_execution_policy,
+    // std::terminate shall be called. therefore we do not test exceptions
+    // with a vector execution policy
+    test_merge_exception(execution::seq);
+    test_merge_exception(execution::par);
+
+    test_merge_bad_alloc_async(execution::seq(execution::task));
+    test_merge_bad_alloc_async(execution::par(execution::task));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main(boost::program_options::variables_map& vm)
+{
+    unsigned int seed = (unsigned int)std::time(nullptr);
+    if (vm.count("seed"))
+        seed = vm["seed"].as<unsigned int>();
+
+    std::cout << "using seed: " << seed << std::endl;
+    std::srand(seed);
+
+    merge_test1();
+    merge_test2();
+    merge_exception_test();
+    return hpx::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    // add command line option which controls the random number generator seed
+    using namespace boost::program_options;
+    options_description desc_commandline(
+        "Usage: " HPX_APPLICATION_STRING " [options]");
+
+    desc_commandline.add_options()
+        ("seed,s", value<unsigned int>(),
+        "the random number generator seed to use for this run")
+        ;
+
+    // By default this test should run on all available cores
+    std::vector<std::string> const cfg = {
+        "hpx.os_threads=all"
+    };
+
+    // Initialize and run HPX
+    HPX_TEST_EQ_MSG(hpx::init(desc_commandline, argc, argv, cfg), 0,
+        "HPX main exited with non-zero status");
+
+    return hpx::util::report_errors();
+}
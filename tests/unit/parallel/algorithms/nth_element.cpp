@@ -0,0 +1,184 @@
+//  Copyright (c) 2026 agent
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/hpx_init.hpp>
+#include <hpx/hpx.hpp>
+#include <hpx/include/parallel_sort.hpp>
+#include <hpx/util/lightweight_test.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <iostream>
+#include <iterator>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "test_utils.hpp"
+
+// the size is chosen such that the parallel partitioning is exercised
+std::size_t const test_size = 500007;
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename Compare>
+void verify_nth_element(std::vector<std::size_t> const& c,
+    std::vector<std::size_t> d, std::size_t nth, Compare comp)
+{
+    std::sort(std::begin(d), std::end(d), comp);
+    HPX_TEST_EQ(c[nth], d[nth]);
+
+    std::size_t count = 0;
+    for (std::size_t i = 0; i != nth; ++i)
+    {
+        if (comp(c[nth], c[i]))
+            ++count;
+    }
+    for (std::size_t i = nth + 1; i < c.size(); ++i)
+    {
+        if (comp(c[i], c[nth]))
+            ++count;
+    }
+    HPX_TEST_EQ(count, std::size_t(0));
+}
+
+template <typename ExPolicy>
+void test_nth_element1(ExPolicy policy, std::size_t modulus)
+{
+    static_assert(
+        hpx::parallel::execution::is_execution_policy<ExPolicy>::value,
+        "hpx::parallel::execution::is_execution_policy<ExPolicy>::value");
+
+    std::vector<std::size_t> c = test::random_fill(test_size);
+    for (std::size_t& v : c)
+        v %= modulus;
+    std::vector<std::size_t> d = c;
+
+    std::size_t nth = std::rand() % c.size(); //-V104
+
+    auto result = hpx::parallel::nth_element(policy,
+        std::begin(c), std::begin(c) + nth, std::end(c));
+    HPX_TEST(result == std::end(c));
+
+    verify_nth_element(c, d, nth, std::less<std::size_t>());
+}
+
+template <typename ExPolicy>
+void test_nth_element1_async(ExPolicy p, std::size_t modulus)
+{
+    std::vector<std::size_t> c = test::random_fill(test_size);
+    for (std::size_t& v : c)
+        v %= modulus;
+    std::vector<std::size_t> d = c;
+
+    std::size_t nth = std::rand() % c.size(); //-V104
+
+    auto f = hpx::parallel::nth_element(p,
+        std::begin(c), std::begin(c) + nth, std::end(c),
+        std::greater<std::size_t>());
+    HPX_TEST(f.get() == std::end(c));
+
+    verify_nth_element(c, d, nth, std::greater<std::size_t>());
+}
+
+void nth_element_test1()
+{
+    using namespace hpx::parallel;
+
+    // distinct values as well as many equivalent elements
+    for (std::size_t modulus : { std::size_t(RAND_MAX) + 1, std::size_t(7) })
+    {
+        test_nth_element1(execution::seq, modulus);
+        test_nth_element1(execution::par, modulus);
+        test_nth_element1(execution::par_unseq, modulus);
+
+        test_nth_element1_async(execution::seq(execution::task), modulus);
+        test_nth_element1_async(execution::par(execution::task), modulus);
+
+#if defined(HPX_HAVE_GENERIC_EXECUTION_POLICY)
+        test_nth_element1(execution_policy(execution::seq), modulus);
+        test_nth_element1(execution_policy(execution::par), modulus);
+        test_nth_element1(execution_policy(execution::par_unseq), modulus);
+#endif
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename ExPolicy>
+void test_nth_element_exception(ExPolicy policy)
+{
+    std::vector<std::size_t> c = test::random_fill(test_size);
+
+    bool caught_exception = false;
+    try {
+        hpx::parallel::nth_element(policy,
+            std::begin(c), std::begin(c) + c.size() / 2, std::end(c),
+            [](std::size_t, std::size_t) -> bool
+            {
+                throw std::runtime_error("test");
+                return true;
+            });
+
+        HPX_TEST(false);
+    }
+    catch(hpx::exception_list const&) {
+        caught_exception = true;
+    }
+    catch(...) {
+        HPX_TEST(false);
+    }
+
+    HPX_TEST(caught_exception);
+}
+
+void nth_element_exception_test()
+{
+    using namespace hpx::parallel;
+
+    // If the execution policy object is of type vector_execution_policy,
+    // std::terminate shall be called. therefore we do not test exceptions
+    // with a vector execution policy
+    test_nth_element_exception(execution::seq);
+    test_nth_element_exception(execution::par);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main(boost::program_options::variables_map& vm)
+{
+    unsigned int seed = (unsigned int)std::time(nullptr);
+    if (vm.count("seed"))
+        seed = vm["seed"].as<unsigned int>();
+
+    std::cout << "using seed: " << seed << std::endl;
+    std::srand(seed);
+
+    nth_element_test1();
+    nth_element_exception_test();
+    return hpx::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    // add command line option which controls the random number generator seed
+    using namespace boost::program_options;
+    options_description desc_commandline(
+        "Usage: " HPX_APPLICATION_STRING " [options]");
+
+    desc_commandline.add_options()
+        ("seed,s", value<unsigned int>(),
+        "the random number generator seed to use for this run")
+        ;
+
+    // By default this test should run on all available cores
+    std::vector<std::string> const cfg = {
+        "hpx.os_threads=all"
+    };
+
+    // Initialize and run HPX
+    HPX_TEST_EQ_MSG(hpx::init(desc_commandline, argc, argv, cfg), 0,
+        "HPX main exited with non-zero status");
+
+    return hpx::util::report_errors();
+}
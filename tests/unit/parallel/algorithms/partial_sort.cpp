@@ -0,0 +1,164 @@
+//  Copyright (c) 2026 agent
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/hpx_init.hpp>
+#include <hpx/hpx.hpp>
+#include <hpx/include/parallel_sort.hpp>
+#include <hpx/util/lightweight_test.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <iostream>
+#include <iterator>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "test_utils.hpp"
+
+// the size is chosen such that the parallel selection is exercised
+std::size_t const test_size = 500007;
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename ExPolicy>
+void test_partial_sort1(ExPolicy policy, std::size_t middle)
+{
+    static_assert(
+        hpx::parallel::execution::is_execution_policy<ExPolicy>::value,
+        "hpx::parallel::execution::is_execution_policy<ExPolicy>::value");
+
+    std::vector<std::size_t> c = test::random_fill(test_size);
+    std::vector<std::size_t> d = c;
+
+    auto result = hpx::parallel::partial_sort(policy,
+        std::begin(c), std::begin(c) + middle, std::end(c));
+    HPX_TEST(result == std::end(c));
+
+    std::partial_sort(std::begin(d), std::begin(d) + middle, std::end(d));
+
+    // verify values
+    HPX_TEST(std::equal(std::begin(c), std::begin(c) + middle,
+        std::begin(d)));
+}
+
+template <typename ExPolicy>
+void test_partial_sort1_async(ExPolicy p, std::size_t middle)
+{
+    std::vector<std::size_t> c = test::random_fill(test_size);
+    std::vector<std::size_t> d = c;
+
+    auto f = hpx::parallel::partial_sort(p,
+        std::begin(c), std::begin(c) + middle, std::end(c),
+        std::greater<std::size_t>());
+    HPX_TEST(f.get() == std::end(c));
+
+    std::partial_sort(std::begin(d), std::begin(d) + middle, std::end(d),
+        std::greater<std::size_t>());
+
+    // verify values
+    HPX_TEST(std::equal(std::begin(c), std::begin(c) + middle,
+        std::begin(d)));
+}
+
+void partial_sort_test1()
+{
+    using namespace hpx::parallel;
+
+    // a few elements, the larger part, and all elements
+    for (std::size_t middle : { std::size_t(17), test_size / 2, test_size })
+    {
+        test_partial_sort1(execution::seq, middle);
+        test_partial_sort1(execution::par, middle);
+        test_partial_sort1(execution::par_unseq, middle);
+
+        test_partial_sort1_async(execution::seq(execution::task), middle);
+        test_partial_sort1_async(execution::par(execution::task), middle);
+
+#if defined(HPX_HAVE_GENERIC_EXECUTION_POLICY)
+        test_partial_sort1(execution_policy(execution::seq), middle);
+        test_partial_sort1(execution_policy(execution::par), middle);
+        test_partial_sort1(execution_policy(execution::par_unseq), middle);
+#endif
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename ExPolicy>
+void test_partial_sort_exception(ExPolicy policy)
+{
+    std::vector<std::size_t> c = test::random_fill(test_size);
+
+    bool caught_exception = false;
+    try {
+        hpx::parallel::partial_sort(policy,
+            std::begin(c), std::begin(c) + 17, std::end(c),
+            [](std::size_t, std::size_t) -> bool
+            {
+                throw std::runtime_error("test");
+                return true;
+            });
+
+        HPX_TEST(false);
+    }
+    catch(hpx::exception_list const&) {
+        caught_exception = true;
+    }
+    catch(...) {
+        HPX_TEST(false);
+    }
+
+    HPX_TEST(caught_exception);
+}
+
+void partial_sort_exception_test()
+{
+    using namespace hpx::parallel;
+
+    // If the execution policy object is of type vector_execution_policy,
+    // std::terminate shall be called. therefore we do not test exceptions
+    // with a vector execution policy
+    test_partial_sort_exception(execution::seq);
+    test_partial_sort_exception(execution::par);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main(boost::program_options::variables_map& vm)
+{
+    unsigned int seed = (unsigned int)std::time(nullptr);
+    if (vm.count("seed"))
+        seed = vm["seed"].as<unsigned int>();
+
+    std::cout << "using seed: " << seed << std::endl;
+    std::srand(seed);
+
+    partial_sort_test1();
+    partial_sort_exception_test();
+    return hpx::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    // add command line option which controls the random number generator seed
+    using namespace boost::program_options;
+    options_description desc_commandline(
+        "Usage: " HPX_APPLICATION_STRING " [options]");
+
+    desc_commandline.add_options()
+        ("seed,s", value<unsigned int>(),
+        "the random number generator seed to use for this run")
+        ;
+
+    // By default this test should run on all available cores
+    std::vector<std::string> const cfg = {
+        "hpx.os_threads=all"
+    };
+
+    // Initialize and run HPX
+    HPX_TEST_EQ_MSG(hpx::init(desc_commandline, argc, argv, cfg), 0,
+        "HPX main exited with non-zero status");
+
+    return hpx::util::report_errors();
+}
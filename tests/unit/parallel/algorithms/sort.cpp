@@ -6,7 +6,10 @@
 #include <hpx/hpx_init.hpp>
 #include <hpx/hpx.hpp>
 
+#include <algorithm>
 #include <cstddef>
+#include <cstdint>
+#include <functional>
 #include <iostream>
 #include <string>
 #include <vector>
@@ -169,6 +172,51 @@ void test_sort2()
 #endif
 }
 
+////////////////////////////////////////////////////////////////////////////////
+// arithmetic keys compared using operator< are sorted using a radix sort,
+// make sure negative values are handled correctly
+template <typename ExPolicy, typename T, typename Compare>
+void test_sort3(ExPolicy && policy, T, Compare comp)
+{
+    static_assert(
+        hpx::parallel::execution::is_execution_policy<ExPolicy>::value,
+        "hpx::parallel::execution::is_execution_policy<ExPolicy>::value");
+    msg(typeid(ExPolicy).name(), typeid(T).name(), typeid(Compare).name(),
+        sync, signed);
+
+    std::vector<T> c(HPX_SORT_TEST_SIZE);
+    for (T& t : c)
+        t = T(std::rand() - RAND_MAX / 2) / T(7);
+    std::vector<T> d = c;
+
+    std::uint64_t t = hpx::util::high_resolution_clock::now();
+    hpx::parallel::sort(std::forward<ExPolicy>(policy),
+        c.begin(), c.end(), comp);
+    std::uint64_t elapsed = hpx::util::high_resolution_clock::now() - t;
+
+    std::sort(d.begin(), d.end());
+
+    HPX_TEST(verify(c, std::less<T>(), elapsed, true) != 0);
+    HPX_TEST(c == d);
+}
+
+void test_sort3()
+{
+    using namespace hpx::parallel;
+
+    test_sort3(execution::seq, int(), std::less<int>());
+    test_sort3(execution::par, int(), std::less<int>());
+    test_sort3(execution::par_unseq, std::int64_t(), std::less<std::int64_t>());
+
+    test_sort3(execution::seq, std::int8_t(), std::less<std::int8_t>());
+    test_sort3(execution::par, std::int16_t(), std::less<std::int16_t>());
+
+    test_sort3(execution::seq, float(), std::less<float>());
+    test_sort3(execution::par, float(), std::less<float>());
+    test_sort3(execution::par, double(), std::less<double>());
+    test_sort3(execution::par_unseq, double(), std::less<double>());
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 int hpx_main(boost::program_options::variables_map& vm)
 {
@@ -186,6 +234,7 @@ int hpx_main(boost::program_options::variables_map& vm)
     else {
         test_sort1();
         test_sort2();
+        test_sort3();
 #ifndef HPX_DEBUG
         sort_benchmark();
 #endif
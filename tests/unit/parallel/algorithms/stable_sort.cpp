@@ -0,0 +1,361 @@
+//  Copyright (c) 2026 agent
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/hpx_init.hpp>
+#include <hpx/hpx.hpp>
+#include <hpx/include/parallel_sort.hpp>
+#include <hpx/util/lightweight_test.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <iostream>
+#include <iterator>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "test_utils.hpp"
+
+// the size is chosen such that the parallel merge steps are exercised
+std::size_t const test_size = 500007;
+
+typedef std::pair<std::size_t, std::size_t> element_type;
+
+///////////////////////////////////////////////////////////////////////////////
+// all elements are sorted by their key only, the second member of each pair
+// records the original position of the element
+std::vector<element_type> make_elements(std::size_t size)
+{
+    std::vector<element_type> c;
+    c.reserve(size);
+    for (std::size_t i = 0; i != size; ++i)
+        c.push_back(element_type(std::rand() % 1000, i));
+    return c;
+}
+
+struct compare_keys
+{
+    bool operator()(element_type const& lhs, element_type const& rhs) const
+    {
+        return lhs.first < rhs.first;
+    }
+};
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename ExPolicy>
+void test_stable_sort1(ExPolicy policy)
+{
+    static_assert(
+        hpx::parallel::execution::is_execution_policy<ExPolicy>::value,
+        "hpx::parallel::execution::is_execution_policy<ExPolicy>::value");
+
+    std::vector<std::size_t> c = test::random_fill(test_size);
+    std::vector<std::size_t> d = c;
+
+    auto result = hpx::parallel::stable_sort(policy, std::begin(c), std::end(c));
+    HPX_TEST(result == std::end(c));
+
+    std::stable_sort(std::begin(d), std::end(d));
+
+    // verify values
+    HPX_TEST(std::equal(std::begin(c), std::end(c), std::begin(d)));
+}
+
+template <typename ExPolicy>
+void test_stable_sort1_async(ExPolicy p)
+{
+    std::vector<std::size_t> c = test::random_fill(test_size);
+    std::vector<std::size_t> d = c;
+
+    auto f = hpx::parallel::stable_sort(p, std::begin(c), std::end(c),
+        std::greater<std::size_t>());
+    HPX_TEST(f.get() == std::end(c));
+
+    std::stable_sort(std::begin(d), std::end(d), std::greater<std::size_t>());
+
+    // verify values
+    HPX_TEST(std::equal(std::begin(c), std::end(c), std::begin(d)));
+}
+
+void stable_sort_test1()
+{
+    using namespace hpx::parallel;
+
+    test_stable_sort1(execution::seq);
+    test_stable_sort1(execution::par);
+    test_stable_sort1(execution::par_unseq);
+
+    test_stable_sort1_async(execution::seq(execution::task));
+    test_stable_sort1_async(execution::par(execution::task));
+
+#if defined(HPX_HAVE_GENERIC_EXECUTION_POLICY)
+    test_stable_sort1(execution_policy(execution::seq));
+    test_stable_sort1(execution_policy(execution::par));
+    test_stable_sort1(execution_policy(execution::par_unseq));
+#endif
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename ExPolicy>
+void test_stable_sort2(ExPolicy policy)
+{
+    static_assert(
+        hpx::parallel::execution::is_execution_policy<ExPolicy>::value,
+        "hpx::parallel::execution::is_execution_policy<ExPolicy>::value");
+
+    // many equal keys, the original order of those has to be preserved
+    std::vector<element_type> c = make_elements(test_size);
+
+    hpx::parallel::stable_sort(policy, std::begin(c), std::end(c),
+        compare_keys());
+
+    std::size_t count = 0;
+    for (std::size_t i = 1; i < c.size(); ++i)
+    {
+        if (c[i - 1].first > c[i].first ||
+            (c[i - 1].first == c[i].first && c[i - 1].second > c[i].second))
+        {
+            ++count;
+        }
+    }
+    HPX_TEST_EQ(count, std::size_t(0));
+}
+
+template <typename ExPolicy>
+void test_stable_sort2_proj(ExPolicy policy)
+{
+    std::vector<element_type> c = make_elements(test_size);
+    std::vector<element_type> d = c;
+
+    hpx::parallel::stable_sort(policy, std::begin(c), std::end(c),
+        std::less<std::size_t>(),
+        [](element_type const& e) { return e.first; });
+
+    std::stable_sort(std::begin(d), std::end(d), compare_keys());
+
+    // verify values
+    HPX_TEST(std::equal(std::begin(c), std::end(c), std::begin(d)));
+}
+
+void stable_sort_test2()
+{
+    using namespace hpx::parallel;
+
+    test_stable_sort2(execution::seq);
+    test_stable_sort2(execution::par);
+    test_stable_sort2(execution::par_unseq);
+
+    test_stable_sort2_proj(execution::seq);
+    test_stable_sort2_proj(execution::par);
+    test_stable_sort2_proj(execution::par_unseq);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// the auxiliary buffer must not require the elements to be default
+// constructible or copyable
+struct move_only_element
+{
+    explicit move_only_element(element_type const& e)
+      : value_(e)
+    {}
+
+    move_only_element(move_only_element const&) = delete;
+    move_only_element& operator=(move_only_element const&) = delete;
+
+    move_only_element(move_only_element&&) = default;
+    move_only_element& operator=(move_only_element&&) = default;
+
+    element_type value_;
+};
+
+template <typename ExPolicy>
+void test_stable_sort3(ExPolicy policy)
+{
+    std::vector<element_type> d = make_elements(test_size);
+
+    std::vector<move_only_element> c;
+    c.reserve(d.size());
+    for (element_type const& e : d)
+        c.push_back(move_only_element(e));
+
+    hpx::parallel::stable_sort(policy, std::begin(c), std::end(c),
+        [](move_only_element const& lhs, move_only_element const& rhs)
+        {
+            return lhs.value_.first < rhs.value_.first;
+        });
+
+    std::stable_sort(std::begin(d), std::end(d), compare_keys());
+
+    // verify values
+    HPX_TEST(std::equal(std::begin(c), std::end(c), std::begin(d),
+        [](move_only_element const& lhs, element_type const& rhs)
+        {
+            return lhs.value_ == rhs;
+        }));
+}
+
+void stable_sort_test3()
+{
+    using namespace hpx::parallel;
+
+    test_stable_sort3(execution::seq);
+    test_stable_sort3(execution::par);
+    test_stable_sort3(execution::par_unseq);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Sequences exceeding the auxiliary buffer are sorted in parts which are
+// merged in place. Use buffers much smaller than the sequence to exercise
+// this without having to sort more than 1 GiB of data.
+template <typename ExPolicy>
+void test_stable_sort_bounded(ExPolicy policy, std::size_t buffer_size)
+{
+    typedef hpx::parallel::v1::detail::auxiliary_buffer<element_type>
+        buffer_type;
+
+    std::vector<element_type> c = make_elements(test_size);
+    std::vector<element_type> d = c;
+
+    std::shared_ptr<buffer_type> buffer;
+    if (buffer_size != 0)
+    {
+        buffer = buffer_type::create(buffer_size);
+        HPX_TEST(buffer && buffer->size() == buffer_size);
+    }
+
+    hpx::parallel::v1::detail::stable_sort_bounded(policy,
+        std::begin(c), std::end(c), buffer, compare_keys()).get();
+
+    std::stable_sort(std::begin(d), std::end(d), compare_keys());
+
+    // verify values, the original positions verify the stability
+    HPX_TEST(c == d);
+}
+
+void stable_sort_bounded_test()
+{
+    using namespace hpx::parallel;
+
+    test_stable_sort_bounded(execution::par, test_size / 7);
+    test_stable_sort_bounded(execution::par, test_size / 2 + 1);
+    test_stable_sort_bounded(execution::par, 0);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename ExPolicy>
+void test_stable_sort_exception(ExPolicy policy)
+{
+    std::vector<std::size_t> c = test::random_fill(test_size);
+
+    bool caught_exception = false;
+    try {
+        hpx::parallel::stable_sort(policy, std::begin(c), std::end(c),
+            [](std::size_t, std::size_t) -> bool
+            {
+                throw std::runtime_error("test");
+                return true;
+            });
+
+        HPX_TEST(false);
+    }
+    catch(hpx::exception_list const&) {
+        caught_exception = true;
+    }
+    catch(...) {
+        HPX_TEST(false);
+    }
+
+    HPX_TEST(caught_exception);
+}
+
+template <typename ExPolicy>
+void test_stable_sort_bad_alloc_async(ExPolicy p)
+{
+    std::vector<std::size_t> c = test::random_fill(test_size);
+
+    bool caught_bad_alloc = false;
+    bool returned_from_algorithm = false;
+    try {
+        auto f = hpx::parallel::stable_sort(p, std::begin(c), std::end(c),
+            [](std::size_t, std::size_t) -> bool
+            {
+                throw std::bad_alloc();
+                return true;
+            });
+
+        returned_from_algorithm = true;
+        f.get();
+
+        HPX_TEST(false);
+    }
+    catch(std::bad_alloc const&) {
+        caught_bad_alloc = true;
+    }
+    catch(...) {
+        HPX_TEST(false);
+    }
+
+    HPX_TEST(caught_bad_alloc);
+    HPX_TEST(returned_from_algorithm);
+}
+
+void stable_sort_exception_test()
+{
+    using namespace hpx::parallel;
+
+    // If the execution policy object is of type vector_execution_policy,
+    // std::terminate shall be called. therefore we do not test exceptions
+    // with a vector execution policy
+    test_stable_sort_exception(execution::seq);
+    test_stable_sort_exception(execution::par);
+
+    test_stable_sort_bad_alloc_async(execution::seq(execution::task));
+    test_stable_sort_bad_alloc_async(execution::par(execution::task));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main(boost::program_options::variables_map& vm)
+{
+    unsigned int seed = (unsigned int)std::time(nullptr);
+    if (vm.count("seed"))
+        seed = vm["seed"].as<unsigned int>();
+
+    std::cout << "using seed: " << seed << std::endl;
+    std::srand(seed);
+
+    stable_sort_test1();
+    stable_sort_test2();
+    stable_sort_test3();
+    stable_sort_bounded_test();
+    stable_sort_exception_test();
+    return hpx::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    // add command line option which controls the random number generator seed
+    using namespace boost::program_options;
+    options_description desc_commandline(
+        "Usage: " HPX_APPLICATION_STRING " [options]");
+
+    desc_commandline.add_options()
+        ("seed,s", value<unsigned int>(),
+        "the random number generator seed to use for this run")
+        ;
+
+    // By default this test should run on all available cores
+    std::vector<std::string> const cfg = {
+        "hpx.os_threads=all"
+    };
+
+    // Initialize and run HPX
+    HPX_TEST_EQ_MSG(hpx::init(desc_commandline, argc, argv, cfg), 0,
+        "HPX main exited with non-zero status");
+
+    return hpx::util::report_errors();
+}
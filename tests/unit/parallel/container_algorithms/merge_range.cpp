@@ -0,0 +1,120 @@
+//  Copyright (c) 2026 agent
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/hpx_init.hpp>
+#include <hpx/hpx.hpp>
+#include <hpx/include/parallel_merge.hpp>
+#include <hpx/util/lightweight_test.hpp>
+#include <hpx/util/iterator_range.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <iostream>
+#include <iterator>
+#include <string>
+#include <vector>
+
+#include "test_utils.hpp"
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename ExPolicy>
+void test_merge(ExPolicy policy)
+{
+    static_assert(
+        hpx::parallel::execution::is_execution_policy<ExPolicy>::value,
+        "hpx::parallel::execution::is_execution_policy<ExPolicy>::value");
+
+    std::vector<std::size_t> c1(300007), c2(100003);
+    std::generate(std::begin(c1), std::end(c1), std::rand);
+    std::generate(std::begin(c2), std::end(c2), std::rand);
+
+    std::sort(std::begin(c1), std::end(c1));
+    std::sort(std::begin(c2), std::end(c2));
+
+    std::vector<std::size_t> c3(c1.size() + c2.size()), c4(c3.size());
+
+    hpx::parallel::merge(policy, c1, c2, std::begin(c3));
+    std::merge(std::begin(c1), std::end(c1),
+        std::begin(c2), std::end(c2), std::begin(c4));
+
+    // verify values
+    HPX_TEST(std::equal(std::begin(c3), std::end(c3), std::begin(c4)));
+}
+
+template <typename ExPolicy>
+void test_inplace_merge_async(ExPolicy p)
+{
+    std::vector<std::size_t> c(300007);
+    std::generate(std::begin(c), std::end(c), std::rand);
+
+    std::size_t middle = std::rand() % c.size(); //-V104
+    std::sort(std::begin(c), std::begin(c) + middle,
+        std::greater<std::size_t>());
+    std::sort(std::begin(c) + middle, std::end(c),
+        std::greater<std::size_t>());
+
+    std::vector<std::size_t> d = c;
+
+    auto f = hpx::parallel::inplace_merge(p, c, std::begin(c) + middle,
+        std::greater<std::size_t>());
+    f.wait();
+
+    std::inplace_merge(std::begin(d), std::begin(d) + middle, std::end(d),
+        std::greater<std::size_t>());
+
+    // verify values
+    HPX_TEST(std::equal(std::begin(c), std::end(c), std::begin(d)));
+}
+
+void merge_test()
+{
+    using namespace hpx::parallel;
+
+    test_merge(execution::seq);
+    test_merge(execution::par);
+    test_merge(execution::par_unseq);
+
+    test_inplace_merge_async(execution::seq(execution::task));
+    test_inplace_merge_async(execution::par(execution::task));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main(boost::program_options::variables_map& vm)
+{
+    unsigned int seed = (unsigned int)std::time(nullptr);
+    if (vm.count("seed"))
+        seed = vm["seed"].as<unsigned int>();
+
+    std::cout << "using seed: " << seed << std::endl;
+    std::srand(seed);
+
+    merge_test();
+    return hpx::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    // add command line option which controls the random number generator seed
+    using namespace boost::program_options;
+    options_description desc_commandline(
+        "Usage: " HPX_APPLICATION_STRING " [options]");
+
+    desc_commandline.add_options()
+        ("seed,s", value<unsigned int>(),
+        "the random number generator seed to use for this run")
+        ;
+
+    // By default this test should run on all available cores
+    std::vector<std::string> const cfg = {
+        "hpx.os_threads=all"
+    };
+
+    // Initialize and run HPX
+    HPX_TEST_EQ_MSG(hpx::init(desc_commandline, argc, argv, cfg), 0,
+        "HPX main exited with non-zero status");
+
+    return hpx::util::report_errors();
+}
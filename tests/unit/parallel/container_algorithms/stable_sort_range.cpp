@@ -0,0 +1,129 @@
+//  Copyright (c) 2026 agent
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/hpx_init.hpp>
+#include <hpx/hpx.hpp>
+#include <hpx/include/parallel_sort.hpp>
+#include <hpx/util/lightweight_test.hpp>
+#include <hpx/util/iterator_range.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <iostream>
+#include <iterator>
+#include <string>
+#include <vector>
+
+#include "test_utils.hpp"
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename ExPolicy>
+void test_stable_sort(ExPolicy policy)
+{
+    static_assert(
+        hpx::parallel::execution::is_execution_policy<ExPolicy>::value,
+        "hpx::parallel::execution::is_execution_policy<ExPolicy>::value");
+
+    std::vector<std::size_t> c(500007);
+    std::generate(std::begin(c), std::end(c), std::rand);
+    std::vector<std::size_t> d = c;
+
+    hpx::parallel::stable_sort(policy, c);
+    std::stable_sort(std::begin(d), std::end(d));
+
+    // verify values
+    HPX_TEST(std::equal(std::begin(c), std::end(c), std::begin(d)));
+}
+
+template <typename ExPolicy>
+void test_partial_sort_async(ExPolicy p)
+{
+    std::vector<std::size_t> c(500007);
+    std::generate(std::begin(c), std::end(c), std::rand);
+    std::vector<std::size_t> d = c;
+
+    std::size_t middle = std::rand() % c.size(); //-V104
+
+    auto f = hpx::parallel::partial_sort(p, c, std::begin(c) + middle,
+        std::greater<std::size_t>());
+    f.wait();
+
+    std::partial_sort(std::begin(d), std::begin(d) + middle, std::end(d),
+        std::greater<std::size_t>());
+
+    // verify values
+    HPX_TEST(std::equal(std::begin(c), std::begin(c) + middle,
+        std::begin(d)));
+}
+
+template <typename ExPolicy>
+void test_nth_element(ExPolicy policy)
+{
+    std::vector<std::size_t> c(500007);
+    std::generate(std::begin(c), std::end(c), std::rand);
+    std::vector<std::size_t> d = c;
+
+    std::size_t nth = std::rand() % c.size(); //-V104
+
+    hpx::parallel::nth_element(policy, c, std::begin(c) + nth);
+    std::nth_element(std::begin(d), std::begin(d) + nth, std::end(d));
+
+    HPX_TEST_EQ(c[nth], d[nth]);
+}
+
+void stable_sort_test()
+{
+    using namespace hpx::parallel;
+
+    test_stable_sort(execution::seq);
+    test_stable_sort(execution::par);
+    test_stable_sort(execution::par_unseq);
+
+    test_partial_sort_async(execution::seq(execution::task));
+    test_partial_sort_async(execution::par(execution::task));
+
+    test_nth_element(execution::seq);
+    test_nth_element(execution::par);
+    test_nth_element(execution::par_unseq);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main(boost::program_options::variables_map& vm)
+{
+    unsigned int seed = (unsigned int)std::time(nullptr);
+    if (vm.count("seed"))
+        seed = vm["seed"].as<unsigned int>();
+
+    std::cout << "using seed: " << seed << std::endl;
+    std::srand(seed);
+
+    stable_sort_test();
+    return hpx::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    // add command line option which controls the random number generator seed
+    using namespace boost::program_options;
+    options_description desc_commandline(
+        "Usage: " HPX_APPLICATION_STRING " [options]");
+
+    desc_commandline.add_options()
+        ("seed,s", value<unsigned int>(),
+        "the random number generator seed to use for this run")
+        ;
+
+    // By default this test should run on all available cores
+    std::vector<std::string> const cfg = {
+        "hpx.os_threads=all"
+    };
+
+    // Initialize and run HPX
+    HPX_TEST_EQ_MSG(hpx::init(desc_commandline, argc, argv, cfg), 0,
+        "HPX main exited with non-zero status");
+
+    return hpx::util::report_errors();
+}
@@ -12,6 +12,9 @@
 
 #include <algorithm>
 #include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
 #include <functional>
 #include <iostream>
 #include <iterator>
@@ -126,6 +129,51 @@ void test_persistent_auto_chunk_size()
     }
 }
 
+void test_adaptive_chunk_size()
+{
+    {
+        hpx::parallel::adaptive_chunk_size acs;
+        parameters_test(acs);
+    }
+
+    {
+        hpx::parallel::adaptive_chunk_size acs(std::chrono::milliseconds(1), 2);
+        parameters_test(acs);
+    }
+
+    // the learned information is recorded per call site
+    {
+        using namespace hpx::parallel;
+
+        adaptive_chunk_size::reset();
+
+        std::vector<std::size_t> c(100007);
+        std::iota(std::begin(c), std::end(c), std::rand());
+
+        adaptive_chunk_size acs;
+        for (int i = 0; i != 20; ++i)
+        {
+            for_each(execution::par.with(acs), std::begin(c), std::end(c),
+                [](std::size_t& v) { ++v; });
+        }
+
+        std::uint64_t invocations = 0;
+        for (adaptive_chunk_size_statistics const& s :
+            adaptive_chunk_size::get_statistics())
+        {
+            invocations += s.invocations_;
+            if (s.invocations_ != 0)
+            {
+                HPX_TEST_NEQ(s.samples_, std::uint64_t(0));
+                HPX_TEST_LTE(s.samples_, s.invocations_);
+                HPX_TEST(s.element_time_ > 0.);
+                HPX_TEST_NEQ(s.chunk_size_, std::size_t(0));
+            }
+        }
+        HPX_TEST_EQ(invocations, std::uint64_t(20));
+    }
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 struct timer_hooks_parameters : hpx::parallel::executor_parameters_tag
 {
@@ -168,6 +216,7 @@ int hpx_main(boost::program_options::variables_map& vm)
     test_guided_chunk_size();
     test_auto_chunk_size();
     test_persistent_auto_chunk_size();
+    test_adaptive_chunk_size();
 
     test_combined_hooks();
 
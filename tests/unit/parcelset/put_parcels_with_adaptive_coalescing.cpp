@@ -0,0 +1,171 @@
+//  Copyright (c) 2026 agent
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// Verify that parcels are delivered if the coalescing message handler derives
+// the number of coalesced parcels from the observed parcel rate
+// (hpx.plugins.coalescing_message_handler.adaptive=1), both for bursts of
+// parcels and for parcels sent slower than the target latency.
+
+#include <hpx/hpx.hpp>
+#include <hpx/hpx_init.hpp>
+#include <hpx/include/actions.hpp>
+#include <hpx/include/iostreams.hpp>
+#include <hpx/include/parcel_coalescing.hpp>
+#include <hpx/include/performance_counters.hpp>
+#include <hpx/runtime/config_entry.hpp>
+#include <hpx/util/lightweight_test.hpp>
+
+#include <chrono>
+#include <cstddef>
+#include <string>
+#include <utility>
+#include <type_traits>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+std::size_t const numparcels_default = 100;
+
+///////////////////////////////////////////////////////////////////////////////
+hpx::id_type test(double data)
+{
+    return hpx::find_here();
+}
+HPX_DECLARE_PLAIN_ACTION(test, test_action);
+HPX_ACTION_USES_MESSAGE_COALESCING(test_action);
+HPX_PLAIN_ACTION(test, test_action);
+
+hpx::parcelset::parcel
+generate_parcel(hpx::id_type const& dest_id, hpx::id_type const& cont)
+{
+    hpx::naming::address addr;
+    hpx::naming::gid_type dest = dest_id.get_gid();
+    hpx::naming::detail::strip_credits_from_gid(dest);
+    hpx::parcelset::parcel p(hpx::parcelset::detail::create_parcel::call(
+        std::true_type(), std::move(dest), std::move(addr),
+        hpx::actions::typed_continuation<hpx::id_type>(cont),
+        test_action(), hpx::threads::thread_priority_normal, 42.0));
+
+    p.set_source_id(hpx::find_here());
+    p.size() = 4096;
+
+    return p;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// all parcels are sent at once, the handler should coalesce them
+void test_burst(hpx::id_type const& id)
+{
+    std::vector<hpx::future<hpx::id_type> > results;
+    results.reserve(numparcels_default);
+
+    std::vector<hpx::parcelset::parcel> parcels;
+    for (std::size_t i = 0; i != numparcels_default; ++i)
+    {
+        hpx::lcos::promise<hpx::id_type> p;
+        results.push_back(p.get_future());
+        parcels.push_back(generate_parcel(id, p.get_id()));
+    }
+
+    hpx::get_runtime().get_parcel_handler().put_parcels(std::move(parcels));
+
+    hpx::wait_all(results);
+    for (hpx::future<hpx::id_type>& f : results)
+    {
+        HPX_TEST(f.get() == id);
+    }
+}
+
+// parcels are sent slower than the target latency, the handler should send
+// them without delaying them
+void test_trickle(hpx::id_type const& id)
+{
+    std::vector<hpx::future<hpx::id_type> > results;
+    results.reserve(10);
+
+    for (std::size_t i = 0; i != 10; ++i)
+    {
+        hpx::lcos::promise<hpx::id_type> p;
+        results.push_back(p.get_future());
+
+        hpx::get_runtime().get_parcel_handler().put_parcel(
+            generate_parcel(id, p.get_id()));
+
+        hpx::this_thread::sleep_for(std::chrono::milliseconds(5));
+    }
+
+    hpx::wait_all(results);
+    for (hpx::future<hpx::id_type>& f : results)
+    {
+        HPX_TEST(f.get() == id);
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+double get_counter_value(char const* name)
+{
+    using namespace hpx::performance_counters;
+
+    double result = 0.0;
+    for (performance_counter const& c : discover_counters(name))
+    {
+        counter_value value = c.get_counter_value(hpx::launch::sync);
+        result += value.get_value<double>();
+
+        hpx::cout
+            << "counter: " << c.get_name(hpx::launch::sync)
+            << ", value: " << value.get_value<double>()
+            << std::endl;
+    }
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main()
+{
+    for (hpx::id_type const& id : hpx::find_remote_localities())
+    {
+        test_burst(id);
+        test_trickle(id);
+
+        // changing the target latency at runtime has to be picked up by
+        // the existing handler
+        hpx::set_config_entry(
+            "hpx.plugins.coalescing_message_handler.target_latency",
+            std::size_t(100));
+
+        test_burst(id);
+        test_trickle(id);
+    }
+
+    // make sure coalescing was actually invoked
+    double parcels = get_counter_value(
+        "/coalescing{locality#0/total}/count/parcels@test_action");
+    double messages = get_counter_value(
+        "/coalescing{locality#0/total}/count/messages@test_action");
+
+    HPX_TEST_NEQ(parcels, 0.0);
+    HPX_TEST_NEQ(messages, 0.0);
+    HPX_TEST_LTE(messages, parcels);
+
+    return hpx::finalize();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int main(int argc, char* argv[])
+{
+    // explicitly enable message handlers (parcel coalescing) and let the
+    // handler adapt the number of coalesced parcels
+    std::vector<std::string> const cfg = {
+        "hpx.parcel.message_handlers=1",
+        "hpx.plugins.coalescing_message_handler.adaptive=1",
+        "hpx.plugins.coalescing_message_handler.target_latency=1000"
+    };
+
+    // Initialize and run HPX
+    HPX_TEST_EQ_MSG(hpx::init(argc, argv, cfg), 0,
+        "HPX main exited with non-zero status");
+
+    return hpx::util::report_errors();
+}
@@ -0,0 +1,154 @@
+//  Copyright (c) 2026 agent
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/hpx.hpp>
+#include <hpx/hpx_init.hpp>
+#include <hpx/include/performance_counters.hpp>
+#include <hpx/include/iostreams.hpp>
+#include <hpx/util/lightweight_test.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdlib>
+#include <ctime>
+#include <iostream>
+#include <string>
+#include <utility>
+#include <type_traits>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+// The parcels sent by this test are large enough for each batch to be split
+// into several segments which are encoded concurrently.
+std::size_t const vsize_default = 4096;
+std::size_t const numparcels_default = 256;
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename Action, typename ... Ts>
+hpx::parcelset::parcel
+generate_parcel(hpx::id_type const& dest_id, hpx::id_type const& cont,
+    Ts &&... data)
+{
+    hpx::naming::address addr;
+    hpx::naming::gid_type dest = dest_id.get_gid();
+    hpx::parcelset::parcel p(hpx::parcelset::detail::create_parcel::call(
+        std::true_type(), std::move(dest), std::move(addr),
+        hpx::actions::typed_continuation<std::size_t>(cont),
+        Action(), hpx::threads::thread_priority_normal,
+        std::forward<Ts>(data)...));
+
+    p.set_source_id(hpx::find_here());
+    p.size() = 4096;
+    return p;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+std::size_t test(std::size_t index, std::vector<double> const& data)
+{
+    HPX_TEST_EQ(data.size(), vsize_default);
+    HPX_TEST_EQ(data[0], double(index));
+    return index;
+}
+HPX_PLAIN_ACTION(test);
+
+void test_large_batch(hpx::id_type const& id)
+{
+    std::vector<hpx::future<std::size_t> > results;
+    results.reserve(numparcels_default);
+
+    // create parcels
+    std::vector<hpx::parcelset::parcel> parcels;
+    for (std::size_t i = 0; i != numparcels_default; ++i)
+    {
+        std::vector<double> data(vsize_default);
+        std::generate(data.begin(), data.end(), std::rand);
+        data[0] = double(i);
+
+        hpx::lcos::promise<std::size_t> p;
+        auto f = p.get_future();
+        parcels.push_back(
+            generate_parcel<test_action>(id, p.get_id(), i, std::move(data))
+        );
+        results.push_back(std::move(f));
+    }
+
+    // send parcels
+    hpx::get_runtime().get_parcel_handler().put_parcels(std::move(parcels));
+
+    // verify all parcels got delivered intact
+    hpx::wait_all(results);
+
+    for (std::size_t i = 0; i != numparcels_default; ++i)
+    {
+        HPX_TEST_EQ(results[i].get(), i);
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void print_counters(char const* name)
+{
+    using namespace hpx::performance_counters;
+
+    std::vector<performance_counter> counters = discover_counters(name);
+
+    for (performance_counter const& c : counters)
+    {
+        counter_value value = c.get_counter_value(hpx::launch::sync);
+        hpx::cout
+            << "counter: " << c.get_name(hpx::launch::sync)
+            << ", value: " << value.get_value<double>()
+            << std::endl;
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main(boost::program_options::variables_map& vm)
+{
+    unsigned int seed = (unsigned int)std::time(nullptr);
+    if (vm.count("seed"))
+        seed = vm["seed"].as<unsigned int>();
+
+    std::cout << "using seed: " << seed << std::endl;
+    std::srand(seed);
+
+    for (hpx::id_type const& id : hpx::find_remote_localities())
+    {
+        test_large_batch(id);
+    }
+
+    // compare number of parcels with number of messages generated
+    print_counters("/parcels/count/*/sent");
+    print_counters("/messages/count/*/sent");
+
+    return hpx::finalize();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int main(int argc, char* argv[])
+{
+    // add command line option which controls the random number generator seed
+    using namespace boost::program_options;
+    options_description desc_commandline(
+        "Usage: " HPX_APPLICATION_STRING " [options]");
+
+    desc_commandline.add_options()
+        ("seed,s", value<unsigned int>(),
+        "the random number generator seed to use for this run")
+        ;
+
+    // explicitly disable message handlers (parcel coalescing) and make sure
+    // all batches are large enough to be encoded concurrently
+    std::vector<std::string> const cfg = {
+        "hpx.parcel.message_handlers=0",
+        "hpx.parcel.parallel_encoding_segment_size=65536",
+        "hpx.parcel.max_outbound_message_size=16777216"
+    };
+
+    // Initialize and run HPX
+    HPX_TEST_EQ_MSG(hpx::init(desc_commandline, argc, argv, cfg), 0,
+        "HPX main exited with non-zero status");
+
+    return hpx::util::report_errors();
+}
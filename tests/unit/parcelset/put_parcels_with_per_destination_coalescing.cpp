@@ -0,0 +1,147 @@
+//  Copyright (c) 2026 agent
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// Verify that the parcels of different actions are delivered if they are
+// coalesced by a handler shared by all actions sent to the same destination
+// (hpx.plugins.coalescing_message_handler.per_destination=1).
+
+#include <hpx/hpx.hpp>
+#include <hpx/hpx_init.hpp>
+#include <hpx/include/actions.hpp>
+#include <hpx/include/iostreams.hpp>
+#include <hpx/include/parcel_coalescing.hpp>
+#include <hpx/include/performance_counters.hpp>
+#include <hpx/util/lightweight_test.hpp>
+
+#include <cstddef>
+#include <string>
+#include <utility>
+#include <type_traits>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+std::size_t const numparcels_default = 100;
+
+///////////////////////////////////////////////////////////////////////////////
+hpx::id_type test1(double data)
+{
+    return hpx::find_here();
+}
+HPX_DECLARE_PLAIN_ACTION(test1, test1_action);
+HPX_ACTION_USES_MESSAGE_COALESCING(test1_action);
+HPX_PLAIN_ACTION(test1, test1_action);
+
+hpx::id_type test2(double data)
+{
+    return hpx::find_here();
+}
+HPX_DECLARE_PLAIN_ACTION(test2, test2_action);
+HPX_ACTION_USES_MESSAGE_COALESCING(test2_action);
+HPX_PLAIN_ACTION(test2, test2_action);
+
+template <typename Action>
+hpx::parcelset::parcel
+generate_parcel(hpx::id_type const& dest_id, hpx::id_type const& cont)
+{
+    hpx::naming::address addr;
+    hpx::naming::gid_type dest = dest_id.get_gid();
+    hpx::naming::detail::strip_credits_from_gid(dest);
+    hpx::parcelset::parcel p(hpx::parcelset::detail::create_parcel::call(
+        std::true_type(), std::move(dest), std::move(addr),
+        hpx::actions::typed_continuation<hpx::id_type>(cont),
+        Action(), hpx::threads::thread_priority_normal, 42.0));
+
+    p.set_source_id(hpx::find_here());
+    p.size() = 4096;
+
+    return p;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// parcels of both actions are interleaved, all of them should be buffered
+// by the handler responsible for their common destination
+void test_mixed_actions(hpx::id_type const& id)
+{
+    std::vector<hpx::future<hpx::id_type> > results;
+    results.reserve(numparcels_default);
+
+    std::vector<hpx::parcelset::parcel> parcels;
+    for (std::size_t i = 0; i != numparcels_default; ++i)
+    {
+        hpx::lcos::promise<hpx::id_type> p;
+        results.push_back(p.get_future());
+
+        if (i % 2)
+            parcels.push_back(generate_parcel<test1_action>(id, p.get_id()));
+        else
+            parcels.push_back(generate_parcel<test2_action>(id, p.get_id()));
+    }
+
+    hpx::get_runtime().get_parcel_handler().put_parcels(std::move(parcels));
+
+    hpx::wait_all(results);
+    for (hpx::future<hpx::id_type>& f : results)
+    {
+        HPX_TEST(f.get() == id);
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+double get_counter_value(char const* name)
+{
+    using namespace hpx::performance_counters;
+
+    double result = 0.0;
+    for (performance_counter const& c : discover_counters(name))
+    {
+        counter_value value = c.get_counter_value(hpx::launch::sync);
+        result += value.get_value<double>();
+
+        hpx::cout
+            << "counter: " << c.get_name(hpx::launch::sync)
+            << ", value: " << value.get_value<double>()
+            << std::endl;
+    }
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main()
+{
+    for (hpx::id_type const& id : hpx::find_remote_localities())
+    {
+        test_mixed_actions(id);
+    }
+
+    // the parcels went through the handlers of the actions, but the
+    // messages were sent by the shared handler of the destination
+    HPX_TEST_NEQ(get_counter_value(
+        "/coalescing{locality#0/total}/count/parcels@test1_action"), 0.0);
+    HPX_TEST_NEQ(get_counter_value(
+        "/coalescing{locality#0/total}/count/parcels@test2_action"), 0.0);
+    HPX_TEST_EQ(get_counter_value(
+        "/coalescing{locality#0/total}/count/messages@test1_action"), 0.0);
+    HPX_TEST_EQ(get_counter_value(
+        "/coalescing{locality#0/total}/count/messages@test2_action"), 0.0);
+
+    return hpx::finalize();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int main(int argc, char* argv[])
+{
+    // explicitly enable message handlers (parcel coalescing) and share the
+    // handlers between all actions sent to the same destination
+    std::vector<std::string> const cfg = {
+        "hpx.parcel.message_handlers=1",
+        "hpx.plugins.coalescing_message_handler.per_destination=1"
+    };
+
+    // Initialize and run HPX
+    HPX_TEST_EQ_MSG(hpx::init(argc, argv, cfg), 0,
+        "HPX main exited with non-zero status");
+
+    return hpx::util::report_errors();
+}
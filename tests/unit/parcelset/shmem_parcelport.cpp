@@ -0,0 +1,121 @@
+//  Copyright (c) 2026 agent
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// Send messages of various sizes between two localities running on the same
+// node using the shared memory parcelport. Small messages are sent through
+// the ring buffer only, large chunks are placed into the shared heap, and
+// chunks which don't fit the (deliberately small) heap are streamed through
+// the ring buffer in several pieces.
+
+#include <hpx/hpx.hpp>
+#include <hpx/hpx_init.hpp>
+#include <hpx/include/actions.hpp>
+#include <hpx/include/performance_counters.hpp>
+#include <hpx/runtime/config_entry.hpp>
+#include <hpx/util/lightweight_test.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <string>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+std::vector<char> echo(std::vector<char> const& data)
+{
+    return data;
+}
+HPX_PLAIN_ACTION(echo, echo_action);
+
+std::vector<char> make_data(std::size_t size, std::size_t seed)
+{
+    std::vector<char> data(size);
+    for (std::size_t i = 0; i != size; ++i)
+        data[i] = static_cast<char>((i + seed) % 251);
+    return data;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// sizes below and above the zero copy threshold, above the size of the ring
+// buffer, and above the size of the shared heap
+std::size_t const sizes[] =
+{
+    0, 1, 100, 4095, 4096, 8191, 8192, 8193, 65536, 65537,
+    1024 * 1024, 3 * 1024 * 1024
+};
+
+void test_sizes(hpx::id_type const& id)
+{
+    std::size_t seed = 0;
+    for (std::size_t size : sizes)
+    {
+        std::vector<char> data = make_data(size, ++seed);
+        HPX_TEST(echo_action()(id, data) == data);
+    }
+}
+
+// many messages in flight at the same time fill the ring buffer and the
+// shared heap
+void test_concurrent(hpx::id_type const& id)
+{
+    std::vector<std::vector<char> > data;
+    std::vector<hpx::future<std::vector<char> > > results;
+
+    std::size_t seed = 0;
+    for (std::size_t i = 0; i != 10; ++i)
+    {
+        for (std::size_t size : sizes)
+        {
+            data.push_back(make_data(size, ++seed));
+            results.push_back(hpx::async(echo_action(), id, data.back()));
+        }
+    }
+
+    hpx::wait_all(results);
+    for (std::size_t i = 0; i != results.size(); ++i)
+    {
+        HPX_TEST(results[i].get() == data[i]);
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main()
+{
+    if (hpx::get_config_entry("hpx.parcel.shmem.enable", "0") != "1")
+    {
+        std::cout << "the shared memory parcelport is not enabled, "
+            "skipping test" << std::endl;
+        return hpx::finalize();
+    }
+
+    for (hpx::id_type const& id : hpx::find_remote_localities())
+    {
+        test_sizes(id);
+        test_concurrent(id);
+    }
+
+    // make sure the messages were sent through shared memory
+    using namespace hpx::performance_counters;
+    performance_counter sent(
+        "/messages{locality#0/total}/count/shmem/sent");
+    HPX_TEST_NEQ(sent.get_value<std::int64_t>(hpx::launch::sync),
+        std::int64_t(0));
+
+    return hpx::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    // use a small ring buffer and shared heap to exercise the transfer of
+    // messages which don't fit into either of them
+    std::vector<std::string> const cfg = {
+        "hpx.parcel.shmem.ring_size=65536",
+        "hpx.parcel.shmem.heap_size=2097152",
+        "hpx.parcel.shmem.zero_copy_threshold=8192"
+    };
+
+    HPX_TEST_EQ(hpx::init(argc, argv, cfg), 0);
+    return hpx::util::report_errors();
+}
@@ -0,0 +1,164 @@
+//  Copyright (c) 2026 agent
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+#include <hpx/runtime/serialization/array.hpp>
+#include <hpx/runtime/serialization/input_archive.hpp>
+#include <hpx/runtime/serialization/map.hpp>
+#include <hpx/runtime/serialization/output_archive.hpp>
+#include <hpx/runtime/serialization/serialize.hpp>
+#include <hpx/runtime/serialization/string.hpp>
+#include <hpx/runtime/serialization/vector.hpp>
+#include <hpx/traits/is_bitwise_serializable.hpp>
+#include <hpx/traits/serialized_size.hpp>
+#include <hpx/util/lightweight_test.hpp>
+#include <hpx/util/tuple.hpp>
+
+#include <boost/array.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <utility>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+enum color { red, green, blue };
+
+enum class shape : std::uint8_t { circle, square };
+
+typedef std::pair<color, std::int32_t> color_pair;
+typedef hpx::util::tuple<std::int32_t, shape, double> shape_tuple;
+typedef boost::array<double, 3> point;
+typedef std::pair<point, color> colored_point;
+
+// the layout of all of these collapses into a single block of memory
+static_assert(hpx::traits::is_bitwise_serializable<color>::value,
+    "enumerations are bitwise serializable");
+static_assert(hpx::traits::is_bitwise_serializable<color_pair>::value,
+    "pairs of bitwise serializable types are bitwise serializable");
+static_assert(hpx::traits::is_bitwise_serializable<shape_tuple>::value,
+    "tuples of bitwise serializable types are bitwise serializable");
+static_assert(hpx::traits::is_bitwise_serializable<point>::value,
+    "small arrays of bitwise serializable types are bitwise serializable");
+static_assert(hpx::traits::is_bitwise_serializable<colored_point>::value,
+    "pairs of small arrays are bitwise serializable");
+
+// large arrays are still sent as separate (zero-copy) chunks
+static_assert(!hpx::traits::is_bitwise_serializable<
+        boost::array<char, HPX_ZERO_COPY_SERIALIZATION_THRESHOLD>
+    >::value, "large arrays are not bitwise serializable");
+
+static_assert(!hpx::traits::is_bitwise_serializable<
+        std::pair<std::string, int>
+    >::value, "strings are not bitwise serializable");
+
+// sizes are known at compile time
+static_assert(hpx::traits::serialized_size<std::int32_t>::value ==
+    sizeof(std::int64_t), "integral values are promoted");
+static_assert(hpx::traits::serialized_size<shape>::value ==
+    sizeof(std::int64_t), "enumerations are promoted");
+static_assert(hpx::traits::serialized_size<char>::value == 1,
+    "characters are not promoted");
+static_assert(hpx::traits::serialized_size<bool const>::value == 1,
+    "booleans are not promoted");
+static_assert(hpx::traits::serialized_size<double>::value == sizeof(double),
+    "floating point values are stored as is");
+static_assert(hpx::traits::serialized_size<colored_point>::value ==
+    sizeof(colored_point), "bitwise serializable types are stored as is");
+static_assert(hpx::traits::serialized_size<std::string>::value == 0,
+    "the size of strings is not known at compile time");
+
+///////////////////////////////////////////////////////////////////////////////
+std::size_t archive_overhead()
+{
+    std::vector<char> buffer;
+    hpx::serialization::output_archive oarchive(buffer);
+    return oarchive.bytes_written();
+}
+
+template <typename T>
+void test_size(T const& t)
+{
+    std::vector<char> buffer;
+    hpx::serialization::output_archive oarchive(buffer);
+    oarchive << t;
+
+    HPX_TEST_EQ(oarchive.bytes_written() - archive_overhead(),
+        hpx::traits::serialized_size<T>::value);
+}
+
+template <typename T>
+void test_vector(std::vector<T> const& os, int flags)
+{
+    std::vector<char> buffer;
+    hpx::serialization::output_archive oarchive(buffer, flags);
+    oarchive << os;
+
+    std::vector<T> is;
+    hpx::serialization::input_archive iarchive(buffer);
+    iarchive >> is;
+
+    HPX_TEST(os == is);
+}
+
+template <typename T>
+void test_vector(std::vector<T> const& os)
+{
+    test_vector(os, 0);
+    test_vector(os, hpx::serialization::disable_data_chunking);
+    test_vector(os, hpx::serialization::disable_array_optimization);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int main()
+{
+    test_size(std::int32_t(42));
+    test_size(blue);
+    test_size(shape::square);
+    test_size('a');
+    test_size(true);
+    test_size(3.14);
+    test_size(color_pair(green, 42));
+    test_size(shape_tuple(1, shape::circle, 2.0));
+    test_size(colored_point(point{{ 1.0, 2.0, 3.0 }}, red));
+
+    {
+        std::vector<color> v;
+        for (int i = 0; i != 100; ++i)
+            v.push_back(static_cast<color>(i % 3));
+        test_vector(v);
+    }
+
+    {
+        std::vector<color_pair> v;
+        for (int i = 0; i != 100; ++i)
+            v.push_back(color_pair(static_cast<color>(i % 3), i));
+        test_vector(v);
+    }
+
+    {
+        std::vector<shape_tuple> v;
+        for (int i = 0; i != 100; ++i)
+        {
+            v.push_back(shape_tuple(
+                i, static_cast<shape>(i % 2), static_cast<double>(i)));
+        }
+        test_vector(v);
+    }
+
+    {
+        std::vector<colored_point> v;
+        for (int i = 0; i != 100; ++i)
+        {
+            double d = static_cast<double>(i);
+            v.push_back(colored_point(point{{ d, d + 1, d + 2 }},
+                static_cast<color>(i % 3)));
+        }
+        test_vector(v);
+    }
+
+    return hpx::util::report_errors();
+}
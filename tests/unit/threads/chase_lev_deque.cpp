@@ -0,0 +1,168 @@
+//  Copyright (c) 2026 agent
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+#include <hpx/compat/thread.hpp>
+#include <hpx/util/bind.hpp>
+#include <hpx/util/lockfree/chase_lev_deque.hpp>
+
+#include <boost/atomic.hpp>
+#include <boost/program_options.hpp>
+
+#include <boost/detail/lightweight_test.hpp>
+
+#include <cstdint>
+#include <iostream>
+#include <vector>
+
+namespace compat = hpx::compat;
+
+typedef boost::lockfree::chase_lev_deque<std::uint64_t> deque_type;
+
+std::uint64_t thieves = 2;
+std::uint64_t items = 500000;
+
+// every item has to be retrieved exactly once
+std::vector<boost::atomic<std::uint64_t> >* seen = nullptr;
+boost::atomic<std::uint64_t> retrieved(0);
+boost::atomic<bool> done(false);
+
+void record(std::uint64_t item)
+{
+    BOOST_TEST(item < items);
+    ++(*seen)[item];
+    ++retrieved;
+}
+
+void thief_thread(deque_type& q)
+{
+    std::uint64_t item = 0;
+    while (!done.load())
+    {
+        if (q.steal(item))
+            record(item);
+    }
+
+    while (q.steal(item))
+        record(item);
+}
+
+void owner_thread(deque_type& q)
+{
+    std::uint64_t item = 0;
+    for (std::uint64_t i = 0; i != items; ++i)
+    {
+        q.push_bottom(i);
+
+        // pop every other item locally to exercise the race on the last
+        // remaining element
+        if ((i % 2) == 0 && q.pop_bottom(item))
+            record(item);
+    }
+
+    while (q.pop_bottom(item))
+        record(item);
+
+    done.store(true);
+}
+
+void test_sequential()
+{
+    deque_type q;
+    BOOST_TEST(q.empty());
+
+    // force the deque to grow a couple of times
+    for (std::uint64_t i = 0; i != 1000; ++i)
+        q.push_bottom(i);
+
+    BOOST_TEST_EQ(q.size(), 1000);
+
+    std::uint64_t item = 0;
+
+    // owner end is LIFO
+    BOOST_TEST(q.pop_bottom(item));
+    BOOST_TEST_EQ(item, 999u);
+
+    // stealing end is FIFO
+    BOOST_TEST(q.steal(item));
+    BOOST_TEST_EQ(item, 0u);
+
+    std::uint64_t count = 2;
+    while (q.pop_bottom(item))
+        ++count;
+
+    BOOST_TEST_EQ(count, 1000u);
+    BOOST_TEST(q.empty());
+    BOOST_TEST(!q.steal(item));
+}
+
+int main(int argc, char** argv)
+{
+    using boost::program_options::variables_map;
+    using boost::program_options::options_description;
+    using boost::program_options::value;
+    using boost::program_options::store;
+    using boost::program_options::command_line_parser;
+    using boost::program_options::notify;
+
+    variables_map vm;
+
+    options_description
+        desc_cmdline("Usage: " HPX_APPLICATION_STRING " [options]");
+
+    desc_cmdline.add_options()
+        ("help,h", "print out program usage (this message)")
+        ("threads,t", value<std::uint64_t>(&thieves)->default_value(2),
+         "the number of threads stealing items from the deque")
+        ("items,i", value<std::uint64_t>(&items)->default_value(500000),
+         "the number of items to push onto the deque")
+    ;
+
+    store(
+        command_line_parser(argc,
+            argv).options(desc_cmdline).allow_unregistered().run(),vm);
+
+    notify(vm);
+
+    // print help screen
+    if (vm.count("help"))
+    {
+        std::cout << desc_cmdline;
+        return boost::report_errors();
+    }
+
+    test_sequential();
+
+    std::vector<boost::atomic<std::uint64_t> > seen_items(items);
+    for (boost::atomic<std::uint64_t>& s : seen_items)
+        s.store(0);
+    seen = &seen_items;
+
+    {
+        deque_type q;
+        std::vector<compat::thread> tg;
+
+        for (std::uint64_t i = 0; i != thieves; ++i)
+            tg.push_back(compat::thread(hpx::util::bind(
+                &thief_thread, std::ref(q))));
+
+        tg.push_back(compat::thread(hpx::util::bind(
+            &owner_thread, std::ref(q))));
+
+        for (compat::thread& t : tg)
+        {
+            if (t.joinable())
+                t.join();
+        }
+
+        BOOST_TEST(q.empty());
+    }
+
+    BOOST_TEST_EQ(retrieved.load(), items);
+    for (boost::atomic<std::uint64_t>& s : seen_items)
+        BOOST_TEST_EQ(s.load(), 1u);
+
+    return boost::report_errors();
+}
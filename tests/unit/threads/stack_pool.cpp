@@ -0,0 +1,106 @@
+//  Copyright (c) 2026 agent
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/hpx_main.hpp>
+#include <hpx/compat/thread.hpp>
+#include <hpx/runtime/threads/coroutines/detail/posix_utility.hpp>
+#include <hpx/util/lightweight_test.hpp>
+
+#if defined(__linux__)
+#include <sys/mman.h>
+#endif
+
+#include <cstddef>
+#include <cstring>
+#include <set>
+#include <vector>
+
+namespace posix = hpx::threads::coroutines::detail::posix;
+
+std::size_t const stack_size = HPX_SMALL_STACK_SIZE;
+
+///////////////////////////////////////////////////////////////////////////////
+void allocate_stacks(std::size_t rounds, std::size_t count)
+{
+    for (std::size_t r = 0; r != rounds; ++r)
+    {
+        std::vector<void*> stacks;
+        for (std::size_t i = 0; i != count; ++i)
+        {
+            void* stack = posix::alloc_stack(stack_size);
+            HPX_TEST(stack != nullptr);
+
+            // the whole stack has to be usable
+            std::memset(stack, '\0', stack_size);
+            stacks.push_back(stack);
+        }
+
+        // no stack may be handed out twice
+        HPX_TEST_EQ(std::set<void*>(stacks.begin(), stacks.end()).size(),
+            count);
+
+        for (void* stack : stacks)
+            posix::free_stack(stack, stack_size);
+    }
+
+    // all stacks cached by this thread are handed back to the pool at once
+    HPX_TEST_NEQ(posix::trim_stack_pool(), std::size_t(0));
+    HPX_TEST_EQ(posix::trim_stack_pool(), std::size_t(0));
+}
+
+void test_stack_pool()
+{
+    std::vector<hpx::compat::thread> threads;
+    for (std::size_t i = 0; i != 4; ++i)
+    {
+        threads.push_back(
+            hpx::compat::thread(&allocate_stacks, 100, 200));
+    }
+
+    for (hpx::compat::thread& t : threads)
+        t.join();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+#if defined(__linux__)
+// stacks carved from a slab are faulted in by the allocating thread
+void check_prefaulted_stack(std::size_t size)
+{
+    void* stack = posix::alloc_stack(size);
+    HPX_TEST(stack != nullptr);
+
+    std::size_t const pages = size / EXEC_PAGESIZE;
+    std::vector<unsigned char> resident(pages);
+    HPX_TEST_EQ(::mincore(stack, size, resident.data()), 0);
+
+    for (std::size_t i = 0; i != pages; ++i)
+        HPX_TEST((resident[i] & 1) != 0);
+
+    posix::free_stack(stack, size);
+    posix::trim_stack_pool();
+}
+
+void test_prefaulted_stacks()
+{
+    // use a stack size no other thread allocates stacks of, this way the
+    // stack is carved instead of being taken from a free list
+    hpx::compat::thread t(&check_prefaulted_stack,
+        stack_size + EXEC_PAGESIZE);
+    t.join();
+}
+#endif
+
+///////////////////////////////////////////////////////////////////////////////
+int main()
+{
+    HPX_TEST(posix::use_stack_pool);
+
+#if defined(__linux__)
+    test_prefaulted_stacks();
+#endif
+    test_stack_pool();
+
+    return hpx::util::report_errors();
+}
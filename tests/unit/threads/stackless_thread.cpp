@@ -0,0 +1,209 @@
+//  Copyright (c) 2026 agent
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/hpx_init.hpp>
+#include <hpx/include/apply.hpp>
+#include <hpx/include/lcos.hpp>
+#include <hpx/include/runtime.hpp>
+#include <hpx/include/threadmanager.hpp>
+#include <hpx/include/threads.hpp>
+#include <hpx/util/bind.hpp>
+#include <hpx/util/lightweight_test.hpp>
+
+#include <cstddef>
+#include <functional>
+#include <string>
+#include <utility>
+#include <vector>
+
+#define NUM_STACKLESS_THREADS 1000
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename F>
+void register_stackless(F && f)
+{
+    hpx::threads::register_thread_nullary(std::forward<F>(f),
+        "stackless_thread", hpx::threads::pending, true,
+        hpx::threads::thread_priority_normal, std::size_t(-1),
+        hpx::threads::thread_stacksize_nostack);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void test_stackless_run(hpx::lcos::local::promise<void>& p)
+{
+    HPX_TEST(hpx::threads::get_self_ptr() != nullptr);
+    HPX_TEST(hpx::threads::get_self_id() != hpx::threads::invalid_thread_id);
+    HPX_TEST_EQ(hpx::threads::get_self_stacksize(),
+        std::size_t(hpx::threads::thread_stacksize_nostack));
+
+    // yielding returns immediately
+    hpx::this_thread::yield();
+
+    p.set_value();
+}
+
+void test_stackless()
+{
+    std::vector<hpx::lcos::local::promise<void> > promises(
+        NUM_STACKLESS_THREADS);
+    std::vector<hpx::future<void> > finished;
+    finished.reserve(NUM_STACKLESS_THREADS);
+
+    for (hpx::lcos::local::promise<void>& p : promises)
+    {
+        finished.push_back(p.get_future());
+        register_stackless(hpx::util::bind(&test_stackless_run, std::ref(p)));
+    }
+
+    hpx::wait_all(finished);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void test_stackless_suspend_run(hpx::lcos::local::promise<bool>& p)
+{
+    bool caught_exception = false;
+    try
+    {
+        hpx::this_thread::suspend(hpx::threads::suspended);
+    }
+    catch (hpx::exception const& e)
+    {
+        caught_exception = (e.get_error() == hpx::invalid_status);
+    }
+    p.set_value(caught_exception);
+}
+
+void test_stackless_suspend()
+{
+    hpx::lcos::local::promise<bool> p;
+    hpx::future<bool> f = p.get_future();
+
+    register_stackless(
+        hpx::util::bind(&test_stackless_suspend_run, std::ref(p)));
+
+    HPX_TEST(f.get());
+}
+
+///////////////////////////////////////////////////////////////////////////////
+std::size_t get_stacksize()
+{
+    return hpx::threads::get_self_stacksize();
+}
+
+void test_stackless_spawn_run(hpx::lcos::local::promise<void>& p,
+    hpx::future<std::size_t>& result)
+{
+    // threads created from a stackless thread get a stack
+    result = hpx::async(&get_stacksize);
+    p.set_value();
+}
+
+void test_stackless_spawn()
+{
+    hpx::lcos::local::promise<void> p;
+    hpx::future<void> f = p.get_future();
+    hpx::future<std::size_t> result;
+
+    register_stackless(hpx::util::bind(&test_stackless_spawn_run,
+        std::ref(p), std::ref(result)));
+
+    f.get();
+    HPX_TEST_EQ(result.get(), std::size_t(hpx::get_runtime().get_config().
+        get_stack_size(hpx::threads::thread_stacksize_default)));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int test_nostack_policy_run(int i)
+{
+    HPX_TEST_EQ(hpx::threads::get_self_stacksize(),
+        std::size_t(hpx::threads::thread_stacksize_nostack));
+    return i;
+}
+
+void test_nostack_policy()
+{
+    std::vector<hpx::future<int> > results;
+    results.reserve(NUM_STACKLESS_THREADS);
+
+    for (int i = 0; i != NUM_STACKLESS_THREADS; ++i)
+    {
+        results.push_back(
+            hpx::async(hpx::launch::nostack, &test_nostack_policy_run, i));
+    }
+
+    for (int i = 0; i != NUM_STACKLESS_THREADS; ++i)
+    {
+        HPX_TEST_EQ(results[i].get(), i);
+    }
+
+    // the policy is usable through the generic launch type as well
+    hpx::launch policy = hpx::launch::nostack;
+    HPX_TEST_EQ(hpx::async(policy, &test_nostack_policy_run, 42).get(), 42);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void test_nostack_apply_run(hpx::lcos::local::promise<std::size_t>& p)
+{
+    p.set_value(hpx::threads::get_self_stacksize());
+}
+
+void test_nostack_continuations()
+{
+    std::size_t const nostack =
+        std::size_t(hpx::threads::thread_stacksize_nostack);
+
+    // continuations attached with launch::nostack run without a stack
+    hpx::future<int> f = hpx::make_ready_future(42);
+    HPX_TEST_EQ(f.then(hpx::launch::nostack,
+        [](hpx::future<int> && f)
+        {
+            return test_nostack_policy_run(f.get());
+        }).get(), 42);
+
+    // as do dataflow functions
+    HPX_TEST_EQ(hpx::dataflow(hpx::launch::nostack,
+        [](hpx::future<int> && f)
+        {
+            return test_nostack_policy_run(f.get());
+        },
+        hpx::make_ready_future(43)).get(), 43);
+
+    hpx::launch policy = hpx::launch::nostack;
+    HPX_TEST_EQ(hpx::dataflow(policy,
+        [](hpx::future<int> && f)
+        {
+            return test_nostack_policy_run(f.get());
+        },
+        hpx::make_ready_future(44)).get(), 44);
+
+    // hpx::apply accepts launch policies, launch::nostack included
+    hpx::lcos::local::promise<std::size_t> p;
+    hpx::future<std::size_t> result = p.get_future();
+    hpx::apply(hpx::launch::nostack, &test_nostack_apply_run, std::ref(p));
+    HPX_TEST_EQ(result.get(), nostack);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main()
+{
+    test_stackless();
+    test_stackless_suspend();
+    test_stackless_spawn();
+    test_nostack_policy();
+    test_nostack_continuations();
+
+    return hpx::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    // By default this test should run on all available cores
+    std::vector<std::string> const cfg = {
+        "hpx.os_threads=all"
+    };
+
+    HPX_TEST_EQ(hpx::init(argc, argv, cfg), 0);
+    return hpx::util::report_errors();
+}
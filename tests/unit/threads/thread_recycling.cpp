@@ -0,0 +1,133 @@
+//  Copyright (c) 2026 agent
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// Create and terminate many threads such that the thread objects are
+// recycled by the lock-free recycling lists while other threads enumerate
+// the threads known to the thread queues.
+
+#include <hpx/hpx_init.hpp>
+#include <hpx/include/lcos.hpp>
+#include <hpx/include/threadmanager.hpp>
+#include <hpx/include/threads.hpp>
+#include <hpx/util/lightweight_test.hpp>
+
+#include <boost/atomic.hpp>
+
+#include <cstddef>
+#include <functional>
+#include <string>
+#include <vector>
+
+#define NUM_ROUNDS 10
+#define NUM_THREADS 1000
+#define NUM_SUSPENDED_THREADS 10
+
+///////////////////////////////////////////////////////////////////////////////
+boost::atomic<std::size_t> count_executed(0);
+
+void short_thread()
+{
+    ++count_executed;
+}
+
+// create lots of short lived threads, their thread objects will be
+// recycled for the threads of the next round
+void test_create_recycle()
+{
+    for (std::size_t round = 0; round != NUM_ROUNDS; ++round)
+    {
+        std::vector<hpx::future<void> > futures;
+        futures.reserve(NUM_THREADS);
+
+        for (std::size_t i = 0; i != NUM_THREADS; ++i)
+            futures.push_back(hpx::async(&short_thread));
+
+        hpx::wait_all(futures);
+    }
+
+    HPX_TEST_EQ(count_executed.load(), std::size_t(NUM_ROUNDS * NUM_THREADS));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+#if defined(HPX_HAVE_THREAD_ENUMERATION)
+void suspended_thread(hpx::lcos::local::promise<void>& started,
+    hpx::lcos::local::promise<void>& resume)
+{
+    hpx::future<void> f = resume.get_future();
+    started.set_value();
+    f.get();
+}
+
+// enumerate threads while other threads are being created, terminated and
+// recycled, all suspended threads have to be found
+void test_enumerate()
+{
+    std::vector<hpx::lcos::local::promise<void> > started(
+        NUM_SUSPENDED_THREADS);
+    std::vector<hpx::lcos::local::promise<void> > resume(
+        NUM_SUSPENDED_THREADS);
+    std::vector<hpx::future<void> > suspended;
+    suspended.reserve(NUM_SUSPENDED_THREADS);
+
+    for (std::size_t i = 0; i != NUM_SUSPENDED_THREADS; ++i)
+    {
+        hpx::future<void> f = started[i].get_future();
+        suspended.push_back(hpx::async(&suspended_thread,
+            std::ref(started[i]), std::ref(resume[i])));
+        f.get();
+    }
+
+    for (std::size_t round = 0; round != NUM_ROUNDS; ++round)
+    {
+        std::vector<hpx::future<void> > futures;
+        futures.reserve(NUM_THREADS);
+
+        for (std::size_t i = 0; i != NUM_THREADS; ++i)
+            futures.push_back(hpx::async(&short_thread));
+
+        std::size_t count = 0;
+        HPX_TEST(hpx::threads::enumerate_threads(
+            [&count](hpx::threads::thread_id_type const& id) -> bool
+            {
+                HPX_TEST(id != hpx::threads::invalid_thread_id);
+                ++count;
+                return true;
+            },
+            hpx::threads::suspended));
+
+        // the current thread may be suspended as well while enumerating
+        HPX_TEST_LTE(std::size_t(NUM_SUSPENDED_THREADS), count);
+
+        hpx::wait_all(futures);
+    }
+
+    for (hpx::lcos::local::promise<void>& p : resume)
+        p.set_value();
+
+    hpx::wait_all(suspended);
+}
+#endif
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main()
+{
+    test_create_recycle();
+#if defined(HPX_HAVE_THREAD_ENUMERATION)
+    test_enumerate();
+#endif
+
+    return hpx::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    // By default this test should run on all available cores
+    std::vector<std::string> const cfg = {
+        "hpx.os_threads=all"
+    };
+
+    HPX_TEST_EQ(hpx::init(argc, argv, cfg), 0);
+    return hpx::util::report_errors();
+}
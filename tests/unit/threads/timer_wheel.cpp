@@ -0,0 +1,254 @@
+//  Copyright (c) 2026 agent
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+#include <hpx/compat/thread.hpp>
+#include <hpx/runtime/threads/policies/timer_wheel.hpp>
+#include <hpx/util/bind.hpp>
+#include <hpx/util/steady_clock.hpp>
+
+#include <boost/atomic.hpp>
+#include <boost/program_options.hpp>
+
+#include <boost/detail/lightweight_test.hpp>
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <ctime>
+#include <functional>
+#include <iostream>
+#include <vector>
+
+namespace compat = hpx::compat;
+
+typedef hpx::threads::policies::detail::timer_wheel<std::size_t> wheel_type;
+typedef wheel_type::time_point time_point;
+
+std::uint64_t timers = 100000;
+std::uint64_t threads = 4;
+
+///////////////////////////////////////////////////////////////////////////////
+// all timers fire exactly once, never early, and as soon as the wheel is
+// advanced beyond their expiry (with a resolution of one nanosecond the
+// ranges covered by all levels and the overflow list are exercised)
+void test_expiry(std::chrono::nanoseconds resolution, std::int64_t range)
+{
+    // the wheel is driven by the given points in time only, those are in the
+    // future to make sure that no timer is considered to be expired already
+    time_point const epoch = wheel_type::clock_type::now() +
+        std::chrono::hours(1);
+    wheel_type w(resolution, epoch);
+
+    std::vector<time_point> expiry(timers);
+    std::vector<wheel_type::handle> handles(timers);
+    for (std::size_t i = 0; i != timers; ++i)
+    {
+        // cluster some of the timers at the same point in time
+        std::int64_t offset = (i % 7 == 0) ?
+            (range / 2) : (std::rand() * std::int64_t(RAND_MAX) +
+                std::rand()) % range;
+        expiry[i] = epoch + std::chrono::nanoseconds(offset);
+        handles[i] = w.arm(expiry[i], std::size_t(i));
+    }
+    BOOST_TEST_EQ(w.size(), timers);
+
+    // cancel every third timer
+    for (std::size_t i = 0; i < timers; i += 3)
+    {
+        BOOST_TEST(w.cancel(handles[i]));
+        BOOST_TEST(!w.cancel(handles[i]));
+    }
+
+    std::vector<std::size_t> fired(timers, 0);
+    std::size_t count = 0;
+
+    std::chrono::nanoseconds const step(range / 997 + 1);
+
+    time_point now = epoch;
+    time_point const end = epoch + std::chrono::nanoseconds(range) +
+        resolution + step;
+
+    while (now <= end)
+    {
+        count += w.expire(now,
+            [&](std::size_t i)
+            {
+                ++fired[i];
+                BOOST_TEST(expiry[i] <= now);
+                BOOST_TEST(now - expiry[i] <= step + resolution);
+            });
+        BOOST_TEST(w.next_expiry() > now);
+        now += step;
+    }
+
+    BOOST_TEST(w.empty());
+    BOOST_TEST_EQ(w.size(), std::size_t(0));
+    BOOST_TEST_EQ(count, timers - (timers + 2) / 3);
+
+    for (std::size_t i = 0; i != timers; ++i)
+    {
+        BOOST_TEST_EQ(fired[i], (i % 3 == 0) ? 0u : 1u);
+        BOOST_TEST(!w.cancel(handles[i]));
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// timers armed in the past or at the current point in time fire right away,
+// the wheel doesn't fire anything before it was advanced
+void test_past()
+{
+    time_point const epoch = wheel_type::clock_type::now();
+    wheel_type w(std::chrono::microseconds(100), epoch);
+
+    bool earliest = false;
+    w.arm(epoch - std::chrono::seconds(1), std::size_t(1), earliest);
+    BOOST_TEST(earliest);
+    w.arm(epoch + std::chrono::seconds(1), std::size_t(2), earliest);
+    BOOST_TEST(!earliest);
+
+    std::size_t fired = 0;
+    auto f = [&](std::size_t i) { fired += i; };
+
+    BOOST_TEST_EQ(w.expire(epoch, f), std::size_t(0));
+    BOOST_TEST_EQ(w.expire(epoch + std::chrono::seconds(1) -
+        std::chrono::microseconds(1), f), std::size_t(1));
+    BOOST_TEST_EQ(fired, 1u);
+    BOOST_TEST_EQ(w.expire(epoch + std::chrono::seconds(1), f),
+        std::size_t(1));
+    BOOST_TEST_EQ(fired, 3u);
+    BOOST_TEST(w.empty());
+
+    // the wheel is empty, new timers are relative to the current time
+    wheel_type::handle h = w.arm(wheel_type::clock_type::now() +
+        std::chrono::hours(24), std::size_t(4), earliest);
+    BOOST_TEST(earliest);
+    BOOST_TEST_EQ(w.expire(f), std::size_t(0));
+    BOOST_TEST(w.cancel(h));
+    BOOST_TEST(w.empty());
+
+    // dropping all timers doesn't fire them
+    w.arm(epoch + std::chrono::seconds(2), std::size_t(8));
+    w.clear();
+    BOOST_TEST(w.empty());
+    BOOST_TEST_EQ(w.expire(epoch + std::chrono::seconds(3), f),
+        std::size_t(0));
+    BOOST_TEST_EQ(fired, 3u);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// concurrently arm and cancel timers while the wheel is advanced by several
+// threads using the real clock, every timer either fires or is canceled
+boost::atomic<std::uint64_t> fired_count(0);
+boost::atomic<std::uint64_t> canceled_count(0);
+boost::atomic<bool> done(false);
+
+void arm_thread(wheel_type& w, std::uint64_t count)
+{
+    for (std::uint64_t i = 0; i != count; ++i)
+    {
+        wheel_type::handle h = w.arm(wheel_type::clock_type::now() +
+            std::chrono::microseconds(std::rand() % 2000), std::size_t(i));
+
+        if ((i % 2) == 0 && w.cancel(h))
+            ++canceled_count;
+    }
+}
+
+void expire_thread(wheel_type& w)
+{
+    while (!done.load() || !w.empty())
+    {
+        fired_count += w.expire([](std::size_t) {});
+        compat::this_thread::yield();
+    }
+}
+
+void test_concurrent()
+{
+    wheel_type w(std::chrono::microseconds(10));
+
+    std::vector<compat::thread> expiring;
+    for (std::uint64_t i = 0; i != 2; ++i)
+    {
+        expiring.push_back(compat::thread(hpx::util::bind(
+            &expire_thread, std::ref(w))));
+    }
+
+    std::vector<compat::thread> arming;
+    for (std::uint64_t i = 0; i != threads; ++i)
+    {
+        arming.push_back(compat::thread(hpx::util::bind(
+            &arm_thread, std::ref(w), timers / threads)));
+    }
+
+    for (compat::thread& t : arming)
+        t.join();
+
+    done.store(true);
+
+    for (compat::thread& t : expiring)
+        t.join();
+
+    BOOST_TEST(w.empty());
+    BOOST_TEST_EQ(fired_count.load() + canceled_count.load(),
+        (timers / threads) * threads);
+}
+
+int main(int argc, char** argv)
+{
+    using boost::program_options::variables_map;
+    using boost::program_options::options_description;
+    using boost::program_options::value;
+    using boost::program_options::store;
+    using boost::program_options::command_line_parser;
+    using boost::program_options::notify;
+
+    variables_map vm;
+
+    options_description
+        desc_cmdline("Usage: " HPX_APPLICATION_STRING " [options]");
+
+    desc_cmdline.add_options()
+        ("help,h", "print out program usage (this message)")
+        ("threads,t", value<std::uint64_t>(&threads)->default_value(4),
+         "the number of threads arming timers concurrently")
+        ("timers,n", value<std::uint64_t>(&timers)->default_value(100000),
+         "the number of timers to arm")
+        ("seed,s", value<unsigned int>(),
+         "the random number generator seed to use for this run")
+    ;
+
+    store(
+        command_line_parser(argc,
+            argv).options(desc_cmdline).allow_unregistered().run(),vm);
+
+    notify(vm);
+
+    // print help screen
+    if (vm.count("help"))
+    {
+        std::cout << desc_cmdline;
+        return boost::report_errors();
+    }
+
+    unsigned int seed = (unsigned int)std::time(nullptr);
+    if (vm.count("seed"))
+        seed = vm["seed"].as<unsigned int>();
+
+    std::cout << "using seed: " << seed << std::endl;
+    std::srand(seed);
+
+    // one level, all levels and the overflow list
+    test_expiry(std::chrono::microseconds(1), 50000);
+    test_expiry(std::chrono::nanoseconds(1), 50000000000ll);
+    test_expiry(std::chrono::nanoseconds(1), 200000000000ll);
+
+    test_past();
+    test_concurrent();
+
+    return boost::report_errors();
+}
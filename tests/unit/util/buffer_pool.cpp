@@ -0,0 +1,78 @@
+//  Copyright (c) 2026 agent
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/hpx_main.hpp>
+#include <hpx/util/buffer_pool.hpp>
+#include <hpx/util/lightweight_test.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+typedef hpx::util::buffer_pool<char> pool_type;
+
+void test_reuse()
+{
+    pool_type pool;
+
+    std::vector<char> buffer = pool.get(1000);
+    HPX_TEST(buffer.empty());
+    HPX_TEST_LTE(std::size_t(1000), buffer.capacity());
+    HPX_TEST_EQ(pool.misses(false), 1);
+
+    buffer.resize(1000);
+    char const* data = buffer.data();
+    std::size_t capacity = buffer.capacity();
+
+    pool.reclaim(std::move(buffer));
+    HPX_TEST_EQ(pool.retained_bytes(), std::int64_t(capacity));
+
+    // any request fitting into the same size class reuses the buffer
+    std::vector<char> reused = pool.get(600);
+    HPX_TEST(reused.empty());
+    HPX_TEST_EQ(reused.data(), data);
+    HPX_TEST_EQ(reused.capacity(), capacity);
+    HPX_TEST_EQ(pool.hits(true), 1);
+    HPX_TEST_EQ(pool.hits(false), 0);
+    HPX_TEST_EQ(pool.retained_bytes(), 0);
+
+    // larger requests will not be served from smaller buffers
+    pool.reclaim(std::move(reused));
+    std::vector<char> larger = pool.get(2 * capacity);
+    HPX_TEST_LTE(2 * capacity, larger.capacity());
+    HPX_TEST_EQ(pool.misses(false), 2);
+    HPX_TEST_EQ(pool.retained_bytes(), std::int64_t(capacity));
+
+    pool.clear();
+    HPX_TEST_EQ(pool.retained_bytes(), 0);
+}
+
+void test_limit()
+{
+    pool_type pool(1024);
+
+    std::vector<char> first = pool.get(1024);
+    std::vector<char> second = pool.get(1024);
+
+    pool.reclaim(std::move(first));
+    HPX_TEST_EQ(pool.retained_bytes(), 1024);
+
+    // exceeding the limit releases the buffer
+    pool.reclaim(std::move(second));
+    HPX_TEST_EQ(pool.retained_bytes(), 1024);
+
+    // empty buffers are never retained
+    pool.reclaim(std::vector<char>());
+    HPX_TEST_EQ(pool.retained_bytes(), 1024);
+}
+
+int main()
+{
+    test_reuse();
+    test_limit();
+
+    return hpx::util::report_errors();
+}
@@ -0,0 +1,214 @@
+//  Copyright (c) 2026 agent
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/hpx_main.hpp>
+#include <hpx/include/async.hpp>
+#include <hpx/include/lcos.hpp>
+#include <hpx/util/cache/sharded_cache.hpp>
+#include <hpx/util/lightweight_test.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+// A key representing the range of integers [first, first + count)
+struct range_key
+{
+    range_key()
+      : first(0), count(1)
+    {}
+
+    range_key(std::uint64_t f, std::uint64_t c = 1)
+      : first(f), count(c)
+    {}
+
+    std::uint64_t first;
+    std::uint64_t count;
+
+    friend bool operator<(range_key const& lhs, range_key const& rhs)
+    {
+        return lhs.first + lhs.count <= rhs.first;
+    }
+};
+
+struct range_key_blocks
+{
+    std::pair<std::uint64_t, std::uint64_t> operator()(
+        range_key const& key) const
+    {
+        return std::make_pair(key.first / 16,
+            (key.first + key.count - 1) / 16);
+    }
+};
+
+typedef hpx::util::cache::sharded_cache<
+        range_key, std::uint64_t, range_key_blocks
+    > cache_type;
+
+///////////////////////////////////////////////////////////////////////////////
+void test_insert_get()
+{
+    cache_type c(1024, 8);
+    HPX_TEST_EQ(c.num_shards(), std::size_t(8));
+
+    for (std::uint64_t i = 0; i != 100; ++i)
+        HPX_TEST(c.insert(range_key(i), i * 3));
+
+    HPX_TEST_EQ(c.size(), std::size_t(100));
+
+    // inserting an existing key fails
+    HPX_TEST(!c.insert(range_key(42), 42));
+
+    for (std::uint64_t i = 0; i != 100; ++i)
+    {
+        std::uint64_t value = 0;
+        HPX_TEST(c.get_entry(range_key(i), value));
+        HPX_TEST_EQ(value, i * 3);
+    }
+
+    std::uint64_t value = 0;
+    HPX_TEST(!c.get_entry(range_key(100), value));
+
+    HPX_TEST_EQ(c.get_statistics().hits(), std::size_t(100));
+    HPX_TEST_EQ(c.get_statistics().misses(true), std::size_t(101));
+    HPX_TEST_EQ(c.get_statistics().misses(), std::size_t(0));
+    HPX_TEST_EQ(c.get_statistics().insertions(), std::size_t(100));
+    HPX_TEST_EQ(c.get_statistics().get_get_entry_count(false),
+        std::int64_t(101));
+
+    // update an existing entry
+    c.update(range_key(42), 4242);
+    HPX_TEST(c.get_entry(range_key(42), value));
+    HPX_TEST_EQ(value, std::uint64_t(4242));
+
+    // erase all even entries
+    HPX_TEST_EQ(c.erase(
+        [](cache_type::entry_pair const& p)
+        {
+            return (p.first.first % 2) == 0;
+        }), std::size_t(50));
+    HPX_TEST_EQ(c.size(), std::size_t(50));
+    HPX_TEST(!c.get_entry(range_key(42), value));
+    HPX_TEST(c.get_entry(range_key(43), value));
+
+    HPX_TEST_EQ(c.clear(), std::size_t(50));
+    HPX_TEST_EQ(c.size(), std::size_t(0));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void test_ranges()
+{
+    cache_type c(1024, 8);
+
+    // this range covers all shards
+    HPX_TEST(c.insert(range_key(1000, 1000), 1));
+    // this range is stored in two shards
+    HPX_TEST(c.insert(range_key(60, 8), 2));
+
+    for (std::uint64_t i = 1000; i != 2000; ++i)
+    {
+        cache_type::key_type realkey;
+        std::uint64_t value = 0;
+        HPX_TEST(c.get_entry(range_key(i), realkey, value));
+        HPX_TEST_EQ(realkey.first, std::uint64_t(1000));
+        HPX_TEST_EQ(realkey.count, std::uint64_t(1000));
+        HPX_TEST_EQ(value, std::uint64_t(1));
+    }
+
+    for (std::uint64_t i = 60; i != 68; ++i)
+    {
+        std::uint64_t value = 0;
+        HPX_TEST(c.get_entry(range_key(i), value));
+        HPX_TEST_EQ(value, std::uint64_t(2));
+    }
+
+    // overlapping ranges collide
+    HPX_TEST(!c.insert(range_key(1500), 3));
+    HPX_TEST(!c.update_if(range_key(64, 2), 3,
+        [](range_key const& lhs, range_key const& rhs)
+        {
+            return lhs.first != rhs.first || lhs.count != rhs.count;
+        }));
+
+    // insertions are counted once per key
+    HPX_TEST_EQ(c.get_statistics().insertions(), std::size_t(2));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void test_eviction()
+{
+    cache_type c(16, 1);
+    HPX_TEST_EQ(c.capacity(), std::size_t(16));
+
+    for (std::uint64_t i = 0; i != 16; ++i)
+        HPX_TEST(c.insert(range_key(i), i * 3));
+
+    // reset the reference bits of all entries and reference the first one
+    HPX_TEST(c.insert(range_key(16), 16));
+
+    std::uint64_t value = 0;
+    HPX_TEST(c.get_entry(range_key(1), value));
+
+    HPX_TEST(c.insert(range_key(17), 17));
+    HPX_TEST_EQ(c.size(), std::size_t(16));
+    HPX_TEST_EQ(c.get_statistics().evictions(), std::size_t(2));
+
+    // the referenced entry survived
+    HPX_TEST(c.holds_key(range_key(1)));
+
+    // shrinking the cache evicts entries
+    c.reserve(4);
+    HPX_TEST_EQ(c.size(), std::size_t(4));
+    HPX_TEST_EQ(c.get_statistics().evictions(), std::size_t(14));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void test_concurrent_access()
+{
+    cache_type c(256, 16);
+
+    std::size_t const num_tasks = 16;
+    std::vector<hpx::future<void> > tasks;
+    tasks.reserve(num_tasks);
+
+    for (std::size_t t = 0; t != num_tasks; ++t)
+    {
+        tasks.push_back(hpx::async(
+            [&c, t]()
+            {
+                for (std::uint64_t i = 0; i != 10000; ++i)
+                {
+                    std::uint64_t k = (i * 7 + t) % 512;
+                    if (t % 4 == 0)
+                    {
+                        c.update(range_key(k), k * 3);
+                    }
+                    else
+                    {
+                        std::uint64_t value = 0;
+                        if (c.get_entry(range_key(k), value))
+                            HPX_TEST_EQ(value, k * 3);
+                    }
+                }
+            }));
+    }
+
+    hpx::wait_all(tasks);
+
+    HPX_TEST(c.size() <= 256);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int main()
+{
+    test_insert_get();
+    test_ranges();
+    test_eviction();
+    test_concurrent_access();
+
+    return hpx::util::report_errors();
+}